@@ -1,5816 +1,6421 @@
- #include <stdio.h>
-#include <string.h>
-#include <stdlib.h>
-#include <time.h>
-#include <errno.h>
-#include <ctype.h>
-#include <windows.h>  // For Windows console colors
-#include <conio.h>    // For hidden password input
-
-#define USERS_FILE "user_data.txt"
-#define PARTS_FILE "inventory.txt"
-#define NOT_AVAILABLE_FILE "not_available.txt"
-#define ORDERS_FILE "orders.txt"
-#define DISCOUNTS_FILE "discounts.txt"
-#define MECHANICS_FILE "mechanics.txt"
-#define APPOINTMENTS_FILE "appointments.txt"
-#define CAR_PROFILES_FILE "car_profiles.txt"
-#define VEHICLE_HISTORY_FILE "vehicle_history.txt"
-#define PROGRESS_FILE "progress.txt"
-#define DEADLINES_FILE "deadlines.txt"
-#define SERVICE_CALENDAR_FILE "service_calendar.txt"
-#define MAINTENANCE_REMINDERS_FILE "maintenance_reminders.txt"
-#define QNA_FILE "qna.txt"
-#define CAR_PARKING_FILE "car_parking.txt"
-#define QR_RECEIPTS_FILE "qr_receipts.txt"
-#define CAR_COMPATIBILITY_FILE "car_compatibility.txt"
-#define SEASONAL_RECOMMENDATIONS_FILE "seasonal_recommendations.txt"
-#define LOYALTY_POINTS_FILE "loyalty_points.txt"
-#define CUSTOMER_BADGES_FILE "customer_badges.txt"
-#define REDEMPTION_HISTORY_FILE "redemption_history.txt"
-#define VAT_RATE 0.15f
-#define CARS_FILE "cars.txt"
-#define ADMIN_SECRET_CODE "ADMIN2024@SECURE"
-#define MAX_LOGIN_ATTEMPTS 3
-#define LOCKOUT_TIME 120 // 2 minutes in seconds
-
-// Dynamic console width - will be set automatically
-int CONSOLE_WIDTH = 80;
-
-// ========== CENTER ALIGNMENT CONFIGURATION ==========
-// Adjust these values to fine-tune the center positioning
-// Use Ctrl+F to search for "CENTER ALIGNMENT" to find this section quickly
-#define PADDING_LARGE_SCREENS   5    // For screens > 120 chars (adjust 1-10)
-#define PADDING_MEDIUM_SCREENS  4    // For screens > 100 chars (adjust 1-8)
-#define PADDING_STANDARD_SCREENS 3   // For screens > 80 chars (adjust 1-6)
-#define PADDING_SMALL_SCREENS   2    // For smaller screens (adjust 1-4)
-// ====================================================
-
-// Console Color Codes
-#define COLOR_BLUE 9
-#define COLOR_GREEN 10
-#define COLOR_CYAN 11
-#define COLOR_RED 12
-#define COLOR_MAGENTA 13
-#define COLOR_YELLOW 14
-#define COLOR_WHITE 15
-#define COLOR_GRAY 8
-#define COLOR_DEFAULT 7
-
-// Global variables for login attempts
-int admin_failed_attempts = 0;
-int user_failed_attempts = 0;
-time_t admin_lockout_time = 0;
-time_t user_lockout_time = 0;
-
-// Function prototypes
-void get_console_width();
-void center_subtitle(const char* text);
-void set_console_color(int color);
-void reset_console_color();
-void display_current_time();
-void display_ascii_logo();
-void center_print(const char* text);
-void center_prompt(const char* text);
-void get_hidden_password(char *password, int max_length);
-void print_separator();
-void clear_screen();
-void display_developer_copyright();
-void register_user();
-int login_user(char logged_in_user[30], char logged_in_role[20]);
-int admin_login(char logged_in_user[30], char logged_in_role[20]);
-int admin_password_recovery();
-int validate_phone(const char* phone);
-int validate_email(const char* email);
-int validate_username(const char* username, const char* name);
-int validate_strong_password(const char* password);
-int is_account_locked(time_t lockout_time);
-void lock_account(time_t* lockout_time);
-void add_part();
-void delete_part();
-void view_parts();
-void view_not_available_parts();
-void update_profile(const char *logged_in_username);
-void order_parts(const char *username);
-void view_order_history(const char *username);
-float calculate_estimation(const char *username);
-void generate_invoice(const char *actor_username, const char *actor_role);
-void add_car();
-void view_cars();
-void delete_car();
-void modify_car();
-void admin_panel(const char *admin_username);
-void view_all_users();
-void view_all_orders();
-void system_statistics();
-void daily_dashboard();
-void main_menu();
-void manage_discounts();
-void add_discount();
-void view_discounts();
-void delete_discount();
-float apply_promo_code(float total_amount);
-float apply_loyalty_discount(const char *username, float current_amount, float *discount_applied);
-void initialize_default_discounts();
-void manage_appointments();
-void add_mechanic();
-void view_mechanics();
-void assign_mechanic_to_order();
-void view_appointments();
-void delete_mechanic();
-// Mechanic Dashboard Functions
-int mechanic_login(char logged_in_user[30], char logged_in_role[20]);
-void mechanic_dashboard(const char *mechanic_username);
-void view_car_profile();
-void add_car_profile(const char *car_number);
-void delete_car_profile();
-void view_vehicle_history();
-void add_vehicle_history();
-void update_progress();
-void view_progress();
-void delete_progress_record();
-void delete_order_history(const char *username);
-void delete_parking_record();
-void auto_add_service_progress(const char *car_number, const char *service_type);
-void set_deadline();
-void view_assigned_cars(const char *mechanic_username);
-void view_service_calendar();
-void add_service_event();
-void set_maintenance_reminder();
-void view_maintenance_reminders();
-void customer_view_maintenance_reminders();
-void manage_qna();
-void add_qna();
-void view_qna();
-void customer_view_qna();
-void add_car_parking(const char *username);
-void view_car_parking();
-void initialize_default_qna();
-void generate_qr_receipt(const char *username, const char *service_details, float amount);
-void view_qr_receipts(const char *username);
-void smart_parts_recommendation(const char *username);
-void initialize_car_compatibility();
-void initialize_seasonal_recommendations();
-void loyalty_system_menu(const char *username);
-void add_loyalty_points(const char *username, int points);
-void view_loyalty_points(const char *username);
-void redeem_loyalty_points(const char *username);
-void view_customer_badges(const char *username);
-void check_and_award_badges(const char *username);
-void admin_loyalty_dashboard();
-
-/**
- * Set console color
- */
-void set_console_color(int color) {
-    HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
-    SetConsoleTextAttribute(hConsole, color);
-}
-
-/**
- * Reset console color to default
- */
-void reset_console_color() {
-    set_console_color(COLOR_DEFAULT);
-}
-
-/**
- * Get console width dynamically for perfect center alignment
- */
-void get_console_width() {
-    CONSOLE_SCREEN_BUFFER_INFO csbi;
-    HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
-
-    if (GetConsoleScreenBufferInfo(hConsole, &csbi)) {
-        CONSOLE_WIDTH = csbi.srWindow.Right - csbi.srWindow.Left + 1;
-
-        // Ensure minimum width for proper display
-        if (CONSOLE_WIDTH < 80) {
-            CONSOLE_WIDTH = 80;
-        }
-
-        // For very wide screens, cap at reasonable width for readability
-        if (CONSOLE_WIDTH > 200) {
-            CONSOLE_WIDTH = 200;
-        }
-    } else {
-        // Fallback to default if detection fails
-        CONSOLE_WIDTH = 120; // Slightly larger default for modern screens
-    }
-}
-
-/**
- * Clear screen function with blue background
- */
-void clear_screen() {
-    system("cls"); // For Windows
-    get_console_width(); // Update console width dynamically
-    set_console_color(COLOR_BLUE);
-}
-
-/**
- * Display developer copyright in lower right corner
- */
-void display_developer_copyright() {
-    // Get console info for proper positioning
-    CONSOLE_SCREEN_BUFFER_INFO csbi;
-    HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
-
-    if (GetConsoleScreenBufferInfo(hConsole, &csbi)) {
-        int consoleHeight = csbi.srWindow.Bottom - csbi.srWindow.Top + 1;
-        int currentY = csbi.dwCursorPosition.Y;
-
-        // Calculate how many lines to skip to reach bottom
-        int linesToBottom = consoleHeight - currentY - 6; // Adjust for 5 lines of text
-
-        // Move to bottom of screen
-        for (int i = 0; i < linesToBottom; i++) {
-            printf("\n");
-        }
-    }
-
-    // Print copyright in bottom right corner with left-aligned text from right position
-    set_console_color(COLOR_GRAY);
-
-    // Calculate starting position for left-aligned text in right corner
-    int rightMargin = CONSOLE_WIDTH - 35; // Position from right edge
-
-    printf("%*s%s\n", rightMargin, "", "(C) 2025 Developed by:");
-    printf("%*s%s\n", rightMargin, "", "H.M.Ashis Rahman");
-    printf("%*s%s\n", rightMargin, "", "MD.Yeasif Jani Mishad");
-    printf("%*s%s\n", rightMargin, "", "Redwan Ahmed");
-    printf("%*s%s\n", rightMargin, "", "All Rights Reserved");
-
-    reset_console_color();
-}
-
-/**
- * Hidden password input function
- */
-void get_hidden_password(char *password, int max_length) {
-    int i = 0;
-    char ch;
-
-    while (i < max_length - 1) {
-        ch = _getch(); // Get character without displaying it
-
-        if (ch == '\r' || ch == '\n') { // Enter key pressed
-            break;
-        } else if (ch == '\b' && i > 0) { // Backspace pressed
-            printf("\b \b"); // Erase the asterisk
-            i--;
-        } else if (ch != '\b') { // Normal character
-            password[i] = ch;
-            printf("*"); // Display asterisk
-            i++;
-        }
-    }
-    password[i] = '\0'; // Null terminate
-    printf("\n");
-}
-
-/**
- * Center align text in console with improved precision
- */
-void center_print(const char* text) {
-    set_console_color(COLOR_CYAN);
-    int len = strlen(text);
-    int padding = (CONSOLE_WIDTH - len) / 2;
-
-    // Ensure padding is never negative
-    if (padding < 0) padding = 0;
-
-    // Add configurable extra space for perfect visual centering
-    // Search for "CENTER ALIGNMENT" to modify these values
-    if (CONSOLE_WIDTH > 120) padding += PADDING_LARGE_SCREENS;
-    else if (CONSOLE_WIDTH > 100) padding += PADDING_MEDIUM_SCREENS;
-    else if (CONSOLE_WIDTH > 80) padding += PADDING_STANDARD_SCREENS;
-    else padding += PADDING_SMALL_SCREENS;
-
-    for (int i = 0; i < padding; i++) printf(" ");
-    printf("%s\n", text);
-    set_console_color(COLOR_BLUE);
-}
-
-/**
- * Center align input prompt (without newline) with improved precision
- */
-void center_prompt(const char* text) {
-    set_console_color(COLOR_YELLOW);
-    int len = strlen(text);
-    int padding = (CONSOLE_WIDTH - len) / 2;
-
-    // Ensure padding is never negative
-    if (padding < 0) padding = 0;
-
-    // Add configurable extra space for perfect visual centering
-    // Search for "CENTER ALIGNMENT" to modify these values
-    if (CONSOLE_WIDTH > 120) padding += PADDING_LARGE_SCREENS;
-    else if (CONSOLE_WIDTH > 100) padding += PADDING_MEDIUM_SCREENS;
-    else if (CONSOLE_WIDTH > 80) padding += PADDING_STANDARD_SCREENS;
-    else padding += PADDING_SMALL_SCREENS;
-
-    for (int i = 0; i < padding; i++) printf(" ");
-    printf("%s", text);
-    set_console_color(COLOR_BLUE);
-}
-
-/**
- * Display prompt in upper right corner
- */
-void right_prompt(const char* text) {
-    set_console_color(COLOR_YELLOW);
-    int len = strlen(text);
-    int padding = CONSOLE_WIDTH - len - 10; // 10 chars from right edge
-
-    if (padding < 0) padding = 0;
-
-    for (int i = 0; i < padding; i++) printf(" ");
-    printf("%s", text);
-    set_console_color(COLOR_BLUE);
-}
-
-/**
- * Center align subtitle with extra precision for long text
- */
-void center_subtitle(const char* text) {
-    set_console_color(COLOR_CYAN);
-    int len = strlen(text);
-    int padding = (CONSOLE_WIDTH - len) / 2;
-
-    // Ensure padding is never negative
-    if (padding < 0) padding = 0;
-
-    // Add configurable extra space for better visual centering of long subtitle
-    // Search for "CENTER ALIGNMENT" to modify these values
-    if (CONSOLE_WIDTH > 120) padding += PADDING_LARGE_SCREENS;
-    else if (CONSOLE_WIDTH > 100) padding += PADDING_MEDIUM_SCREENS;
-    else if (CONSOLE_WIDTH > 80) padding += PADDING_STANDARD_SCREENS;
-    else padding += PADDING_SMALL_SCREENS;
-
-    for (int i = 0; i < padding; i++) printf(" ");
-    printf("%s\n", text);
-    set_console_color(COLOR_BLUE);
-}
-
-/**
- * Print decorative separator line with perfect centering
- */
-void print_separator() {
-    set_console_color(COLOR_CYAN);
-
-    // Calculate optimal separator width based on subtitle length for perfect alignment
-    const char* subtitle = "Your One-Stop Solution for Car Parts & Garage Management";
-    int subtitle_len = strlen(subtitle);
-    int separator_width = subtitle_len + 6; // Slightly wider than subtitle
-
-    // Ensure reasonable bounds
-    if (separator_width > CONSOLE_WIDTH - 10) separator_width = CONSOLE_WIDTH - 10;
-    if (separator_width < 60) separator_width = 60;
-
-    // Center the separator
-    int padding = (CONSOLE_WIDTH - separator_width) / 2;
-
-    // Add configurable extra centering for wide screens
-    // Search for "CENTER ALIGNMENT" to modify these values
-    if (CONSOLE_WIDTH > 120) padding += PADDING_LARGE_SCREENS;
-    else if (CONSOLE_WIDTH > 100) padding += PADDING_MEDIUM_SCREENS;
-    else if (CONSOLE_WIDTH > 80) padding += PADDING_STANDARD_SCREENS;
-    else padding += PADDING_SMALL_SCREENS;
-
-    for (int i = 0; i < padding; i++) printf(" ");
-    for (int i = 0; i < separator_width; i++) printf("=");
-    printf("\n");
-
-    set_console_color(COLOR_BLUE);
-}
-
-/**
- * Display current time with decorative elements
- */
-void display_current_time() {
-    time_t now = time(NULL);
-    struct tm *local = localtime(&now);
-
-    set_console_color(COLOR_YELLOW);
-    printf("\n");
-    center_print("╔═══════════════════════════════════════════════════════════════╗");
-
-    char time_display[100];
-    sprintf(time_display, "║  ⏰ CURRENT TIME: %02d:%02d:%02d  📅 DATE: %04d-%02d-%02d  ║",
-            local->tm_hour, local->tm_min, local->tm_sec,
-            local->tm_year + 1900, local->tm_mon + 1, local->tm_mday);
-    center_print(time_display);
-
-    center_print("╚═══════════════════════════════════════════════════════════════╝");
-    set_console_color(COLOR_BLUE);
-}
-
-/**
- * Display ASCII art logo with center alignment
- */
-void display_ascii_logo() {
-    clear_screen();
-    printf("\n\n");
-
-    set_console_color(COLOR_YELLOW);
-    center_print("    ____   _    ____  _  __ ___ _______   __");
-    center_print("   |  _ \\ / \\  |  _ \\| |/ /|_ _|  ___\\ \\ / /");
-    center_print("   | |_) / _ \\ | |_) | ' /  | || |_   \\ V / ");
-    center_print("   |  __/ ___ \\|  _ <| . \\  | ||  _|   | |  ");
-    center_print("   |_| /_/   \\_\\_| \\_\\_|\\_\\|___|_|     |_|  ");
-
-    printf("\n");
-    set_console_color(COLOR_MAGENTA);
-    center_print("*** SMART GARAGE MANAGEMENT SYSTEM ***");
-
-    set_console_color(COLOR_CYAN);
-    print_separator();
-    center_subtitle("Your One-Stop Solution for Car Parts & Garage Management");
-    print_separator();
-
-    set_console_color(COLOR_BLUE);
-    printf("\n");
-}
-
-/**
- * Validate phone number (must start with 01 and be 11 digits)
- */
-int validate_phone(const char* phone) {
-    if (strlen(phone) != 11) return 0;
-    if (phone[0] != '0' || phone[1] != '1') return 0;
-    for (int i = 0; i < 11; i++) {
-        if (!isdigit(phone[i])) return 0;
-    }
-    return 1;
-}
-
-/**
- * Validate email domain
- */
-int validate_email(const char* email) {
-    const char* valid_domains[] = {
-        "@gmail.com", "@hotmail.com", "@outlook.com",
-        "@protonmail.com", "@diu.edu.bd", "@yahoo.com"
-    };
-    int num_domains = sizeof(valid_domains) / sizeof(valid_domains[0]);
-
-    for (int i = 0; i < num_domains; i++) {
-        if (strstr(email, valid_domains[i]) != NULL) {
-            return 1;
-        }
-    }
-    return 0;
-}
-
-/**
- * Validate username format (name_id)
- */
-int validate_username(const char* username, const char* name) {
-    // Extract first name from full name for username validation
-    char first_name[50];
-    sscanf(name, "%s", first_name); // Gets first word only
-
-    char expected_format[100];
-    sprintf(expected_format, "%s_", first_name);
-
-    // Check if username starts with first name followed by underscore
-    if (strncmp(username, expected_format, strlen(expected_format)) != 0) {
-        return 0;
-    }
-
-    // Check if there's an ID after underscore
-    const char* id_part = username + strlen(expected_format);
-    if (strlen(id_part) == 0) return 0;
-
-    // ID part should contain at least some characters/numbers
-    return 1;
-}
-
-/**
- * Validate strong password requirements
- * Must contain: 1 uppercase, 1 lowercase, 1 number, 1 special character
- * Minimum length: 8 characters
- */
-int validate_strong_password(const char* password) {
-    int length = strlen(password);
-    int has_upper = 0, has_lower = 0, has_digit = 0, has_special = 0;
-
-    // Check minimum length
-    if (length < 4) {
-        return 0;
-    }
-
-    // Check for required character types
-    for (int i = 0; i < length; i++) {
-        char c = password[i];
-
-        if (c >= 'A' && c <= 'Z') {
-            has_upper = 1;
-        } else if (c >= 'a' && c <= 'z') {
-            has_lower = 1;
-        } else if (c >= '0' && c <= '9') {
-            has_digit = 1;
-        } else if (c == '@' || c == '#' || c == '$' || c == '%' ||
-                   c == '&' || c == '*' || c == '!' || c == '?' ||
-                   c == '+' || c == '-' || c == '=' || c == '_') {
-            has_special = 1;
-        }
-    }
-
-    // All requirements must be met
-    return (has_upper && has_lower && has_digit && has_special);
-}
-
-/**
- * Check if account is locked
- */
-int is_account_locked(time_t lockout_time) {
-    if (lockout_time == 0) return 0;
-
-    time_t current_time = time(NULL);
-    if (current_time - lockout_time < LOCKOUT_TIME) {
-        int remaining = LOCKOUT_TIME - (current_time - lockout_time);
-        char lock_msg[100];
-        sprintf(lock_msg, "[X] Account locked! Try again in %d seconds.", remaining);
-        center_print(lock_msg);
-        return 1;
-    }
-    return 0;
-}
-
-/**
- * Lock account for specified time
- */
-void lock_account(time_t* lockout_time) {
-    *lockout_time = time(NULL);
-    center_print("[!] SECURITY ALERT: Account locked for 2 minutes!");
-    center_print("Too many failed login attempts detected.");
-}
-
-/**
- * Admin password recovery
- */
-int admin_password_recovery() {
-    clear_screen();
-    center_print("[#] ADMIN PASSWORD RECOVERY");
-    center_print("Security Questions for Password Recovery");
-    print_separator();
-
-    char answer[100];
-
-    printf("\n");
-    center_print("Security Question: What is the default admin username?");
-    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
-    printf("Answer: ");
-    scanf("%s", answer);
-
-    if (strcmp(answer, "admin") != 0) {
-        center_print("[X] Incorrect answer!");
-        return 0;
-    }
-
-    center_print("Security Question: What is the system name? (SmartGarage)");
-    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
-    printf("Answer: ");
-    scanf("%s", answer);
-
-    if (strcmp(answer, "SmartGarage") != 0) {
-        center_print("[X] Incorrect answer!");
-        return 0;
-    }
-
-    printf("\n");
-    center_print("[+] Security questions verified!");
-    center_print("[#] Default Password: admin123");
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-    return 1;
-}
-
-/**
- * Customer registration (No inventory manager option)
- */
-void register_user() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[+] CUSTOMER REGISTRATION");
-    print_separator();
-
-    FILE *f = fopen(USERS_FILE, "a");
-    char username[30], password[30];
-    char name[50], email[50], phone[20];
-
-    if (!f) {
-        center_print("[X] Error opening users file.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    printf("\n");
-    center_print("Please fill in your details:");
-    printf("\n");
-
-    // Get name first for username validation
-    center_prompt("Full Name: ");
-    getchar(); // Clear any leftover newline character
-    fgets(name, sizeof(name), stdin);
-    // Remove newline character if present
-    if (name[strlen(name) - 1] == '\n') {
-        name[strlen(name) - 1] = '\0';
-    }
-
-    // Validate and get username
-    while (1) {
-        char prompt[100];
-        char first_name[50];
-        sscanf(name, "%s", first_name); // Extract first name for prompt
-        sprintf(prompt, "Username (format: %s_id): ", first_name);
-        center_prompt(prompt);
-        scanf("%s", username);
-
-        if (validate_username(username, name)) {
-            break;
-        } else {
-            center_print("[X] Invalid username format! Use: firstname_id");
-        }
-    }
-
-    // Validate and get strong password
-    while (1) {
-        center_print("Password Requirements:");
-        center_print("- At least 4 characters");
-        center_print("- 1 uppercase letter (A-Z)");
-        center_print("- 1 lowercase letter (a-z)");
-        center_print("- 1 number (0-9)");
-        center_print("- 1 special character (@#$%&*!?+-=_)");
-        printf("\n");
-        center_prompt("Password: ");
-        get_hidden_password(password, sizeof(password));
-
-        if (validate_strong_password(password)) {
-            break;
-        } else {
-            printf("\n");
-            center_print("[X] Password does not meet requirements!");
-            center_print("Must have: 1 uppercase, 1 lowercase, 1 number, 1 special char");
-            printf("\n");
-        }
-    }
-
-    // Validate and get email
-    while (1) {
-        center_prompt("Email: ");
-        scanf("%s", email);
-
-        if (validate_email(email)) {
-            break;
-        } else {
-            center_print("[X] Invalid email domain!");
-            center_print("Allowed: gmail.com, hotmail.com, outlook.com, protonmail.com, diu.edu.bd, yahoo.com");
-        }
-    }
-
-    // Validate and get phone
-    while (1) {
-        center_prompt("Phone (01XXXXXXXXX): ");
-        scanf("%s", phone);
-
-        if (validate_phone(phone)) {
-            break;
-        } else {
-            center_print("[X] Invalid phone number!");
-            center_print("Must start with 01 and be exactly 11 digits.");
-        }
-    }
-
-    // All registrations are customers by default
-    fprintf(f, "Customer %s %s %s %s %s\n", username, password, name, email, phone);
-    fclose(f);
-
-    printf("\n");
-    center_print("[+] Registration successful! You are registered as a Customer.");
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Regular user login (Customer only)
- */
-int login_user(char logged_in_user[30], char logged_in_role[20]) {
-    if (is_account_locked(user_lockout_time)) {
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return 0;
-    }
-
-    clear_screen();
-    display_ascii_logo();
-    center_print("[#] USER LOGIN");
-    print_separator();
-
-    FILE *f = fopen(USERS_FILE, "r");
-    char username[30], password[30], role[20];
-    char name[50], email[50], phone[20];
-    char input_username[30], input_password[30];
-    int found = 0;
-
-    if (!f) {
-        center_print("[X] No users registered yet.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return 0;
-    }
-
-    printf("\n");
-    center_prompt("Username: ");
-    scanf("%s", input_username);
-
-    center_prompt("Password: ");
-    get_hidden_password(input_password, sizeof(input_password));
-
-    while (fscanf(f, "%s %s %s %s %s %s", role, username, password, name, email, phone) == 6) {
-        if (strcmp(username, input_username) == 0 && strcmp(password, input_password) == 0) {
-            if (strcmp(role, "Customer") == 0) { // Only customers can login here
-                printf("\n");
-                center_print("[+] Login Successful!");
-                printf("\n");
-                char welcome_msg[100];
-                sprintf(welcome_msg, "Welcome, %s (%s)", name, role);
-                center_print(welcome_msg);
-                printf("\n");
-
-                strcpy(logged_in_user, username);
-                strcpy(logged_in_role, role);
-                found = 1;
-                user_failed_attempts = 0; // Reset on successful login
-                break;
-            }
-        }
-    }
-    fclose(f);
-
-    if (!found) {
-        user_failed_attempts++;
-        center_print("[X] Login failed. Invalid credentials.");
-
-        if (user_failed_attempts >= MAX_LOGIN_ATTEMPTS) {
-            lock_account(&user_lockout_time);
-            user_failed_attempts = 0;
-        } else {
-            char attempts_msg[100];
-            sprintf(attempts_msg, "[!] Warning: %d/%d attempts remaining",
-                   MAX_LOGIN_ATTEMPTS - user_failed_attempts, MAX_LOGIN_ATTEMPTS);
-            center_print(attempts_msg);
-        }
-
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return 0;
-    }
-
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-    return 1;
-}
-
-/**
- * Secure admin login
- */
-int admin_login(char logged_in_user[30], char logged_in_role[20]) {
-    if (is_account_locked(admin_lockout_time)) {
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return 0;
-    }
-
-    clear_screen();
-    display_ascii_logo();
-    center_print("[#] ADMIN SECURE LOGIN");
-    center_print("[!] AUTHORIZED PERSONNEL ONLY [!]");
-    print_separator();
-
-    char username[30], password[30];
-
-    printf("\n");
-    center_prompt("Admin Username: ");
-    scanf("%s", username);
-
-    center_prompt("Admin Password: ");
-    get_hidden_password(password, sizeof(password));
-
-    // Check default admin credentials
-    if (strcmp(username, "admin") == 0 && strcmp(password, "admin123") == 0) {
-        strcpy(logged_in_user, "admin");
-        strcpy(logged_in_role, "Admin");
-        admin_failed_attempts = 0; // Reset on successful login
-
-        center_print("[*] ADMIN ACCESS GRANTED");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return 1;
-    }
-
-    admin_failed_attempts++;
-    center_print("[X] Invalid admin credentials.");
-
-    if (admin_failed_attempts >= MAX_LOGIN_ATTEMPTS) {
-        lock_account(&admin_lockout_time);
-        admin_failed_attempts = 0;
-
-        printf("\n");
-        center_print("[?] Forgot Password? Try Password Recovery");
-        center_print("Press 'R' for Recovery or any other key to continue...");
-
-        char choice = getchar();
-        getchar(); // consume newline
-
-        if (choice == 'R' || choice == 'r') {
-            if (admin_password_recovery()) {
-                admin_lockout_time = 0; // Reset lockout if recovery successful
-            }
-        }
-    } else {
-        char attempts_msg[100];
-        sprintf(attempts_msg, "[!] Warning: %d/%d attempts remaining",
-               MAX_LOGIN_ATTEMPTS - admin_failed_attempts, MAX_LOGIN_ATTEMPTS);
-        center_print(attempts_msg);
-    }
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-    return 0;
-}
-
-/**
- * Mechanic login function
- */
-int mechanic_login(char logged_in_user[30], char logged_in_role[20]) {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[#] MECHANIC LOGIN");
-    print_separator();
-
-    // Check if mechanics are locked out
-    if (is_account_locked(user_lockout_time)) {
-        center_print("[X] Account temporarily locked due to failed attempts.");
-        center_print("Please try again later.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return 0;
-    }
-
-    char username[30], password[30];
-    printf("\n");
-    center_prompt("Username: ");
-    scanf("%s", username);
-
-    center_prompt("Password: ");
-    get_hidden_password(password, sizeof(password));
-
-    // Check if mechanic exists in mechanics.txt with correct credentials
-    FILE *f = fopen(MECHANICS_FILE, "r");
-    if (!f) {
-        center_print("[X] No mechanics registered in system.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return 0;
-    }
-
-    char line[200], stored_name[50], stored_username[30], stored_password[30];
-    int age;
-    char phone[20];
-    int found = 0;
-
-    while (fgets(line, sizeof(line), f)) {
-        // Updated format: name username password age phone
-        sscanf(line, "%s %s %s %d %s", stored_name, stored_username, stored_password, &age, phone);
-        if (strcmp(stored_username, username) == 0 && strcmp(stored_password, password) == 0) {
-            found = 1;
-            break;
-        }
-    }
-    fclose(f);
-
-    if (found) {
-        strcpy(logged_in_user, username);  // Store username instead of name
-        strcpy(logged_in_role, "Mechanic");
-
-        user_failed_attempts = 0; // Reset attempts on success
-
-        center_print("[+] Login successful!");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return 1;
-    } else {
-        user_failed_attempts++;
-
-        center_print("[X] Invalid username or password.");
-        center_print("Please contact admin if you need assistance.");
-
-        if (user_failed_attempts >= MAX_LOGIN_ATTEMPTS) {
-            lock_account(&user_lockout_time);
-            center_print("[!] Account locked due to multiple failed attempts.");
-        }
-
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return 0;
-    }
-}
-
-/**
- * Daily dashboard for admin
- */
-void daily_dashboard() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] DAILY DASHBOARD");
-    print_separator();
-
-    time_t now = time(NULL);
-    struct tm *local = localtime(&now);
-    char today_date[20];
-    sprintf(today_date, "%04d-%02d-%02d",
-            local->tm_year + 1900, local->tm_mon + 1, local->tm_mday);
-
-    char dashboard_msg[100];
-    sprintf(dashboard_msg, "[*] Today's Report: %s", today_date);
-    center_print(dashboard_msg);
-    printf("\n");
-
-    // Count today's orders
-    FILE *f = fopen(ORDERS_FILE, "r");
-    int today_orders = 0;
-    float today_revenue = 0;
-    char order_parts[100][50];
-    int part_count = 0;
-
-    if (f) {
-        char user[30], part[50];
-        int quantity;
-        float total;
-
-        while (fscanf(f, "%s %s %d %f", user, part, &quantity, &total) == 4) {
-            // For demo purposes, we'll count all orders as "today's"
-            // In real implementation, you'd compare with actual order dates
-            today_orders++;
-            today_revenue += total;
-
-            // Store unique parts ordered today
-            int part_exists = 0;
-            for (int i = 0; i < part_count; i++) {
-                if (strcmp(order_parts[i], part) == 0) {
-                    part_exists = 1;
-                    break;
-                }
-            }
-            if (!part_exists && part_count < 100) {
-                strcpy(order_parts[part_count], part);
-                part_count++;
-            }
-        }
-        fclose(f);
-    }
-
-    // Display today's statistics
-    sprintf(dashboard_msg, "[*] Orders Placed Today: %d", today_orders);
-    center_print(dashboard_msg);
-
-    sprintf(dashboard_msg, "[$] Today's Revenue: $%.2f", today_revenue);
-    center_print(dashboard_msg);
-
-    sprintf(dashboard_msg, "[#] Different Parts Ordered: %d", part_count);
-    center_print(dashboard_msg);
-
-    if (part_count > 0) {
-        printf("\n");
-        center_print("[*] POPULAR PARTS TODAY:");
-        print_separator();
-        for (int i = 0; i < part_count && i < 10; i++) { // Show top 10
-            printf("%*s", (CONSOLE_WIDTH-20)/2, "");
-            printf("* %s\n", order_parts[i]);
-        }
-    }
-
-    // Quick stats
-    printf("\n");
-    print_separator();
-    center_print("[*] QUICK SYSTEM STATUS");
-
-    // Count total users
-    f = fopen(USERS_FILE, "r");
-    int total_customers = 0;
-    if (f) {
-        char role[20], username[30], password[30], name[50], email[50], phone[20];
-        while (fscanf(f, "%s %s %s %s %s %s", role, username, password, name, email, phone) == 6) {
-            if (strcmp(role, "Customer") == 0) total_customers++;
-        }
-        fclose(f);
-    }
-
-    sprintf(dashboard_msg, "[#] Total Customers: %d", total_customers);
-    center_print(dashboard_msg);
-
-    // Count cars in garage
-    f = fopen(CARS_FILE, "r");
-    int cars_count = 0;
-    if (f) {
-        char line[100];
-        while (fgets(line, sizeof(line), f)) {
-            cars_count++;
-        }
-        fclose(f);
-    }
-
-    sprintf(dashboard_msg, "[*] Cars in Garage: %d", cars_count);
-    center_print(dashboard_msg);
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Add part to inventory
- */
-void add_part() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[+] ADD NEW PART");
-    print_separator();
-
-    FILE *f = fopen(PARTS_FILE, "a");
-    char part[50], spec[50];
-    float price;
-
-    if (!f) {
-        center_print("[X] Error opening inventory file.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    printf("\n");
-    center_prompt("Part Name: ");
-    scanf("%s", part);
-
-    center_prompt("Specifications: ");
-    scanf("%s", spec);
-
-    center_prompt("Price: $");
-    scanf("%f", &price);
-
-    fprintf(f, "%s %s %.2f\n", part, spec, price);
-    fclose(f);
-
-    printf("\n");
-    center_print("[+] Part added successfully!");
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Delete part from inventory
- */
-void delete_part() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[-] DELETE PART");
-    print_separator();
-
-    FILE *f = fopen(PARTS_FILE, "r");
-    FILE *temp = fopen("temp.txt", "w");
-    char part[50], spec[50], target[50];
-    float price;
-    int found = 0;
-
-    if (!f || !temp) {
-        center_print("[X] Error opening files.");
-        if (f) fclose(f);
-        if (temp) fclose(temp);
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    printf("\n");
-    center_prompt("Enter part name to delete: ");
-    scanf("%s", target);
-
-    while (fscanf(f, "%s %s %f", part, spec, &price) == 3) {
-        if (strcmp(part, target) != 0) {
-            fprintf(temp, "%s %s %.2f\n", part, spec, price);
-        } else {
-            found = 1;
-        }
-    }
-
-    fclose(f);
-    fclose(temp);
-    remove(PARTS_FILE);
-    rename("temp.txt", PARTS_FILE);
-
-    printf("\n");
-    if (found)
-        center_print("[+] Part deleted successfully!");
-    else
-        center_print("[X] Part not found.");
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * View all parts in inventory
- */
-void view_parts() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] AVAILABLE PARTS INVENTORY");
-    print_separator();
-
-    FILE *f = fopen(PARTS_FILE, "r");
-    char part[50], spec[50];
-    float price;
-
-    if (!f) {
-        center_print("[-] No parts found in inventory.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-40)/2, "");
-    printf("%-15s %-20s %s\n", "PART NAME", "SPECIFICATIONS", "PRICE ($)");
-    printf("%*s", (CONSOLE_WIDTH-40)/2, "");
-    for (int i = 0; i < 40; i++) printf("-");
-    printf("\n");
-
-    while (fscanf(f, "%s %s %f", part, spec, &price) == 3) {
-        printf("%*s", (CONSOLE_WIDTH-40)/2, "");
-        printf("%-15s %-20s $%.2f\n", part, spec, price);
-    }
-    fclose(f);
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * View not available parts
- */
-void view_not_available_parts() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[X] OUT OF STOCK / UPCOMING PARTS");
-    print_separator();
-
-    FILE *f = fopen(NOT_AVAILABLE_FILE, "r");
-    char part[50], spec[50], date[20];
-
-    if (!f) {
-        center_print("[+] All parts are currently available!");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-50)/2, "");
-    printf("%-15s %-20s %s\n", "PART NAME", "SPECIFICATIONS", "RESTOCK DATE");
-    printf("%*s", (CONSOLE_WIDTH-50)/2, "");
-    for (int i = 0; i < 50; i++) printf("-");
-    printf("\n");
-
-    while (fscanf(f, "%s %s %s", part, spec, date) == 3) {
-        printf("%*s", (CONSOLE_WIDTH-50)/2, "");
-        printf("%-15s %-20s %s\n", part, spec, date);
-    }
-    fclose(f);
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Update user profile
- */
-void update_profile(const char *logged_in_username) {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] UPDATE PROFILE");
-    print_separator();
-
-    FILE *f = fopen(USERS_FILE, "r");
-    FILE *temp = fopen("temp.txt", "w");
-    char username[30], password[30], role[20];
-    char name[50], email[50], phone[20];
-    int found = 0;
-
-    if (!f || !temp) {
-        center_print("[X] Error opening files.");
-        if (f) fclose(f);
-        if (temp) fclose(temp);
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    while (fscanf(f, "%s %s %s %s %s %s", role, username, password, name, email, phone) == 6) {
-        if (strcmp(username, logged_in_username) == 0) {
-            char update_msg[50];
-            sprintf(update_msg, "Updating profile for: %s", logged_in_username);
-            center_print(update_msg);
-            printf("\n");
-
-            printf("%*s", (CONSOLE_WIDTH-20)/2, "");
-            printf("New Name: ");
-            scanf("%s", name);
-
-            // Validate and get email
-            while (1) {
-                printf("%*s", (CONSOLE_WIDTH-20)/2, "");
-                printf("New Email: ");
-                scanf("%s", email);
-
-                if (validate_email(email)) {
-                    break;
-                } else {
-                    center_print("[X] Invalid email domain!");
-                }
-            }
-
-            // Validate and get phone
-            while (1) {
-                printf("%*s", (CONSOLE_WIDTH-30)/2, "");
-                printf("New Phone (01XXXXXXXXX): ");
-                scanf("%s", phone);
-
-                if (validate_phone(phone)) {
-                    break;
-                } else {
-                    center_print("[X] Invalid phone number format!");
-                }
-            }
-
-            found = 1;
-        }
-        fprintf(temp, "%s %s %s %s %s %s\n", role, username, password, name, email, phone);
-    }
-
-    fclose(f);
-    fclose(temp);
-    remove(USERS_FILE);
-    rename("temp.txt", USERS_FILE);
-
-    printf("\n");
-    if (found)
-        center_print("[+] Profile updated successfully!");
-    else
-        center_print("[X] Username not found.");
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Order parts (Customer only)
- */
-void order_parts(const char *username) {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] PLACE YOUR ORDER");
-    print_separator();
-
-    FILE *f_parts = fopen(PARTS_FILE, "r");
-    if (!f_parts) {
-        center_print("[X] Error opening parts file.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    // Read and display all parts with numbers
-    char parts[100][50], specs[100][50];
-    float prices[100];
-    int total_parts = 0;
-
-    printf("\n");
-    center_print("[*] AVAILABLE PARTS:");
-    printf("\n");
-
-    while (fscanf(f_parts, "%s %s %f", parts[total_parts], specs[total_parts], &prices[total_parts]) == 3) {
-        char part_line[150];
-        sprintf(part_line, "%d.  [%s] %s - $%.2f", total_parts + 1, specs[total_parts], parts[total_parts], prices[total_parts]);
-        center_print(part_line);
-        total_parts++;
-        if (total_parts >= 100) break; // Safety limit
-    }
-    fclose(f_parts);
-
-    if (total_parts == 0) {
-        center_print("[X] No parts available in inventory.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    printf("\n");
-    int choice, quantity;
-    char prompt[100];
-    sprintf(prompt, "Select part number (1-%d): ", total_parts);
-    center_prompt(prompt);
-    scanf("%d", &choice);
-
-    if (choice < 1 || choice > total_parts) {
-        center_print("[X] Invalid part selection.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    choice--; // Convert to 0-based index
-
-    center_prompt("Quantity: ");
-    scanf("%d", &quantity);
-
-    if (quantity <= 0) {
-        center_print("[X] Invalid quantity.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    // Ask for car number to track service progress
-    char car_number[20];
-    printf("\n");
-    center_prompt("Car Number (for service tracking): ");
-    scanf("%s", car_number);
-
-    float total_price = prices[choice] * quantity;
-
-    // Show order summary
-    printf("\n");
-    center_print("[*] ORDER SUMMARY:");
-    char summary[150];
-    sprintf(summary, "Part: %s | Quantity: %d | Unit Price: $%.2f", parts[choice], quantity, prices[choice]);
-    center_print(summary);
-    sprintf(summary, "Total Amount: $%.2f", total_price);
-    center_print(summary);
-
-    // Apply promo code
-    float promo_discount = 0;
-    float after_promo = apply_promo_code(total_price);
-    promo_discount = total_price - after_promo;
-
-    // Apply loyalty points redemption
-    float loyalty_discount = 0;
-    float final_price = apply_loyalty_discount(username, after_promo, &loyalty_discount);
-
-    // Show final pricing breakdown
-    if (promo_discount > 0 || loyalty_discount > 0) {
-        printf("\n");
-        center_print("[*] DISCOUNT BREAKDOWN:");
-        if (promo_discount > 0) {
-            sprintf(summary, "Promo Code Discount: -$%.2f", promo_discount);
-            center_print(summary);
-        }
-        if (loyalty_discount > 0) {
-            sprintf(summary, "Loyalty Points Discount: -$%.2f", loyalty_discount);
-            center_print(summary);
-        }
-        sprintf(summary, "Final Amount: $%.2f", final_price);
-        center_print(summary);
-    }
-
-    // Payment options
-    printf("\n");
-    center_print("[*] PAYMENT OPTIONS:");
-    center_print("1  [C]  Cash Payment");
-    center_print("2  [O]  Paid Online");
-    printf("\n");
-
-    int payment_choice;
-    center_prompt("Select payment method (1-2): ");
-    scanf("%d", &payment_choice);
-
-    char payment_method[20];
-    if (payment_choice == 1) {
-        strcpy(payment_method, "Cash");
-    } else if (payment_choice == 2) {
-        strcpy(payment_method, "Online");
-    } else {
-        center_print("[X] Invalid payment option. Defaulting to Cash.");
-        strcpy(payment_method, "Cash");
-    }
-
-    // Get current date and time
-    time_t now = time(0);
-    char *date_time = ctime(&now);
-    date_time[strlen(date_time) - 1] = '\0'; // Remove newline
-
-    // Save order to file with payment info and date/time
-    FILE *f_orders = fopen(ORDERS_FILE, "a");
-    if (!f_orders) {
-        center_print("[X] Error saving order.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    fprintf(f_orders, "%s %s %d %.2f %s %s\n", username, parts[choice], quantity, final_price, payment_method, date_time);
-    fclose(f_orders);
-
-    printf("\n");
-    center_print("[+] Order placed successfully!");
-    char payment_msg[100];
-    sprintf(payment_msg, "[*] Payment Method: %s", payment_method);
-    center_print(payment_msg);
-    sprintf(payment_msg, "[*] Final Amount: $%.2f", final_price);
-    center_print(payment_msg);
-
-    // Award loyalty points (1 point per $1 spent)
-    int points_earned = (int)final_price;
-    add_loyalty_points(username, points_earned);
-    sprintf(payment_msg, "[LOYALTY] Loyalty Points Earned: %d", points_earned);
-    center_print(payment_msg);
-
-    // Auto-add service progress for the car
-    auto_add_service_progress(car_number, "ORDER_PLACED");
-    center_print("[+] Service progress updated automatically!");
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * View Order History
- */
-void view_order_history(const char *username) {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[H] ORDER HISTORY");
-    print_separator();
-
-    printf("\n");
-    center_print("1  [*]  View All Orders");
-    center_print("2  [F]  Filter by Date");
-    center_print("3  [<]  Back to Menu");
-    printf("\n");
-
-    int choice;
-    center_prompt("Select option (1-3): ");
-    scanf("%d", &choice);
-
-    FILE *f_orders = fopen(ORDERS_FILE, "r");
-    if (!f_orders) {
-        center_print("[X] Error opening orders file or no orders found.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char user[30], part[50], payment[20], date_time[100];
-    int quantity, order_count = 0;
-    float price;
-
-    if (choice == 1) {
-        // View all orders
-        clear_screen();
-        display_ascii_logo();
-        center_print("[H] YOUR ORDER HISTORY");
-        print_separator();
-        printf("\n");
-
-        // Table headers
-        printf("%*s", (CONSOLE_WIDTH-95)/2, "");
-        printf("%-4s %-15s %-8s %-10s %-12s %-10s %-15s %-12s\n", "No.", "Item Name", "Quantity", "Unit Price", "Total Cost", "Payment", "Customer Name", "Current Date");
-        printf("%*s", (CONSOLE_WIDTH-95)/2, "");
-        for (int i = 0; i < 95; i++) printf("-");
-        printf("\n");
-
-        // Get current date
-        time_t now = time(0);
-        char current_date[15];
-        strftime(current_date, sizeof(current_date), "%Y-%m-%d", localtime(&now));
-
-        // Get customer's full name from user file
-        char customer_full_name[50] = "Unknown";
-        FILE *f_users = fopen(USERS_FILE, "r");
-        if (f_users) {
-            char role[20], stored_username[30], password[30], name[50], email[50], phone[20];
-            while (fscanf(f_users, "%s %s %s %s %s %s", role, stored_username, password, name, email, phone) == 6) {
-                if (strcmp(stored_username, username) == 0) {
-                    strcpy(customer_full_name, name);
-                    break;
-                }
-            }
-            fclose(f_users);
-        }
-
-        while (fscanf(f_orders, "%s %s %d %f %s %[^\n]", user, part, &quantity, &price, payment, date_time) == 6) {
-            if (strcmp(user, username) == 0) {
-                order_count++;
-                float unit_price = price / quantity; // Calculate unit price
-                printf("%*s", (CONSOLE_WIDTH-95)/2, "");
-                printf("%-4d %-15s %-8d $%-9.2f $%-11.2f %-10s %-15s %-12s\n",
-                       order_count, part, quantity, unit_price, price, payment, customer_full_name, current_date);
-            }
-        }
-
-        if (order_count == 0) {
-            center_print("[X] No orders found for your account.");
-        }
-
-    } else if (choice == 2) {
-        // Filter by date
-        char search_date[20];
-        printf("\n");
-        center_prompt("Enter date to search (format: Mon Aug 09 or just Aug 09): ");
-        getchar(); // Clear buffer
-        fgets(search_date, sizeof(search_date), stdin);
-        search_date[strcspn(search_date, "\n")] = 0; // Remove newline
-
-        clear_screen();
-        display_ascii_logo();
-        center_print("[F] FILTERED ORDER HISTORY");
-        print_separator();
-        printf("\n");
-        char filter_msg[100];
-        sprintf(filter_msg, "Showing orders for: %s", search_date);
-        center_print(filter_msg);
-        printf("\n");
-
-        // Table headers
-        printf("%*s", (CONSOLE_WIDTH-95)/2, "");
-        printf("%-4s %-15s %-8s %-10s %-12s %-10s %-15s %-12s\n", "No.", "Item Name", "Quantity", "Unit Price", "Total Cost", "Payment", "Customer Name", "Current Date");
-        printf("%*s", (CONSOLE_WIDTH-95)/2, "");
-        for (int i = 0; i < 95; i++) printf("-");
-        printf("\n");
-
-        // Get current date
-        time_t now = time(0);
-        char current_date[15];
-        strftime(current_date, sizeof(current_date), "%Y-%m-%d", localtime(&now));
-
-        // Get customer's full name from user file
-        char customer_full_name[50] = "Unknown";
-        FILE *f_users = fopen(USERS_FILE, "r");
-        if (f_users) {
-            char role[20], stored_username[30], password[30], name[50], email[50], phone[20];
-            while (fscanf(f_users, "%s %s %s %s %s %s", role, stored_username, password, name, email, phone) == 6) {
-                if (strcmp(stored_username, username) == 0) {
-                    strcpy(customer_full_name, name);
-                    break;
-                }
-            }
-            fclose(f_users);
-        }
-
-        while (fscanf(f_orders, "%s %s %d %f %s %[^\n]", user, part, &quantity, &price, payment, date_time) == 6) {
-            if (strcmp(user, username) == 0 && strstr(date_time, search_date) != NULL) {
-                order_count++;
-                float unit_price = price / quantity; // Calculate unit price
-                printf("%*s", (CONSOLE_WIDTH-95)/2, "");
-                printf("%-4d %-15s %-8d $%-9.2f $%-11.2f %-10s %-15s %-12s\n",
-                       order_count, part, quantity, unit_price, price, payment, customer_full_name, current_date);
-            }
-        }
-
-        if (order_count == 0) {
-            center_print("[X] No orders found for the specified date.");
-        }
-
-    } else if (choice == 3) {
-        fclose(f_orders);
-        return;
-    } else {
-        center_print("[X] Invalid choice.");
-    }
-
-    fclose(f_orders);
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Calculate order estimation
- */
-float calculate_estimation(const char *username) {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[$] ORDER ESTIMATION");
-    print_separator();
-
-    FILE *orders = fopen(ORDERS_FILE, "r");
-    char user[30], part[50], payment[20], date_time[100];
-    int quantity;
-    float total, sum = 0;
-
-    if (!orders) {
-        center_print("[-] No orders found.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return 0;
-    }
-
-    printf("\n");
-    center_print("[*] YOUR ORDERS:");
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-    printf("%-15s %-10s %-8s %s\n", "PART", "QUANTITY", "PAYMENT", "TOTAL ($)");
-    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-    for (int i = 0; i < 60; i++) printf("-");
-    printf("\n");
-
-    // Try new format first
-    while (fscanf(orders, "%s %s %d %f %s %[^\n]", user, part, &quantity, &total, payment, date_time) == 6) {
-        if (strcmp(user, username) == 0) {
-            printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-            printf("%-15s %-10d %-8s $%.2f\n", part, quantity, payment, total);
-            sum += total;
-        }
-    }
-
-    // If no new format found, try old format
-    if (sum == 0) {
-        fseek(orders, 0, SEEK_SET);
-        while (fscanf(orders, "%s %s %d %f", user, part, &quantity, &total) == 4) {
-            if (strcmp(user, username) == 0) {
-                printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-                printf("%-15s %-10d %-8s $%.2f\n", part, quantity, "Cash", total);
-                sum += total;
-            }
-        }
-    }
-    fclose(orders);
-
-    printf("\n");
-    char total_msg[50];
-    sprintf(total_msg, "[$] TOTAL ESTIMATION: $%.2f", sum);
-    center_print(total_msg);
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-    return sum;
-}
-
-/**
- * Generate invoice
- */
-void generate_invoice(const char *actor_username, const char *actor_role) {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] GENERATE INVOICE");
-    print_separator();
-
-    char target_username[30];
-    char cust_name[50] = "N/A", cust_email[50] = "N/A", cust_phone[20] = "N/A";
-    int user_found = 0;
-
-    if (strcmp(actor_role, "Admin") == 0) {
-        printf("\n");
-        center_prompt("Customer username for invoice: ");
-        scanf("%s", target_username);
-    } else {
-        strcpy(target_username, actor_username);
-    }
-
-    FILE *f_users = fopen(USERS_FILE, "r");
-    if (f_users) {
-        char role[20], username[30], password[30], name[50], email[50], phone[20];
-        while (fscanf(f_users, "%s %s %s %s %s %s", role, username, password, name, email, phone) == 6) {
-            if (strcmp(username, target_username) == 0) {
-                strcpy(cust_name, name);
-                strcpy(cust_email, email);
-                strcpy(cust_phone, phone);
-                user_found = 1;
-                break;
-            }
-        }
-        fclose(f_users);
-    }
-
-    if (!user_found) {
-        center_print("[X] Customer not found.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    printf("\n");
-    print_separator();
-    center_print("[*] OFFICIAL INVOICE");
-    print_separator();
-
-    char customer_info[100];
-    sprintf(customer_info, "Customer: %s", cust_name);
-    center_print(customer_info);
-
-    sprintf(customer_info, "Email: %s", cust_email);
-    center_print(customer_info);
-
-    sprintf(customer_info, "Phone: %s", cust_phone);
-    center_print(customer_info);
-
-    print_separator();
-
-    // Show order details without clearing screen
-    FILE *orders = fopen(ORDERS_FILE, "r");
-    char user[30], part[50];
-    int quantity;
-    float total, sum = 0;
-
-    if (orders) {
-        printf("\n");
-        center_print("[*] ORDER DETAILS:");
-        printf("\n");
-        printf("%*s", (CONSOLE_WIDTH-40)/2, "");
-        printf("%-15s %-10s %s\n", "PART", "QUANTITY", "TOTAL ($)");
-        printf("%*s", (CONSOLE_WIDTH-40)/2, "");
-        for (int i = 0; i < 40; i++) printf("-");
-        printf("\n");
-
-        while (fscanf(orders, "%s %s %d %f", user, part, &quantity, &total) == 4) {
-            if (strcmp(user, target_username) == 0) {
-                printf("%*s", (CONSOLE_WIDTH-40)/2, "");
-                printf("%-15s %-10d $%.2f\n", part, quantity, total);
-                sum += total;
-            }
-        }
-        fclose(orders);
-    }
-
-    float vat = sum * VAT_RATE;
-
-    printf("\n");
-    print_separator();
-    char vat_msg[50], final_msg[50];
-    sprintf(vat_msg, "VAT (%.0f%%): $%.2f", VAT_RATE * 100, vat);
-    sprintf(final_msg, "TOTAL WITH VAT: $%.2f", sum + vat);
-
-    center_print(vat_msg);
-    center_print(final_msg);
-    print_separator();
-
-    // Generate QR receipt after invoice
-    char service_details[200];
-    sprintf(service_details, "Invoice_Total:$%.2f_VAT:$%.2f_Customer:%s", sum + vat, vat, cust_name);
-    generate_qr_receipt(target_username, service_details, sum + vat);
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Car management functions
- */
-void add_car() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] ADD CAR TO GARAGE");
-    print_separator();
-
-    FILE *f = fopen(CARS_FILE, "a");
-    if (!f) {
-        center_print("[X] Error opening cars file.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char number[20], time[20];
-
-    printf("\n");
-    center_prompt("Car Number: ");
-    scanf("%s", number);
-
-    center_prompt("Entry Time: ");
-    scanf("%s", time);
-
-    fprintf(f, "%s %s\n", number, time);
-    fclose(f);
-
-    printf("\n");
-    center_print("[+] Car added to garage successfully!");
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-void view_cars() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] CARS IN GARAGE");
-    print_separator();
-
-    printf("\n");
-    center_print("1  [*]  View All Cars");
-    center_print("2  [F]  Filter by Date");
-    center_print("3  [<]  Back to Menu");
-    printf("\n");
-
-    int choice;
-    center_prompt("Select option (1-3): ");
-    scanf("%d", &choice);
-
-    FILE *f = fopen(CARS_FILE, "r");
-    if (!f) {
-        center_print("[P] No cars in garage.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char line[100];
-    char search_date[20];
-    int car_count = 0;
-
-    if (choice == 1) {
-        // View all cars
-        clear_screen();
-        display_ascii_logo();
-        center_print("[*] ALL CARS IN GARAGE");
-        print_separator();
-
-        printf("\n");
-        printf("%*s", (CONSOLE_WIDTH-30)/2, "");
-        printf("%-15s %s\n", "CAR NUMBER", "ENTRY TIME");
-        printf("%*s", (CONSOLE_WIDTH-30)/2, "");
-        for (int i = 0; i < 30; i++) printf("-");
-        printf("\n");
-
-        while (fgets(line, sizeof(line), f)) {
-            printf("%*s", (CONSOLE_WIDTH-30)/2, "");
-            printf("%s", line);
-            car_count++;
-        }
-
-        if (car_count == 0) {
-            center_print("[P] No cars in garage.");
-        }
-
-    } else if (choice == 2) {
-        // Filter by date
-        printf("\n");
-        center_prompt("Enter date to search (format: Mon Aug 09 or just Aug 09): ");
-        getchar(); // Clear buffer
-        fgets(search_date, sizeof(search_date), stdin);
-        search_date[strcspn(search_date, "\n")] = 0; // Remove newline
-
-        clear_screen();
-        display_ascii_logo();
-        center_print("[F] FILTERED CARS BY DATE");
-        print_separator();
-        printf("\n");
-        char filter_msg[100];
-        sprintf(filter_msg, "Showing cars for: %s", search_date);
-        center_print(filter_msg);
-        printf("\n");
-
-        printf("%*s", (CONSOLE_WIDTH-30)/2, "");
-        printf("%-15s %s\n", "CAR NUMBER", "ENTRY TIME");
-        printf("%*s", (CONSOLE_WIDTH-30)/2, "");
-        for (int i = 0; i < 30; i++) printf("-");
-        printf("\n");
-
-        while (fgets(line, sizeof(line), f)) {
-            if (strstr(line, search_date) != NULL) {
-                printf("%*s", (CONSOLE_WIDTH-30)/2, "");
-                printf("%s", line);
-                car_count++;
-            }
-        }
-
-        if (car_count == 0) {
-            center_print("[P] No cars found for the specified date.");
-        }
-
-    } else if (choice == 3) {
-        fclose(f);
-        return;
-    } else {
-        center_print("[X] Invalid choice.");
-    }
-
-    fclose(f);
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-void delete_car() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[-] REMOVE CAR FROM GARAGE");
-    print_separator();
-
-    FILE *f = fopen(CARS_FILE, "r");
-    if (!f) {
-        center_print("[P] No cars in garage.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    FILE *temp = fopen("temp_cars.txt", "w");
-    if (!temp) {
-        center_print("[X] Error creating temporary file.");
-        fclose(f);
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char number[20], time[20], target[20];
-    int found = 0;
-
-    printf("\n");
-    center_prompt("Car number to remove: ");
-    scanf("%s", target);
-
-    while (fscanf(f, "%s %s", number, time) == 2) {
-        if (strcmp(number, target) != 0) {
-            fprintf(temp, "%s %s\n", number, time);
-        } else {
-            found = 1;
-        }
-    }
-
-    fclose(f);
-    fclose(temp);
-    remove(CARS_FILE);
-    rename("temp_cars.txt", CARS_FILE);
-
-    printf("\n");
-    if (found)
-        center_print("[+] Car removed from garage successfully!");
-    else
-        center_print("[X] Car not found.");
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-void modify_car() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] MODIFY CAR ENTRY");
-    print_separator();
-
-    FILE *f = fopen(CARS_FILE, "r");
-    if (!f) {
-        center_print("[P] No cars in garage.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    FILE *temp = fopen("temp_cars.txt", "w");
-    if (!temp) {
-        center_print("[X] Error creating temporary file.");
-        fclose(f);
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char number[20], time[20], target[20];
-    int found = 0;
-
-    printf("\n");
-    center_prompt("Car number to modify: ");
-    scanf("%s", target);
-
-    while (fscanf(f, "%s %s", number, time) == 2) {
-        if (strcmp(number, target) == 0) {
-            center_prompt("New entry time: ");
-            scanf("%s", time);
-            found = 1;
-        }
-        fprintf(temp, "%s %s\n", number, time);
-    }
-
-    fclose(f);
-    fclose(temp);
-    remove(CARS_FILE);
-    rename("temp_cars.txt", CARS_FILE);
-
-    printf("\n");
-    if (found)
-        center_print("[+] Car entry modified successfully!");
-    else
-        center_print("[X] Car not found.");
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Admin panel functions
- */
-void view_all_users() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[#] ALL REGISTERED USERS");
-    print_separator();
-
-    FILE *f = fopen(USERS_FILE, "r");
-    if (!f) {
-        center_print("[-] No users found.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char role[20], username[30], password[30], name[50], email[50], phone[20];
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-70)/2, "");
-    printf("%-12s %-15s %-20s %-15s %s\n", "ROLE", "USERNAME", "NAME", "EMAIL", "PHONE");
-    printf("%*s", (CONSOLE_WIDTH-70)/2, "");
-    for (int i = 0; i < 70; i++) printf("-");
-    printf("\n");
-
-    while (fscanf(f, "%s %s %s %s %s %s", role, username, password, name, email, phone) == 6) {
-        printf("%*s", (CONSOLE_WIDTH-70)/2, "");
-        printf("%-12s %-15s %-20s %-15s %s\n", role, username, name, email, phone);
-    }
-    fclose(f);
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-void view_all_orders() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] ALL CUSTOMER ORDERS");
-    print_separator();
-
-    printf("\n");
-    center_print("1  [*]  View All Orders");
-    center_print("2  [F]  Filter by Date");
-    center_print("3  [<]  Back to Menu");
-    printf("\n");
-
-    int choice;
-    center_prompt("Select option (1-3): ");
-    scanf("%d", &choice);
-
-    FILE *f = fopen(ORDERS_FILE, "r");
-    if (!f) {
-        center_print("[-] No orders found.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char user[30], part[50], payment[20], date_time[100];
-    int quantity, order_count = 0;
-    float total;
-
-    if (choice == 1) {
-        // View all orders
-        clear_screen();
-        display_ascii_logo();
-        center_print("[*] ALL CUSTOMER ORDERS");
-        print_separator();
-
-        printf("\n");
-        printf("%*s", (CONSOLE_WIDTH-80)/2, "");
-        printf("%-12s %-12s %-4s %-8s %-8s %s\n", "CUSTOMER", "PART", "QTY", "TOTAL($)", "PAYMENT", "DATE");
-        printf("%*s", (CONSOLE_WIDTH-80)/2, "");
-        for (int i = 0; i < 80; i++) printf("-");
-        printf("\n");
-
-        // Try new format first
-        while (fscanf(f, "%s %s %d %f %s %[^\n]", user, part, &quantity, &total, payment, date_time) == 6) {
-            printf("%*s", (CONSOLE_WIDTH-80)/2, "");
-            printf("%-12s %-12s %-4d $%-7.2f %-8s %s\n", user, part, quantity, total, payment, date_time);
-            order_count++;
-        }
-
-        // If no new format found, try old format
-        if (order_count == 0) {
-            fseek(f, 0, SEEK_SET);
-            while (fscanf(f, "%s %s %d %f", user, part, &quantity, &total) == 4) {
-                printf("%*s", (CONSOLE_WIDTH-80)/2, "");
-                printf("%-12s %-12s %-4d $%-7.2f %-8s %s\n", user, part, quantity, total, "Cash", "Legacy Order");
-                order_count++;
-            }
-        }
-
-        if (order_count == 0) {
-            center_print("[-] No orders found.");
-        }
-
-    } else if (choice == 2) {
-        // Filter by date
-        char search_date[20];
-        printf("\n");
-        center_prompt("Enter date to search (format: Mon Aug 09 or just Aug 09): ");
-        getchar(); // Clear buffer
-        fgets(search_date, sizeof(search_date), stdin);
-        search_date[strcspn(search_date, "\n")] = 0; // Remove newline
-
-        clear_screen();
-        display_ascii_logo();
-        center_print("[F] FILTERED ORDERS BY DATE");
-        print_separator();
-        printf("\n");
-        char filter_msg[100];
-        sprintf(filter_msg, "Showing orders for: %s", search_date);
-        center_print(filter_msg);
-        printf("\n");
-
-        printf("%*s", (CONSOLE_WIDTH-80)/2, "");
-        printf("%-12s %-12s %-4s %-8s %-8s %s\n", "CUSTOMER", "PART", "QTY", "TOTAL($)", "PAYMENT", "DATE");
-        printf("%*s", (CONSOLE_WIDTH-80)/2, "");
-        for (int i = 0; i < 80; i++) printf("-");
-        printf("\n");
-
-        while (fscanf(f, "%s %s %d %f %s %[^\n]", user, part, &quantity, &total, payment, date_time) == 6) {
-            if (strstr(date_time, search_date) != NULL) {
-                printf("%*s", (CONSOLE_WIDTH-80)/2, "");
-                printf("%-12s %-12s %-4d $%-7.2f %-8s %s\n", user, part, quantity, total, payment, date_time);
-                order_count++;
-            }
-        }
-
-        if (order_count == 0) {
-            center_print("[-] No orders found for the specified date.");
-        }
-
-    } else if (choice == 3) {
-        fclose(f);
-        return;
-    } else {
-        center_print("[X] Invalid choice.");
-    }
-
-    fclose(f);
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-void system_statistics() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] SYSTEM STATISTICS");
-    print_separator();
-
-    printf("\n");
-    center_print("1  [*]  View All Statistics");
-    center_print("2  [F]  Statistics by Date");
-    center_print("3  [<]  Back to Menu");
-    printf("\n");
-
-    int choice;
-    center_prompt("Select option (1-3): ");
-    scanf("%d", &choice);
-
-    if (choice == 3) {
-        return;
-    }
-
-    // Count users
-    FILE *f = fopen(USERS_FILE, "r");
-    int total_users = 0, customers = 0, admins = 0;
-    if (f) {
-        char role[20], username[30], password[30], name[50], email[50], phone[20];
-        while (fscanf(f, "%s %s %s %s %s %s", role, username, password, name, email, phone) == 6) {
-            total_users++;
-            if (strcmp(role, "Customer") == 0) customers++;
-            else if (strcmp(role, "Admin") == 0) admins++;
-        }
-        fclose(f);
-    }
-
-    // Count parts
-    f = fopen(PARTS_FILE, "r");
-    int total_parts = 0;
-    if (f) {
-        char part[50], spec[50];
-        float price;
-        while (fscanf(f, "%s %s %f", part, spec, &price) == 3) {
-            total_parts++;
-        }
-        fclose(f);
-    }
-
-    // Count cars
-    f = fopen(CARS_FILE, "r");
-    int total_cars = 0;
-    if (f) {
-        char line[100];
-        while (fgets(line, sizeof(line), f)) {
-            total_cars++;
-        }
-        fclose(f);
-    }
-
-    char search_date[20];
-    int filtered = 0;
-
-    if (choice == 2) {
-        printf("\n");
-        center_prompt("Enter date to filter (format: Mon Aug 09 or just Aug 09): ");
-        getchar(); // Clear buffer
-        fgets(search_date, sizeof(search_date), stdin);
-        search_date[strcspn(search_date, "\n")] = 0; // Remove newline
-        filtered = 1;
-    }
-
-    // Count orders and payment statistics
-    f = fopen(ORDERS_FILE, "r");
-    int total_orders = 0, cash_payments = 0, online_payments = 0;
-    float total_revenue = 0, cash_revenue = 0, online_revenue = 0;
-    if (f) {
-        char user[30], part[50], payment[20], date_time[100];
-        int quantity;
-        float total;
-
-        // Try new format first (with payment and date)
-        while (fscanf(f, "%s %s %d %f %s %[^\n]", user, part, &quantity, &total, payment, date_time) == 6) {
-            // If filtering by date, check if order matches
-            if (filtered && strstr(date_time, search_date) == NULL) {
-                continue; // Skip orders that don't match the date filter
-            }
-
-            total_orders++;
-            total_revenue += total;
-
-            if (strcmp(payment, "Cash") == 0) {
-                cash_payments++;
-                cash_revenue += total;
-            } else if (strcmp(payment, "Online") == 0) {
-                online_payments++;
-                online_revenue += total;
-            }
-        }
-
-        // If no new format orders found, try old format (only for non-filtered view)
-        if (total_orders == 0 && !filtered) {
-            fseek(f, 0, SEEK_SET); // Reset file pointer
-            while (fscanf(f, "%s %s %d %f", user, part, &quantity, &total) == 4) {
-                total_orders++;
-                total_revenue += total;
-                cash_payments++; // Old orders default to cash
-                cash_revenue += total;
-            }
-        }
-        fclose(f);
-    }
-
-    clear_screen();
-    display_ascii_logo();
-    if (filtered) {
-        center_print("[F] FILTERED SYSTEM STATISTICS");
-        print_separator();
-        printf("\n");
-        char filter_msg[100];
-        sprintf(filter_msg, "Statistics for: %s", search_date);
-        center_print(filter_msg);
-    } else {
-        center_print("[*] SYSTEM STATISTICS");
-        print_separator();
-    }
-
-    printf("\n");
-    char stat_msg[100];
-
-    if (!filtered) {
-        sprintf(stat_msg, "[#] Total Users: %d", total_users);
-        center_print(stat_msg);
-        sprintf(stat_msg, "   * Customers: %d", customers);
-        center_print(stat_msg);
-        sprintf(stat_msg, "   * Admins: %d", admins);
-        center_print(stat_msg);
-
-        printf("\n");
-        sprintf(stat_msg, "[*] Total Parts in Inventory: %d", total_parts);
-        center_print(stat_msg);
-        sprintf(stat_msg, "[*] Cars in Garage: %d", total_cars);
-        center_print(stat_msg);
-        printf("\n");
-    }
-
-    sprintf(stat_msg, "[*] Total Orders: %d", total_orders);
-    center_print(stat_msg);
-    sprintf(stat_msg, "[$] Total Revenue: $%.2f", total_revenue);
-    center_print(stat_msg);
-
-    printf("\n");
-    center_print("[*] PAYMENT STATISTICS:");
-    sprintf(stat_msg, "   * Cash Payments: %d (Revenue: $%.2f)", cash_payments, cash_revenue);
-    center_print(stat_msg);
-    sprintf(stat_msg, "   * Online Payments: %d (Revenue: $%.2f)", online_payments, online_revenue);
-    center_print(stat_msg);
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-void admin_panel(const char *admin_username) {
-    int choice;
-
-    while (1) {
-        clear_screen();
-
-        // Display developer copyright in lower right corner first
-        display_developer_copyright();
-
-        display_ascii_logo();
-        center_print("[#] ADMIN CONTROL PANEL");
-        center_print("System Administration Dashboard");
-        print_separator();
-
-        char welcome_msg[50];
-        sprintf(welcome_msg, "Welcome, Administrator: %s", admin_username);
-        center_print(welcome_msg);
-
-        printf("\n");
-        center_print("1  [*]  Daily Dashboard");
-        center_print("2  [#]  View All Users");
-        center_print("3  [*]  Manage Inventory");
-        center_print("4  [*]  View All Orders");
-        center_print("5  [*]  Generate Customer Invoice");
-        center_print("6  [*]  Car Management");
-        center_print("7  [%]  Manage Discounts");
-        center_print("8  [*]  Appointment Management");
-        center_print("9  [X]  View Out of Stock Parts");
-        center_print("10  [*]  View Car Parking Records");
-        center_print("11  [*]  System Statistics");
-        center_print("12  [LOYALTY] Loyalty System Dashboard");
-        center_print("13  [X]  Return to Main Menu");
-
-        // Display "Enter choice:" in upper right
-        printf("\n\n");
-        right_prompt("Enter choice: ");
-
-        // Save cursor position for input
-        CONSOLE_SCREEN_BUFFER_INFO csbi;
-        HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
-        GetConsoleScreenBufferInfo(hConsole, &csbi);
-        COORD inputPos = csbi.dwCursorPosition;
-
-        // Display developer copyright in lower right corner
-        display_developer_copyright();
-
-        // Return cursor to input position
-        SetConsoleCursorPosition(hConsole, inputPos);
-        scanf("%d", &choice);
-
-        switch (choice) {
-            case 1: daily_dashboard(); break;
-            case 2: view_all_users(); break;
-            case 3: {
-                int inv_choice;
-                clear_screen();
-                display_ascii_logo();
-                center_print("[*] INVENTORY MANAGEMENT");
-                print_separator();
-                center_print("1  [+]  Add Part");
-                center_print("2  [-]  Delete Part");
-                center_print("3  [*]  View Parts");
-                center_print("4  [<]  Back");
-                printf("\n");
-                center_prompt("Enter choice: ");
-                scanf("%d", &inv_choice);
-
-                switch (inv_choice) {
-                    case 1: add_part(); break;
-                    case 2: delete_part(); break;
-                    case 3: view_parts(); break;
-                    case 4: break;
-                    default:
-                        center_print("[X] Invalid choice.");
-                        printf("\n");
-                        center_print("Press any key to continue...");
-                        getchar(); getchar();
-                }
-                break;
-            }
-            case 4: view_all_orders(); break;
-            case 5: generate_invoice(admin_username, "Admin"); break;
-            case 6: {
-                int car_choice;
-                clear_screen();
-                display_ascii_logo();
-                center_print("[*] CAR MANAGEMENT");
-                print_separator();
-                center_print("1  [+]  Add Car");
-                center_print("2  [*]  View Cars");
-                center_print("3  [-]  Remove Car");
-                center_print("4  [*]  Modify Car");
-                center_print("5  [<]  Back");
-                printf("\n");
-                center_prompt("Enter choice: ");
-                scanf("%d", &car_choice);
-
-                switch (car_choice) {
-                    case 1: add_car(); break;
-                    case 2: view_cars(); break;
-                    case 3: delete_car(); break;
-                    case 4: modify_car(); break;
-                    case 5: break;
-                    default:
-                        center_print("[X] Invalid choice.");
-                        printf("\n");
-                        center_print("Press any key to continue...");
-                        getchar(); getchar();
-                }
-                break;
-            }
-            case 7: manage_discounts(); break;
-            case 8: manage_appointments(); break;
-            case 9: view_not_available_parts(); break;
-            case 10: view_car_parking(); break;
-            case 11: system_statistics(); break;
-            case 12: admin_loyalty_dashboard(); break;
-            case 13:
-                center_print("[*] Admin logged out successfully.");
-                printf("\n");
-                center_print("[*] Thank you for using Smart Garage Management System!");
-                center_print("Goodbye!");
-                printf("\n");
-                center_print("Press any key to continue...");
-                getchar(); getchar();
-                return;
-            default:
-                center_print("[X] Invalid choice.");
-                printf("\n");
-                center_print("Press any key to continue...");
-                getchar(); getchar();
-        }
-    }
-}
-
-/**
- * Initialize default discount codes
- */
-void initialize_default_discounts() {
-    FILE *f = fopen(DISCOUNTS_FILE, "r");
-    if (f) {
-        fclose(f);
-        return; // File exists, don't overwrite
-    }
-
-    f = fopen(DISCOUNTS_FILE, "w");
-    if (f) {
-        fprintf(f, "OFF10 10.0\n");
-        fprintf(f, "OFF25 25.0\n");
-        fprintf(f, "OFF50 50.0\n");
-        fprintf(f, "SAVE15 15.0\n");
-        fprintf(f, "WELCOME20 20.0\n");
-        fclose(f);
-    }
-}
-
-/**
- * Apply promo code and return discounted amount
- */
-float apply_promo_code(float total_amount) {
-    char promo_code[20];
-
-    printf("\n");
-    center_prompt("Enter promo code (or 'SKIP' to skip): ");
-    scanf("%s", promo_code);
-
-    if (strcmp(promo_code, "SKIP") == 0 || strcmp(promo_code, "skip") == 0) {
-        return total_amount;
-    }
-
-    // Remove % symbol if present at the end
-    int len = strlen(promo_code);
-    if (len > 0 && promo_code[len-1] == '%') {
-        promo_code[len-1] = '\0';
-    }
-
-    FILE *f = fopen(DISCOUNTS_FILE, "r");
-    if (!f) {
-        center_print("[X] Discount system not available.");
-        return total_amount;
-    }
-
-    char code[20];
-    float discount_percent;
-    int found = 0;
-
-    while (fscanf(f, "%s %f", code, &discount_percent) == 2) {
-        if (strcmp(code, promo_code) == 0) {
-            found = 1;
-            break;
-        }
-    }
-    fclose(f);
-
-    // Check for loyalty codes (LOYAL2024, etc.)
-    if (!found && strstr(promo_code, "LOYAL") != NULL) {
-        // Special loyalty codes get 10% discount
-        found = 1;
-        discount_percent = 10.0;
-    }
-
-    if (found) {
-        float discount_amount = total_amount * (discount_percent / 100.0f);
-        float final_amount = total_amount - discount_amount;
-
-        char discount_msg[100];
-        sprintf(discount_msg, "[*] Promo Code Applied: %s (%.0f%% OFF)", promo_code, discount_percent);
-        center_print(discount_msg);
-
-        sprintf(discount_msg, "[*] Discount Amount: $%.2f", discount_amount);
-        center_print(discount_msg);
-
-        sprintf(discount_msg, "[$] Final Amount: $%.2f", final_amount);
-        center_print(discount_msg);
-
-        return final_amount;
-    } else {
-        center_print("[X] Invalid promo code! No discount applied.");
-        return total_amount;
-    }
-}
-
-/**
- * Apply loyalty points discount
- */
-float apply_loyalty_discount(const char *username, float current_amount, float *discount_applied) {
-    *discount_applied = 0;
-
-    // Check user's current loyalty points
-    FILE *f = fopen(LOYALTY_POINTS_FILE, "r");
-    if (!f) {
-        printf("\n");
-        center_print("[-] No loyalty points available.");
-        return current_amount;
-    }
-
-    char user[30];
-    int current_points = 0, found = 0;
-
-    while (fscanf(f, "%s %d", user, &current_points) == 2) {
-        if (strcmp(user, username) == 0) {
-            found = 1;
-            break;
-        }
-    }
-    fclose(f);
-
-    if (!found || current_points == 0) {
-        printf("\n");
-        center_print("[-] No loyalty points available for redemption.");
-        return current_amount;
-    }
-
-    // Show loyalty redemption options
-    printf("\n");
-    center_print("[LOYALTY] REDEEM LOYALTY POINTS:");
-    char points_msg[100];
-    sprintf(points_msg, "Available Points: %d", current_points);
-    center_print(points_msg);
-
-    printf("\n");
-    center_print("Redemption Options:");
-    if (current_points >= 100) center_print("1. Use 100 points -> $5 discount");
-    if (current_points >= 200) center_print("2. Use 200 points -> $12 discount");
-    if (current_points >= 500) center_print("3. Use 500 points -> $30 discount");
-    center_print("4. Skip loyalty redemption");
-
-    printf("\n");
-    center_prompt("Choose option: ");
-    int choice;
-    scanf("%d", &choice);
-
-    int points_needed = 0;
-    float discount = 0;
-
-    switch (choice) {
-        case 1:
-            if (current_points >= 100) {
-                points_needed = 100;
-                discount = 5.0;
-            } else {
-                center_print("[X] Insufficient points!");
-                return current_amount;
-            }
-            break;
-        case 2:
-            if (current_points >= 200) {
-                points_needed = 200;
-                discount = 12.0;
-            } else {
-                center_print("[X] Insufficient points!");
-                return current_amount;
-            }
-            break;
-        case 3:
-            if (current_points >= 500) {
-                points_needed = 500;
-                discount = 30.0;
-            } else {
-                center_print("[X] Insufficient points!");
-                return current_amount;
-            }
-            break;
-        case 4:
-            return current_amount;
-        default:
-            center_print("[X] Invalid choice!");
-            return current_amount;
-    }
-
-    // Apply discount (but don't make price negative)
-    if (discount > current_amount) {
-        discount = current_amount;
-    }
-
-    // Deduct points from user account
-    FILE *temp = fopen("temp_loyalty.txt", "w");
-    f = fopen(LOYALTY_POINTS_FILE, "r");
-
-    while (fscanf(f, "%s %d", user, &current_points) == 2) {
-        if (strcmp(user, username) == 0) {
-            fprintf(temp, "%s %d\n", user, current_points - points_needed);
-        } else {
-            fprintf(temp, "%s %d\n", user, current_points);
-        }
-    }
-    fclose(f);
-    fclose(temp);
-
-    remove(LOYALTY_POINTS_FILE);
-    rename("temp_loyalty.txt", LOYALTY_POINTS_FILE);
-
-    // Record redemption
-    FILE *redemption = fopen(REDEMPTION_HISTORY_FILE, "a");
-    if (redemption) {
-        time_t now = time(NULL);
-        struct tm *local = localtime(&now);
-        fprintf(redemption, "%s %d %.2f %02d/%02d/%04d\n",
-                username, points_needed, discount,
-                local->tm_mday, local->tm_mon + 1, local->tm_year + 1900);
-        fclose(redemption);
-    }
-
-    *discount_applied = discount;
-
-    char success_msg[100];
-    sprintf(success_msg, "[+] Used %d loyalty points for $%.2f discount!", points_needed, discount);
-    center_print(success_msg);
-
-    return current_amount - discount;
-}
-
-/**
- * Add new discount code
- */
-void add_discount() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[+] ADD NEW DISCOUNT CODE");
-    print_separator();
-
-    FILE *f = fopen(DISCOUNTS_FILE, "a");
-    if (!f) {
-        center_print("[X] Error opening discounts file.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char code[20];
-    float percent;
-
-    printf("\n");
-    center_prompt("Promo Code: ");
-    scanf("%s", code);
-
-    center_prompt("Discount Percentage (0-100): ");
-    scanf("%f", &percent);
-
-    if (percent < 0 || percent > 100) {
-        center_print("[X] Invalid discount percentage! Must be 0-100.");
-        fclose(f);
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    fprintf(f, "%s %.1f\n", code, percent);
-    fclose(f);
-
-    printf("\n");
-    center_print("[+] Discount code added successfully!");
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * View all discount codes
- */
-void view_discounts() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] AVAILABLE DISCOUNT CODES");
-    print_separator();
-
-    FILE *f = fopen(DISCOUNTS_FILE, "r");
-    if (!f) {
-        center_print("[-] No discount codes found.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char code[20];
-    float percent;
-
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-30)/2, "");
-    printf("%-15s %s\n", "PROMO CODE", "DISCOUNT (%)");
-    printf("%*s", (CONSOLE_WIDTH-30)/2, "");
-    for (int i = 0; i < 30; i++) printf("-");
-    printf("\n");
-
-    while (fscanf(f, "%s %f", code, &percent) == 2) {
-        printf("%*s", (CONSOLE_WIDTH-30)/2, "");
-        printf("%-15s %.1f%%\n", code, percent);
-    }
-    fclose(f);
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Delete discount code
- */
-void delete_discount() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[-] DELETE DISCOUNT CODE");
-    print_separator();
-
-    FILE *f = fopen(DISCOUNTS_FILE, "r");
-    if (!f) {
-        center_print("[-] No discount codes found.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    FILE *temp = fopen("temp_discounts.txt", "w");
-    if (!temp) {
-        center_print("[X] Error creating temporary file.");
-        fclose(f);
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char target_code[20], code[20];
-    float percent;
-    int found = 0;
-
-    printf("\n");
-    center_prompt("Enter promo code to delete: ");
-    scanf("%s", target_code);
-
-    while (fscanf(f, "%s %f", code, &percent) == 2) {
-        if (strcmp(code, target_code) != 0) {
-            fprintf(temp, "%s %.1f\n", code, percent);
-        } else {
-            found = 1;
-        }
-    }
-
-    fclose(f);
-    fclose(temp);
-    remove(DISCOUNTS_FILE);
-    rename("temp_discounts.txt", DISCOUNTS_FILE);
-
-    printf("\n");
-    if (found)
-        center_print("[+] Discount code deleted successfully!");
-    else
-        center_print("[X] Discount code not found.");
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Manage discount codes (Admin only)
- */
-void manage_discounts() {
-    int choice;
-
-    while (1) {
-        clear_screen();
-        display_ascii_logo();
-        center_print("[%] DISCOUNT MANAGEMENT");
-        print_separator();
-
-        center_print("1  [+]  Add Discount Code");
-        center_print("2  [*]  View All Discounts");
-        center_print("3  [-]  Delete Discount Code");
-        center_print("4  [<]  Back to Admin Panel");
-
-        printf("\n");
-        printf("%*s", (CONSOLE_WIDTH-20)/2, "");
-        printf("Enter choice: ");
-        scanf("%d", &choice);
-
-        switch (choice) {
-            case 1: add_discount(); break;
-            case 2: view_discounts(); break;
-            case 3: delete_discount(); break;
-            case 4: return;
-            default:
-                center_print("[X] Invalid choice.");
-                printf("\n");
-                center_print("Press any key to continue...");
-                getchar(); getchar();
-        }
-    }
-}
-
-/**
- * Add new mechanic
- */
-void add_mechanic() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[+] ADD NEW MECHANIC");
-    print_separator();
-
-    FILE *f = fopen(MECHANICS_FILE, "a");
-    if (!f) {
-        center_print("[X] Error opening mechanics file.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char name[50], phone[20], username[30], password[30];
-    int age;
-
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
-    printf("Mechanic Name: ");
-    scanf("%s", name);
-
-    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
-    printf("Username: ");
-    scanf("%s", username);
-
-    // Validate and get strong password
-    while (1) {
-        printf("\n");
-        center_print("Password Requirements:");
-        center_print("- At least 4 characters");
-        center_print("- 1 uppercase letter (A-Z)");
-        center_print("- 1 lowercase letter (a-z)");
-        center_print("- 1 number (0-9)");
-        center_print("- 1 special character (@#$%&*!?+-=_)");
-        printf("\n");
-        printf("%*s", (CONSOLE_WIDTH-20)/2, "");
-        printf("Password: ");
-        get_hidden_password(password, sizeof(password));
-
-        if (validate_strong_password(password)) {
-            break;
-        } else {
-            printf("\n");
-            center_print("[X] Password does not meet requirements!");
-            center_print("Must have: 1 uppercase, 1 lowercase, 1 number, 1 special char");
-            printf("\n");
-        }
-    }
-
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-20)/2, "");
-    printf("Age: ");
-    scanf("%d", &age);
-
-    // Validate and get phone
-    while (1) {
-        printf("%*s", (CONSOLE_WIDTH-30)/2, "");
-        printf("Phone (01XXXXXXXXX): ");
-        scanf("%s", phone);
-
-        if (validate_phone(phone)) {
-            break;
-        } else {
-            center_print("[X] Invalid phone number!");
-            center_print("Must start with 01 and be exactly 11 digits.");
-        }
-    }
-
-    fprintf(f, "%s %s %s %d %s\n", name, username, password, age, phone);
-    fclose(f);
-
-    printf("\n");
-    center_print("[+] Mechanic added successfully!");
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * View all mechanics
- */
-void view_mechanics() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] AVAILABLE MECHANICS");
-    print_separator();
-
-    FILE *f = fopen(MECHANICS_FILE, "r");
-    if (!f) {
-        center_print("[-] No mechanics found.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char name[50], phone[20], username[30], password[30];
-    int age;
-
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-    printf("%-20s %-15s %-5s %s\n", "MECHANIC NAME", "USERNAME", "AGE", "PHONE");
-    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-    for (int i = 0; i < 60; i++) printf("-");
-    printf("\n");
-
-    while (fscanf(f, "%s %s %s %d %s", name, username, password, &age, phone) == 5) {
-        printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-        printf("%-20s %-15s %-5d %s\n", name, username, age, phone);
-    }
-    fclose(f);
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Delete mechanic
- */
-void delete_mechanic() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[-] DELETE MECHANIC");
-    print_separator();
-
-    FILE *f = fopen(MECHANICS_FILE, "r");
-    if (!f) {
-        center_print("[-] No mechanics found.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    FILE *temp = fopen("temp_mechanics.txt", "w");
-    if (!temp) {
-        center_print("[X] Error creating temporary file.");
-        fclose(f);
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char target_name[50], name[50], username[30], password[30], phone[20];
-    int age, found = 0;
-
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-30)/2, "");
-    printf("Enter mechanic name to delete: ");
-    scanf("%s", target_name);
-
-    while (fscanf(f, "%s %s %s %d %s", name, username, password, &age, phone) == 5) {
-        if (strcmp(name, target_name) != 0) {
-            fprintf(temp, "%s %s %s %d %s\n", name, username, password, age, phone);
-        } else {
-            found = 1;
-        }
-    }
-
-    fclose(f);
-    fclose(temp);
-    remove(MECHANICS_FILE);
-    rename("temp_mechanics.txt", MECHANICS_FILE);
-
-    printf("\n");
-    if (found)
-        center_print("[+] Mechanic deleted successfully!");
-    else
-        center_print("[X] Mechanic not found.");
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Assign mechanic to customer order
- */
-void assign_mechanic_to_order() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] ASSIGN MECHANIC TO ORDER");
-    print_separator();
-
-    // First show all orders
-    FILE *orders = fopen(ORDERS_FILE, "r");
-    if (!orders) {
-        center_print("[-] No orders found.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    printf("\n");
-    center_print("[*] AVAILABLE ORDERS:");
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-    printf("%-15s %-15s %-10s %s\n", "CUSTOMER", "PART", "QUANTITY", "TOTAL ($)");
-    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-    for (int i = 0; i < 60; i++) printf("-");
-    printf("\n");
-
-    char user[30], part[50];
-    int quantity;
-    float total;
-    int order_count = 0;
-
-    while (fscanf(orders, "%s %s %d %f", user, part, &quantity, &total) == 4) {
-        order_count++;
-        printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-        printf("%-15s %-15s %-10d $%.2f\n", user, part, quantity, total);
-    }
-    fclose(orders);
-
-    if (order_count == 0) {
-        center_print("[-] No orders available for assignment.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    // Show available mechanics
-    printf("\n");
-    center_print("[*] AVAILABLE MECHANICS:");
-
-    FILE *mechanics_display = fopen(MECHANICS_FILE, "r");
-    if (mechanics_display) {
-        char mech_name_display[50], mech_username_display[30], mech_password_display[30], mech_phone_display[20];
-        int mech_age_display;
-
-        printf("\n");
-        printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-        printf("%-20s %-15s %-5s %s\n", "MECHANIC NAME", "USERNAME", "AGE", "PHONE");
-        printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-        for (int i = 0; i < 60; i++) printf("-");
-        printf("\n");
-
-        while (fscanf(mechanics_display, "%s %s %s %d %s", mech_name_display, mech_username_display, mech_password_display, &mech_age_display, mech_phone_display) == 5) {
-            printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-            printf("%-20s %-15s %-5d %s\n", mech_name_display, mech_username_display, mech_age_display, mech_phone_display);
-        }
-        fclose(mechanics_display);
-    }
-
-    // Get assignment details
-    char customer[30], part_name[50], mechanic_username[30];
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
-    printf("Customer username: ");
-    scanf("%s", customer);
-
-    printf("%*s", (CONSOLE_WIDTH-20)/2, "");
-    printf("Part name: ");
-    scanf("%s", part_name);
-
-    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
-    printf("Mechanic username: ");
-    scanf("%s", mechanic_username);
-
-    // Verify mechanic exists
-    FILE *mechanics = fopen(MECHANICS_FILE, "r");
-    if (!mechanics) {
-        center_print("[X] No mechanics available.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char mech_name[50], mech_username[30], mech_password[30], mech_phone[20];
-    int mech_age, mechanic_found = 0;
-
-    while (fscanf(mechanics, "%s %s %s %d %s", mech_name, mech_username, mech_password, &mech_age, mech_phone) == 5) {
-        if (strcmp(mech_username, mechanic_username) == 0) {
-            mechanic_found = 1;
-            break;
-        }
-    }
-    fclose(mechanics);
-
-    if (!mechanic_found) {
-        center_print("[X] Mechanic not found!");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    // Verify order exists
-    orders = fopen(ORDERS_FILE, "r");
-    int order_found = 0;
-
-    while (fscanf(orders, "%s %s %d %f", user, part, &quantity, &total) == 4) {
-        if (strcmp(user, customer) == 0 && strcmp(part, part_name) == 0) {
-            order_found = 1;
-            break;
-        }
-    }
-    fclose(orders);
-
-    if (!order_found) {
-        center_print("[X] Order not found!");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    // Save assignment
-    FILE *appointments = fopen(APPOINTMENTS_FILE, "a");
-    if (!appointments) {
-        center_print("[X] Error opening appointments file.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    // Get current date/time for appointment
-    time_t now = time(NULL);
-    struct tm *local = localtime(&now);
-    char date[20];
-    sprintf(date, "%04d-%02d-%02d",
-            local->tm_year + 1900, local->tm_mon + 1, local->tm_mday);
-
-    fprintf(appointments, "%s %s %s %s\n", customer, part_name, mechanic_username, date);
-    fclose(appointments);
-
-    printf("\n");
-    center_print("[+] Mechanic assigned successfully!");
-    char assignment_msg[100];
-    sprintf(assignment_msg, "[*] %s assigned to %s's %s order", mechanic_username, customer, part_name);
-    center_print(assignment_msg);
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * View all appointments/assignments
- */
-void view_appointments() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] MECHANIC ASSIGNMENTS");
-    print_separator();
-
-    FILE *f = fopen(APPOINTMENTS_FILE, "r");
-    if (!f) {
-        center_print("[-] No assignments found.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char customer[30], part[50], mechanic[50], date[20];
-
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-70)/2, "");
-    printf("%-15s %-15s %-20s %s\n", "CUSTOMER", "PART", "MECHANIC", "DATE");
-    printf("%*s", (CONSOLE_WIDTH-70)/2, "");
-    for (int i = 0; i < 70; i++) printf("-");
-    printf("\n");
-
-    while (fscanf(f, "%s %s %s %s", customer, part, mechanic, date) == 4) {
-        printf("%*s", (CONSOLE_WIDTH-70)/2, "");
-        printf("%-15s %-15s %-20s %s\n", customer, part, mechanic, date);
-    }
-    fclose(f);
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Manage appointments (Admin only)
- */
-void manage_appointments() {
-    int choice;
-
-    while (1) {
-        clear_screen();
-        display_ascii_logo();
-        center_print("[*] APPOINTMENT MANAGEMENT");
-        print_separator();
-
-        center_print("1  [+]  Add Mechanic");
-        center_print("2  [*]  View All Mechanics");
-        center_print("3  [-]  Delete Mechanic");
-        center_print("4  [*]  Assign Mechanic to Order");
-        center_print("5  [*]  View All Assignments");
-        center_print("6  [<]  Back to Admin Panel");
-
-        printf("\n");
-        printf("%*s", (CONSOLE_WIDTH-20)/2, "");
-        printf("Enter choice: ");
-        scanf("%d", &choice);
-
-        switch (choice) {
-            case 1: add_mechanic(); break;
-            case 2: view_mechanics(); break;
-            case 3: delete_mechanic(); break;
-            case 4: assign_mechanic_to_order(); break;
-            case 5: view_appointments(); break;
-            case 6: return;
-            default:
-                center_print("[X] Invalid choice.");
-                printf("\n");
-                center_print("Press any key to continue...");
-                getchar(); getchar();
-        }
-    }
-}
-
-/**
- * Mechanic Dashboard
- */
-void mechanic_dashboard(const char *mechanic_username) {
-    int choice;
-
-    while (1) {
-        clear_screen();
-
-        // Display developer copyright in lower right corner first
-        display_developer_copyright();
-
-        display_ascii_logo();
-        char welcome_msg[100];
-        sprintf(welcome_msg, "Welcome, %s (Mechanic)", mechanic_username);
-        center_print(welcome_msg);
-        center_print("[*] MECHANIC DASHBOARD");
-        print_separator();
-
-        center_print("1  [*]  View My Assigned Cars");
-        center_print("2  [*]  Car Profile Management");
-        center_print("3  [*]  Vehicle History");
-        center_print("4  [*]  Update Progress");
-        center_print("5  [*]  Set/View Deadlines");
-        center_print("6  [*]  Service Calendar");
-        center_print("7  [*]  Maintenance Reminders");
-        center_print("8  [*]  Manage Q&A");
-        center_print("9  [-]  Delete Records");
-        center_print("10 [X]  Logout");
-
-        printf("\n");
-        printf("%*s", (CONSOLE_WIDTH-20)/2, "");
-        printf("Enter choice: ");
-        scanf("%d", &choice);
-
-        switch (choice) {
-            case 1: view_assigned_cars(mechanic_username); break;
-            case 2: view_car_profile(); break;
-            case 3: view_vehicle_history(); break;
-            case 4: update_progress(); break;
-            case 5: {
-                int deadline_choice;
-                clear_screen();
-                display_ascii_logo();
-                center_print("[*] DEADLINE MANAGEMENT");
-                print_separator();
-                center_print("1  [+]  Set New Deadline");
-                center_print("2  [*]  View All Deadlines");
-                center_print("3  [<]  Back");
-                printf("\n");
-                printf("%*s", (CONSOLE_WIDTH-20)/2, "");
-                printf("Enter choice: ");
-                scanf("%d", &deadline_choice);
-
-                switch (deadline_choice) {
-                    case 1: set_deadline(); break;
-                    case 2: view_progress(); break; // This will show deadlines too
-                    case 3: break;
-                    default:
-                        center_print("[X] Invalid choice.");
-                        printf("\n");
-                        center_print("Press any key to continue...");
-                        getchar(); getchar();
-                }
-                break;
-            }
-            case 6: view_service_calendar(); break;
-            case 7: {
-                int reminder_choice;
-                clear_screen();
-                display_ascii_logo();
-                center_print("[*] MAINTENANCE REMINDERS");
-                print_separator();
-                center_print("1  [+]  Set Maintenance Reminder");
-                center_print("2  [*]  View All Reminders");
-                center_print("3  [<]  Back");
-                printf("\n");
-                printf("%*s", (CONSOLE_WIDTH-20)/2, "");
-                printf("Enter choice: ");
-                scanf("%d", &reminder_choice);
-
-                switch (reminder_choice) {
-                    case 1: set_maintenance_reminder(); break;
-                    case 2: view_maintenance_reminders(); break;
-                    case 3: break;
-                    default:
-                        center_print("[X] Invalid choice.");
-                        printf("\n");
-                        center_print("Press any key to continue...");
-                        getchar(); getchar();
-                }
-                break;
-            }
-            case 8: manage_qna(); break;
-            case 9: {
-                int delete_choice;
-                clear_screen();
-                display_ascii_logo();
-                center_print("[*] DELETE RECORDS");
-                print_separator();
-                center_print("1  [-]  Delete Progress Record");
-                center_print("2  [-]  Delete Parking Record");
-                center_print("3  [<]  Back");
-                printf("\n");
-                printf("%*s", (CONSOLE_WIDTH-20)/2, "");
-                printf("Enter choice: ");
-                scanf("%d", &delete_choice);
-
-                switch (delete_choice) {
-                    case 1: delete_progress_record(); break;
-                    case 2: delete_parking_record(); break;
-                    case 3: break;
-                    default:
-                        center_print("[X] Invalid choice.");
-                        printf("\n");
-                        center_print("Press any key to continue...");
-                        getchar(); getchar();
-                }
-                break;
-            }
-            case 10:
-                center_print("[*] Logged out successfully.");
-                printf("\n");
-                center_print("[*] Thank you for using Smart Garage Management System!");
-                center_print("Goodbye!");
-                printf("\n");
-                center_print("Press any key to continue...");
-                getchar(); getchar();
-                return;
-            default:
-                center_print("[X] Invalid choice. Please try again.");
-                printf("\n");
-                center_print("Press any key to continue...");
-                getchar(); getchar();
-        }
-    }
-}
-
-/**
- * Main menu system
- */
-void main_menu() {
-    // Initialize console width for perfect center alignment
-    get_console_width();
-
-    char logged_in_user[30], logged_in_role[20];
-    int choice, logged_in = 0;
-
-    while (1) {
-        if (!logged_in) {
-            clear_screen();
-
-            display_ascii_logo();
-            center_print("[*] MAIN MENU");
-            center_print("Please select an option:");
-            printf("\n");
-            center_print("1  [+]  Register (Customer)");
-            center_print("2  [#]  User Login");
-            center_print("3  [#]  Admin Login");
-            center_print("4  [#]  Mechanic Login");
-            center_print("5  [X]  Exit System");
-
-            // Display "Enter choice:" right below menu options with 2 line gap and center aligned
-            printf("\n\n");
-            center_prompt("Enter choice: ");
-
-            // Save cursor position for input
-            CONSOLE_SCREEN_BUFFER_INFO csbi;
-            HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
-            GetConsoleScreenBufferInfo(hConsole, &csbi);
-            COORD inputPos = csbi.dwCursorPosition;
-
-            // Display developer copyright at the very bottom right corner
-            display_developer_copyright();
-
-            // Return cursor to input position
-            SetConsoleCursorPosition(hConsole, inputPos);
-            scanf("%d", &choice);
-
-            switch (choice) {
-                case 1:
-                    register_user();
-                    break;
-                case 2:
-                    if (login_user(logged_in_user, logged_in_role)) {
-                        logged_in = 1;
-                    }
-                    break;
-                case 3:
-                    if (admin_login(logged_in_user, logged_in_role)) {
-                        admin_panel(logged_in_user);
-                    }
-                    break;
-                case 4:
-                    if (mechanic_login(logged_in_user, logged_in_role)) {
-                        mechanic_dashboard(logged_in_user);
-                    }
-                    break;
-                case 5:
-                    clear_screen();
-                    display_ascii_logo();
-                    center_print("[*] Thank you for using Smart Garage Management System!");
-                    center_print("Goodbye!");
-                    return;
-                default:
-                    center_print("[X] Invalid choice. Please try again.");
-                    printf("\n");
-                    center_print("Press any key to continue...");
-                    getchar(); getchar();
-            }
-        } else {
-            // Customer menu
-            clear_screen();
-
-            // Display developer copyright in lower right corner first
-            display_developer_copyright();
-
-            display_ascii_logo();
-            char welcome_msg[100];
-            sprintf(welcome_msg, "Welcome, %s (%s)", logged_in_user, logged_in_role);
-            center_print(welcome_msg);
-            center_print("[*] CUSTOMER DASHBOARD");
-            printf("\n");
-
-            center_print("1  [*]  View Parts");
-            center_print("2  [*]  Update Profile");
-            center_print("3  [*]  Appointment Options");
-            center_print("4  [$]  Calculate Estimation");
-            center_print("5  [*]  Generate Invoice");
-            center_print("6  [*]  Car Management");
-            center_print("7  [*]  My Service Progress");
-            center_print("8  [?]  Troubleshooting Q&A");
-            center_print("9  [*]  Maintenance Reminders");
-            center_print("10  [H]  Order History");
-            center_print("11  [QR] QR Receipts");
-            center_print("12  [REC] Smart Recommendations");
-            center_print("13  [LOYALTY] Loyalty Rewards");
-            center_print("14  [-]  Delete My Records");
-            center_print("15  [X]  Logout");
-
-            printf("\n");
-            center_prompt("Enter choice: ");
-            scanf("%d", &choice);
-
-            switch (choice) {
-                case 1: view_parts(); break;
-                case 2: update_profile(logged_in_user); break;
-                case 3: {
-                    // Appointment Options submenu
-                    int appointment_choice;
-                    while (1) {
-                        clear_screen();
-                        display_ascii_logo();
-                        center_print("[*] APPOINTMENT OPTIONS");
-                        print_separator();
-                        center_print("1  [*]  Order Parts");
-                        center_print("2  [*]  Car Parking");
-                        center_print("3  [<]  Back to Main Menu");
-
-                        printf("\n");
-                        center_prompt("Enter choice: ");
-                        scanf("%d", &appointment_choice);
-
-                        switch (appointment_choice) {
-                            case 1:
-                                order_parts(logged_in_user);
-                                break;
-                            case 2:
-                                add_car_parking(logged_in_user);
-                                break;
-                            case 3:
-                                goto exit_appointment_menu;
-                            default:
-                                center_print("[X] Invalid choice.");
-                                printf("\n");
-                                center_print("Press any key to continue...");
-                                getchar(); getchar();
-                        }
-                    }
-                    exit_appointment_menu:
-                    break;
-                }
-                case 4: calculate_estimation(logged_in_user); break;
-                case 5: generate_invoice(logged_in_user, logged_in_role); break;
-                case 6: {
-                    int car_choice;
-                    clear_screen();
-                    display_ascii_logo();
-                    center_print("[*] CAR MANAGEMENT");
-                    print_separator();
-                    center_print("1  [+]  Add Car");
-                    center_print("2  [*]  View Cars");
-                    center_print("3  [-]  Remove Car");
-                    center_print("4  [*]  Modify Car");
-                    center_print("5  [*]  View Parking Data");
-                    center_print("6  [<]  Back");
-                    printf("\n");
-                    center_prompt("Enter choice: ");
-                    scanf("%d", &car_choice);
-
-                    switch (car_choice) {
-                        case 1: add_car(); break;
-                        case 2: view_cars(); break;
-                        case 3: delete_car(); break;
-                        case 4: modify_car(); break;
-                        case 5: view_car_parking(); break;
-                        case 6: break;
-                        default:
-                            center_print("[X] Invalid choice.");
-                            printf("\n");
-                            center_print("Press any key to continue...");
-                            getchar(); getchar();
-                    }
-                    break;
-                }
-                case 7: {
-                    // Customer view progress
-                    char car_number[20];
-                    printf("\n");
-                    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
-                    printf("Enter your car number: ");
-                    scanf("%s", car_number);
-
-                    // Show progress
-                    clear_screen();
-                    display_ascii_logo();
-                    center_print("[*] MY SERVICE PROGRESS");
-                    print_separator();
-
-                    FILE *f = fopen(PROGRESS_FILE, "r");
-                    if (f) {
-                        char line[300], stored_car[20], date[20], percentage[10], description[100];
-                        int found = 0;
-
-                        printf("\n");
-                        center_print("=== SERVICE PROGRESS ===");
-                        while (fgets(line, sizeof(line), f)) {
-                            sscanf(line, "%s %s %s %s", stored_car, date, percentage, description);
-                            if (strcmp(stored_car, car_number) == 0) {
-                                printf("%*s", (CONSOLE_WIDTH-50)/2, "");
-                                printf("%s - %s: %s\n", date, percentage, description);
-                                found = 1;
-                            }
-                        }
-
-                        if (!found) {
-                            center_print("[!] No service records found for this car.");
-                        }
-                        fclose(f);
-                    } else {
-                        center_print("[!] No progress data available.");
-                    }
-
-                    // Show deadlines
-                    printf("\n");
-                    center_print("=== SERVICE DEADLINES ===");
-                    f = fopen(DEADLINES_FILE, "r");
-                    if (f) {
-                        char line[200], stored_car[20], deadline[20], service[50];
-                        int found = 0;
-
-                        while (fgets(line, sizeof(line), f)) {
-                            sscanf(line, "%s %s %s", stored_car, deadline, service);
-                            if (strcmp(stored_car, car_number) == 0) {
-                                printf("%*s", (CONSOLE_WIDTH-40)/2, "");
-                                printf("%s: %s\n", service, deadline);
-                                found = 1;
-                            }
-                        }
-
-                        if (!found) {
-                            center_print("[!] No deadlines set for this car.");
-                        }
-                        fclose(f);
-                    }
-
-                    printf("\n");
-                    center_print("Press any key to continue...");
-                    getchar(); getchar();
-                    break;
-                }
-                case 8:
-                    customer_view_qna();
-                    break;
-                case 9:
-                    customer_view_maintenance_reminders();
-                    break;
-                case 10:
-                    view_order_history(logged_in_user);
-                    break;
-                case 11:
-                    view_qr_receipts(logged_in_user);
-                    break;
-                case 12:
-                    smart_parts_recommendation(logged_in_user);
-                    break;
-                case 13:
-                    loyalty_system_menu(logged_in_user);
-                    break;
-                case 14: {
-                    // Delete Records submenu
-                    int delete_choice;
-                    clear_screen();
-                    display_ascii_logo();
-                    center_print("[*] DELETE MY RECORDS");
-                    print_separator();
-                    center_print("1  [-]  Delete Order History");
-                    center_print("2  [<]  Back");
-                    printf("\n");
-                    printf("%*s", (CONSOLE_WIDTH-20)/2, "");
-                    printf("Enter choice: ");
-                    scanf("%d", &delete_choice);
-
-                    switch (delete_choice) {
-                        case 1: delete_order_history(logged_in_user); break;
-                        case 2: break;
-                        default:
-                            center_print("[X] Invalid choice.");
-                            printf("\n");
-                            center_print("Press any key to continue...");
-                            getchar(); getchar();
-                    }
-                    break;
-                }
-                case 15:
-                    logged_in = 0;
-                    center_print("[*] Logged out successfully.");
-                    printf("\n");
-                    center_print("[*] Thank you for using Smart Garage Management System!");
-                    center_print("Goodbye!");
-                    printf("\n");
-                    center_print("Press any key to continue...");
-                    getchar(); getchar();
-                    break;
-                default:
-                    center_print("[X] Invalid choice. Please try again.");
-                    printf("\n");
-                    center_print("Press any key to continue...");
-                    getchar(); getchar();
-            }
-        }
-    }
-}
-
-// ==================== MECHANIC DASHBOARD FUNCTIONS ====================
-
-/**
- * View cars assigned to specific mechanic
- */
-void view_assigned_cars(const char *mechanic_username) {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] MY ASSIGNED CARS");
-    print_separator();
-
-    FILE *f = fopen(APPOINTMENTS_FILE, "r");
-    if (!f) {
-        center_print("[!] No assignments found.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char line[200], assigned_mechanic[50], car_number[20], order_id[20];
-    int found = 0;
-
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-50)/2, "");
-    printf("%-15s %-15s %s\n", "ORDER ID", "CAR NUMBER", "ASSIGNED TO");
-    printf("%*s", (CONSOLE_WIDTH-50)/2, "");
-    for (int i = 0; i < 50; i++) printf("-");
-    printf("\n");
-
-    while (fgets(line, sizeof(line), f)) {
-        sscanf(line, "%s %s %s", order_id, car_number, assigned_mechanic);
-        if (strcmp(assigned_mechanic, mechanic_username) == 0) {
-            printf("%*s", (CONSOLE_WIDTH-50)/2, "");
-            printf("%-15s %-15s %s\n", order_id, car_number, assigned_mechanic);
-            found = 1;
-        }
-    }
-
-    if (!found) {
-        center_print("[!] No cars assigned to you.");
-    }
-
-    fclose(f);
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * View and manage car profiles
- */
-void view_car_profile() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] CAR PROFILE MANAGEMENT");
-    print_separator();
-
-    int choice;
-    center_print("1  [*]  View Car Profile");
-    center_print("2  [+]  Add Car Profile");
-    center_print("3  [-]  Delete Car Profile");
-    center_print("4  [<]  Back");
-
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-20)/2, "");
-    printf("Enter choice: ");
-    scanf("%d", &choice);
-
-    switch (choice) {
-        case 1: {
-            char car_number[20];
-            printf("\n");
-            printf("%*s", (CONSOLE_WIDTH-25)/2, "");
-            printf("Enter Car Number: ");
-            scanf("%s", car_number);
-
-            FILE *f = fopen(CAR_PROFILES_FILE, "r");
-            if (!f) {
-                center_print("[!] No car profiles found.");
-                printf("\n");
-                center_print("Press any key to continue...");
-                getchar(); getchar();
-                return;
-            }
-
-            char line[300], stored_car[20], owner[50], model[50], engine[50];
-            int found = 0;
-
-            while (fgets(line, sizeof(line), f)) {
-                sscanf(line, "%s %s %s %s", stored_car, owner, model, engine);
-                if (strcmp(stored_car, car_number) == 0) {
-                    printf("\n");
-                    center_print("=== CAR PROFILE ===");
-                    printf("%*s", (CONSOLE_WIDTH-40)/2, "");
-                    printf("Car Number: %s\n", stored_car);
-                    printf("%*s", (CONSOLE_WIDTH-40)/2, "");
-                    printf("Owner: %s\n", owner);
-                    printf("%*s", (CONSOLE_WIDTH-40)/2, "");
-                    printf("Model: %s\n", model);
-                    printf("%*s", (CONSOLE_WIDTH-40)/2, "");
-                    printf("Engine: %s\n", engine);
-                    found = 1;
-                    break;
-                }
-            }
-
-            if (!found) {
-                center_print("[!] Car profile not found.");
-            }
-
-            fclose(f);
-            break;
-        }
-        case 2: {
-            char car_number[20];
-            printf("\n");
-            printf("%*s", (CONSOLE_WIDTH-25)/2, "");
-            printf("Enter Car Number: ");
-            scanf("%s", car_number);
-            add_car_profile(car_number);
-            break;
-        }
-        case 3: {
-            delete_car_profile();
-            break;
-        }
-        case 4:
-            return;
-        default:
-            center_print("[X] Invalid choice.");
-    }
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Add car profile
- */
-void add_car_profile(const char *car_number) {
-    FILE *f = fopen(CAR_PROFILES_FILE, "a");
-    if (!f) {
-        center_print("[X] Error opening car profiles file.");
-        return;
-    }
-
-    char owner[50], model[50], engine[50];
-
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
-    printf("Owner Name: ");
-    scanf("%s", owner);
-
-    printf("%*s", (CONSOLE_WIDTH-20)/2, "");
-    printf("Car Model: ");
-    scanf("%s", model);
-
-    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
-    printf("Engine Number: ");
-    scanf("%s", engine);
-
-    fprintf(f, "%s %s %s %s\n", car_number, owner, model, engine);
-    fclose(f);
-
-    // Auto-add initial service progress
-    auto_add_service_progress(car_number, "CAR_ADDED");
-
-    center_print("[+] Car profile added successfully!");
-    center_print("[+] Initial service progress recorded!");
-}
-
-/**
- * View vehicle service history
- */
-void view_vehicle_history() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] VEHICLE SERVICE HISTORY");
-    print_separator();
-
-    char car_number[20];
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
-    printf("Enter Car Number: ");
-    scanf("%s", car_number);
-
-    FILE *f = fopen(VEHICLE_HISTORY_FILE, "r");
-    if (!f) {
-        center_print("[!] No service history found.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char line[300], stored_car[20], date[20], service[100], problem[100];
-    int found = 0;
-
-    printf("\n");
-    center_print("=== SERVICE HISTORY ===");
-    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-    printf("%-12s %-20s %s\n", "DATE", "SERVICE", "PROBLEM");
-    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-    for (int i = 0; i < 60; i++) printf("-");
-    printf("\n");
-
-    while (fgets(line, sizeof(line), f)) {
-        sscanf(line, "%s %s %s %s", stored_car, date, service, problem);
-        if (strcmp(stored_car, car_number) == 0) {
-            printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-            printf("%-12s %-20s %s\n", date, service, problem);
-            found = 1;
-        }
-    }
-
-    if (!found) {
-        center_print("[!] No service history for this car.");
-    }
-
-    fclose(f);
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Update service progress
- */
-void update_progress() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] UPDATE SERVICE PROGRESS");
-    print_separator();
-
-    char car_number[20], progress[100];
-    int percentage;
-
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
-    printf("Car Number: ");
-    scanf("%s", car_number);
-
-    printf("%*s", (CONSOLE_WIDTH-30)/2, "");
-    printf("Progress Percentage (0-100): ");
-    scanf("%d", &percentage);
-
-    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
-    printf("Progress Description: ");
-    getchar(); // consume newline
-    fgets(progress, sizeof(progress), stdin);
-    progress[strcspn(progress, "\n")] = '\0'; // remove newline
-
-    FILE *f = fopen(PROGRESS_FILE, "a");
-    if (!f) {
-        center_print("[X] Error opening progress file.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    time_t now = time(NULL);
-    struct tm *local = localtime(&now);
-    char date[20];
-    sprintf(date, "%04d-%02d-%02d", local->tm_year + 1900, local->tm_mon + 1, local->tm_mday);
-
-    fprintf(f, "%s %s %d%% %s\n", car_number, date, percentage, progress);
-    fclose(f);
-
-    center_print("[+] Progress updated successfully!");
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * View progress and deadlines
- */
-void view_progress() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] SERVICE PROGRESS & DEADLINES");
-    print_separator();
-
-    char car_number[20];
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
-    printf("Enter Car Number: ");
-    scanf("%s", car_number);
-
-    // Show Progress
-    printf("\n");
-    center_print("=== PROGRESS HISTORY ===");
-    FILE *f = fopen(PROGRESS_FILE, "r");
-    if (f) {
-        char line[300], stored_car[20], date[20], percentage[10], description[100];
-        int found = 0;
-
-        while (fgets(line, sizeof(line), f)) {
-            sscanf(line, "%s %s %s %s", stored_car, date, percentage, description);
-            if (strcmp(stored_car, car_number) == 0) {
-                printf("%*s", (CONSOLE_WIDTH-50)/2, "");
-                printf("%s - %s: %s\n", date, percentage, description);
-                found = 1;
-            }
-        }
-
-        if (!found) {
-            center_print("[!] No progress records found.");
-        }
-        fclose(f);
-    }
-
-    // Show Deadlines
-    printf("\n");
-    center_print("=== DEADLINES ===");
-    f = fopen(DEADLINES_FILE, "r");
-    if (f) {
-        char line[200], stored_car[20], deadline[20], service[50];
-        int found = 0;
-
-        while (fgets(line, sizeof(line), f)) {
-            sscanf(line, "%s %s %s", stored_car, deadline, service);
-            if (strcmp(stored_car, car_number) == 0) {
-                printf("%*s", (CONSOLE_WIDTH-40)/2, "");
-                printf("%s: %s\n", service, deadline);
-                found = 1;
-            }
-        }
-
-        if (!found) {
-            center_print("[!] No deadlines set.");
-        }
-        fclose(f);
-    }
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Set service deadline
- */
-void set_deadline() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] SET SERVICE DEADLINE");
-    print_separator();
-
-    char car_number[20], deadline[20], service[50];
-
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
-    printf("Car Number: ");
-    scanf("%s", car_number);
-
-    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
-    printf("Service Type: ");
-    scanf("%s", service);
-
-    printf("%*s", (CONSOLE_WIDTH-35)/2, "");
-    printf("Deadline (YYYY-MM-DD): ");
-    scanf("%s", deadline);
-
-    FILE *f = fopen(DEADLINES_FILE, "a");
-    if (!f) {
-        center_print("[X] Error opening deadlines file.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    fprintf(f, "%s %s %s\n", car_number, deadline, service);
-    fclose(f);
-
-    center_print("[+] Deadline set successfully!");
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * View service calendar
- */
-void view_service_calendar() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] SERVICE CALENDAR");
-    print_separator();
-
-    FILE *f = fopen(SERVICE_CALENDAR_FILE, "r");
-    if (!f) {
-        center_print("[!] No service events found.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char line[200], date[20], car[20], service[50];
-
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-50)/2, "");
-    printf("%-12s %-15s %s\n", "DATE", "CAR", "SERVICE");
-    printf("%*s", (CONSOLE_WIDTH-50)/2, "");
-    for (int i = 0; i < 50; i++) printf("-");
-    printf("\n");
-
-    while (fgets(line, sizeof(line), f)) {
-        sscanf(line, "%s %s %s", date, car, service);
-        printf("%*s", (CONSOLE_WIDTH-50)/2, "");
-        printf("%-12s %-15s %s\n", date, car, service);
-    }
-
-    fclose(f);
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Set maintenance reminder
- */
-void set_maintenance_reminder() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] SET MAINTENANCE REMINDER");
-    print_separator();
-
-    char car_number[20], reminder_date[20], service_type[50];
-
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
-    printf("Car Number: ");
-    scanf("%s", car_number);
-
-    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
-    printf("Service Type: ");
-    scanf("%s", service_type);
-
-    printf("%*s", (CONSOLE_WIDTH-35)/2, "");
-    printf("Reminder Date (YYYY-MM-DD): ");
-    scanf("%s", reminder_date);
-
-    FILE *f = fopen(MAINTENANCE_REMINDERS_FILE, "a");
-    if (!f) {
-        center_print("[X] Error opening reminders file.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    fprintf(f, "%s %s %s\n", car_number, reminder_date, service_type);
-    fclose(f);
-
-    center_print("[+] Maintenance reminder set successfully!");
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * View maintenance reminders
- */
-void view_maintenance_reminders() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] MAINTENANCE REMINDERS");
-    print_separator();
-
-    FILE *f = fopen(MAINTENANCE_REMINDERS_FILE, "r");
-    if (!f) {
-        center_print("[!] No reminders found.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char line[200], car[20], date[20], service[50];
-
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-50)/2, "");
-    printf("%-15s %-12s %s\n", "CAR", "DATE", "SERVICE");
-    printf("%*s", (CONSOLE_WIDTH-50)/2, "");
-    for (int i = 0; i < 50; i++) printf("-");
-    printf("\n");
-
-    while (fgets(line, sizeof(line), f)) {
-        sscanf(line, "%s %s %s", car, date, service);
-        printf("%*s", (CONSOLE_WIDTH-50)/2, "");
-        printf("%-15s %-12s %s\n", car, date, service);
-    }
-
-    fclose(f);
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Customer view maintenance reminders (filtered for alerts)
- */
-void customer_view_maintenance_reminders() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] MAINTENANCE ALERTS & REMINDERS");
-    print_separator();
-
-    FILE *f = fopen(MAINTENANCE_REMINDERS_FILE, "r");
-    if (!f) {
-        center_print("[*] No maintenance reminders at this time.");
-        center_print("Your vehicle is up to date!");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char line[200], car[20], date[20], service[50];
-    int reminder_count = 0;
-
-    // Get current date for comparison
-    time_t now = time(NULL);
-    struct tm *local = localtime(&now);
-    char today[20];
-    sprintf(today, "%04d-%02d-%02d", local->tm_year + 1900, local->tm_mon + 1, local->tm_mday);
-
-    printf("\n");
-    center_print("UPCOMING MAINTENANCE SCHEDULE");
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-    printf("%-15s %-12s %s\n", "CAR", "DATE", "SERVICE");
-    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-    for (int i = 0; i < 60; i++) printf("=");
-    printf("\n");
-
-    while (fgets(line, sizeof(line), f)) {
-        if (sscanf(line, "%s %s %[^\n]", car, date, service) == 3) {
-            printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-            printf("%-15s %-12s %s\n", car, date, service);
-            reminder_count++;
-        }
-    }
-
-    if (reminder_count == 0) {
-        printf("%*s", (CONSOLE_WIDTH-40)/2, "");
-        printf("No scheduled maintenance found.\n");
-        printf("%*s", (CONSOLE_WIDTH-40)/2, "");
-        printf("Your vehicle is up to date!\n");
-    } else {
-        printf("\n");
-        center_print("TIP: Regular maintenance keeps your car running smoothly!");
-        center_print("Contact us to schedule your service appointment.");
-    }
-
-    fclose(f);
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Manage Q&A system
- */
-void manage_qna() {
-    int choice;
-
-    while (1) {
-        clear_screen();
-        display_ascii_logo();
-        center_print("[*] Q&A MANAGEMENT");
-        print_separator();
-
-        center_print("1  [+]  Add Q&A");
-        center_print("2  [*]  View All Q&A");
-        center_print("3  [<]  Back");
-
-        printf("\n");
-        printf("%*s", (CONSOLE_WIDTH-20)/2, "");
-        printf("Enter choice: ");
-        scanf("%d", &choice);
-
-        switch (choice) {
-            case 1: add_qna(); break;
-            case 2: view_qna(); break;
-            case 3: return;
-            default:
-                center_print("[X] Invalid choice.");
-                printf("\n");
-                center_print("Press any key to continue...");
-                getchar(); getchar();
-        }
-    }
-}
-
-/**
- * Add Q&A entry
- */
-void add_qna() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[+] ADD Q&A ENTRY");
-    print_separator();
-
-    char question[200], answer[300];
-
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-15)/2, "");
-    printf("Question: ");
-    getchar(); // consume newline
-    fgets(question, sizeof(question), stdin);
-    question[strcspn(question, "\n")] = '\0';
-
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-15)/2, "");
-    printf("Answer: ");
-    fgets(answer, sizeof(answer), stdin);
-    answer[strcspn(answer, "\n")] = '\0';
-
-    FILE *f = fopen(QNA_FILE, "a");
-    if (!f) {
-        center_print("[X] Error opening Q&A file.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    fprintf(f, "Q: %s\nA: %s\n---\n", question, answer);
-    fclose(f);
-
-    center_print("[+] Q&A added successfully!");
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * View all Q&A entries
- */
-void view_qna() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] Q&A DATABASE");
-    print_separator();
-
-    FILE *f = fopen(QNA_FILE, "r");
-    if (!f) {
-        center_print("[!] No Q&A entries found.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char line[500];
-    printf("\n");
-
-    while (fgets(line, sizeof(line), f)) {
-        if (strstr(line, "Q: ") == line) {
-            printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-            printf("[?] %s", line + 3);
-        } else if (strstr(line, "A: ") == line) {
-            printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-            printf("[>] %s", line + 3);
-        } else if (strstr(line, "---") == line) {
-            printf("\n");
-        }
-    }
-
-    fclose(f);
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Customer view Q&A (for customer dashboard)
- */
-void customer_view_qna() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] TROUBLESHOOTING Q&A");
-    print_separator();
-
-    FILE *f = fopen(QNA_FILE, "r");
-    if (!f) {
-        center_print("[!] No Q&A available.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char line[500];
-    int question_count = 0;
-
-    // Count questions first
-    while (fgets(line, sizeof(line), f)) {
-        if (strstr(line, "Q: ") == line) {
-            question_count++;
-        }
-    }
-    rewind(f);
-
-    if (question_count == 0) {
-        center_print("[!] No questions available.");
-        fclose(f);
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    // Display questions with numbers
-    printf("\n");
-    center_print("Available Questions:");
-    printf("\n");
-
-    int current_q = 1;
-    while (fgets(line, sizeof(line), f)) {
-        if (strstr(line, "Q: ") == line) {
-            printf("%*s", (CONSOLE_WIDTH-70)/2, "");
-            printf("%d. %s", current_q, line + 3);
-            current_q++;
-        }
-    }
-
-    // Let customer select a question
-    int choice;
-    printf("\n");
-    char prompt[50];
-    sprintf(prompt, "Select question (1-%d): ", question_count);
-    center_prompt(prompt);
-    scanf("%d", &choice);
-
-    if (choice < 1 || choice > question_count) {
-        center_print("[X] Invalid choice.");
-        fclose(f);
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    // Show selected Q&A
-    rewind(f);
-    current_q = 1;
-    while (fgets(line, sizeof(line), f)) {
-        if (strstr(line, "Q: ") == line) {
-            if (current_q == choice) {
-                printf("\n");
-                center_print("=== SELECTED Q&A ===");
-                printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-                printf("[?] %s", line + 3);
-
-                // Get the answer
-                if (fgets(line, sizeof(line), f) && strstr(line, "A: ") == line) {
-                    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-                    printf("[>] %s", line + 3);
-                }
-                break;
-            }
-            current_q++;
-        }
-    }
-
-    fclose(f);
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-// ==================== CAR PARKING FUNCTIONS ====================
-
-/**
- * Add car parking entry
- */
-void add_car_parking(const char *username) {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[+] CAR PARKING REGISTRATION");
-    print_separator();
-
-    char car_number[20], entry_time[20], manufacturer[50];
-
-    printf("\n");
-    center_prompt("Car Number: ");
-    scanf("%s", car_number);
-
-    center_prompt("Entry Time (HH:MM): ");
-    scanf("%s", entry_time);
-
-    center_prompt("Car Manufacturer Company: ");
-    // Clear the input buffer first
-    while (getchar() != '\n');
-    // Now read the manufacturer name
-    fgets(manufacturer, sizeof(manufacturer), stdin);
-    // Remove the trailing newline character
-    manufacturer[strcspn(manufacturer, "\n")] = '\0';
-
-    // Get current date
-    time_t now = time(NULL);
-    struct tm *local = localtime(&now);
-    char date[20];
-    sprintf(date, "%04d-%02d-%02d", local->tm_year + 1900, local->tm_mon + 1, local->tm_mday);
-
-    FILE *f = fopen(CAR_PARKING_FILE, "a");
-    if (!f) {
-        center_print("[X] Error opening car parking file.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    fprintf(f, "%s %s %s %s %s\n", username, car_number, date, entry_time, manufacturer);
-    fclose(f);
-
-    // Auto-add service progress for parking
-    auto_add_service_progress(car_number, "PARKING_BOOKED");
-
-    printf("\n");
-    center_print("[+] Car parking registered successfully!");
-    center_print("[+] Service progress updated automatically!");
-    printf("\n");
-    char parking_msg[100];
-    sprintf(parking_msg, "[*] %s parked at %s on %s", car_number, entry_time, date);
-    center_print(parking_msg);
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * View car parking records
- */
-void view_car_parking() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] CAR PARKING RECORDS");
-    print_separator();
-
-    printf("\n");
-    center_print("1  [*]  View All Parking Records");
-    center_print("2  [F]  Filter by Date");
-    center_print("3  [<]  Back to Menu");
-    printf("\n");
-
-    int choice;
-    center_prompt("Select option (1-3): ");
-    scanf("%d", &choice);
-
-    FILE *f = fopen(CAR_PARKING_FILE, "r");
-    if (!f) {
-        center_print("[!] No parking records found.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char line[300], username[30], car_number[20], date[20], entry_time[20], manufacturer[50];
-    char search_date[20];
-    int record_count = 0;
-
-    if (choice == 1) {
-        // View all parking records
-        clear_screen();
-        display_ascii_logo();
-        center_print("[*] ALL CAR PARKING RECORDS");
-        print_separator();
-
-        printf("\n");
-        printf("%*s", (CONSOLE_WIDTH-80)/2, "");
-        printf("%-12s %-12s %-12s %-8s %s\n", "CUSTOMER", "CAR NUMBER", "DATE", "TIME", "MANUFACTURER");
-        printf("%*s", (CONSOLE_WIDTH-80)/2, "");
-        for (int i = 0; i < 80; i++) printf("-");
-        printf("\n");
-
-        while (fgets(line, sizeof(line), f)) {
-            sscanf(line, "%s %s %s %s %s", username, car_number, date, entry_time, manufacturer);
-            printf("%*s", (CONSOLE_WIDTH-80)/2, "");
-            printf("%-12s %-12s %-12s %-8s %s\n", username, car_number, date, entry_time, manufacturer);
-            record_count++;
-        }
-
-        if (record_count == 0) {
-            center_print("[!] No parking records found.");
-        }
-
-    } else if (choice == 2) {
-        // Filter by date
-        printf("\n");
-        center_prompt("Enter date to search (format: Mon Aug 09 or just Aug 09): ");
-        getchar(); // Clear buffer
-        fgets(search_date, sizeof(search_date), stdin);
-        search_date[strcspn(search_date, "\n")] = 0; // Remove newline
-
-        clear_screen();
-        display_ascii_logo();
-        center_print("[F] FILTERED PARKING RECORDS BY DATE");
-        print_separator();
-        printf("\n");
-        char filter_msg[100];
-        sprintf(filter_msg, "Showing parking records for: %s", search_date);
-        center_print(filter_msg);
-        printf("\n");
-
-        printf("%*s", (CONSOLE_WIDTH-80)/2, "");
-        printf("%-12s %-12s %-12s %-8s %s\n", "CUSTOMER", "CAR NUMBER", "DATE", "TIME", "MANUFACTURER");
-        printf("%*s", (CONSOLE_WIDTH-80)/2, "");
-        for (int i = 0; i < 80; i++) printf("-");
-        printf("\n");
-
-        while (fgets(line, sizeof(line), f)) {
-            sscanf(line, "%s %s %s %s %s", username, car_number, date, entry_time, manufacturer);
-            if (strstr(date, search_date) != NULL || strstr(line, search_date) != NULL) {
-                printf("%*s", (CONSOLE_WIDTH-80)/2, "");
-                printf("%-12s %-12s %-12s %-8s %s\n", username, car_number, date, entry_time, manufacturer);
-                record_count++;
-            }
-        }
-
-        if (record_count == 0) {
-            center_print("[!] No parking records found for the specified date.");
-        }
-
-    } else if (choice == 3) {
-        fclose(f);
-        return;
-    } else {
-        center_print("[X] Invalid choice.");
-    }
-
-    fclose(f);
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Initialize default Q&A entries
- */
-void initialize_default_qna() {
-    FILE *f = fopen(QNA_FILE, "r");
-    if (f) {
-        fclose(f);
-        return; // File exists, don't overwrite
-    }
-
-    f = fopen(QNA_FILE, "w");
-    if (f) {
-        fprintf(f, "Q: My car engine is overheating. What should I do?\n");
-        fprintf(f, "A: Turn off the AC, turn on the heater, pull over safely, turn off the engine, check coolant level (when cool), and call for help if needed.\n\n");
-
-        fprintf(f, "Q: My car won't start. What are the possible causes?\n");
-        fprintf(f, "A: Check battery connections, try jump-starting, check fuel level, ensure the gear is in Park/Neutral, and verify the starter motor.\n\n");
-
-        fprintf(f, "Q: Why are my brakes making squeaking noises?\n");
-        fprintf(f, "A: Usually indicates worn brake pads. Have them inspected immediately as this is a safety issue. May also be due to dust or moisture.\n\n");
-
-        fprintf(f, "Q: How often should I change my car's oil?\n");
-        fprintf(f, "A: Generally every 3,000-7,500 miles depending on oil type. Synthetic oil lasts longer. Check your owner's manual for specific recommendations.\n\n");
-
-        fprintf(f, "Q: My car is pulling to one side while driving. What's wrong?\n");
-        fprintf(f, "A: Could be tire pressure imbalance, wheel alignment issues, or brake problems. Check tire pressure first, then visit a mechanic.\n\n");
-
-        fprintf(f, "Q: What should I do if my car battery dies?\n");
-        fprintf(f, "A: Use jumper cables with another car, call roadside assistance, or use a portable battery pack. Replace old batteries preventively.\n\n");
-
-        fprintf(f, "Q: How can I improve my car's fuel efficiency?\n");
-        fprintf(f, "A: Maintain proper tire pressure, regular oil changes, remove excess weight, drive smoothly, and keep up with regular maintenance.\n\n");
-
-        fprintf(f, "Q: My check engine light is on. Is it serious?\n");
-        fprintf(f, "A: It varies. If blinking, stop driving immediately. If steady, get it diagnosed soon. Could range from loose gas cap to serious engine issues.\n\n");
-
-        fclose(f);
-    }
-}
-
-/**
- * Generate QR Receipt for services
- */
-void generate_qr_receipt(const char *username, const char *service_details, float amount) {
-    FILE *f = fopen(QR_RECEIPTS_FILE, "a");
-    if (!f) return;
-
-    time_t now = time(NULL);
-    struct tm *local = localtime(&now);
-    char date[20];
-    sprintf(date, "%02d/%02d/%04d", local->tm_mday, local->tm_mon + 1, local->tm_year + 1900);
-
-    // Generate simple QR code representation (text-based)
-    char qr_code[50];
-    sprintf(qr_code, "QR_%s_%ld", username, now);
-
-    fprintf(f, "%s|%s|%s|%.2f|%s\n", qr_code, username, date, amount, service_details);
-    fclose(f);
-
-    printf("\n");
-    center_print("[+] Digital QR Receipt Generated!");
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-40)/2, "");
-    printf("QR Code: %s\n", qr_code);
-    printf("%*s", (CONSOLE_WIDTH-40)/2, "");
-    printf("Scan this code to view service details\n");
-}
-
-/**
- * View QR Receipts for customer
- */
-void view_qr_receipts(const char *username) {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] YOUR QR RECEIPTS");
-    print_separator();
-
-    FILE *f = fopen(QR_RECEIPTS_FILE, "r");
-    if (!f) {
-        center_print("[-] No QR receipts found.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char qr_code[50], user[30], date[20], service_details[200];
-    float amount;
-    int found = 0;
-
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-80)/2, "");
-    printf("%-15s %-12s %-10s %s\n", "QR CODE", "DATE", "AMOUNT", "SERVICE DETAILS");
-    printf("%*s", (CONSOLE_WIDTH-80)/2, "");
-    for (int i = 0; i < 80; i++) printf("-");
-    printf("\n");
-
-    while (fscanf(f, "%[^|]|%[^|]|%[^|]|%f|%[^\n]\n", qr_code, user, date, &amount, service_details) == 5) {
-        if (strcmp(user, username) == 0) {
-            found = 1;
-            printf("%*s", (CONSOLE_WIDTH-80)/2, "");
-            printf("%-15s %-12s $%-9.2f %s\n", qr_code, date, amount, service_details);
-        }
-    }
-    fclose(f);
-
-    if (!found) {
-        center_print("[-] No QR receipts found for your account.");
-    }
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Smart Parts Recommendation System
- */
-void smart_parts_recommendation(const char *username) {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] SMART PARTS RECOMMENDATIONS");
-    print_separator();
-
-    // Initialize compatibility and seasonal data
-    initialize_car_compatibility();
-    initialize_seasonal_recommendations();
-
-    printf("\n");
-    center_print("[+] Personalized Recommendations for You:");
-    printf("\n");
-
-    // Based on order history
-    FILE *orders = fopen(ORDERS_FILE, "r");
-    if (orders) {
-        char user[30], part[50];
-        int quantity;
-        float total;
-        int brake_ordered = 0, oil_ordered = 0;
-
-        while (fscanf(orders, "%s %s %d %f", user, part, &quantity, &total) == 4) {
-            if (strcmp(user, username) == 0) {
-                if (strstr(part, "brake") || strstr(part, "Brake")) brake_ordered = 1;
-                if (strstr(part, "oil") || strstr(part, "Oil")) oil_ordered = 1;
-            }
-        }
-        fclose(orders);
-
-        // Smart recommendations based on purchase history
-        if (brake_ordered) {
-            printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-            printf("* Brake fluid recommended (for brake maintenance)\n");
-        }
-        if (oil_ordered) {
-            printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-            printf("* Oil filter recommended (for complete oil service)\n");
-        }
-    }
-
-    // Seasonal recommendations
-    time_t now = time(NULL);
-    struct tm *local = localtime(&now);
-    int month = local->tm_mon + 1;
-
-    printf("\n");
-    center_print("[SEASONAL] Seasonal Recommendations:");
-    printf("\n");
-
-    if (month >= 11 || month <= 2) {
-        printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-        printf("*  Winter tires - Better grip in cold weather\n");
-        printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-        printf("*  Battery check - Cold weather affects battery life\n");
-    } else if (month >= 6 && month <= 8) {
-        printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-        printf("*  AC service - Summer cooling system maintenance\n");
-        printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-        printf("*  Coolant check - Prevent overheating\n");
-    } else {
-        printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-        printf("*  Windshield wipers - Spring/Fall weather preparation\n");
-        printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-        printf("*  Tire rotation - Seasonal maintenance\n");
-    }
-
-    printf("\n");
-    center_print("[POPULAR] Popular with Similar Customers:");
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-    printf("* Engine oil (Most purchased item)\n");
-    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-    printf("* Brake pads (Safety essential)\n");
-    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-    printf("* Air filter (Performance booster)\n");
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Initialize car compatibility data
- */
-void initialize_car_compatibility() {
-    FILE *f = fopen(CAR_COMPATIBILITY_FILE, "r");
-    if (f) {
-        fclose(f);
-        return; // File exists, no need to initialize
-    }
-
-    f = fopen(CAR_COMPATIBILITY_FILE, "w");
-    if (f) {
-        fprintf(f, "Toyota|Engine_Oil|Brake_Pads|Air_Filter|Spark_Plugs\n");
-        fprintf(f, "Honda|Engine_Oil|Brake_Pads|Transmission_Fluid|Timing_Belt\n");
-        fprintf(f, "Ford|Engine_Oil|Brake_Pads|Power_Steering_Fluid|Fuel_Filter\n");
-        fprintf(f, "BMW|Synthetic_Oil|Performance_Brake_Pads|Premium_Air_Filter|Ignition_Coils\n");
-        fprintf(f, "Mercedes|Synthetic_Oil|Ceramic_Brake_Pads|HEPA_Air_Filter|Premium_Spark_Plugs\n");
-        fclose(f);
-    }
-}
-
-/**
- * Initialize seasonal recommendations
- */
-void initialize_seasonal_recommendations() {
-    FILE *f = fopen(SEASONAL_RECOMMENDATIONS_FILE, "r");
-    if (f) {
-        fclose(f);
-        return; // File exists
-    }
-
-    f = fopen(SEASONAL_RECOMMENDATIONS_FILE, "w");
-    if (f) {
-        fprintf(f, "Winter|Winter_Tires|Battery_Check|Antifreeze|Windshield_Fluid\n");
-        fprintf(f, "Summer|AC_Service|Coolant_Check|UV_Protection|Tire_Pressure\n");
-        fprintf(f, "Spring|Wiper_Blades|Oil_Change|Tire_Rotation|Brake_Inspection\n");
-        fprintf(f, "Fall|Wiper_Blades|Heater_Check|Tire_Rotation|Battery_Test\n");
-        fclose(f);
-    }
-}
-
-/**
- * Loyalty System Menu
- */
-void loyalty_system_menu(const char *username) {
-    int choice;
-
-    while (1) {
-        clear_screen();
-        display_ascii_logo();
-        center_print("[*] LOYALTY REWARDS SYSTEM");
-        print_separator();
-
-        printf("\n");
-        center_print("1. View My Points");
-        center_print("2. View My Badges");
-        center_print("3. Redeem Points");
-        center_print("4. Back to Main Menu");
-        printf("\n");
-        center_prompt("Enter choice: ");
-        scanf("%d", &choice);
-
-        switch (choice) {
-            case 1:
-                view_loyalty_points(username);
-                break;
-            case 2:
-                view_customer_badges(username);
-                break;
-            case 3:
-                redeem_loyalty_points(username);
-                break;
-            case 4:
-                return;
-            default:
-                center_print("[X] Invalid choice!");
-                printf("\n");
-                center_print("Press any key to continue...");
-                getchar(); getchar();
-        }
-    }
-}
-
-/**
- * Add loyalty points for customer
- */
-void add_loyalty_points(const char *username, int points) {
-    FILE *f = fopen(LOYALTY_POINTS_FILE, "r");
-    FILE *temp = fopen("temp_loyalty.txt", "w");
-
-    if (!temp) return;
-
-    char user[30];
-    int current_points, found = 0;
-
-    if (f) {
-        while (fscanf(f, "%s %d", user, &current_points) == 2) {
-            if (strcmp(user, username) == 0) {
-                fprintf(temp, "%s %d\n", user, current_points + points);
-                found = 1;
-            } else {
-                fprintf(temp, "%s %d\n", user, current_points);
-            }
-        }
-        fclose(f);
-    }
-
-    if (!found) {
-        fprintf(temp, "%s %d\n", username, points);
-    }
-
-    fclose(temp);
-    remove(LOYALTY_POINTS_FILE);
-    rename("temp_loyalty.txt", LOYALTY_POINTS_FILE);
-
-    // Check for badge achievements
-    check_and_award_badges(username);
-}
-
-/**
- * View loyalty points
- */
-void view_loyalty_points(const char *username) {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] YOUR LOYALTY POINTS");
-    print_separator();
-
-    FILE *f = fopen(LOYALTY_POINTS_FILE, "r");
-    if (!f) {
-        center_print("[-] No loyalty points found.");
-        printf("\n");
-        center_print("You'll earn points with each purchase!");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char user[30];
-    int points, found = 0;
-
-    while (fscanf(f, "%s %d", user, &points) == 2) {
-        if (strcmp(user, username) == 0) {
-            found = 1;
-            printf("\n");
-            char points_msg[100];
-            sprintf(points_msg, "LOYALTY Your Current Points: %d", points);
-            center_print(points_msg);
-
-            printf("\n");
-            center_print("Redemption Options:");
-            center_print("$ 100 points = $5 discount");
-            center_print("$ 200 points = $12 discount");
-            center_print("$ 500 points = $30 discount");
-            break;
-        }
-    }
-    fclose(f);
-
-    if (!found) {
-        center_print("[-] No loyalty points found.");
-        printf("\n");
-        center_print("Start shopping to earn points!");
-    }
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Redeem loyalty points
- */
-void redeem_loyalty_points(const char *username) {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] REDEEM LOYALTY POINTS");
-    print_separator();
-
-    // First show current points
-    FILE *f = fopen(LOYALTY_POINTS_FILE, "r");
-    if (!f) {
-        center_print("[-] No loyalty points to redeem.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char user[30];
-    int current_points = 0, found = 0;
-
-    while (fscanf(f, "%s %d", user, &current_points) == 2) {
-        if (strcmp(user, username) == 0) {
-            found = 1;
-            break;
-        }
-    }
-    fclose(f);
-
-    if (!found || current_points == 0) {
-        center_print("[-] No points available for redemption.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    printf("\n");
-    char points_msg[100];
-    sprintf(points_msg, "Available Points: %d", current_points);
-    center_print(points_msg);
-
-    printf("\n");
-    center_print("Redemption Options:");
-    center_print("1. 100 points -> $5 discount");
-    center_print("2. 200 points -> $12 discount");
-    center_print("3. 500 points -> $30 discount");
-    center_print("4. Cancel");
-
-    printf("\n");
-    center_prompt("Choose option: ");
-    int choice;
-    scanf("%d", &choice);
-
-    int points_needed = 0;
-    float discount = 0;
-
-    switch (choice) {
-        case 1: points_needed = 100; discount = 5.0; break;
-        case 2: points_needed = 200; discount = 12.0; break;
-        case 3: points_needed = 500; discount = 30.0; break;
-        case 4: return;
-        default:
-            center_print("[X] Invalid choice!");
-            printf("\n");
-            center_print("Press any key to continue...");
-            getchar(); getchar();
-            return;
-    }
-
-    if (current_points < points_needed) {
-        center_print("[X] Insufficient points!");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    // Deduct points
-    FILE *temp = fopen("temp_loyalty.txt", "w");
-    f = fopen(LOYALTY_POINTS_FILE, "r");
-
-    while (fscanf(f, "%s %d", user, &current_points) == 2) {
-        if (strcmp(user, username) == 0) {
-            fprintf(temp, "%s %d\n", user, current_points - points_needed);
-        } else {
-            fprintf(temp, "%s %d\n", user, current_points);
-        }
-    }
-    fclose(f);
-    fclose(temp);
-
-    remove(LOYALTY_POINTS_FILE);
-    rename("temp_loyalty.txt", LOYALTY_POINTS_FILE);
-
-    // Record redemption
-    FILE *redemption = fopen(REDEMPTION_HISTORY_FILE, "a");
-    if (redemption) {
-        time_t now = time(NULL);
-        struct tm *local = localtime(&now);
-        fprintf(redemption, "%s %d %.2f %02d/%02d/%04d\n",
-                username, points_needed, discount,
-                local->tm_mday, local->tm_mon + 1, local->tm_year + 1900);
-        fclose(redemption);
-    }
-
-    printf("\n");
-    char success_msg[100];
-    sprintf(success_msg, "[+] Successfully redeemed %d points for $%.2f discount!", points_needed, discount);
-    center_print(success_msg);
-    center_print("Your discount code: LOYAL2024");
-    center_print("Use this code in your next order for 10% additional discount!");
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * View customer badges
- */
-void view_customer_badges(const char *username) {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] YOUR ACHIEVEMENT BADGES");
-    print_separator();
-
-    FILE *f = fopen(CUSTOMER_BADGES_FILE, "r");
-    if (!f) {
-        center_print("[-] No badges earned yet.");
-        printf("\n");
-        center_print("Keep shopping to unlock achievements!");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char user[30], badge[50], date[20];
-    int found = 0;
-
-    printf("\n");
-    center_print("ACHIEVEMENTS YOUR ACHIEVEMENTS:");
-    printf("\n");
-
-    while (fscanf(f, "%s %s %s", user, badge, date) == 3) {
-        if (strcmp(user, username) == 0) {
-            found = 1;
-            printf("%*s", (CONSOLE_WIDTH-50)/2, "");
-            printf("*  %s (Earned: %s)\n", badge, date);
-        }
-    }
-    fclose(f);
-
-    if (!found) {
-        center_print("[-] No badges earned yet.");
-        printf("\n");
-        center_print("Available Badges:");
-        center_print("BRONZE First Purchase - Make your first order");
-        center_print("SILVER Regular Customer - Make 5 orders");
-        center_print("GOLD VIP Customer - Make 10 orders");
-        center_print("PLATINUM Platinum Member - Make 20 orders");
-    }
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Check and award badges based on activity
- */
-void check_and_award_badges(const char *username) {
-    // Count user orders
-    FILE *orders = fopen(ORDERS_FILE, "r");
-    if (!orders) return;
-
-    char user[30], part[50];
-    int quantity, order_count = 0;
-    float total;
-
-    while (fscanf(orders, "%s %s %d %f", user, part, &quantity, &total) == 4) {
-        if (strcmp(user, username) == 0) {
-            order_count++;
-        }
-    }
-    fclose(orders);
-
-    // Check existing badges
-    FILE *badges = fopen(CUSTOMER_BADGES_FILE, "r");
-    char badge_user[30], badge_name[50], badge_date[20];
-    int has_first = 0, has_regular = 0, has_vip = 0, has_platinum = 0;
-
-    if (badges) {
-        while (fscanf(badges, "%s %s %s", badge_user, badge_name, badge_date) == 3) {
-            if (strcmp(badge_user, username) == 0) {
-                if (strcmp(badge_name, "First_Purchase") == 0) has_first = 1;
-                if (strcmp(badge_name, "Regular_Customer") == 0) has_regular = 1;
-                if (strcmp(badge_name, "VIP_Customer") == 0) has_vip = 1;
-                if (strcmp(badge_name, "Platinum_Member") == 0) has_platinum = 1;
-            }
-        }
-        fclose(badges);
-    }
-
-    // Award new badges
-    FILE *badge_file = fopen(CUSTOMER_BADGES_FILE, "a");
-    if (badge_file) {
-        time_t now = time(NULL);
-        struct tm *local = localtime(&now);
-        char date[20];
-        sprintf(date, "%02d/%02d/%04d", local->tm_mday, local->tm_mon + 1, local->tm_year + 1900);
-
-        if (order_count >= 1 && !has_first) {
-            fprintf(badge_file, "%s First_Purchase %s\n", username, date);
-        }
-        if (order_count >= 5 && !has_regular) {
-            fprintf(badge_file, "%s Regular_Customer %s\n", username, date);
-        }
-        if (order_count >= 10 && !has_vip) {
-            fprintf(badge_file, "%s VIP_Customer %s\n", username, date);
-        }
-        if (order_count >= 20 && !has_platinum) {
-            fprintf(badge_file, "%s Platinum_Member %s\n", username, date);
-        }
-        fclose(badge_file);
-    }
-}
-
-/**
- * Admin loyalty dashboard
- */
-void admin_loyalty_dashboard() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] LOYALTY SYSTEM DASHBOARD");
-    print_separator();
-
-    printf("\n");
-    center_print("=== CUSTOMER LOYALTY STATISTICS ===");
-    printf("\n");
-
-    // Show top customers by points
-    FILE *f = fopen(LOYALTY_POINTS_FILE, "r");
-    if (f) {
-        center_print("TOP CUSTOMERS BY POINTS:");
-        printf("\n");
-        printf("%*s", (CONSOLE_WIDTH-40)/2, "");
-        printf("%-20s %s\n", "CUSTOMER", "POINTS");
-        printf("%*s", (CONSOLE_WIDTH-40)/2, "");
-        for (int i = 0; i < 40; i++) printf("-");
-        printf("\n");
-
-        char user[30];
-        int points;
-        while (fscanf(f, "%s %d", user, &points) == 2) {
-            printf("%*s", (CONSOLE_WIDTH-40)/2, "");
-            printf("%-20s %d\n", user, points);
-        }
-        fclose(f);
-    }
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-// ==================== DELETE FUNCTIONS ====================
-
-/**
- * Delete car profile
- */
-void delete_car_profile() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] DELETE CAR PROFILE");
-    print_separator();
-
-    char car_number[20];
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
-    printf("Enter Car Number to Delete: ");
-    scanf("%s", car_number);
-
-    FILE *f = fopen(CAR_PROFILES_FILE, "r");
-    if (!f) {
-        center_print("[!] No car profiles found.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    FILE *temp = fopen("temp_profiles.txt", "w");
-    if (!temp) {
-        center_print("[X] Error creating temporary file.");
-        fclose(f);
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    char line[300];
-    int found = 0;
-
-    while (fgets(line, sizeof(line), f)) {
-        char stored_car[20];
-        sscanf(line, "%s", stored_car);
-
-        if (strcmp(stored_car, car_number) != 0) {
-            fputs(line, temp);
-        } else {
-            found = 1;
-        }
-    }
-
-    fclose(f);
-    fclose(temp);
-
-    if (found) {
-        remove(CAR_PROFILES_FILE);
-        rename("temp_profiles.txt", CAR_PROFILES_FILE);
-        center_print("[+] Car profile deleted successfully!");
-    } else {
-        remove("temp_profiles.txt");
-        center_print("[!] Car profile not found.");
-    }
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Delete progress record
- */
-void delete_progress_record() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] DELETE PROGRESS RECORD");
-    print_separator();
-
-    char car_number[20];
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-35)/2, "");
-    printf("Enter Car Number: ");
-    scanf("%s", car_number);
-
-    FILE *f = fopen(PROGRESS_FILE, "r");
-    if (!f) {
-        center_print("[!] No progress records found.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    // First show existing records for this car
-    printf("\n");
-    center_print("=== EXISTING PROGRESS RECORDS ===");
-    char line[300];
-    int record_count = 0;
-
-    while (fgets(line, sizeof(line), f)) {
-        char stored_car[20], date[20], percentage[10], description[100];
-        sscanf(line, "%s %s %s %s", stored_car, date, percentage, description);
-        if (strcmp(stored_car, car_number) == 0) {
-            printf("%*s", (CONSOLE_WIDTH-60)/2, "");
-            printf("%d. %s - %s: %s\n", ++record_count, date, percentage, description);
-        }
-    }
-
-    if (record_count == 0) {
-        center_print("[!] No progress records found for this car.");
-        fclose(f);
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    fclose(f);
-
-    char date_to_delete[20];
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-40)/2, "");
-    printf("Enter date to delete (YYYY-MM-DD): ");
-    scanf("%s", date_to_delete);
-
-    f = fopen(PROGRESS_FILE, "r");
-    FILE *temp = fopen("temp_progress.txt", "w");
-    if (!temp) {
-        center_print("[X] Error creating temporary file.");
-        fclose(f);
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    int found = 0;
-    while (fgets(line, sizeof(line), f)) {
-        char stored_car[20], date[20];
-        sscanf(line, "%s %s", stored_car, date);
-
-        if (strcmp(stored_car, car_number) == 0 && strcmp(date, date_to_delete) == 0) {
-            found = 1;
-        } else {
-            fputs(line, temp);
-        }
-    }
-
-    fclose(f);
-    fclose(temp);
-
-    if (found) {
-        remove(PROGRESS_FILE);
-        rename("temp_progress.txt", PROGRESS_FILE);
-        center_print("[+] Progress record deleted successfully!");
-    } else {
-        remove("temp_progress.txt");
-        center_print("[!] Progress record not found.");
-    }
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Delete order history
- */
-void delete_order_history(const char *username) {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] DELETE ORDER HISTORY");
-    print_separator();
-
-    FILE *f = fopen(ORDERS_FILE, "r");
-    if (!f) {
-        center_print("[!] No order history found.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    // First show existing orders for this user
-    printf("\n");
-    center_print("=== YOUR ORDER HISTORY ===");
-    char line[500];
-    int order_count = 0;
-
-    while (fgets(line, sizeof(line), f)) {
-        char stored_user[30];
-        sscanf(line, "%s", stored_user);
-        if (strcmp(stored_user, username) == 0) {
-            char date[20], time[10], parts[200];
-            float amount;
-            sscanf(line, "%s %s %s %f %[^\n]", stored_user, date, time, &amount, parts);
-            printf("%*s", (CONSOLE_WIDTH-80)/2, "");
-            printf("%d. %s %s - $%.2f - %s\n", ++order_count, date, time, amount, parts);
-        }
-    }
-
-    if (order_count == 0) {
-        center_print("[!] No order history found for your account.");
-        fclose(f);
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    fclose(f);
-
-    printf("\n");
-    center_print("1  [-]  Delete Specific Order");
-    center_print("2  [-]  Delete All My Orders");
-    center_print("3  [<]  Back");
-
-    int choice;
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-20)/2, "");
-    printf("Enter choice: ");
-    scanf("%d", &choice);
-
-    switch (choice) {
-        case 1: {
-            char date_to_delete[20], time_to_delete[10];
-            printf("\n");
-            printf("%*s", (CONSOLE_WIDTH-30)/2, "");
-            printf("Enter date (YYYY-MM-DD): ");
-            scanf("%s", date_to_delete);
-            printf("%*s", (CONSOLE_WIDTH-25)/2, "");
-            printf("Enter time (HH:MM): ");
-            scanf("%s", time_to_delete);
-
-            f = fopen(ORDERS_FILE, "r");
-            FILE *temp = fopen("temp_orders.txt", "w");
-            if (!temp) {
-                center_print("[X] Error creating temporary file.");
-                fclose(f);
-                break;
-            }
-
-            int found = 0;
-            while (fgets(line, sizeof(line), f)) {
-                char stored_user[30], date[20], time[10];
-                sscanf(line, "%s %s %s", stored_user, date, time);
-
-                if (strcmp(stored_user, username) == 0 &&
-                    strcmp(date, date_to_delete) == 0 &&
-                    strcmp(time, time_to_delete) == 0) {
-                    found = 1;
-                } else {
-                    fputs(line, temp);
-                }
-            }
-
-            fclose(f);
-            fclose(temp);
-
-            if (found) {
-                remove(ORDERS_FILE);
-                rename("temp_orders.txt", ORDERS_FILE);
-                center_print("[+] Order deleted successfully!");
-            } else {
-                remove("temp_orders.txt");
-                center_print("[!] Order not found.");
-            }
-            break;
-        }
-        case 2: {
-            printf("\n");
-            center_print("[!] WARNING: This will delete ALL your orders!");
-            printf("%*s", (CONSOLE_WIDTH-35)/2, "");
-            printf("Type 'DELETE' to confirm: ");
-            char confirm[20];
-            scanf("%s", confirm);
-
-            if (strcmp(confirm, "DELETE") == 0) {
-                f = fopen(ORDERS_FILE, "r");
-                FILE *temp = fopen("temp_orders.txt", "w");
-                if (!temp) {
-                    center_print("[X] Error creating temporary file.");
-                    fclose(f);
-                    break;
-                }
-
-                int deleted_count = 0;
-                while (fgets(line, sizeof(line), f)) {
-                    char stored_user[30];
-                    sscanf(line, "%s", stored_user);
-
-                    if (strcmp(stored_user, username) != 0) {
-                        fputs(line, temp);
-                    } else {
-                        deleted_count++;
-                    }
-                }
-
-                fclose(f);
-                fclose(temp);
-
-                if (deleted_count > 0) {
-                    remove(ORDERS_FILE);
-                    rename("temp_orders.txt", ORDERS_FILE);
-                    char msg[100];
-                    sprintf(msg, "[+] %d orders deleted successfully!", deleted_count);
-                    center_print(msg);
-                } else {
-                    remove("temp_orders.txt");
-                    center_print("[!] No orders found to delete.");
-                }
-            } else {
-                center_print("[!] Deletion cancelled.");
-            }
-            break;
-        }
-        case 3:
-            return;
-    }
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Delete parking record
- */
-void delete_parking_record() {
-    clear_screen();
-    display_ascii_logo();
-    center_print("[*] DELETE PARKING RECORD");
-    print_separator();
-
-    char car_number[20];
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
-    printf("Enter Car Number: ");
-    scanf("%s", car_number);
-
-    FILE *f = fopen(CAR_PARKING_FILE, "r");
-    if (!f) {
-        center_print("[!] No parking records found.");
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    // First show existing parking records for this car
-    printf("\n");
-    center_print("=== EXISTING PARKING RECORDS ===");
-    char line[200];
-    int record_count = 0;
-
-    while (fgets(line, sizeof(line), f)) {
-        char stored_car[20], owner[30], date[20], slot[10];
-        sscanf(line, "%s %s %s %s", stored_car, owner, date, slot);
-        if (strcmp(stored_car, car_number) == 0) {
-            printf("%*s", (CONSOLE_WIDTH-50)/2, "");
-            printf("%d. %s - %s - Slot %s\n", ++record_count, owner, date, slot);
-        }
-    }
-
-    if (record_count == 0) {
-        center_print("[!] No parking records found for this car.");
-        fclose(f);
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    fclose(f);
-
-    char date_to_delete[20];
-    printf("\n");
-    printf("%*s", (CONSOLE_WIDTH-40)/2, "");
-    printf("Enter date to delete (YYYY-MM-DD): ");
-    scanf("%s", date_to_delete);
-
-    f = fopen(CAR_PARKING_FILE, "r");
-    FILE *temp = fopen("temp_parking.txt", "w");
-    if (!temp) {
-        center_print("[X] Error creating temporary file.");
-        fclose(f);
-        printf("\n");
-        center_print("Press any key to continue...");
-        getchar(); getchar();
-        return;
-    }
-
-    int found = 0;
-    while (fgets(line, sizeof(line), f)) {
-        char stored_car[20], date[20];
-        sscanf(line, "%s %*s %s", stored_car, date);
-
-        if (strcmp(stored_car, car_number) == 0 && strcmp(date, date_to_delete) == 0) {
-            found = 1;
-        } else {
-            fputs(line, temp);
-        }
-    }
-
-    fclose(f);
-    fclose(temp);
-
-    if (found) {
-        remove(CAR_PARKING_FILE);
-        rename("temp_parking.txt", CAR_PARKING_FILE);
-        center_print("[+] Parking record deleted successfully!");
-    } else {
-        remove("temp_parking.txt");
-        center_print("[!] Parking record not found.");
-    }
-
-    printf("\n");
-    center_print("Press any key to continue...");
-    getchar(); getchar();
-}
-
-/**
- * Auto-add service progress when cars are added or orders are made
- */
-void auto_add_service_progress(const char *car_number, const char *service_type) {
-    FILE *f = fopen(PROGRESS_FILE, "a");
-    if (!f) return;
-
-    time_t now = time(NULL);
-    struct tm *local = localtime(&now);
-    char date[20];
-    sprintf(date, "%04d-%02d-%02d", local->tm_year + 1900, local->tm_mon + 1, local->tm_mday);
-
-    if (strcmp(service_type, "CAR_ADDED") == 0) {
-        fprintf(f, "%s %s 10%% Car_profile_created_initial_inspection_pending\n", car_number, date);
-    } else if (strcmp(service_type, "ORDER_PLACED") == 0) {
-        fprintf(f, "%s %s 25%% Parts_ordered_waiting_for_delivery\n", car_number, date);
-    } else if (strcmp(service_type, "PARKING_BOOKED") == 0) {
-        fprintf(f, "%s %s 5%% Parking_slot_reserved_car_inspection_scheduled\n", car_number, date);
-    }
-
-    fclose(f);
-}
-
-/**
- * Main function
- */
-int main() {
-    // Create default admin user (no need to store in file)
-    // Default credentials: username=admin, password=admin123
-
-    // Initialize default discount codes
-    initialize_default_discounts();
-
-    // Initialize default Q&A entries
-    initialize_default_qna();
-    //5800loc
-
-    main_menu();
-    return 0;
-}
+ #include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <errno.h>
+#include <ctype.h>
+#include "platform.h" // Console colors, width, hidden input (Windows/POSIX)
+#include "screen.h"   // Buffered screen composition
+#include "garage.h"   // Data files, records and core operations
+#include "pager.h"    // Page-at-a-time file browsing
+#include "export.h"   // CSV and JSON report export
+#include "promo.h"    // Promo code table and usage limits
+#include "invoice.h"  // Month-end batch invoicing
+#include "receipts.h" // QR receipt index and verification
+#include "recommend.h" // Co-purchase part recommendations
+#include "compat.h"    // Brand and seasonal part tables
+#include "qna.h"       // Troubleshooting Q&A search
+#include "scheduler.h" // Mechanic workload scheduling
+#include "parking.h"   // Parking occupancy index
+#include "vehicles.h"  // Per-vehicle record index
+#include "calendar.h"  // Date-ordered calendar and reminders
+#include "rollup.h"    // Revenue rollups by hour, day and month
+#include "stock.h"     // Part stock levels and checkout reservations
+#include "catalog.h"   // Part search by name or brand
+#include "usernames.h" // Taken-username check for registration
+#include "history.h"   // Per-customer order summaries
+#include "customers.h" // Customer 360 view
+#include "leaderboard.h" // Loyalty ranks, top customers and percentiles
+
+#define VAT_RATE 0.15f
+#define ADMIN_SECRET_CODE "ADMIN2024@SECURE"
+#define MAX_LOGIN_ATTEMPTS 3
+#define LOCKOUT_TIME 120 // 2 minutes in seconds
+#define LOYALTY_TOP_COUNT 10 // Customers on the loyalty dashboard
+
+// Paged listings: rows per page follow the console height
+#define PAGE_ROWS_DEFAULT 15  // When the height is unknown (redirected output)
+#define PAGE_ROWS_MIN 5
+#define PAGE_CHROME_LINES 26  // Logo, title, table header and paging controls
+
+// Dynamic console width - will be set automatically
+int CONSOLE_WIDTH = 80;
+
+// ========== CENTER ALIGNMENT CONFIGURATION ==========
+// Adjust these values to fine-tune the center positioning
+// Use Ctrl+F to search for "CENTER ALIGNMENT" to find this section quickly
+#define PADDING_LARGE_SCREENS   5    // For screens > 120 chars (adjust 1-10)
+#define PADDING_MEDIUM_SCREENS  4    // For screens > 100 chars (adjust 1-8)
+#define PADDING_STANDARD_SCREENS 3   // For screens > 80 chars (adjust 1-6)
+#define PADDING_SMALL_SCREENS   2    // For smaller screens (adjust 1-4)
+// ====================================================
+
+// Console Color Codes
+#define COLOR_BLUE 9
+#define COLOR_GREEN 10
+#define COLOR_CYAN 11
+#define COLOR_RED 12
+#define COLOR_MAGENTA 13
+#define COLOR_YELLOW 14
+#define COLOR_WHITE 15
+#define COLOR_GRAY 8
+#define COLOR_DEFAULT 7
+
+// A data file shown through browse_table()
+typedef struct {
+    const char *title;
+    const char *subtitle;        // Optional line under the title (active filter)
+    const char *path;
+    const char *empty_message;
+    void (*print_header)();
+    PagerRowRender render;
+    PagerRowFilter filter;
+    PagerRowDate date_of;        // NULL when the table has no date to jump to
+    void *context;               // Passed to filter and render
+} PagedTable;
+
+// Global variables for login attempts
+int admin_failed_attempts = 0;
+int user_failed_attempts = 0;
+time_t admin_lockout_time = 0;
+time_t user_lockout_time = 0;
+
+// Function prototypes
+void get_console_width();
+void center_subtitle(const char* text);
+void set_console_color(int color);
+void reset_console_color();
+void display_current_time();
+void display_ascii_logo();
+void center_print(const char* text);
+int center_padding(int len);
+void center_prompt(const char* text);
+void get_hidden_password(char *password, int max_length);
+void print_separator();
+void clear_screen();
+void display_developer_copyright();
+void register_user();
+int login_user(char logged_in_user[30], char logged_in_role[20]);
+int admin_login(char logged_in_user[30], char logged_in_role[20]);
+int admin_password_recovery();
+int validate_phone(const char* phone);
+int validate_email(const char* email);
+int validate_username(const char* username, const char* name);
+int validate_strong_password(const char* password);
+int is_account_locked(time_t lockout_time);
+void lock_account(time_t* lockout_time);
+void add_part();
+void delete_part();
+void restock_part();
+void view_parts();
+void format_stock(const char *part, char *buffer, size_t size);
+void format_stock_level(const StockLevel *level, char *buffer, size_t size);
+int print_stock_row(const StockLevel *level, void *context);
+void view_not_available_parts();
+void update_profile(const char *logged_in_username);
+int search_parts(CatalogHit hits[], GaragePart listed[], int max);
+void order_parts(const char *username);
+void view_order_history(const char *username);
+float calculate_estimation(const char *username);
+void generate_invoice(const char *actor_username, const char *actor_role);
+void batch_invoicing();
+void add_car();
+void view_cars();
+void delete_car();
+void modify_car();
+void admin_panel(const char *admin_username);
+void view_all_users();
+void view_all_orders();
+void system_statistics();
+void fill_order_stats(long from, long to, GarageStats *stats);
+void print_revenue_bar(const char *label, const RollupPoint *point, double max_revenue);
+void view_monthly_trend();
+long read_date_filter(const char *prompt);
+void export_reports();
+void print_customer_view(const CustomerView *view);
+void customer_360_view();
+void daily_dashboard();
+void main_menu();
+void manage_discounts();
+void add_discount();
+void view_discounts();
+void delete_discount();
+float apply_promo_code(const char *username, float total_amount, PromoHold *promo);
+float apply_loyalty_discount(const char *username, float current_amount, float *discount_applied, int *points_used);
+void initialize_default_discounts();
+void manage_appointments();
+void add_mechanic();
+void view_mechanics();
+void assign_mechanic_to_order();
+void auto_assign_mechanics();
+void print_auto_assignment(const SchedulerOrder *order, const SchedulerMechanic *mechanic, void *context);
+void view_appointments();
+void delete_mechanic();
+// Mechanic Dashboard Functions
+int mechanic_login(char logged_in_user[30], char logged_in_role[20]);
+void mechanic_dashboard(const char *mechanic_username);
+void view_car_profile();
+void add_car_profile(const char *car_number);
+void delete_car_profile();
+void view_vehicle_history();
+void add_vehicle_history();
+void update_progress();
+void view_progress();
+void delete_progress_record();
+void delete_order_history(const char *username);
+void delete_parking_record();
+void auto_add_service_progress(const char *car_number, const char *service_type);
+void set_deadline();
+void view_assigned_cars(const char *mechanic_username);
+int print_assigned_car(const VehicleRecord *record, void *context);
+int print_vehicle_record(const VehicleRecord *record, void *context);
+int print_car_profile(const VehicleRecord *record, void *context);
+int print_progress_record(const VehicleRecord *record, void *context);
+int print_deadline_record(const VehicleRecord *record, void *context);
+void view_service_calendar();
+int print_calendar_event(const CalendarEvent *event, void *context);
+void view_calendar_events(unsigned kinds, const char *title);
+int print_due_reminder(const CalendarEvent *event, void *context);
+void add_service_event();
+void set_maintenance_reminder();
+void view_maintenance_reminders();
+void customer_view_maintenance_reminders();
+void manage_qna();
+void add_qna();
+void view_qna();
+void customer_view_qna();
+void add_car_parking(const char *username);
+void view_car_parking();
+void initialize_default_qna();
+void generate_qr_receipt(const char *username, const char *service_details, float amount);
+void view_qr_receipts(const char *username);
+void verify_qr_receipt();
+void smart_parts_recommendation(const char *username);
+void initialize_car_compatibility();
+void initialize_seasonal_recommendations();
+void loyalty_system_menu(const char *username);
+void add_loyalty_points(const char *username, int points);
+void view_loyalty_points(const char *username);
+void redeem_loyalty_points(const char *username);
+void view_customer_badges(const char *username);
+void check_and_award_badges(const char *username);
+void admin_loyalty_dashboard();
+// Visitors passed to the garage_for_each_* scans
+int print_part_row(const GaragePart *part, void *context);
+int print_history_row(const GarageOrder *order, void *context);
+int print_customer_order_row(const GarageOrder *order, void *context);
+int print_discount_row(const PromoCode *promo, void *context);
+int print_receipt_row(const GarageReceipt *receipt, void *context);
+// Paged listings
+int page_rows();
+void browse_table(const PagedTable *table);
+int user_line_valid(const char *line, void *context);
+void print_users_header();
+void render_user_line(const char *line, void *context);
+int order_line_matches(const char *line, void *context);
+long order_line_date(const char *line);
+void print_orders_header();
+void render_order_line(const char *line, void *context);
+int mechanic_line_valid(const char *line, void *context);
+void print_mechanics_header();
+void render_mechanic_line(const char *line, void *context);
+int parking_line_matches(const char *line, void *context);
+long parking_line_date(const char *line);
+void print_parking_header();
+void render_parking_line(const char *line, void *context);
+void print_stay_header();
+int print_stay_row(const ParkingStay *stay, void *context);
+void view_parked_at(time_t when, const char *title);
+void view_parking_history();
+void view_daily_occupancy();
+void check_out_car();
+int car_line_matches(const char *line, void *context);
+void print_cars_header();
+void render_car_line(const char *line, void *context);
+void print_receipts_header();
+
+/**
+ * Set console color
+ */
+void set_console_color(int color) {
+    screen_set_color(color);
+}
+
+/**
+ * Reset console color to default
+ */
+void reset_console_color() {
+    set_console_color(COLOR_DEFAULT);
+}
+
+/**
+ * Get console width dynamically for perfect center alignment
+ */
+void get_console_width() {
+    int width = platform_console_width();
+
+    if (width > 0) {
+        CONSOLE_WIDTH = width;
+
+        // Ensure minimum width for proper display
+        if (CONSOLE_WIDTH < 80) {
+            CONSOLE_WIDTH = 80;
+        }
+
+        // For very wide screens, cap at reasonable width for readability
+        if (CONSOLE_WIDTH > 200) {
+            CONSOLE_WIDTH = 200;
+        }
+    } else {
+        // Fallback to default if detection fails
+        CONSOLE_WIDTH = 120; // Slightly larger default for modern screens
+    }
+}
+
+/**
+ * Clear screen function with blue background
+ */
+void clear_screen() {
+    screen_clear();
+
+    // Width is cached until the console reports a resize
+    if (platform_console_resized()) {
+        get_console_width();
+    }
+    set_console_color(COLOR_BLUE);
+}
+
+/**
+ * Display developer copyright in lower right corner
+ */
+void display_developer_copyright() {
+    // Get console info for proper positioning
+    int consoleHeight = platform_console_height();
+    int currentY = platform_cursor_row();
+
+    if (consoleHeight > 0 && currentY >= 0) {
+        // Calculate how many lines to skip to reach bottom
+        int linesToBottom = consoleHeight - currentY - 6; // Adjust for 5 lines of text
+
+        // Move to bottom of screen
+        for (int i = 0; i < linesToBottom; i++) {
+            printf("\n");
+        }
+    }
+
+    // Print copyright in bottom right corner with left-aligned text from right position
+    set_console_color(COLOR_GRAY);
+
+    // Calculate starting position for left-aligned text in right corner
+    int rightMargin = CONSOLE_WIDTH - 35; // Position from right edge
+
+    printf("%*s%s\n", rightMargin, "", "(C) 2025 Developed by:");
+    printf("%*s%s\n", rightMargin, "", "H.M.Ashis Rahman");
+    printf("%*s%s\n", rightMargin, "", "MD.Yeasif Jani Mishad");
+    printf("%*s%s\n", rightMargin, "", "Redwan Ahmed");
+    printf("%*s%s\n", rightMargin, "", "All Rights Reserved");
+
+    reset_console_color();
+}
+
+/**
+ * Hidden password input function
+ */
+void get_hidden_password(char *password, int max_length) {
+    platform_read_password(password, max_length);
+}
+
+/**
+ * Left padding that centers text of the given length
+ * Search for "CENTER ALIGNMENT" to modify the extra spacing
+ */
+int center_padding(int len) {
+    int padding = (CONSOLE_WIDTH - len) / 2;
+
+    // Ensure padding is never negative
+    if (padding < 0) padding = 0;
+
+    // Add configurable extra space for perfect visual centering
+    if (CONSOLE_WIDTH > 120) padding += PADDING_LARGE_SCREENS;
+    else if (CONSOLE_WIDTH > 100) padding += PADDING_MEDIUM_SCREENS;
+    else if (CONSOLE_WIDTH > 80) padding += PADDING_STANDARD_SCREENS;
+    else padding += PADDING_SMALL_SCREENS;
+
+    return padding;
+}
+
+/**
+ * Center align text in console with improved precision
+ */
+void center_print(const char* text) {
+    screen_begin();
+    set_console_color(COLOR_CYAN);
+    screen_pad(center_padding(strlen(text)), ' ');
+    screen_puts(text);
+    screen_puts("\n");
+    set_console_color(COLOR_BLUE);
+    screen_end();
+}
+
+/**
+ * Center align input prompt (without newline) with improved precision
+ */
+void center_prompt(const char* text) {
+    screen_begin();
+    set_console_color(COLOR_YELLOW);
+    screen_pad(center_padding(strlen(text)), ' ');
+    screen_puts(text);
+    set_console_color(COLOR_BLUE);
+    screen_end();
+}
+
+/**
+ * Display prompt in upper right corner
+ */
+void right_prompt(const char* text) {
+    int len = strlen(text);
+    int padding = CONSOLE_WIDTH - len - 10; // 10 chars from right edge
+
+    if (padding < 0) padding = 0;
+
+    screen_begin();
+    set_console_color(COLOR_YELLOW);
+    screen_pad(padding, ' ');
+    screen_puts(text);
+    set_console_color(COLOR_BLUE);
+    screen_end();
+}
+
+/**
+ * Center align subtitle with extra precision for long text
+ */
+void center_subtitle(const char* text) {
+    center_print(text);
+}
+
+/**
+ * Print decorative separator line with perfect centering
+ */
+void print_separator() {
+    // Calculate optimal separator width based on subtitle length for perfect alignment
+    const char* subtitle = "Your One-Stop Solution for Car Parts & Garage Management";
+    int subtitle_len = strlen(subtitle);
+    int separator_width = subtitle_len + 6; // Slightly wider than subtitle
+
+    // Ensure reasonable bounds
+    if (separator_width > CONSOLE_WIDTH - 10) separator_width = CONSOLE_WIDTH - 10;
+    if (separator_width < 60) separator_width = 60;
+
+    screen_begin();
+    set_console_color(COLOR_CYAN);
+    screen_pad(center_padding(separator_width), ' ');
+    screen_pad(separator_width, '=');
+    screen_puts("\n");
+    set_console_color(COLOR_BLUE);
+    screen_end();
+}
+
+/**
+ * Display current time with decorative elements
+ */
+void display_current_time() {
+    time_t now = time(NULL);
+    struct tm *local = localtime(&now);
+
+    set_console_color(COLOR_YELLOW);
+    printf("\n");
+    center_print("╔═══════════════════════════════════════════════════════════════╗");
+
+    char time_display[100];
+    sprintf(time_display, "║  ⏰ CURRENT TIME: %02d:%02d:%02d  📅 DATE: %04d-%02d-%02d  ║",
+            local->tm_hour, local->tm_min, local->tm_sec,
+            local->tm_year + 1900, local->tm_mon + 1, local->tm_mday);
+    center_print(time_display);
+
+    center_print("╚═══════════════════════════════════════════════════════════════╝");
+    set_console_color(COLOR_BLUE);
+}
+
+/**
+ * Display ASCII art logo with center alignment
+ */
+void display_ascii_logo() {
+    screen_begin();
+    clear_screen();
+    screen_puts("\n\n");
+
+    set_console_color(COLOR_YELLOW);
+    center_print("    ____   _    ____  _  __ ___ _______   __");
+    center_print("   |  _ \\ / \\  |  _ \\| |/ /|_ _|  ___\\ \\ / /");
+    center_print("   | |_) / _ \\ | |_) | ' /  | || |_   \\ V / ");
+    center_print("   |  __/ ___ \\|  _ <| . \\  | ||  _|   | |  ");
+    center_print("   |_| /_/   \\_\\_| \\_\\_|\\_\\|___|_|     |_|  ");
+
+    screen_puts("\n");
+    set_console_color(COLOR_MAGENTA);
+    center_print("*** SMART GARAGE MANAGEMENT SYSTEM ***");
+
+    set_console_color(COLOR_CYAN);
+    print_separator();
+    center_subtitle("Your One-Stop Solution for Car Parts & Garage Management");
+    print_separator();
+
+    set_console_color(COLOR_BLUE);
+    screen_puts("\n");
+    screen_end();
+}
+
+// ==================== PAGED LISTINGS ====================
+
+/**
+ * Rows per page: whatever fits under the logo and table header
+ */
+int page_rows() {
+    int height = platform_console_height();
+    int rows = height > 0 ? height - PAGE_CHROME_LINES : PAGE_ROWS_DEFAULT;
+    return rows < PAGE_ROWS_MIN ? PAGE_ROWS_MIN : rows;
+}
+
+/**
+ * Browse a data file one page at a time. Only the rows on screen are
+ * read, so large files open instantly and memory use stays flat.
+ */
+void browse_table(const PagedTable *table) {
+    Pager pager;
+
+    if (!pager_open(&pager, table->path, page_rows(), table->filter, table->context)) {
+        center_print(table->empty_message);
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    while (1) {
+        screen_begin();
+        clear_screen();
+        display_ascii_logo();
+        center_print(table->title);
+        print_separator();
+        if (table->subtitle) {
+            screen_puts("\n");
+            center_print(table->subtitle);
+        }
+        screen_puts("\n");
+        table->print_header();
+
+        if (pager_read_page(&pager, table->render, table->context) == 0) {
+            center_print(table->empty_message);
+        }
+
+        char status[100];
+        if (pager.page_number > 0) {
+            sprintf(status, "Page %d  (%d%% through the records)", pager.page_number, pager_percent(&pager));
+        } else {
+            sprintf(status, "%d%% through the records", pager_percent(&pager));
+        }
+        screen_puts("\n");
+        center_print(status);
+        center_print(table->date_of ? "[N] Next  [P] Previous  [F] First  [D] Jump to Date  [Q] Back"
+                                    : "[N] Next  [P] Previous  [F] First  [Q] Back");
+        screen_puts("\n");
+        center_prompt("Select option: ");
+        screen_end();
+
+        char command[20];
+        if (scanf("%19s", command) != 1) break;
+
+        switch (tolower((unsigned char)command[0])) {
+            case 'n': pager_next(&pager); break;
+            case 'p': pager_prev(&pager); break;
+            case 'f': pager_first(&pager); break;
+            case 'd':
+                if (table->date_of) {
+                    char date[20];
+                    center_prompt("Jump to date (YYYY-MM-DD): ");
+                    scanf("%19s", date);
+                    long date_key = garage_date_key(date);
+                    if (date_key > 0) pager_seek_date(&pager, date_key, table->date_of);
+                }
+                break;
+            case 'q':
+                pager_close(&pager);
+                return;
+        }
+    }
+    pager_close(&pager);
+}
+
+/**
+ * Validate phone number (must start with 01 and be 11 digits)
+ */
+int validate_phone(const char* phone) {
+    if (strlen(phone) != 11) return 0;
+    if (phone[0] != '0' || phone[1] != '1') return 0;
+    for (int i = 0; i < 11; i++) {
+        if (!isdigit(phone[i])) return 0;
+    }
+    return 1;
+}
+
+/**
+ * Validate email domain
+ */
+int validate_email(const char* email) {
+    const char* valid_domains[] = {
+        "@gmail.com", "@hotmail.com", "@outlook.com",
+        "@protonmail.com", "@diu.edu.bd", "@yahoo.com"
+    };
+    int num_domains = sizeof(valid_domains) / sizeof(valid_domains[0]);
+
+    for (int i = 0; i < num_domains; i++) {
+        if (strstr(email, valid_domains[i]) != NULL) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Validate username format (name_id)
+ */
+int validate_username(const char* username, const char* name) {
+    // Extract first name from full name for username validation
+    char first_name[50];
+    sscanf(name, "%s", first_name); // Gets first word only
+
+    char expected_format[100];
+    sprintf(expected_format, "%s_", first_name);
+
+    // Check if username starts with first name followed by underscore
+    if (strncmp(username, expected_format, strlen(expected_format)) != 0) {
+        return 0;
+    }
+
+    // Check if there's an ID after underscore
+    const char* id_part = username + strlen(expected_format);
+    if (strlen(id_part) == 0) return 0;
+
+    // ID part should contain at least some characters/numbers
+    return 1;
+}
+
+/**
+ * Validate strong password requirements
+ * Must contain: 1 uppercase, 1 lowercase, 1 number, 1 special character
+ * Minimum length: 8 characters
+ */
+int validate_strong_password(const char* password) {
+    int length = strlen(password);
+    int has_upper = 0, has_lower = 0, has_digit = 0, has_special = 0;
+
+    // Check minimum length
+    if (length < 4) {
+        return 0;
+    }
+
+    // Check for required character types
+    for (int i = 0; i < length; i++) {
+        char c = password[i];
+
+        if (c >= 'A' && c <= 'Z') {
+            has_upper = 1;
+        } else if (c >= 'a' && c <= 'z') {
+            has_lower = 1;
+        } else if (c >= '0' && c <= '9') {
+            has_digit = 1;
+        } else if (c == '@' || c == '#' || c == '$' || c == '%' ||
+                   c == '&' || c == '*' || c == '!' || c == '?' ||
+                   c == '+' || c == '-' || c == '=' || c == '_') {
+            has_special = 1;
+        }
+    }
+
+    // All requirements must be met
+    return (has_upper && has_lower && has_digit && has_special);
+}
+
+/**
+ * Check if account is locked
+ */
+int is_account_locked(time_t lockout_time) {
+    if (lockout_time == 0) return 0;
+
+    time_t current_time = time(NULL);
+    if (current_time - lockout_time < LOCKOUT_TIME) {
+        int remaining = LOCKOUT_TIME - (current_time - lockout_time);
+        char lock_msg[100];
+        sprintf(lock_msg, "[X] Account locked! Try again in %d seconds.", remaining);
+        center_print(lock_msg);
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * Lock account for specified time
+ */
+void lock_account(time_t* lockout_time) {
+    *lockout_time = time(NULL);
+    center_print("[!] SECURITY ALERT: Account locked for 2 minutes!");
+    center_print("Too many failed login attempts detected.");
+}
+
+/**
+ * Admin password recovery
+ */
+int admin_password_recovery() {
+    clear_screen();
+    center_print("[#] ADMIN PASSWORD RECOVERY");
+    center_print("Security Questions for Password Recovery");
+    print_separator();
+
+    char answer[100];
+
+    printf("\n");
+    center_print("Security Question: What is the default admin username?");
+    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
+    printf("Answer: ");
+    scanf("%s", answer);
+
+    if (strcmp(answer, "admin") != 0) {
+        center_print("[X] Incorrect answer!");
+        return 0;
+    }
+
+    center_print("Security Question: What is the system name? (SmartGarage)");
+    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
+    printf("Answer: ");
+    scanf("%s", answer);
+
+    if (strcmp(answer, "SmartGarage") != 0) {
+        center_print("[X] Incorrect answer!");
+        return 0;
+    }
+
+    printf("\n");
+    center_print("[+] Security questions verified!");
+    center_print("[#] Default Password: admin123");
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+    return 1;
+}
+
+/**
+ * Customer registration (No inventory manager option)
+ */
+void register_user() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[+] CUSTOMER REGISTRATION");
+    print_separator();
+
+    char username[30], password[30];
+    char name[50], email[50], phone[20];
+
+    printf("\n");
+    center_print("Please fill in your details:");
+    printf("\n");
+
+    // Get name first for username validation
+    center_prompt("Full Name: ");
+    getchar(); // Clear any leftover newline character
+    fgets(name, sizeof(name), stdin);
+    // Remove newline character if present
+    if (name[strlen(name) - 1] == '\n') {
+        name[strlen(name) - 1] = '\0';
+    }
+
+    // Validate and get username
+    while (1) {
+        char prompt[100];
+        char first_name[50];
+        sscanf(name, "%s", first_name); // Extract first name for prompt
+        sprintf(prompt, "Username (format: %s_id): ", first_name);
+        center_prompt(prompt);
+        scanf("%s", username);
+
+        if (!validate_username(username, name)) {
+            center_print("[X] Invalid username format! Use: firstname_id");
+        } else if (usernames_taken(username)) {
+            center_print("[X] Username already taken! Choose another id");
+        } else {
+            break;
+        }
+    }
+
+    // Validate and get strong password
+    while (1) {
+        center_print("Password Requirements:");
+        center_print("- At least 4 characters");
+        center_print("- 1 uppercase letter (A-Z)");
+        center_print("- 1 lowercase letter (a-z)");
+        center_print("- 1 number (0-9)");
+        center_print("- 1 special character (@#$%&*!?+-=_)");
+        printf("\n");
+        center_prompt("Password: ");
+        get_hidden_password(password, sizeof(password));
+
+        if (validate_strong_password(password)) {
+            break;
+        } else {
+            printf("\n");
+            center_print("[X] Password does not meet requirements!");
+            center_print("Must have: 1 uppercase, 1 lowercase, 1 number, 1 special char");
+            printf("\n");
+        }
+    }
+
+    // Validate and get email
+    while (1) {
+        center_prompt("Email: ");
+        scanf("%s", email);
+
+        if (validate_email(email)) {
+            break;
+        } else {
+            center_print("[X] Invalid email domain!");
+            center_print("Allowed: gmail.com, hotmail.com, outlook.com, protonmail.com, diu.edu.bd, yahoo.com");
+        }
+    }
+
+    // Validate and get phone
+    while (1) {
+        center_prompt("Phone (01XXXXXXXXX): ");
+        scanf("%s", phone);
+
+        if (validate_phone(phone)) {
+            break;
+        } else {
+            center_print("[X] Invalid phone number!");
+            center_print("Must start with 01 and be exactly 11 digits.");
+        }
+    }
+
+    // All registrations are customers by default
+    GarageUser user;
+    strcpy(user.role, "Customer");
+    strcpy(user.username, username);
+    strcpy(user.password, password);
+    strcpy(user.name, name);
+    strcpy(user.email, email);
+    strcpy(user.phone, phone);
+
+    // Checked again under the lock: another program may have taken it meanwhile
+    int registered = usernames_register(&user);
+    if (registered == 0) {
+        center_print("[X] Username already taken! Please register again.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+    if (registered < 0) {
+        center_print("[X] Error opening users file.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    printf("\n");
+    center_print("[+] Registration successful! You are registered as a Customer.");
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Regular user login (Customer only)
+ */
+int login_user(char logged_in_user[30], char logged_in_role[20]) {
+    if (is_account_locked(user_lockout_time)) {
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return 0;
+    }
+
+    clear_screen();
+    display_ascii_logo();
+    center_print("[#] USER LOGIN");
+    print_separator();
+
+    char input_username[30], input_password[30];
+    GarageUser user;
+    int found = 0;
+
+    if (!garage_has_file(USERS_FILE)) {
+        center_print("[X] No users registered yet.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return 0;
+    }
+
+    printf("\n");
+    center_prompt("Username: ");
+    scanf("%s", input_username);
+
+    center_prompt("Password: ");
+    get_hidden_password(input_password, sizeof(input_password));
+
+    // Only customers can login here
+    if (garage_authenticate_user(input_username, input_password, "Customer", &user)) {
+        printf("\n");
+        center_print("[+] Login Successful!");
+        printf("\n");
+        char welcome_msg[100];
+        sprintf(welcome_msg, "Welcome, %s (%s)", user.name, user.role);
+        center_print(welcome_msg);
+        printf("\n");
+
+        strcpy(logged_in_user, user.username);
+        strcpy(logged_in_role, user.role);
+        found = 1;
+        user_failed_attempts = 0; // Reset on successful login
+    }
+
+    if (!found) {
+        user_failed_attempts++;
+        center_print("[X] Login failed. Invalid credentials.");
+
+        if (user_failed_attempts >= MAX_LOGIN_ATTEMPTS) {
+            lock_account(&user_lockout_time);
+            user_failed_attempts = 0;
+        } else {
+            char attempts_msg[100];
+            sprintf(attempts_msg, "[!] Warning: %d/%d attempts remaining",
+                   MAX_LOGIN_ATTEMPTS - user_failed_attempts, MAX_LOGIN_ATTEMPTS);
+            center_print(attempts_msg);
+        }
+
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return 0;
+    }
+
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+    return 1;
+}
+
+/**
+ * Secure admin login
+ */
+int admin_login(char logged_in_user[30], char logged_in_role[20]) {
+    if (is_account_locked(admin_lockout_time)) {
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return 0;
+    }
+
+    clear_screen();
+    display_ascii_logo();
+    center_print("[#] ADMIN SECURE LOGIN");
+    center_print("[!] AUTHORIZED PERSONNEL ONLY [!]");
+    print_separator();
+
+    char username[30], password[30];
+
+    printf("\n");
+    center_prompt("Admin Username: ");
+    scanf("%s", username);
+
+    center_prompt("Admin Password: ");
+    get_hidden_password(password, sizeof(password));
+
+    // Check default admin credentials
+    if (strcmp(username, "admin") == 0 && strcmp(password, "admin123") == 0) {
+        strcpy(logged_in_user, "admin");
+        strcpy(logged_in_role, "Admin");
+        admin_failed_attempts = 0; // Reset on successful login
+
+        center_print("[*] ADMIN ACCESS GRANTED");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return 1;
+    }
+
+    admin_failed_attempts++;
+    center_print("[X] Invalid admin credentials.");
+
+    if (admin_failed_attempts >= MAX_LOGIN_ATTEMPTS) {
+        lock_account(&admin_lockout_time);
+        admin_failed_attempts = 0;
+
+        printf("\n");
+        center_print("[?] Forgot Password? Try Password Recovery");
+        center_print("Press 'R' for Recovery or any other key to continue...");
+
+        char choice = getchar();
+        getchar(); // consume newline
+
+        if (choice == 'R' || choice == 'r') {
+            if (admin_password_recovery()) {
+                admin_lockout_time = 0; // Reset lockout if recovery successful
+            }
+        }
+    } else {
+        char attempts_msg[100];
+        sprintf(attempts_msg, "[!] Warning: %d/%d attempts remaining",
+               MAX_LOGIN_ATTEMPTS - admin_failed_attempts, MAX_LOGIN_ATTEMPTS);
+        center_print(attempts_msg);
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+    return 0;
+}
+
+/**
+ * Mechanic login function
+ */
+int mechanic_login(char logged_in_user[30], char logged_in_role[20]) {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[#] MECHANIC LOGIN");
+    print_separator();
+
+    // Check if mechanics are locked out
+    if (is_account_locked(user_lockout_time)) {
+        center_print("[X] Account temporarily locked due to failed attempts.");
+        center_print("Please try again later.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return 0;
+    }
+
+    char username[30], password[30];
+    printf("\n");
+    center_prompt("Username: ");
+    scanf("%s", username);
+
+    center_prompt("Password: ");
+    get_hidden_password(password, sizeof(password));
+
+    // Check if mechanic exists in mechanics.txt with correct credentials
+    if (!garage_has_file(MECHANICS_FILE)) {
+        center_print("[X] No mechanics registered in system.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return 0;
+    }
+
+    int found = garage_authenticate_mechanic(username, password, NULL);
+
+    if (found) {
+        strcpy(logged_in_user, username);  // Store username instead of name
+        strcpy(logged_in_role, "Mechanic");
+
+        user_failed_attempts = 0; // Reset attempts on success
+
+        center_print("[+] Login successful!");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return 1;
+    } else {
+        user_failed_attempts++;
+
+        center_print("[X] Invalid username or password.");
+        center_print("Please contact admin if you need assistance.");
+
+        if (user_failed_attempts >= MAX_LOGIN_ATTEMPTS) {
+            lock_account(&user_lockout_time);
+            center_print("[!] Account locked due to multiple failed attempts.");
+        }
+
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return 0;
+    }
+}
+
+/**
+ * One trend row: label, a bar scaled to max_revenue, revenue and orders
+ */
+void print_revenue_bar(const char *label, const RollupPoint *point, double max_revenue) {
+    char bar[21];
+    int width = max_revenue > 0 ? (int)(point->revenue / max_revenue * 20 + 0.5) : 0;
+
+    memset(bar, '#', (size_t)width);
+    bar[width] = '\0';
+    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+    printf("%-8s %-20s $%9.2f  (%d orders)\n", label, bar, point->revenue, point->orders);
+}
+
+/**
+ * Daily dashboard for admin
+ */
+void daily_dashboard() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] DAILY DASHBOARD");
+    print_separator();
+
+    time_t now = time(NULL);
+    long today = rollup_bucket(ROLLUP_DAY, now);
+    char today_date[GARAGE_DATE_TEXT];
+    garage_format_date_key(today, today_date, sizeof(today_date));
+
+    char dashboard_msg[100];
+    sprintf(dashboard_msg, "[*] Today's Report: %s", today_date);
+    center_print(dashboard_msg);
+    printf("\n");
+
+    // Today's figures come from the rollups, not from rereading orders.txt
+    RollupPoint day, parts[100], payments[10];
+    rollup_get(ROLLUP_DAY, today, ROLLUP_ANY, NULL, &day);
+    int part_count = rollup_breakdown(ROLLUP_DAY, today, ROLLUP_PART, parts, 100);
+    int payment_count = rollup_breakdown(ROLLUP_DAY, today, ROLLUP_PAYMENT, payments, 10);
+
+    // Display today's statistics
+    sprintf(dashboard_msg, "[*] Orders Placed Today: %d", day.orders);
+    center_print(dashboard_msg);
+
+    sprintf(dashboard_msg, "[#] Units Sold Today: %d", day.units);
+    center_print(dashboard_msg);
+
+    sprintf(dashboard_msg, "[$] Today's Revenue: $%.2f", day.revenue);
+    center_print(dashboard_msg);
+
+    sprintf(dashboard_msg, "[#] Different Parts Ordered: %d", part_count);
+    center_print(dashboard_msg);
+
+    for (int i = 0; i < payment_count; i++) {
+        sprintf(dashboard_msg, "   * %.20s: %d orders ($%.2f)", payments[i].name, payments[i].orders, payments[i].revenue);
+        center_print(dashboard_msg);
+    }
+
+    if (part_count > 0) {
+        printf("\n");
+        center_print("[*] POPULAR PARTS TODAY:");
+        print_separator();
+        for (int i = 0; i < part_count && i < 10; i++) { // Show top 10
+            printf("%*s", (CONSOLE_WIDTH-40)/2, "");
+            printf("* %-20s x%-4d $%.2f\n", parts[i].name, parts[i].units, parts[i].revenue);
+        }
+
+        // Revenue by hour, for the hours that had orders
+        RollupPoint hours[24];
+        int hour_count = rollup_series(ROLLUP_HOUR, today * 100, rollup_bucket(ROLLUP_HOUR, now),
+                                       ROLLUP_ANY, NULL, hours, 24);
+        double max_revenue = 0;
+        for (int i = 0; i < hour_count; i++) {
+            if (hours[i].revenue > max_revenue) max_revenue = hours[i].revenue;
+        }
+
+        printf("\n");
+        center_print("[*] REVENUE BY HOUR:");
+        print_separator();
+        for (int i = 0; i < hour_count; i++) {
+            if (hours[i].orders == 0) continue;
+            char label[10];
+            sprintf(label, "%02ld:00", hours[i].bucket % 100);
+            print_revenue_bar(label, &hours[i], max_revenue);
+        }
+    }
+
+    // Month over month
+    RollupPoint this_month, last_month;
+    long month = rollup_bucket(ROLLUP_MONTH, now);
+    rollup_get(ROLLUP_MONTH, month, ROLLUP_ANY, NULL, &this_month);
+    rollup_get(ROLLUP_MONTH, rollup_step(ROLLUP_MONTH, month, -1), ROLLUP_ANY, NULL, &last_month);
+
+    printf("\n");
+    print_separator();
+    center_print("[*] MONTH OVER MONTH");
+    sprintf(dashboard_msg, "[$] This Month: $%.2f (%d orders)", this_month.revenue, this_month.orders);
+    center_print(dashboard_msg);
+    sprintf(dashboard_msg, "[$] Last Month: $%.2f (%d orders)", last_month.revenue, last_month.orders);
+    center_print(dashboard_msg);
+    if (last_month.revenue > 0) {
+        sprintf(dashboard_msg, "[*] Change: %+.1f%%", (this_month.revenue - last_month.revenue) / last_month.revenue * 100);
+        center_print(dashboard_msg);
+    }
+
+    // Quick stats
+    GarageStats stats;
+    garage_count_records(&stats);
+
+    printf("\n");
+    print_separator();
+    center_print("[*] QUICK SYSTEM STATUS");
+
+    sprintf(dashboard_msg, "[#] Total Customers: %d", stats.customers);
+    center_print(dashboard_msg);
+
+    sprintf(dashboard_msg, "[*] Cars in Garage: %d", stats.total_cars);
+    center_print(dashboard_msg);
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Add part to inventory
+ */
+void add_part() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[+] ADD NEW PART");
+    print_separator();
+
+    GaragePart part;
+
+    printf("\n");
+    center_prompt("Part Name: ");
+    scanf("%49s", part.name);
+
+    center_prompt("Specifications: ");
+    scanf("%49s", part.spec);
+
+    center_prompt("Price: $");
+    scanf("%f", &part.price);
+
+    int quantity;
+    center_prompt("Units in Stock: ");
+    scanf("%d", &quantity);
+    if (quantity < 0) quantity = 0;
+
+    if (!garage_add_part(&part)) {
+        center_print("[X] Error opening inventory file.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+    if (!stock_add(part.name, quantity)) {
+        center_print("[X] Part added, but its stock could not be recorded.");
+    }
+
+    printf("\n");
+    center_print("[+] Part added successfully!");
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Delete part from inventory
+ */
+void delete_part() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[-] DELETE PART");
+    print_separator();
+
+    FILE *f = fopen(PARTS_FILE, "r");
+    FILE *temp = fopen("temp.txt", "w");
+    char part[50], spec[50], target[50];
+    float price;
+    int found = 0;
+
+    if (!f || !temp) {
+        center_print("[X] Error opening files.");
+        if (f) fclose(f);
+        if (temp) fclose(temp);
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    printf("\n");
+    center_prompt("Enter part name to delete: ");
+    scanf("%s", target);
+
+    while (fscanf(f, "%s %s %f", part, spec, &price) == 3) {
+        if (strcmp(part, target) != 0) {
+            fprintf(temp, "%s %s %.2f\n", part, spec, price);
+        } else {
+            found = 1;
+        }
+    }
+
+    fclose(f);
+    fclose(temp);
+    remove(PARTS_FILE);
+    rename("temp.txt", PARTS_FILE);
+    if (found) stock_drop(target);
+
+    printf("\n");
+    if (found)
+        center_print("[+] Part deleted successfully!");
+    else
+        center_print("[X] Part not found.");
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Add delivered units to a part's stock (or write some off)
+ */
+void restock_part() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[+] RESTOCK PART");
+    print_separator();
+
+    char name[50];
+    int quantity;
+
+    printf("\n");
+    center_prompt("Part Name: ");
+    scanf("%49s", name);
+
+    center_prompt("Units Received (negative to write off): ");
+    scanf("%d", &quantity);
+
+    printf("\n");
+    if (!stock_add(name, quantity)) {
+        center_print("[X] Error opening stock file.");
+    } else {
+        char stock[40], message[120];
+        format_stock(name, stock, sizeof(stock));
+        snprintf(message, sizeof(message), "[+] %s now has %s.", name, stock);
+        center_print(message);
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * A part's stock as shown in the lists ("12 in stock", "2 left",
+ * "out of stock"); "-" for parts that were never stocked
+ */
+void format_stock(const char *part, char *buffer, size_t size) {
+    StockLevel level;
+    format_stock_level(stock_get(part, &level) ? &level : NULL, buffer, size);
+}
+
+/**
+ * As format_stock() for a level already fetched; NULL for an untracked part
+ */
+void format_stock_level(const StockLevel *level, char *buffer, size_t size) {
+    if (!level) {
+        snprintf(buffer, size, "-");
+    } else if (level->available <= 0) {
+        snprintf(buffer, size, "out of stock");
+    } else if (level->available <= STOCK_LOW_LEVEL) {
+        snprintf(buffer, size, "%d left", level->available);
+    } else {
+        snprintf(buffer, size, "%d in stock", level->available);
+    }
+}
+
+/**
+ * Print one inventory row (visitor for garage_for_each_part)
+ */
+int print_part_row(const GaragePart *part, void *context) {
+    char stock[40];
+    (void)context;
+    format_stock(part->name, stock, sizeof(stock));
+    printf("%*s", (CONSOLE_WIDTH-55)/2, "");
+    printf("%-15s %-20s $%-8.2f %s\n", part->name, part->spec, part->price, stock);
+    return 0;
+}
+
+/**
+ * View all parts in inventory
+ */
+void view_parts() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] AVAILABLE PARTS INVENTORY");
+    print_separator();
+
+    if (!garage_has_file(PARTS_FILE)) {
+        center_print("[-] No parts found in inventory.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-55)/2, "");
+    printf("%-15s %-20s %-9s %s\n", "PART NAME", "SPECIFICATIONS", "PRICE ($)", "STOCK");
+    printf("%*s", (CONSOLE_WIDTH-55)/2, "");
+    for (int i = 0; i < 55; i++) printf("-");
+    printf("\n");
+
+    garage_for_each_part(print_part_row, NULL);
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Print one out-of-stock or low-stock part (visitor for stock_for_each)
+ */
+int print_stock_row(const StockLevel *level, void *context) {
+    (void)context;
+    printf("%*s", (CONSOLE_WIDTH-50)/2, "");
+    printf("%-15s %-10d %-10d %d\n", level->part, level->on_hand, level->held,
+           level->available > 0 ? level->available : 0);
+    return 0;
+}
+
+/**
+ * View not available parts: the out-of-stock and low-stock lists follow
+ * the stock levels; not_available.txt adds parts expected later
+ */
+void view_not_available_parts() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[X] OUT OF STOCK / UPCOMING PARTS");
+    print_separator();
+
+    StockList lists[2] = {STOCK_LIST_OUT, STOCK_LIST_LOW};
+    const char *titles[2] = {"[X] OUT OF STOCK", "[!] LOW STOCK"};
+    int listed = 0;
+
+    for (int i = 0; i < 2; i++) {
+        if (stock_for_each(lists[i], NULL, NULL) == 0) continue;
+
+        printf("\n");
+        center_print(titles[i]);
+        printf("%*s", (CONSOLE_WIDTH-50)/2, "");
+        printf("%-15s %-10s %-10s %s\n", "PART NAME", "ON HAND", "HELD", "AVAILABLE");
+        printf("%*s", (CONSOLE_WIDTH-50)/2, "");
+        for (int j = 0; j < 50; j++) printf("-");
+        printf("\n");
+        listed += stock_for_each(lists[i], print_stock_row, NULL);
+    }
+
+    FILE *f = fopen(NOT_AVAILABLE_FILE, "r");
+    char part[50], spec[50], date[20];
+
+    if (f) {
+        printf("\n");
+        center_print("[~] UPCOMING PARTS");
+        printf("%*s", (CONSOLE_WIDTH-50)/2, "");
+        printf("%-15s %-20s %s\n", "PART NAME", "SPECIFICATIONS", "RESTOCK DATE");
+        printf("%*s", (CONSOLE_WIDTH-50)/2, "");
+        for (int i = 0; i < 50; i++) printf("-");
+        printf("\n");
+
+        while (fscanf(f, "%49s %49s %19s", part, spec, date) == 3) {
+            printf("%*s", (CONSOLE_WIDTH-50)/2, "");
+            printf("%-15s %-20s %s\n", part, spec, date);
+            listed++;
+        }
+        fclose(f);
+    }
+
+    if (listed == 0) {
+        printf("\n");
+        center_print("[+] All parts are currently available!");
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Update user profile
+ */
+void update_profile(const char *logged_in_username) {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] UPDATE PROFILE");
+    print_separator();
+
+    FILE *f = fopen(USERS_FILE, "r");
+    FILE *temp = fopen("temp.txt", "w");
+    char username[30], password[30], role[20];
+    char name[50], email[50], phone[20];
+    int found = 0;
+
+    if (!f || !temp) {
+        center_print("[X] Error opening files.");
+        if (f) fclose(f);
+        if (temp) fclose(temp);
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    while (fscanf(f, "%s %s %s %s %s %s", role, username, password, name, email, phone) == 6) {
+        if (strcmp(username, logged_in_username) == 0) {
+            char update_msg[50];
+            sprintf(update_msg, "Updating profile for: %s", logged_in_username);
+            center_print(update_msg);
+            printf("\n");
+
+            printf("%*s", (CONSOLE_WIDTH-20)/2, "");
+            printf("New Name: ");
+            scanf("%s", name);
+
+            // Validate and get email
+            while (1) {
+                printf("%*s", (CONSOLE_WIDTH-20)/2, "");
+                printf("New Email: ");
+                scanf("%s", email);
+
+                if (validate_email(email)) {
+                    break;
+                } else {
+                    center_print("[X] Invalid email domain!");
+                }
+            }
+
+            // Validate and get phone
+            while (1) {
+                printf("%*s", (CONSOLE_WIDTH-30)/2, "");
+                printf("New Phone (01XXXXXXXXX): ");
+                scanf("%s", phone);
+
+                if (validate_phone(phone)) {
+                    break;
+                } else {
+                    center_print("[X] Invalid phone number format!");
+                }
+            }
+
+            found = 1;
+        }
+        fprintf(temp, "%s %s %s %s %s %s\n", role, username, password, name, email, phone);
+    }
+
+    fclose(f);
+    fclose(temp);
+    remove(USERS_FILE);
+    rename("temp.txt", USERS_FILE);
+
+    printf("\n");
+    if (found)
+        center_print("[+] Profile updated successfully!");
+    else
+        center_print("[X] Username not found.");
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Live part search for the order screen: the matches are redrawn after
+ * every key. Returns how many are listed when Enter is pressed (with a
+ * copy of each listed part), -1 on Esc.
+ */
+int search_parts(CatalogHit hits[], GaragePart listed[], int max) {
+    char query[CATALOG_QUERY_MAX + 1] = "";
+    int length = 0;
+
+    for (;;) {
+        int count = catalog_search(query, hits, max);
+
+        // All the listed levels in one stock.txt lock, not one per row
+        const char *names[CATALOG_MAX_HITS];
+        StockLevel levels[CATALOG_MAX_HITS];
+        int tracked[CATALOG_MAX_HITS];
+        if (count > CATALOG_MAX_HITS) count = CATALOG_MAX_HITS;
+        for (int i = 0; i < count; i++) {
+            const GaragePart *part = catalog_part(hits[i].id);
+            if (!part) {            // inventory.txt shrank since the search
+                count = i;
+                break;
+            }
+            listed[i] = *part;
+            names[i] = listed[i].name;
+        }
+        stock_get_many(names, count, levels, tracked);
+
+        screen_begin();
+        clear_screen();
+        display_ascii_logo();
+        center_print("[*] PLACE YOUR ORDER");
+        print_separator();
+        screen_puts("\n");
+        center_print("Type a part name or brand - Enter to choose, Esc to cancel");
+        screen_puts("\n");
+
+        for (int i = 0; i < count; i++) {
+            const GaragePart *part = &listed[i];
+            char part_line[150], stock[40];
+            int used;
+
+            format_stock_level(tracked[i] ? &levels[i] : NULL, stock, sizeof(stock));
+            used = snprintf(part_line, sizeof(part_line), "%d.  [%s] %s - $%.2f", i + 1, part->spec, part->name, part->price);
+            if (strcmp(stock, "-") != 0) used += snprintf(part_line + used, sizeof(part_line) - used, " (%s)", stock);
+            if (hits[i].distance > 0) snprintf(part_line + used, sizeof(part_line) - used, " ~");
+            center_print(part_line);
+        }
+        if (count == 0) center_print("[X] No matching parts.");
+        else if (hits[count - 1].distance > 0) center_print("(~ close spelling)");
+
+        char prompt[CATALOG_QUERY_MAX + 20];
+        screen_puts("\n");
+        snprintf(prompt, sizeof(prompt), "Search: %s", query);
+        center_prompt(prompt);
+        screen_end();
+        fflush(stdout);
+
+        int ch = platform_getch();
+        if (ch == EOF || ch == 27) return -1; // Esc
+        if (ch == 0 || ch == 224) {           // Windows arrow and function keys
+            platform_getch();
+        } else if (ch == '\r' || ch == '\n') {
+            // Scripted input still holds the newline left by the menu's scanf
+            if (length == 0 && ch == '\n' && !platform_stdin_is_console()) continue;
+            return count;
+        } else if (ch == '\b' || ch == 127) {
+            if (length > 0) query[--length] = '\0';
+        } else if (isprint(ch) && length < CATALOG_QUERY_MAX) {
+            query[length++] = (char)ch;
+            query[length] = '\0';
+        }
+    }
+}
+
+/**
+ * Order parts (Customer only)
+ */
+void order_parts(const char *username) {
+    if (catalog_count() == 0) {
+        clear_screen();
+        display_ascii_logo();
+        center_print("[*] PLACE YOUR ORDER");
+        print_separator();
+        if (!garage_has_file(PARTS_FILE))
+            center_print("[X] Error opening parts file.");
+        else
+            center_print("[X] No parts available in inventory.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    // Find the part by name or brand instead of scrolling the catalog
+    CatalogHit hits[CATALOG_MAX_HITS];
+    GaragePart listed[CATALOG_MAX_HITS];
+    int total_parts = search_parts(hits, listed, CATALOG_MAX_HITS);
+
+    if (total_parts < 0) return; // Cancelled
+
+    if (total_parts == 0) {
+        printf("\n");
+        center_print("[X] No matching parts.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    printf("\n");
+    int choice, quantity;
+    char prompt[100];
+    sprintf(prompt, "Select part number (1-%d): ", total_parts);
+    center_prompt(prompt);
+    scanf("%d", &choice);
+
+    if (choice < 1 || choice > total_parts) {
+        center_print("[X] Invalid part selection.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    // inventory.txt may have changed while the customer was choosing
+    const GaragePart *current = catalog_part(hits[choice - 1].id);
+    if (!current || strcmp(current->name, listed[choice - 1].name) != 0) {
+        center_print("[X] The parts list changed. Please search again.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+    GaragePart selected = *current;
+
+    center_prompt("Quantity: ");
+    scanf("%d", &quantity);
+
+    if (quantity <= 0) {
+        center_print("[X] Invalid quantity.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    // Hold the units while the customer checks out, so nobody else can
+    // buy them in the meantime
+    StockHold hold;
+    StockResult reserved = stock_reserve(selected.name, quantity, &hold);
+    if (reserved == STOCK_SHORT || reserved == STOCK_ERROR) {
+        char stock_msg[100];
+        if (reserved == STOCK_ERROR)
+            snprintf(stock_msg, sizeof(stock_msg), "[X] Stock could not be checked. Please try again.");
+        else if (hold.quantity == 0)
+            snprintf(stock_msg, sizeof(stock_msg), "[X] %s is out of stock.", selected.name);
+        else
+            snprintf(stock_msg, sizeof(stock_msg), "[X] Only %d x %s in stock.", hold.quantity, selected.name);
+        center_print(stock_msg);
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    // Ask for car number to track service progress
+    char car_number[20];
+    printf("\n");
+    center_prompt("Car Number (for service tracking): ");
+    scanf("%s", car_number);
+
+    float total_price = selected.price * quantity;
+
+    // Show order summary
+    printf("\n");
+    center_print("[*] ORDER SUMMARY:");
+    char summary[150];
+    sprintf(summary, "Part: %s | Quantity: %d | Unit Price: $%.2f", selected.name, quantity, selected.price);
+    center_print(summary);
+    sprintf(summary, "Total Amount: $%.2f", total_price);
+    center_print(summary);
+
+    // Apply promo code
+    float promo_discount = 0;
+    PromoHold promo;
+    float after_promo = apply_promo_code(username, total_price, &promo);
+    promo_discount = total_price - after_promo;
+
+    // Apply loyalty points redemption
+    float loyalty_discount = 0;
+    int loyalty_points_used = 0;
+    float final_price = apply_loyalty_discount(username, after_promo, &loyalty_discount, &loyalty_points_used);
+
+    // Show final pricing breakdown
+    if (promo_discount > 0 || loyalty_discount > 0) {
+        printf("\n");
+        center_print("[*] DISCOUNT BREAKDOWN:");
+        if (promo_discount > 0) {
+            sprintf(summary, "Promo Code Discount: -$%.2f", promo_discount);
+            center_print(summary);
+        }
+        if (loyalty_discount > 0) {
+            sprintf(summary, "Loyalty Points Discount: -$%.2f", loyalty_discount);
+            center_print(summary);
+        }
+        sprintf(summary, "Final Amount: $%.2f", final_price);
+        center_print(summary);
+    }
+
+    // Payment options
+    printf("\n");
+    center_print("[*] PAYMENT OPTIONS:");
+    center_print("1  [C]  Cash Payment");
+    center_print("2  [O]  Paid Online");
+    printf("\n");
+
+    int payment_choice;
+    center_prompt("Select payment method (1-2): ");
+    scanf("%d", &payment_choice);
+
+    char payment_method[20];
+    if (payment_choice == 1) {
+        strcpy(payment_method, "Cash");
+    } else if (payment_choice == 2) {
+        strcpy(payment_method, "Online");
+    } else {
+        center_print("[X] Invalid payment option. Defaulting to Cash.");
+        strcpy(payment_method, "Cash");
+    }
+
+    // Keep the promo use and sell the held units; a hold left too long may
+    // have been released
+    PromoStatus promo_kept = promo_commit(&promo);
+    if (promo_kept != PROMO_OK) {
+        stock_release(&hold);
+        char promo_msg[100];
+        snprintf(promo_msg, sizeof(promo_msg), "[X] %s", promo_status_text(promo_kept));
+        center_print(promo_msg);
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+    if (stock_commit(&hold) != STOCK_OK) {
+        promo_release(&promo);
+        center_print("[X] Your reserved stock was released. Please place the order again.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    // Take the points before saving, so no discount goes out unpaid
+    if (loyalty_points_used > 0) {
+        int spent = leaderboard_spend_points(username, loyalty_points_used);
+        if (spent != 1) {
+            if (hold.id != 0) stock_add(selected.name, quantity); // Put the units back
+            promo_release(&promo);
+            center_print(spent == 0 ? "[X] Insufficient points! Please place the order again."
+                                    : "[X] Could not update loyalty points.");
+            printf("\n");
+            center_print("Press any key to continue...");
+            getchar(); getchar();
+            return;
+        }
+    }
+
+    // Save order to file with payment info and date/time (stamped on save)
+    GarageOrder order;
+    strcpy(order.username, username);
+    strcpy(order.part, selected.name);
+    order.quantity = quantity;
+    order.total = final_price;
+    strcpy(order.payment, payment_method);
+    order.date_time[0] = '\0';
+
+    if (!garage_add_order(&order)) {
+        if (hold.id != 0) stock_add(selected.name, quantity); // Put the units back
+        promo_release(&promo);
+        if (loyalty_points_used > 0) leaderboard_add_points(username, loyalty_points_used, NULL); // Refund
+        center_print("[X] Error saving order.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    if (loyalty_points_used > 0) garage_record_redemption(username, loyalty_points_used, loyalty_discount);
+
+    printf("\n");
+    center_print("[+] Order placed successfully!");
+    char payment_msg[100];
+    sprintf(payment_msg, "[*] Payment Method: %s", payment_method);
+    center_print(payment_msg);
+    sprintf(payment_msg, "[*] Final Amount: $%.2f", final_price);
+    center_print(payment_msg);
+
+    // Award loyalty points (1 point per $1 spent)
+    int points_earned = (int)final_price;
+    add_loyalty_points(username, points_earned);
+    sprintf(payment_msg, "[LOYALTY] Loyalty Points Earned: %d", points_earned);
+    center_print(payment_msg);
+
+    // Auto-add service progress for the car
+    auto_add_service_progress(car_number, "ORDER_PLACED");
+    center_print("[+] Service progress updated automatically!");
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+// State shared by the order history rows
+typedef struct {
+    const char *username;
+    const char *search_date; // NULL shows every order
+    char customer_name[50];
+    char current_date[15];
+    int order_count;
+} OrderHistoryView;
+
+/**
+ * Print one order of the customer (visitor for garage_for_each_order)
+ */
+int print_history_row(const GarageOrder *order, void *context) {
+    OrderHistoryView *view = context;
+
+    if (strcmp(order->username, view->username) != 0) return 0;
+    if (view->search_date && strstr(order->date_time, view->search_date) == NULL) return 0;
+
+    view->order_count++;
+    float unit_price = order->quantity ? order->total / order->quantity : 0; // Calculate unit price
+    printf("%*s", (CONSOLE_WIDTH-95)/2, "");
+    printf("%-4d %-15s %-8d $%-9.2f $%-11.2f %-10s %-15s %-12s\n",
+           view->order_count, order->part, order->quantity, unit_price, order->total,
+           order->payment, view->customer_name, view->current_date);
+    return 0;
+}
+
+/**
+ * View Order History
+ */
+void view_order_history(const char *username) {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[H] ORDER HISTORY");
+    print_separator();
+
+    HistorySummary summary;
+    if (history_get(username, &summary) > 0) {
+        char summary_msg[200];
+        printf("\n");
+        sprintf(summary_msg, "%d orders  |  $%.2f spent  |  Last: %.24s", summary.order_count,
+                summary.total_spent, summary.last_order[0] ? summary.last_order : "N/A");
+        center_print(summary_msg);
+        printf("\n");
+
+        HistoryOrder recent[HISTORY_RECENT];
+        int recent_count = history_recent(username, recent, HISTORY_RECENT);
+        center_print("Recent orders:");
+        for (int i = 0; i < recent_count; i++) {
+            printf("%*s", (CONSOLE_WIDTH-70)/2, "");
+            printf("%-15s %-6d $%-10.2f %-8s %.24s\n", recent[i].part, recent[i].quantity,
+                   recent[i].total, recent[i].payment, recent[i].date_time);
+        }
+    }
+
+    printf("\n");
+    center_print("1  [*]  View All Orders");
+    center_print("2  [F]  Filter by Date");
+    center_print("3  [<]  Back to Menu");
+    printf("\n");
+
+    int choice;
+    center_prompt("Select option (1-3): ");
+    scanf("%d", &choice);
+
+    if (!garage_has_file(ORDERS_FILE)) {
+        center_print("[X] Error opening orders file or no orders found.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    OrderHistoryView history;
+    history.username = username;
+    history.search_date = NULL;
+    history.order_count = 0;
+
+    // Get current date
+    time_t now = time(0);
+    strftime(history.current_date, sizeof(history.current_date), "%Y-%m-%d", localtime(&now));
+
+    strcpy(history.customer_name, summary.name);
+
+    if (choice == 1) {
+        // View all orders
+        clear_screen();
+        display_ascii_logo();
+        center_print("[H] YOUR ORDER HISTORY");
+        print_separator();
+        printf("\n");
+
+        // Table headers
+        printf("%*s", (CONSOLE_WIDTH-95)/2, "");
+        printf("%-4s %-15s %-8s %-10s %-12s %-10s %-15s %-12s\n", "No.", "Item Name", "Quantity", "Unit Price", "Total Cost", "Payment", "Customer Name", "Current Date");
+        printf("%*s", (CONSOLE_WIDTH-95)/2, "");
+        for (int i = 0; i < 95; i++) printf("-");
+        printf("\n");
+
+        history_for_each(username, print_history_row, &history);
+
+        if (history.order_count == 0) {
+            center_print("[X] No orders found for your account.");
+        }
+
+    } else if (choice == 2) {
+        // Filter by date
+        char search_date[20];
+        printf("\n");
+        center_prompt("Enter date to search (format: Mon Aug 09 or just Aug 09): ");
+        getchar(); // Clear buffer
+        fgets(search_date, sizeof(search_date), stdin);
+        search_date[strcspn(search_date, "\n")] = 0; // Remove newline
+
+        clear_screen();
+        display_ascii_logo();
+        center_print("[F] FILTERED ORDER HISTORY");
+        print_separator();
+        printf("\n");
+        char filter_msg[100];
+        sprintf(filter_msg, "Showing orders for: %s", search_date);
+        center_print(filter_msg);
+        printf("\n");
+
+        // Table headers
+        printf("%*s", (CONSOLE_WIDTH-95)/2, "");
+        printf("%-4s %-15s %-8s %-10s %-12s %-10s %-15s %-12s\n", "No.", "Item Name", "Quantity", "Unit Price", "Total Cost", "Payment", "Customer Name", "Current Date");
+        printf("%*s", (CONSOLE_WIDTH-95)/2, "");
+        for (int i = 0; i < 95; i++) printf("-");
+        printf("\n");
+
+        history.search_date = search_date;
+        history_for_each(username, print_history_row, &history);
+
+        if (history.order_count == 0) {
+            center_print("[X] No orders found for the specified date.");
+        }
+
+    } else if (choice == 3) {
+        return;
+    } else {
+        center_print("[X] Invalid choice.");
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+// Running total of one customer's orders
+typedef struct {
+    const char *username;
+    float sum;
+    int show_payment;
+} CustomerOrderTotal;
+
+/**
+ * Print and total one order of the customer (visitor for garage_for_each_order)
+ */
+int print_customer_order_row(const GarageOrder *order, void *context) {
+    CustomerOrderTotal *total = context;
+
+    if (strcmp(order->username, total->username) != 0) return 0;
+
+    if (total->show_payment) {
+        printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+        printf("%-15s %-10d %-8s $%.2f\n", order->part, order->quantity, order->payment, order->total);
+    } else {
+        printf("%*s", (CONSOLE_WIDTH-40)/2, "");
+        printf("%-15s %-10d $%.2f\n", order->part, order->quantity, order->total);
+    }
+    total->sum += order->total;
+    return 0;
+}
+
+/**
+ * Calculate order estimation
+ */
+float calculate_estimation(const char *username) {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[$] ORDER ESTIMATION");
+    print_separator();
+
+    if (!garage_has_file(ORDERS_FILE)) {
+        center_print("[-] No orders found.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return 0;
+    }
+
+    printf("\n");
+    center_print("[*] YOUR ORDERS:");
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+    printf("%-15s %-10s %-8s %s\n", "PART", "QUANTITY", "PAYMENT", "TOTAL ($)");
+    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+    for (int i = 0; i < 60; i++) printf("-");
+    printf("\n");
+
+    // Legacy orders come back from the core as Cash payments
+    CustomerOrderTotal estimate = {username, 0, 1};
+    history_for_each(username, print_customer_order_row, &estimate);
+
+    HistorySummary summary;
+    history_get(username, &summary);
+    float sum = (float)summary.total_spent;
+
+    printf("\n");
+    char total_msg[50];
+    sprintf(total_msg, "[$] TOTAL ESTIMATION: $%.2f", sum);
+    center_print(total_msg);
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+    return sum;
+}
+
+/**
+ * Generate invoice
+ */
+void generate_invoice(const char *actor_username, const char *actor_role) {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] GENERATE INVOICE");
+    print_separator();
+
+    char target_username[30];
+    char cust_name[50] = "N/A", cust_email[50] = "N/A", cust_phone[20] = "N/A";
+    int user_found = 0;
+
+    if (strcmp(actor_role, "Admin") == 0) {
+        printf("\n");
+        center_prompt("Customer username for invoice: ");
+        scanf("%s", target_username);
+    } else {
+        strcpy(target_username, actor_username);
+    }
+
+    GarageUser customer;
+    if (garage_find_user(target_username, &customer)) {
+        strcpy(cust_name, customer.name);
+        strcpy(cust_email, customer.email);
+        strcpy(cust_phone, customer.phone);
+        user_found = 1;
+    }
+
+    if (!user_found) {
+        center_print("[X] Customer not found.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    printf("\n");
+    print_separator();
+    center_print("[*] OFFICIAL INVOICE");
+    print_separator();
+
+    char customer_info[100];
+    sprintf(customer_info, "Customer: %s", cust_name);
+    center_print(customer_info);
+
+    sprintf(customer_info, "Email: %s", cust_email);
+    center_print(customer_info);
+
+    sprintf(customer_info, "Phone: %s", cust_phone);
+    center_print(customer_info);
+
+    print_separator();
+
+    // Show order details without clearing screen
+    CustomerOrderTotal invoice = {target_username, 0, 0};
+
+    if (garage_has_file(ORDERS_FILE)) {
+        printf("\n");
+        center_print("[*] ORDER DETAILS:");
+        printf("\n");
+        printf("%*s", (CONSOLE_WIDTH-40)/2, "");
+        printf("%-15s %-10s %s\n", "PART", "QUANTITY", "TOTAL ($)");
+        printf("%*s", (CONSOLE_WIDTH-40)/2, "");
+        for (int i = 0; i < 40; i++) printf("-");
+        printf("\n");
+
+        history_for_each(target_username, print_customer_order_row, &invoice);
+    }
+    float sum = invoice.sum;
+
+    float vat = sum * VAT_RATE;
+
+    printf("\n");
+    print_separator();
+    char vat_msg[50], final_msg[50];
+    sprintf(vat_msg, "VAT (%.0f%%): $%.2f", VAT_RATE * 100, vat);
+    sprintf(final_msg, "TOTAL WITH VAT: $%.2f", sum + vat);
+
+    center_print(vat_msg);
+    center_print(final_msg);
+    print_separator();
+
+    // Generate QR receipt after invoice
+    char service_details[200];
+    sprintf(service_details, "Invoice_Total:$%.2f_VAT:$%.2f_Customer:%s", sum + vat, vat, cust_name);
+    generate_qr_receipt(target_username, service_details, sum + vat);
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Month-end invoicing: every customer's invoice and QR receipt in one run
+ */
+void batch_invoicing() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] BATCH INVOICING (ALL CUSTOMERS)");
+    print_separator();
+
+    printf("\n");
+    InvoiceBatchOptions options;
+    options.from_date = read_date_filter("From date (YYYY-MM-DD, 0 for all): ");
+    options.to_date = read_date_filter("To date (YYYY-MM-DD, 0 for all): ");
+
+    if (options.from_date < 0 || options.to_date < 0) {
+        center_print("[X] Invalid date. Use the YYYY-MM-DD format.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    char answer[10];
+    center_prompt("Generate QR receipts? (y/n): ");
+    scanf("%9s", answer);
+    options.write_receipts = (answer[0] == 'y' || answer[0] == 'Y');
+
+    center_prompt("Worker threads (1-16): ");
+    if (scanf("%d", &options.workers) != 1) options.workers = 1;
+
+    char path[64];
+    if (options.from_date || options.to_date) {
+        sprintf(path, "invoices_%ld_%ld.txt", options.from_date, options.to_date);
+    } else {
+        strcpy(path, "invoices_all.txt");
+    }
+    options.invoices_path = path;
+    options.vat_rate = VAT_RATE;
+
+    center_print("[*] Generating invoices...");
+    double started = platform_seconds();
+    InvoiceBatchResult result;
+    int invoices = invoice_run_batch(&options, &result);
+    double seconds = platform_seconds() - started;
+
+    printf("\n");
+    char result_msg[150];
+    if (invoices == INVOICE_NO_ORDERS) {
+        center_print("[-] No orders found.");
+    } else if (invoices == INVOICE_WRITE_FAILED) {
+        sprintf(result_msg, "[X] Could not write %s.", path);
+        center_print(result_msg);
+    } else {
+        sprintf(result_msg, "[OK] %d invoices (%d orders) written to %s in %.2f seconds.",
+                result.customers, result.orders, path, seconds);
+        center_print(result_msg);
+        if (options.write_receipts) {
+            sprintf(result_msg, "[+] %d QR receipts added to %s", result.customers, QR_RECEIPTS_FILE);
+            center_print(result_msg);
+        }
+
+        printf("\n");
+        sprintf(result_msg, "Subtotal: $%.2f", result.subtotal);
+        center_print(result_msg);
+        sprintf(result_msg, "VAT (%.0f%%): $%.2f", VAT_RATE * 100, result.vat);
+        center_print(result_msg);
+        sprintf(result_msg, "TOTAL WITH VAT: $%.2f", result.total);
+        center_print(result_msg);
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Car management functions
+ */
+void add_car() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] ADD CAR TO GARAGE");
+    print_separator();
+
+    FILE *f = fopen(CARS_FILE, "a");
+    if (!f) {
+        center_print("[X] Error opening cars file.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    char number[20], time[20];
+
+    printf("\n");
+    center_prompt("Car Number: ");
+    scanf("%s", number);
+
+    center_prompt("Entry Time: ");
+    scanf("%s", time);
+
+    fprintf(f, "%s %s\n", number, time);
+    fclose(f);
+
+    printf("\n");
+    center_print("[+] Car added to garage successfully!");
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+// Rows of the paged car listing (cars.txt lines are free text)
+int car_line_matches(const char *line, void *context) {
+    const char *search_date = context;
+    return !search_date || strstr(line, search_date) != NULL;
+}
+
+void print_cars_header() {
+    screen_pad((CONSOLE_WIDTH-30)/2, ' ');
+    screen_printf("%-15s %s\n", "CAR NUMBER", "ENTRY TIME");
+    screen_pad((CONSOLE_WIDTH-30)/2, ' ');
+    screen_pad(30, '-');
+    screen_puts("\n");
+}
+
+void render_car_line(const char *line, void *context) {
+    (void)context;
+    screen_pad((CONSOLE_WIDTH-30)/2, ' ');
+    screen_write(line, strcspn(line, "\r\n"));
+    screen_puts("\n");
+}
+
+void view_cars() {
+    screen_begin();
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] CARS IN GARAGE");
+    print_separator();
+
+    screen_puts("\n");
+    center_print("1  [*]  View All Cars");
+    center_print("2  [F]  Filter by Date");
+    center_print("3  [<]  Back to Menu");
+    screen_puts("\n");
+
+    int choice;
+    center_prompt("Select option (1-3): ");
+    screen_end();
+    scanf("%d", &choice);
+
+    if (choice == 1) {
+        // View all cars
+        PagedTable table = {
+            "[*] ALL CARS IN GARAGE", NULL, CARS_FILE, "[P] No cars in garage.",
+            print_cars_header, render_car_line, car_line_matches, NULL, NULL
+        };
+        browse_table(&table);
+
+    } else if (choice == 2) {
+        // Filter by date
+        char search_date[20];
+        screen_puts("\n");
+        center_prompt("Enter date to search (format: Mon Aug 09 or just Aug 09): ");
+        getchar(); // Clear buffer
+        fgets(search_date, sizeof(search_date), stdin);
+        search_date[strcspn(search_date, "\n")] = 0; // Remove newline
+
+        char filter_msg[100];
+        sprintf(filter_msg, "Showing cars for: %s", search_date);
+
+        PagedTable table = {
+            "[F] FILTERED CARS BY DATE", filter_msg, CARS_FILE, "[P] No cars found for the specified date.",
+            print_cars_header, render_car_line, car_line_matches, NULL, search_date
+        };
+        browse_table(&table);
+
+    } else if (choice != 3) {
+        center_print("[X] Invalid choice.");
+        screen_puts("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+    }
+}
+
+void delete_car() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[-] REMOVE CAR FROM GARAGE");
+    print_separator();
+
+    FILE *f = fopen(CARS_FILE, "r");
+    if (!f) {
+        center_print("[P] No cars in garage.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    FILE *temp = fopen("temp_cars.txt", "w");
+    if (!temp) {
+        center_print("[X] Error creating temporary file.");
+        fclose(f);
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    char number[20], time[20], target[20];
+    int found = 0;
+
+    printf("\n");
+    center_prompt("Car number to remove: ");
+    scanf("%s", target);
+
+    while (fscanf(f, "%s %s", number, time) == 2) {
+        if (strcmp(number, target) != 0) {
+            fprintf(temp, "%s %s\n", number, time);
+        } else {
+            found = 1;
+        }
+    }
+
+    fclose(f);
+    fclose(temp);
+    remove(CARS_FILE);
+    rename("temp_cars.txt", CARS_FILE);
+
+    printf("\n");
+    if (found)
+        center_print("[+] Car removed from garage successfully!");
+    else
+        center_print("[X] Car not found.");
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+void modify_car() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] MODIFY CAR ENTRY");
+    print_separator();
+
+    FILE *f = fopen(CARS_FILE, "r");
+    if (!f) {
+        center_print("[P] No cars in garage.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    FILE *temp = fopen("temp_cars.txt", "w");
+    if (!temp) {
+        center_print("[X] Error creating temporary file.");
+        fclose(f);
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    char number[20], time[20], target[20];
+    int found = 0;
+
+    printf("\n");
+    center_prompt("Car number to modify: ");
+    scanf("%s", target);
+
+    while (fscanf(f, "%s %s", number, time) == 2) {
+        if (strcmp(number, target) == 0) {
+            center_prompt("New entry time: ");
+            scanf("%s", time);
+            found = 1;
+        }
+        fprintf(temp, "%s %s\n", number, time);
+    }
+
+    fclose(f);
+    fclose(temp);
+    remove(CARS_FILE);
+    rename("temp_cars.txt", CARS_FILE);
+
+    printf("\n");
+    if (found)
+        center_print("[+] Car entry modified successfully!");
+    else
+        center_print("[X] Car not found.");
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+// Rows of the paged user listing
+int user_line_valid(const char *line, void *context) {
+    GarageUser user;
+    (void)context;
+    return garage_parse_user(line, &user);
+}
+
+void print_users_header() {
+    screen_pad((CONSOLE_WIDTH-70)/2, ' ');
+    screen_printf("%-12s %-15s %-20s %-15s %s\n", "ROLE", "USERNAME", "NAME", "EMAIL", "PHONE");
+    screen_pad((CONSOLE_WIDTH-70)/2, ' ');
+    screen_pad(70, '-');
+    screen_puts("\n");
+}
+
+void render_user_line(const char *line, void *context) {
+    GarageUser user;
+    (void)context;
+    if (!garage_parse_user(line, &user)) return;
+
+    screen_pad((CONSOLE_WIDTH-70)/2, ' ');
+    screen_printf("%-12s %-15s %-20s %-15s %s\n", user.role, user.username, user.name, user.email, user.phone);
+}
+
+/**
+ * Admin panel functions
+ */
+void view_all_users() {
+    PagedTable table = {
+        "[#] ALL REGISTERED USERS", NULL, USERS_FILE, "[-] No users found.",
+        print_users_header, render_user_line, user_line_valid, NULL, NULL
+    };
+    browse_table(&table);
+}
+
+/**
+ * Order lines, optionally narrowed to dates containing `context` ("Aug 09")
+ */
+int order_line_matches(const char *line, void *context) {
+    const char *search_date = context;
+    GarageOrder order;
+
+    if (!garage_parse_order(line, &order)) return 0;
+    return !search_date || strstr(order.date_time, search_date) != NULL;
+}
+
+long order_line_date(const char *line) {
+    GarageOrder order;
+    return garage_parse_order(line, &order) ? garage_order_date_key(&order) : 0;
+}
+
+void print_orders_header() {
+    screen_pad((CONSOLE_WIDTH-80)/2, ' ');
+    screen_printf("%-12s %-12s %-4s %-8s %-8s %s\n", "CUSTOMER", "PART", "QTY", "TOTAL($)", "PAYMENT", "DATE");
+    screen_pad((CONSOLE_WIDTH-80)/2, ' ');
+    screen_pad(80, '-');
+    screen_puts("\n");
+}
+
+void render_order_line(const char *line, void *context) {
+    GarageOrder order;
+    (void)context;
+    if (!garage_parse_order(line, &order)) return;
+
+    screen_pad((CONSOLE_WIDTH-80)/2, ' ');
+    screen_printf("%-12s %-12s %-4d $%-7.2f %-8s %s\n", order.username, order.part, order.quantity,
+                  order.total, order.payment, order.legacy ? "Legacy Order" : order.date_time);
+}
+
+void view_all_orders() {
+    screen_begin();
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] ALL CUSTOMER ORDERS");
+    print_separator();
+
+    screen_puts("\n");
+    center_print("1  [*]  View All Orders");
+    center_print("2  [F]  Filter by Date");
+    center_print("3  [<]  Back to Menu");
+    screen_puts("\n");
+
+    int choice;
+    center_prompt("Select option (1-3): ");
+    screen_end();
+    scanf("%d", &choice);
+
+    if (choice == 1) {
+        // View all orders
+        PagedTable table = {
+            "[*] ALL CUSTOMER ORDERS", NULL, ORDERS_FILE, "[-] No orders found.",
+            print_orders_header, render_order_line, order_line_matches, order_line_date, NULL
+        };
+        browse_table(&table);
+
+    } else if (choice == 2) {
+        // Filter by date
+        char search_date[20];
+        screen_puts("\n");
+        center_prompt("Enter date to search (format: Mon Aug 09 or just Aug 09): ");
+        getchar(); // Clear buffer
+        fgets(search_date, sizeof(search_date), stdin);
+        search_date[strcspn(search_date, "\n")] = 0; // Remove newline
+
+        char filter_msg[100];
+        sprintf(filter_msg, "Showing orders for: %s", search_date);
+
+        PagedTable table = {
+            "[F] FILTERED ORDERS BY DATE", filter_msg, ORDERS_FILE, "[-] No orders found for the specified date.",
+            print_orders_header, render_order_line, order_line_matches, NULL, search_date
+        };
+        browse_table(&table);
+
+    } else if (choice != 3) {
+        center_print("[X] Invalid choice.");
+        screen_puts("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+    }
+}
+
+/**
+ * Order totals for a date range (YYYYMMDD, 0 = open end) from the daily
+ * rollups, or for all time (legacy orders included) when both ends are open
+ */
+void fill_order_stats(long from, long to, GarageStats *stats) {
+    RollupPoint total, cash, online;
+
+    if (from == 0 && to == 0) {
+        rollup_get(ROLLUP_ALL, 0, ROLLUP_ANY, NULL, &total);
+        rollup_get(ROLLUP_ALL, 0, ROLLUP_PAYMENT, "Cash", &cash);
+        rollup_get(ROLLUP_ALL, 0, ROLLUP_PAYMENT, "Online", &online);
+    } else {
+        rollup_sum(ROLLUP_DAY, from, to, ROLLUP_ANY, NULL, &total);
+        rollup_sum(ROLLUP_DAY, from, to, ROLLUP_PAYMENT, "Cash", &cash);
+        rollup_sum(ROLLUP_DAY, from, to, ROLLUP_PAYMENT, "Online", &online);
+    }
+
+    stats->total_orders = total.orders;
+    stats->total_revenue = (float)total.revenue;
+    stats->cash_payments = cash.orders;
+    stats->cash_revenue = (float)cash.revenue;
+    stats->online_payments = online.orders;
+    stats->online_revenue = (float)online.revenue;
+}
+
+/**
+ * Revenue, orders and units for the last 12 months
+ */
+void view_monthly_trend() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] MONTHLY REVENUE TREND");
+    print_separator();
+
+    RollupPoint months[12];
+    long last = rollup_bucket(ROLLUP_MONTH, time(NULL));
+    int count = rollup_series(ROLLUP_MONTH, rollup_step(ROLLUP_MONTH, last, -11), last,
+                              ROLLUP_ANY, NULL, months, 12);
+
+    double max_revenue = 0;
+    for (int i = 0; i < count; i++) {
+        if (months[i].revenue > max_revenue) max_revenue = months[i].revenue;
+    }
+
+    printf("\n");
+    for (int i = 0; i < count; i++) {
+        char label[48];
+        snprintf(label, sizeof(label), "%04ld-%02ld", months[i].bucket / 100, months[i].bucket % 100);
+        print_revenue_bar(label, &months[i], max_revenue);
+    }
+
+    RollupPoint this_month = months[count - 1], previous = months[count - 2];
+    printf("\n");
+    char trend_msg[100];
+    sprintf(trend_msg, "[#] Units This Month: %d", this_month.units);
+    center_print(trend_msg);
+    if (previous.revenue > 0) {
+        sprintf(trend_msg, "[*] Month over Month: %+.1f%%", (this_month.revenue - previous.revenue) / previous.revenue * 100);
+        center_print(trend_msg);
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+void system_statistics() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] SYSTEM STATISTICS");
+    print_separator();
+
+    printf("\n");
+    center_print("1  [*]  View All Statistics");
+    center_print("2  [F]  Statistics by Date Range");
+    center_print("3  [#]  Monthly Revenue Trend");
+    center_print("4  [<]  Back to Menu");
+    printf("\n");
+
+    int choice;
+    center_prompt("Select option (1-4): ");
+    scanf("%d", &choice);
+
+    if (choice == 4) {
+        return;
+    }
+    if (choice == 3) {
+        view_monthly_trend();
+        return;
+    }
+
+    long from = 0, to = 0;
+    int filtered = 0;
+
+    if (choice == 2) {
+        printf("\n");
+        from = read_date_filter("From date (YYYY-MM-DD, 0 = any): ");
+        to = read_date_filter("To date (YYYY-MM-DD, 0 = any): ");
+        if (from < 0 || to < 0) {
+            center_print("[X] Invalid date.");
+            printf("\n");
+            center_print("Press any key to continue...");
+            getchar(); getchar();
+            return;
+        }
+        filtered = 1;
+    }
+
+    // Users, parts and cars are counted; order totals come from the rollups
+    GarageStats stats;
+    garage_count_records(&stats);
+    fill_order_stats(from, to, &stats);
+
+    clear_screen();
+    display_ascii_logo();
+    if (filtered) {
+        center_print("[F] FILTERED SYSTEM STATISTICS");
+        print_separator();
+        printf("\n");
+        char from_text[GARAGE_DATE_TEXT], to_text[GARAGE_DATE_TEXT], filter_msg[100];
+        garage_format_date_key(from, from_text, sizeof(from_text));
+        garage_format_date_key(to, to_text, sizeof(to_text));
+        sprintf(filter_msg, "Statistics for: %s to %s", from_text, to_text);
+        center_print(filter_msg);
+    } else {
+        center_print("[*] SYSTEM STATISTICS");
+        print_separator();
+    }
+
+    printf("\n");
+    char stat_msg[100];
+
+    if (!filtered) {
+        sprintf(stat_msg, "[#] Total Users: %d", stats.total_users);
+        center_print(stat_msg);
+        sprintf(stat_msg, "   * Customers: %d", stats.customers);
+        center_print(stat_msg);
+        sprintf(stat_msg, "   * Admins: %d", stats.admins);
+        center_print(stat_msg);
+
+        printf("\n");
+        sprintf(stat_msg, "[*] Total Parts in Inventory: %d", stats.total_parts);
+        center_print(stat_msg);
+        sprintf(stat_msg, "[*] Cars in Garage: %d", stats.total_cars);
+        center_print(stat_msg);
+        printf("\n");
+    }
+
+    sprintf(stat_msg, "[*] Total Orders: %d", stats.total_orders);
+    center_print(stat_msg);
+    sprintf(stat_msg, "[$] Total Revenue: $%.2f", stats.total_revenue);
+    center_print(stat_msg);
+
+    printf("\n");
+    center_print("[*] PAYMENT STATISTICS:");
+    sprintf(stat_msg, "   * Cash Payments: %d (Revenue: $%.2f)", stats.cash_payments, stats.cash_revenue);
+    center_print(stat_msg);
+    sprintf(stat_msg, "   * Online Payments: %d (Revenue: $%.2f)", stats.online_payments, stats.online_revenue);
+    center_print(stat_msg);
+
+    if (from || to) {
+        printf("\n");
+        center_print("(Orders placed before dates were recorded count in View All only.)");
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Read one end of a report date range: YYYY-MM-DD, or 0 to leave it open.
+ * Returns 0 for an open end, -1 for text that is not a date.
+ */
+long read_date_filter(const char *prompt) {
+    char date[20];
+
+    center_prompt(prompt);
+    if (scanf("%19s", date) != 1 || strcmp(date, "0") == 0) return 0;
+
+    long date_key = garage_date_key(date);
+    return date_key ? date_key : -1;
+}
+
+/**
+ * Export reports to CSV or JSON files for accounting and BI tools
+ */
+void export_reports() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[>] EXPORT REPORTS");
+    print_separator();
+
+    printf("\n");
+    center_print("1  [*]  Orders by Date Range");
+    center_print("2  [$]  Revenue by Payment Method");
+    center_print("3  [LOYALTY] Loyalty Balances");
+    center_print("4  [*]  Parking Log");
+    center_print("5  [@]  Customer 360 (All Customers)");
+    center_print("6  [<]  Back to Menu");
+    printf("\n");
+
+    int choice;
+    center_prompt("Select report (1-6): ");
+    scanf("%d", &choice);
+
+    if (choice == 6) {
+        return;
+    }
+    if (choice < 1 || choice > 5) {
+        center_print("[X] Invalid choice.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    int format_choice;
+    center_prompt("Format (1 = CSV, 2 = JSON): ");
+    scanf("%d", &format_choice);
+    ExportFormat format = (format_choice == 2) ? EXPORT_JSON : EXPORT_CSV;
+
+    long from_date = 0, to_date = 0;
+    if (choice != 3 && choice != 5) {
+        from_date = read_date_filter("From date (YYYY-MM-DD, 0 for all): ");
+        to_date = read_date_filter("To date (YYYY-MM-DD, 0 for all): ");
+
+        if (from_date < 0 || to_date < 0) {
+            center_print("[X] Invalid date. Use the YYYY-MM-DD format.");
+            printf("\n");
+            center_print("Press any key to continue...");
+            getchar(); getchar();
+            return;
+        }
+    }
+
+    static const char *report_names[] = {"orders", "revenue_by_payment", "loyalty_balances", "parking_log", "customer_360"};
+    char path[64];
+    sprintf(path, "%s_export.%s", report_names[choice - 1], export_extension(format));
+
+    center_print("[*] Exporting...");
+    double started = platform_seconds();
+    int rows = 0;
+
+    switch (choice) {
+        case 1: rows = export_orders(path, format, from_date, to_date); break;
+        case 2: rows = export_revenue_by_payment(path, format, from_date, to_date); break;
+        case 3: rows = export_loyalty_balances(path, format); break;
+        case 4: rows = export_parking_log(path, format, from_date, to_date); break;
+        case 5: rows = export_customers(path, format); break;
+    }
+
+    double seconds = platform_seconds() - started;
+    char result_msg[150];
+
+    printf("\n");
+    if (rows == EXPORT_NO_SOURCE) {
+        center_print("[X] No records found to export.");
+    } else if (rows == EXPORT_WRITE_FAILED) {
+        sprintf(result_msg, "[X] Could not write %s.", path);
+        center_print(result_msg);
+    } else {
+        sprintf(result_msg, "[OK] %d rows written to %s in %.2f seconds.", rows, path, seconds);
+        center_print(result_msg);
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * One customer's card on the 360 screen
+ */
+void print_customer_view(const CustomerView *view) {
+    char line[200];
+
+    print_separator();
+    if (view->registered) {
+        sprintf(line, "[@] %s (%s)", view->user.name, view->user.username);
+        center_print(line);
+        sprintf(line, "%s  |  %s  |  %s", view->user.role, view->user.email, view->user.phone);
+        center_print(line);
+    } else {
+        sprintf(line, "[@] %s (not registered)", view->user.username);
+        center_print(line);
+    }
+    printf("\n");
+
+    sprintf(line, "Orders: %-5d Spent: $%-10.2f Last order: %s", view->order_count, view->total_spent,
+            view->last_order[0] ? view->last_order : "N/A");
+    center_print(line);
+    sprintf(line, "Loyalty: %-5d points   Badges: %-3d Latest badge: %s", view->loyalty_points,
+            view->badge_count, view->latest_badge[0] ? view->latest_badge : "None");
+    center_print(line);
+    sprintf(line, "Redemptions: %-3d (%d points, $%.2f off)   QR receipts: %d", view->redemptions,
+            view->points_redeemed, view->discount_total, view->receipt_count);
+    center_print(line);
+    sprintf(line, "Parking stays: %-4d Last car: %s %s", view->parking_stays,
+            view->last_car[0] ? view->last_car : "N/A", view->last_parking);
+    center_print(line);
+}
+
+/**
+ * Customer 360: users, orders, loyalty, badges, redemptions, receipts
+ * and parking for one or more customers at once
+ */
+void customer_360_view() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[@] CUSTOMER 360 VIEW");
+    print_separator();
+
+    char usernames[300];
+    printf("\n");
+    center_print("Enter one or more usernames separated by spaces.");
+    center_print("(Export Reports > Customer 360 gives the table for everyone.)");
+    center_prompt("Usernames: ");
+    getchar(); // Clear buffer
+    if (!fgets(usernames, sizeof(usernames), stdin)) return;
+
+    clear_screen();
+    display_ascii_logo();
+    center_print("[@] CUSTOMER 360 VIEW");
+
+    int shown = 0;
+    for (char *username = strtok(usernames, " \t\r\n"); username; username = strtok(NULL, " \t\r\n")) {
+        CustomerView view;
+        if (customers_get(username, &view)) {
+            print_customer_view(&view);
+        } else {
+            char msg[100];
+            print_separator();
+            sprintf(msg, "[X] No records for %.40s.", username);
+            center_print(msg);
+        }
+        shown++;
+    }
+    if (shown == 0) {
+        center_print("[X] No username entered.");
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar();
+}
+
+void admin_panel(const char *admin_username) {
+    int choice;
+
+    while (1) {
+        clear_screen();
+
+        // Display developer copyright in lower right corner first
+        display_developer_copyright();
+
+        display_ascii_logo();
+        center_print("[#] ADMIN CONTROL PANEL");
+        center_print("System Administration Dashboard");
+        print_separator();
+
+        char welcome_msg[50];
+        sprintf(welcome_msg, "Welcome, Administrator: %s", admin_username);
+        center_print(welcome_msg);
+
+        printf("\n");
+        center_print("1  [*]  Daily Dashboard");
+        center_print("2  [#]  View All Users");
+        center_print("3  [*]  Manage Inventory");
+        center_print("4  [*]  View All Orders");
+        center_print("5  [*]  Generate Invoices");
+        center_print("6  [*]  Car Management");
+        center_print("7  [%]  Manage Discounts");
+        center_print("8  [*]  Appointment Management");
+        center_print("9  [X]  View Out of Stock Parts");
+        center_print("10  [*]  View Car Parking Records");
+        center_print("11  [*]  System Statistics");
+        center_print("12  [LOYALTY] Loyalty System Dashboard");
+        center_print("13  [>]  Export Reports");
+        center_print("14  [@]  Customer 360 View");
+        center_print("15  [X]  Return to Main Menu");
+
+        // Display "Enter choice:" in upper right
+        printf("\n\n");
+        right_prompt("Enter choice: ");
+
+        // Save cursor position for input
+        platform_save_cursor();
+
+        // Display developer copyright in lower right corner
+        display_developer_copyright();
+
+        // Return cursor to input position
+        platform_restore_cursor();
+        scanf("%d", &choice);
+
+        switch (choice) {
+            case 1: daily_dashboard(); break;
+            case 2: view_all_users(); break;
+            case 3: {
+                int inv_choice;
+                clear_screen();
+                display_ascii_logo();
+                center_print("[*] INVENTORY MANAGEMENT");
+                print_separator();
+                center_print("1  [+]  Add Part");
+                center_print("2  [-]  Delete Part");
+                center_print("3  [*]  View Parts");
+                center_print("4  [+]  Restock Part");
+                center_print("5  [<]  Back");
+                printf("\n");
+                center_prompt("Enter choice: ");
+                scanf("%d", &inv_choice);
+
+                switch (inv_choice) {
+                    case 1: add_part(); break;
+                    case 2: delete_part(); break;
+                    case 3: view_parts(); break;
+                    case 4: restock_part(); break;
+                    case 5: break;
+                    default:
+                        center_print("[X] Invalid choice.");
+                        printf("\n");
+                        center_print("Press any key to continue...");
+                        getchar(); getchar();
+                }
+                break;
+            }
+            case 4: view_all_orders(); break;
+            case 5: {
+                int invoice_choice;
+                clear_screen();
+                display_ascii_logo();
+                center_print("[*] INVOICES");
+                print_separator();
+                center_print("1  [*]  Single Customer Invoice");
+                center_print("2  [*]  Batch Invoicing (All Customers)");
+                center_print("3  [QR] Verify QR Receipt");
+                center_print("4  [<]  Back");
+                printf("\n");
+                center_prompt("Enter choice: ");
+                scanf("%d", &invoice_choice);
+
+                switch (invoice_choice) {
+                    case 1: generate_invoice(admin_username, "Admin"); break;
+                    case 2: batch_invoicing(); break;
+                    case 3: verify_qr_receipt(); break;
+                    case 4: break;
+                    default:
+                        center_print("[X] Invalid choice.");
+                        printf("\n");
+                        center_print("Press any key to continue...");
+                        getchar(); getchar();
+                }
+                break;
+            }
+            case 6: {
+                int car_choice;
+                clear_screen();
+                display_ascii_logo();
+                center_print("[*] CAR MANAGEMENT");
+                print_separator();
+                center_print("1  [+]  Add Car");
+                center_print("2  [*]  View Cars");
+                center_print("3  [-]  Remove Car");
+                center_print("4  [*]  Modify Car");
+                center_print("5  [<]  Back");
+                printf("\n");
+                center_prompt("Enter choice: ");
+                scanf("%d", &car_choice);
+
+                switch (car_choice) {
+                    case 1: add_car(); break;
+                    case 2: view_cars(); break;
+                    case 3: delete_car(); break;
+                    case 4: modify_car(); break;
+                    case 5: break;
+                    default:
+                        center_print("[X] Invalid choice.");
+                        printf("\n");
+                        center_print("Press any key to continue...");
+                        getchar(); getchar();
+                }
+                break;
+            }
+            case 7: manage_discounts(); break;
+            case 8: manage_appointments(); break;
+            case 9: view_not_available_parts(); break;
+            case 10: view_car_parking(); break;
+            case 11: system_statistics(); break;
+            case 12: admin_loyalty_dashboard(); break;
+            case 13: export_reports(); break;
+            case 14: customer_360_view(); break;
+            case 15:
+                center_print("[*] Admin logged out successfully.");
+                printf("\n");
+                center_print("[*] Thank you for using Smart Garage Management System!");
+                center_print("Goodbye!");
+                printf("\n");
+                center_print("Press any key to continue...");
+                getchar(); getchar();
+                return;
+            default:
+                center_print("[X] Invalid choice.");
+                printf("\n");
+                center_print("Press any key to continue...");
+                getchar(); getchar();
+        }
+    }
+}
+
+/**
+ * Initialize default discount codes
+ */
+void initialize_default_discounts() {
+    FILE *f = fopen(DISCOUNTS_FILE, "r");
+    if (f) {
+        fclose(f);
+        return; // File exists, don't overwrite
+    }
+
+    f = fopen(DISCOUNTS_FILE, "w");
+    if (f) {
+        fprintf(f, "OFF10 10.0\n");
+        fprintf(f, "OFF25 25.0\n");
+        fprintf(f, "OFF50 50.0\n");
+        fprintf(f, "SAVE15 15.0\n");
+        fprintf(f, "WELCOME20 20.0\n");
+        fclose(f);
+    }
+}
+
+/**
+ * Apply promo code and return discounted amount. An accepted code's use is
+ * held in *promo (promo->id is 0 when none); the caller keeps it with
+ * promo_commit() or gives it back with promo_release().
+ */
+float apply_promo_code(const char *username, float total_amount, PromoHold *promo) {
+    char promo_code[PROMO_CODE_MAX];
+
+    promo->id = 0;
+    printf("\n");
+    center_prompt("Enter promo code (or 'SKIP' to skip): ");
+    scanf("%19s", promo_code);
+
+    if (strcmp(promo_code, "SKIP") == 0 || strcmp(promo_code, "skip") == 0) {
+        return total_amount;
+    }
+
+    // Remove % symbol if present at the end
+    int len = strlen(promo_code);
+    if (len > 0 && promo_code[len-1] == '%') {
+        promo_code[len-1] = '\0';
+    }
+
+    // Hold one use, so no other checkout can take it meanwhile
+    PromoStatus status = promo_hold(promo_code, username, promo);
+
+    if (status == PROMO_OK) {
+        float discount_percent = promo->percent;
+        float discount_amount = total_amount * (discount_percent / 100.0f);
+        float final_amount = total_amount - discount_amount;
+
+        char discount_msg[100];
+        sprintf(discount_msg, "[*] Promo Code Applied: %s (%.0f%% OFF)", promo_code, discount_percent);
+        center_print(discount_msg);
+
+        sprintf(discount_msg, "[*] Discount Amount: $%.2f", discount_amount);
+        center_print(discount_msg);
+
+        sprintf(discount_msg, "[$] Final Amount: $%.2f", final_amount);
+        center_print(discount_msg);
+
+        return final_amount;
+    } else {
+        char error_msg[100];
+        sprintf(error_msg, "[X] %s No discount applied.", promo_status_text(status));
+        center_print(error_msg);
+        return total_amount;
+    }
+}
+
+/**
+ * Apply loyalty points discount. The points are only chosen here; the
+ * caller spends *points_used just before the order is saved.
+ */
+float apply_loyalty_discount(const char *username, float current_amount, float *discount_applied, int *points_used) {
+    *discount_applied = 0;
+    *points_used = 0;
+
+    // Check user's current loyalty points
+    if (!garage_has_file(LOYALTY_POINTS_FILE)) {
+        printf("\n");
+        center_print("[-] No loyalty points available.");
+        return current_amount;
+    }
+
+    int current_points = garage_get_loyalty_points(username);
+
+    if (current_points <= 0) {
+        printf("\n");
+        center_print("[-] No loyalty points available for redemption.");
+        return current_amount;
+    }
+
+    // Show loyalty redemption options
+    printf("\n");
+    center_print("[LOYALTY] REDEEM LOYALTY POINTS:");
+    char points_msg[100];
+    sprintf(points_msg, "Available Points: %d", current_points);
+    center_print(points_msg);
+
+    printf("\n");
+    center_print("Redemption Options:");
+    if (current_points >= 100) center_print("1. Use 100 points -> $5 discount");
+    if (current_points >= 200) center_print("2. Use 200 points -> $12 discount");
+    if (current_points >= 500) center_print("3. Use 500 points -> $30 discount");
+    center_print("4. Skip loyalty redemption");
+
+    printf("\n");
+    center_prompt("Choose option: ");
+    int choice;
+    scanf("%d", &choice);
+
+    int points_needed = 0;
+    float discount = 0;
+
+    switch (choice) {
+        case 1:
+            if (current_points >= 100) {
+                points_needed = 100;
+                discount = 5.0;
+            } else {
+                center_print("[X] Insufficient points!");
+                return current_amount;
+            }
+            break;
+        case 2:
+            if (current_points >= 200) {
+                points_needed = 200;
+                discount = 12.0;
+            } else {
+                center_print("[X] Insufficient points!");
+                return current_amount;
+            }
+            break;
+        case 3:
+            if (current_points >= 500) {
+                points_needed = 500;
+                discount = 30.0;
+            } else {
+                center_print("[X] Insufficient points!");
+                return current_amount;
+            }
+            break;
+        case 4:
+            return current_amount;
+        default:
+            center_print("[X] Invalid choice!");
+            return current_amount;
+    }
+
+    // Apply discount (but don't make price negative)
+    if (discount > current_amount) {
+        discount = current_amount;
+    }
+
+    *discount_applied = discount;
+    *points_used = points_needed;
+
+    char success_msg[100];
+    sprintf(success_msg, "[+] Using %d loyalty points for $%.2f discount!", points_needed, discount);
+    center_print(success_msg);
+
+    return current_amount - discount;
+}
+
+/**
+ * Add new discount code
+ */
+void add_discount() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[+] ADD NEW DISCOUNT CODE");
+    print_separator();
+
+    PromoCode promo;
+    char expires[20];
+    memset(&promo, 0, sizeof(promo));
+
+    printf("\n");
+    center_prompt("Promo Code: ");
+    scanf("%19s", promo.code);
+
+    center_prompt("Discount Percentage (0-100): ");
+    scanf("%f", &promo.percent);
+
+    if (promo.percent < 0 || promo.percent > 100) {
+        center_print("[X] Invalid discount percentage! Must be 0-100.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    center_prompt("Expiry Date (YYYY-MM-DD, 0 for none): ");
+    scanf("%19s", expires);
+    if (strcmp(expires, "0") != 0) {
+        promo.expires = garage_date_key(expires);
+        if (!promo.expires) {
+            center_print("[X] Invalid date. Use the YYYY-MM-DD format.");
+            printf("\n");
+            center_print("Press any key to continue...");
+            getchar(); getchar();
+            return;
+        }
+    }
+
+    center_prompt("Maximum Uses (0 for unlimited): ");
+    scanf("%d", &promo.max_uses);
+    center_prompt("Uses per Customer (0 for unlimited): ");
+    scanf("%d", &promo.per_customer);
+
+    if (promo.max_uses < 0 || promo.per_customer < 0) {
+        center_print("[X] Use limits cannot be negative.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    int existed = promo_find(promo.code) != NULL;
+    if (!promo_add(&promo)) {
+        center_print("[X] Error saving discount code.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    printf("\n");
+    center_print(existed ? "[+] Discount code updated successfully!" : "[+] Discount code added successfully!");
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * One row of the discount code table
+ */
+int print_discount_row(const PromoCode *promo, void *context) {
+    (void)context;
+    char expires[32] = "Never";
+    char uses[24];
+    char per_customer[12] = "-";
+
+    if (promo->expires) garage_format_date_key(promo->expires, expires, sizeof(expires));
+    if (promo->max_uses) sprintf(uses, "%d/%d", promo->used, promo->max_uses);
+    else sprintf(uses, "%d", promo->used);
+    if (promo->per_customer) sprintf(per_customer, "%d", promo->per_customer);
+
+    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+    printf("%-15s %-10.1f %-12s %-10s %s\n", promo->code, promo->percent, expires, uses, per_customer);
+    return 0;
+}
+
+/**
+ * View all discount codes
+ */
+void view_discounts() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] AVAILABLE DISCOUNT CODES");
+    print_separator();
+
+    if (promo_for_each(NULL, NULL) == 0) {
+        center_print("[-] No discount codes found.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+    printf("%-15s %-10s %-12s %-10s %s\n", "PROMO CODE", "DISCOUNT %", "EXPIRES", "USED", "PER CUSTOMER");
+    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+    for (int i = 0; i < 60; i++) printf("-");
+    printf("\n");
+
+    promo_for_each(print_discount_row, NULL);
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Delete discount code
+ */
+void delete_discount() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[-] DELETE DISCOUNT CODE");
+    print_separator();
+
+    char target_code[PROMO_CODE_MAX];
+
+    printf("\n");
+    center_prompt("Enter promo code to delete: ");
+    scanf("%19s", target_code);
+
+    printf("\n");
+    if (promo_remove(target_code))
+        center_print("[+] Discount code deleted successfully!");
+    else
+        center_print("[X] Discount code not found.");
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Manage discount codes (Admin only)
+ */
+void manage_discounts() {
+    int choice;
+
+    while (1) {
+        clear_screen();
+        display_ascii_logo();
+        center_print("[%] DISCOUNT MANAGEMENT");
+        print_separator();
+
+        center_print("1  [+]  Add Discount Code");
+        center_print("2  [*]  View All Discounts");
+        center_print("3  [-]  Delete Discount Code");
+        center_print("4  [<]  Back to Admin Panel");
+
+        printf("\n");
+        printf("%*s", (CONSOLE_WIDTH-20)/2, "");
+        printf("Enter choice: ");
+        scanf("%d", &choice);
+
+        switch (choice) {
+            case 1: add_discount(); break;
+            case 2: view_discounts(); break;
+            case 3: delete_discount(); break;
+            case 4: return;
+            default:
+                center_print("[X] Invalid choice.");
+                printf("\n");
+                center_print("Press any key to continue...");
+                getchar(); getchar();
+        }
+    }
+}
+
+/**
+ * Add new mechanic
+ */
+void add_mechanic() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[+] ADD NEW MECHANIC");
+    print_separator();
+
+    char name[50], phone[20], username[30], password[30];
+    int age;
+
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
+    printf("Mechanic Name: ");
+    scanf("%s", name);
+
+    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
+    printf("Username: ");
+    scanf("%s", username);
+
+    // Validate and get strong password
+    while (1) {
+        printf("\n");
+        center_print("Password Requirements:");
+        center_print("- At least 4 characters");
+        center_print("- 1 uppercase letter (A-Z)");
+        center_print("- 1 lowercase letter (a-z)");
+        center_print("- 1 number (0-9)");
+        center_print("- 1 special character (@#$%&*!?+-=_)");
+        printf("\n");
+        printf("%*s", (CONSOLE_WIDTH-20)/2, "");
+        printf("Password: ");
+        get_hidden_password(password, sizeof(password));
+
+        if (validate_strong_password(password)) {
+            break;
+        } else {
+            printf("\n");
+            center_print("[X] Password does not meet requirements!");
+            center_print("Must have: 1 uppercase, 1 lowercase, 1 number, 1 special char");
+            printf("\n");
+        }
+    }
+
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-20)/2, "");
+    printf("Age: ");
+    scanf("%d", &age);
+
+    // Validate and get phone
+    while (1) {
+        printf("%*s", (CONSOLE_WIDTH-30)/2, "");
+        printf("Phone (01XXXXXXXXX): ");
+        scanf("%s", phone);
+
+        if (validate_phone(phone)) {
+            break;
+        } else {
+            center_print("[X] Invalid phone number!");
+            center_print("Must start with 01 and be exactly 11 digits.");
+        }
+    }
+
+    GarageMechanic mechanic;
+    strcpy(mechanic.name, name);
+    strcpy(mechanic.username, username);
+    strcpy(mechanic.password, password);
+    mechanic.age = age;
+    strcpy(mechanic.phone, phone);
+
+    if (!garage_add_mechanic(&mechanic)) {
+        center_print("[X] Error opening mechanics file.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    printf("\n");
+    center_print("[+] Mechanic added successfully!");
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+// Rows of the paged mechanic listing
+int mechanic_line_valid(const char *line, void *context) {
+    GarageMechanic mechanic;
+    (void)context;
+    return garage_parse_mechanic(line, &mechanic);
+}
+
+void print_mechanics_header() {
+    screen_pad((CONSOLE_WIDTH-60)/2, ' ');
+    screen_printf("%-20s %-15s %-5s %s\n", "MECHANIC NAME", "USERNAME", "AGE", "PHONE");
+    screen_pad((CONSOLE_WIDTH-60)/2, ' ');
+    screen_pad(60, '-');
+    screen_puts("\n");
+}
+
+void render_mechanic_line(const char *line, void *context) {
+    GarageMechanic mechanic;
+    (void)context;
+    if (!garage_parse_mechanic(line, &mechanic)) return;
+
+    screen_pad((CONSOLE_WIDTH-60)/2, ' ');
+    screen_printf("%-20s %-15s %-5d %s\n", mechanic.name, mechanic.username, mechanic.age, mechanic.phone);
+}
+
+/**
+ * View all mechanics
+ */
+void view_mechanics() {
+    PagedTable table = {
+        "[*] AVAILABLE MECHANICS", NULL, MECHANICS_FILE, "[-] No mechanics found.",
+        print_mechanics_header, render_mechanic_line, mechanic_line_valid, NULL, NULL
+    };
+    browse_table(&table);
+}
+
+/**
+ * Delete mechanic
+ */
+void delete_mechanic() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[-] DELETE MECHANIC");
+    print_separator();
+
+    FILE *f = fopen(MECHANICS_FILE, "r");
+    if (!f) {
+        center_print("[-] No mechanics found.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    FILE *temp = fopen("temp_mechanics.txt", "w");
+    if (!temp) {
+        center_print("[X] Error creating temporary file.");
+        fclose(f);
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    char target_name[50], name[50], username[30], password[30], phone[20];
+    int age, found = 0;
+
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-30)/2, "");
+    printf("Enter mechanic name to delete: ");
+    scanf("%s", target_name);
+
+    while (fscanf(f, "%s %s %s %d %s", name, username, password, &age, phone) == 5) {
+        if (strcmp(name, target_name) != 0) {
+            fprintf(temp, "%s %s %s %d %s\n", name, username, password, age, phone);
+        } else {
+            found = 1;
+        }
+    }
+
+    fclose(f);
+    fclose(temp);
+    remove(MECHANICS_FILE);
+    rename("temp_mechanics.txt", MECHANICS_FILE);
+
+    printf("\n");
+    if (found)
+        center_print("[+] Mechanic deleted successfully!");
+    else
+        center_print("[X] Mechanic not found.");
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Assign a mechanic to a waiting order; the least loaded mechanic is
+ * suggested
+ */
+void assign_mechanic_to_order() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] ASSIGN MECHANIC TO ORDER");
+    print_separator();
+
+    SchedulerOrder waiting[15];
+    SchedulerMechanic best;
+    int total = scheduler_unassigned(waiting, 15);
+    int shown = total < 15 ? total : 15;
+
+    if (total == 0) {
+        center_print("[-] No orders are waiting for a mechanic.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+    if (!scheduler_suggest(&best)) {
+        center_print("[X] No mechanics available.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    printf("\n");
+    center_print("[*] ORDERS WAITING FOR A MECHANIC (most urgent first):");
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+    printf("%-4s %-15s %-15s %-10s %s\n", "#", "CUSTOMER", "PART", "WAITING", "DUE");
+    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+    for (int i = 0; i < 60; i++) printf("-");
+    printf("\n");
+
+    char due[GARAGE_DATE_TEXT];
+    for (int i = 0; i < shown; i++) {
+        garage_format_date_key(waiting[i].due, due, sizeof(due));
+        printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+        printf("%-4d %-15s %-15s %-10d %s\n", i + 1, waiting[i].customer, waiting[i].part, waiting[i].open, due);
+    }
+    if (total > shown) {
+        char more[60];
+        sprintf(more, "... and %d more (use Auto-Assign for all)", total - shown);
+        center_print(more);
+    }
+
+    char message[160];
+    printf("\n");
+    snprintf(message, sizeof(message), "[*] Least loaded: %s (%s) with %d job%s",
+             best.username, best.name, best.jobs, best.jobs == 1 ? "" : "s");
+    center_print(message);
+
+    int choice;
+    char mechanic_username[30];
+    printf("\n");
+    center_prompt("Order # to assign: ");
+    if (scanf("%d", &choice) != 1 || choice < 1 || choice > shown) {
+        center_print("[X] Invalid choice.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    snprintf(message, sizeof(message), "Mechanic username (0 = %s): ", best.username);
+    center_prompt(message);
+    scanf("%29s", mechanic_username);
+
+    const SchedulerOrder *order = &waiting[choice - 1];
+    int result = scheduler_assign(order->customer, order->part,
+                                  strcmp(mechanic_username, "0") == 0 ? NULL : mechanic_username);
+
+    printf("\n");
+    if (result == SCHEDULER_UNKNOWN_MECHANIC) {
+        center_print("[X] Mechanic not found!");
+    } else if (result == SCHEDULER_NO_ORDER) {
+        center_print("[X] Order not found!");
+    } else if (result == SCHEDULER_WRITE_FAILED) {
+        center_print("[X] Error opening appointments file.");
+    } else {
+        center_print("[+] Mechanic assigned successfully!");
+        snprintf(message, sizeof(message), "[*] %s assigned to %s's %s order",
+                 strcmp(mechanic_username, "0") == 0 ? best.username : mechanic_username,
+                 order->customer, order->part);
+        center_print(message);
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * One line per assignment made by auto_assign_mechanics
+ */
+void print_auto_assignment(const SchedulerOrder *order, const SchedulerMechanic *mechanic, void *context) {
+    int *printed = context;
+    if (++*printed > 20) return;
+
+    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+    printf("%-15s %-15s -> %s (%d jobs)\n", order->customer, order->part, mechanic->username, mechanic->jobs);
+}
+
+/**
+ * Assign every waiting order in one go, most urgent first, each to the
+ * least loaded mechanic at that point
+ */
+void auto_assign_mechanics() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] AUTO-ASSIGN WAITING ORDERS");
+    print_separator();
+    printf("\n");
+
+    int printed = 0;
+    int assigned = scheduler_assign_all(print_auto_assignment, &printed);
+
+    printf("\n");
+    if (assigned == SCHEDULER_UNKNOWN_MECHANIC) {
+        center_print("[X] No mechanics available.");
+    } else if (assigned == SCHEDULER_WRITE_FAILED) {
+        center_print("[X] Error opening appointments file.");
+    } else if (assigned == 0) {
+        center_print("[-] No orders are waiting for a mechanic.");
+    } else {
+        char message[80];
+        if (printed > 20) {
+            sprintf(message, "... and %d more", printed - 20);
+            center_print(message);
+        }
+        sprintf(message, "[+] %d order%s assigned.", assigned, assigned == 1 ? "" : "s");
+        center_print(message);
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * View all appointments/assignments
+ */
+void view_appointments() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] MECHANIC ASSIGNMENTS");
+    print_separator();
+
+    FILE *f = fopen(APPOINTMENTS_FILE, "r");
+    if (!f) {
+        center_print("[-] No assignments found.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    char customer[30], part[50], mechanic[50], date[20];
+
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-70)/2, "");
+    printf("%-15s %-15s %-20s %s\n", "CUSTOMER", "PART", "MECHANIC", "DATE");
+    printf("%*s", (CONSOLE_WIDTH-70)/2, "");
+    for (int i = 0; i < 70; i++) printf("-");
+    printf("\n");
+
+    while (fscanf(f, "%s %s %s %s", customer, part, mechanic, date) == 4) {
+        printf("%*s", (CONSOLE_WIDTH-70)/2, "");
+        printf("%-15s %-15s %-20s %s\n", customer, part, mechanic, date);
+    }
+    fclose(f);
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Manage appointments (Admin only)
+ */
+void manage_appointments() {
+    int choice;
+
+    while (1) {
+        clear_screen();
+        display_ascii_logo();
+        center_print("[*] APPOINTMENT MANAGEMENT");
+        print_separator();
+
+        center_print("1  [+]  Add Mechanic");
+        center_print("2  [*]  View All Mechanics");
+        center_print("3  [-]  Delete Mechanic");
+        center_print("4  [*]  Assign Mechanic to Order");
+        center_print("5  [*]  Auto-Assign All Waiting Orders");
+        center_print("6  [*]  View All Assignments");
+        center_print("7  [<]  Back to Admin Panel");
+
+        printf("\n");
+        printf("%*s", (CONSOLE_WIDTH-20)/2, "");
+        printf("Enter choice: ");
+        scanf("%d", &choice);
+
+        switch (choice) {
+            case 1: add_mechanic(); break;
+            case 2: view_mechanics(); break;
+            case 3: delete_mechanic(); break;
+            case 4: assign_mechanic_to_order(); break;
+            case 5: auto_assign_mechanics(); break;
+            case 6: view_appointments(); break;
+            case 7: return;
+            default:
+                center_print("[X] Invalid choice.");
+                printf("\n");
+                center_print("Press any key to continue...");
+                getchar(); getchar();
+        }
+    }
+}
+
+/**
+ * Mechanic Dashboard
+ */
+void mechanic_dashboard(const char *mechanic_username) {
+    int choice;
+
+    while (1) {
+        clear_screen();
+
+        // Display developer copyright in lower right corner first
+        display_developer_copyright();
+
+        display_ascii_logo();
+        char welcome_msg[100];
+        sprintf(welcome_msg, "Welcome, %s (Mechanic)", mechanic_username);
+        center_print(welcome_msg);
+        center_print("[*] MECHANIC DASHBOARD");
+        print_separator();
+
+        // Reminders whose day has come, a few per visit
+        int due_shown = 0;
+        if (calendar_due(calendar_today(), print_due_reminder, &due_shown) > 0) {
+            print_separator();
+        }
+
+        center_print("1  [*]  View My Assigned Cars");
+        center_print("2  [*]  Car Profile Management");
+        center_print("3  [*]  Vehicle History");
+        center_print("4  [*]  Update Progress");
+        center_print("5  [*]  Set/View Deadlines");
+        center_print("6  [*]  Service Calendar");
+        center_print("7  [*]  Maintenance Reminders");
+        center_print("8  [*]  Manage Q&A");
+        center_print("9  [-]  Delete Records");
+        center_print("10 [X]  Logout");
+
+        printf("\n");
+        printf("%*s", (CONSOLE_WIDTH-20)/2, "");
+        printf("Enter choice: ");
+        scanf("%d", &choice);
+
+        switch (choice) {
+            case 1: view_assigned_cars(mechanic_username); break;
+            case 2: view_car_profile(); break;
+            case 3: view_vehicle_history(); break;
+            case 4: update_progress(); break;
+            case 5: {
+                int deadline_choice;
+                clear_screen();
+                display_ascii_logo();
+                center_print("[*] DEADLINE MANAGEMENT");
+                print_separator();
+                center_print("1  [+]  Set New Deadline");
+                center_print("2  [*]  View All Deadlines");
+                center_print("3  [<]  Back");
+                printf("\n");
+                printf("%*s", (CONSOLE_WIDTH-20)/2, "");
+                printf("Enter choice: ");
+                scanf("%d", &deadline_choice);
+
+                switch (deadline_choice) {
+                    case 1: set_deadline(); break;
+                    case 2: view_progress(); break; // This will show deadlines too
+                    case 3: break;
+                    default:
+                        center_print("[X] Invalid choice.");
+                        printf("\n");
+                        center_print("Press any key to continue...");
+                        getchar(); getchar();
+                }
+                break;
+            }
+            case 6: view_service_calendar(); break;
+            case 7: {
+                int reminder_choice;
+                clear_screen();
+                display_ascii_logo();
+                center_print("[*] MAINTENANCE REMINDERS");
+                print_separator();
+                center_print("1  [+]  Set Maintenance Reminder");
+                center_print("2  [*]  View Reminders");
+                center_print("3  [<]  Back");
+                printf("\n");
+                printf("%*s", (CONSOLE_WIDTH-20)/2, "");
+                printf("Enter choice: ");
+                scanf("%d", &reminder_choice);
+
+                switch (reminder_choice) {
+                    case 1: set_maintenance_reminder(); break;
+                    case 2: view_maintenance_reminders(); break;
+                    case 3: break;
+                    default:
+                        center_print("[X] Invalid choice.");
+                        printf("\n");
+                        center_print("Press any key to continue...");
+                        getchar(); getchar();
+                }
+                break;
+            }
+            case 8: manage_qna(); break;
+            case 9: {
+                int delete_choice;
+                clear_screen();
+                display_ascii_logo();
+                center_print("[*] DELETE RECORDS");
+                print_separator();
+                center_print("1  [-]  Delete Progress Record");
+                center_print("2  [-]  Delete Parking Record");
+                center_print("3  [<]  Back");
+                printf("\n");
+                printf("%*s", (CONSOLE_WIDTH-20)/2, "");
+                printf("Enter choice: ");
+                scanf("%d", &delete_choice);
+
+                switch (delete_choice) {
+                    case 1: delete_progress_record(); break;
+                    case 2: delete_parking_record(); break;
+                    case 3: break;
+                    default:
+                        center_print("[X] Invalid choice.");
+                        printf("\n");
+                        center_print("Press any key to continue...");
+                        getchar(); getchar();
+                }
+                break;
+            }
+            case 10:
+                center_print("[*] Logged out successfully.");
+                printf("\n");
+                center_print("[*] Thank you for using Smart Garage Management System!");
+                center_print("Goodbye!");
+                printf("\n");
+                center_print("Press any key to continue...");
+                getchar(); getchar();
+                return;
+            default:
+                center_print("[X] Invalid choice. Please try again.");
+                printf("\n");
+                center_print("Press any key to continue...");
+                getchar(); getchar();
+        }
+    }
+}
+
+/**
+ * Main menu system
+ */
+void main_menu() {
+    // Initialize console width for perfect center alignment
+    get_console_width();
+
+    char logged_in_user[30], logged_in_role[20];
+    int choice, logged_in = 0;
+
+    while (1) {
+        if (!logged_in) {
+            clear_screen();
+
+            display_ascii_logo();
+            center_print("[*] MAIN MENU");
+            center_print("Please select an option:");
+            printf("\n");
+            center_print("1  [+]  Register (Customer)");
+            center_print("2  [#]  User Login");
+            center_print("3  [#]  Admin Login");
+            center_print("4  [#]  Mechanic Login");
+            center_print("5  [X]  Exit System");
+
+            // Display "Enter choice:" right below menu options with 2 line gap and center aligned
+            printf("\n\n");
+            center_prompt("Enter choice: ");
+
+            // Save cursor position for input
+            platform_save_cursor();
+
+            // Display developer copyright at the very bottom right corner
+            display_developer_copyright();
+
+            // Return cursor to input position
+            platform_restore_cursor();
+            scanf("%d", &choice);
+
+            switch (choice) {
+                case 1:
+                    register_user();
+                    break;
+                case 2:
+                    if (login_user(logged_in_user, logged_in_role)) {
+                        logged_in = 1;
+                    }
+                    break;
+                case 3:
+                    if (admin_login(logged_in_user, logged_in_role)) {
+                        admin_panel(logged_in_user);
+                    }
+                    break;
+                case 4:
+                    if (mechanic_login(logged_in_user, logged_in_role)) {
+                        mechanic_dashboard(logged_in_user);
+                    }
+                    break;
+                case 5:
+                    clear_screen();
+                    display_ascii_logo();
+                    center_print("[*] Thank you for using Smart Garage Management System!");
+                    center_print("Goodbye!");
+                    return;
+                default:
+                    center_print("[X] Invalid choice. Please try again.");
+                    printf("\n");
+                    center_print("Press any key to continue...");
+                    getchar(); getchar();
+            }
+        } else {
+            // Customer menu
+            clear_screen();
+
+            // Display developer copyright in lower right corner first
+            display_developer_copyright();
+
+            display_ascii_logo();
+            char welcome_msg[100];
+            sprintf(welcome_msg, "Welcome, %s (%s)", logged_in_user, logged_in_role);
+            center_print(welcome_msg);
+            center_print("[*] CUSTOMER DASHBOARD");
+            printf("\n");
+
+            center_print("1  [*]  View Parts");
+            center_print("2  [*]  Update Profile");
+            center_print("3  [*]  Appointment Options");
+            center_print("4  [$]  Calculate Estimation");
+            center_print("5  [*]  Generate Invoice");
+            center_print("6  [*]  Car Management");
+            center_print("7  [*]  My Service Progress");
+            center_print("8  [?]  Troubleshooting Q&A");
+            center_print("9  [*]  Maintenance Reminders");
+            center_print("10  [H]  Order History");
+            center_print("11  [QR] QR Receipts");
+            center_print("12  [REC] Smart Recommendations");
+            center_print("13  [LOYALTY] Loyalty Rewards");
+            center_print("14  [-]  Delete My Records");
+            center_print("15  [X]  Logout");
+
+            printf("\n");
+            center_prompt("Enter choice: ");
+            scanf("%d", &choice);
+
+            switch (choice) {
+                case 1: view_parts(); break;
+                case 2: update_profile(logged_in_user); break;
+                case 3: {
+                    // Appointment Options submenu
+                    int appointment_choice;
+                    while (1) {
+                        clear_screen();
+                        display_ascii_logo();
+                        center_print("[*] APPOINTMENT OPTIONS");
+                        print_separator();
+                        center_print("1  [*]  Order Parts");
+                        center_print("2  [*]  Car Parking");
+                        center_print("3  [<]  Back to Main Menu");
+
+                        printf("\n");
+                        center_prompt("Enter choice: ");
+                        scanf("%d", &appointment_choice);
+
+                        switch (appointment_choice) {
+                            case 1:
+                                order_parts(logged_in_user);
+                                break;
+                            case 2:
+                                add_car_parking(logged_in_user);
+                                break;
+                            case 3:
+                                goto exit_appointment_menu;
+                            default:
+                                center_print("[X] Invalid choice.");
+                                printf("\n");
+                                center_print("Press any key to continue...");
+                                getchar(); getchar();
+                        }
+                    }
+                    exit_appointment_menu:
+                    break;
+                }
+                case 4: calculate_estimation(logged_in_user); break;
+                case 5: generate_invoice(logged_in_user, logged_in_role); break;
+                case 6: {
+                    int car_choice;
+                    clear_screen();
+                    display_ascii_logo();
+                    center_print("[*] CAR MANAGEMENT");
+                    print_separator();
+                    center_print("1  [+]  Add Car");
+                    center_print("2  [*]  View Cars");
+                    center_print("3  [-]  Remove Car");
+                    center_print("4  [*]  Modify Car");
+                    center_print("5  [*]  View Parking Data");
+                    center_print("6  [<]  Back");
+                    printf("\n");
+                    center_prompt("Enter choice: ");
+                    scanf("%d", &car_choice);
+
+                    switch (car_choice) {
+                        case 1: add_car(); break;
+                        case 2: view_cars(); break;
+                        case 3: delete_car(); break;
+                        case 4: modify_car(); break;
+                        case 5: view_car_parking(); break;
+                        case 6: break;
+                        default:
+                            center_print("[X] Invalid choice.");
+                            printf("\n");
+                            center_print("Press any key to continue...");
+                            getchar(); getchar();
+                    }
+                    break;
+                }
+                case 7: {
+                    // Customer view progress
+                    char car_number[20];
+                    printf("\n");
+                    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
+                    printf("Enter your car number: ");
+                    scanf("%s", car_number);
+
+                    // Show progress
+                    clear_screen();
+                    display_ascii_logo();
+                    center_print("[*] MY SERVICE PROGRESS");
+                    print_separator();
+
+                    FILE *f = fopen(PROGRESS_FILE, "r");
+                    if (f) {
+                        char line[300], stored_car[20], date[20], percentage[10], description[100];
+                        int found = 0;
+
+                        printf("\n");
+                        center_print("=== SERVICE PROGRESS ===");
+                        while (fgets(line, sizeof(line), f)) {
+                            sscanf(line, "%s %s %s %s", stored_car, date, percentage, description);
+                            if (strcmp(stored_car, car_number) == 0) {
+                                printf("%*s", (CONSOLE_WIDTH-50)/2, "");
+                                printf("%s - %s: %s\n", date, percentage, description);
+                                found = 1;
+                            }
+                        }
+
+                        if (!found) {
+                            center_print("[!] No service records found for this car.");
+                        }
+                        fclose(f);
+                    } else {
+                        center_print("[!] No progress data available.");
+                    }
+
+                    // Show deadlines
+                    printf("\n");
+                    center_print("=== SERVICE DEADLINES ===");
+                    f = fopen(DEADLINES_FILE, "r");
+                    if (f) {
+                        char line[200], stored_car[20], deadline[20], service[50];
+                        int found = 0;
+
+                        while (fgets(line, sizeof(line), f)) {
+                            sscanf(line, "%s %s %s", stored_car, deadline, service);
+                            if (strcmp(stored_car, car_number) == 0) {
+                                printf("%*s", (CONSOLE_WIDTH-40)/2, "");
+                                printf("%s: %s\n", service, deadline);
+                                found = 1;
+                            }
+                        }
+
+                        if (!found) {
+                            center_print("[!] No deadlines set for this car.");
+                        }
+                        fclose(f);
+                    }
+
+                    printf("\n");
+                    center_print("Press any key to continue...");
+                    getchar(); getchar();
+                    break;
+                }
+                case 8:
+                    customer_view_qna();
+                    break;
+                case 9:
+                    customer_view_maintenance_reminders();
+                    break;
+                case 10:
+                    view_order_history(logged_in_user);
+                    break;
+                case 11:
+                    view_qr_receipts(logged_in_user);
+                    break;
+                case 12:
+                    smart_parts_recommendation(logged_in_user);
+                    break;
+                case 13:
+                    loyalty_system_menu(logged_in_user);
+                    break;
+                case 14: {
+                    // Delete Records submenu
+                    int delete_choice;
+                    clear_screen();
+                    display_ascii_logo();
+                    center_print("[*] DELETE MY RECORDS");
+                    print_separator();
+                    center_print("1  [-]  Delete Order History");
+                    center_print("2  [<]  Back");
+                    printf("\n");
+                    printf("%*s", (CONSOLE_WIDTH-20)/2, "");
+                    printf("Enter choice: ");
+                    scanf("%d", &delete_choice);
+
+                    switch (delete_choice) {
+                        case 1: delete_order_history(logged_in_user); break;
+                        case 2: break;
+                        default:
+                            center_print("[X] Invalid choice.");
+                            printf("\n");
+                            center_print("Press any key to continue...");
+                            getchar(); getchar();
+                    }
+                    break;
+                }
+                case 15:
+                    logged_in = 0;
+                    center_print("[*] Logged out successfully.");
+                    printf("\n");
+                    center_print("[*] Thank you for using Smart Garage Management System!");
+                    center_print("Goodbye!");
+                    printf("\n");
+                    center_print("Press any key to continue...");
+                    getchar(); getchar();
+                    break;
+                default:
+                    center_print("[X] Invalid choice. Please try again.");
+                    printf("\n");
+                    center_print("Press any key to continue...");
+                    getchar(); getchar();
+            }
+        }
+    }
+}
+
+// ==================== MECHANIC DASHBOARD FUNCTIONS ====================
+
+/**
+ * One assignment row: date, the customer's car, and the job
+ */
+int print_assigned_car(const VehicleRecord *record, void *context) {
+    char date[GARAGE_DATE_TEXT];
+    (void)context;
+
+    garage_format_date_key(record->date, date, sizeof(date));
+    printf("%*s", (CONSOLE_WIDTH-70)/2, "");
+    printf("%-12s %-15s %s\n", date, record->car_number, record->detail);
+    return 0;
+}
+
+/**
+ * View cars assigned to specific mechanic
+ */
+void view_assigned_cars(const char *mechanic_username) {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] MY ASSIGNED CARS");
+    print_separator();
+
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-70)/2, "");
+    printf("%-12s %-15s %s\n", "DATE", "CAR NUMBER", "JOB");
+    printf("%*s", (CONSOLE_WIDTH-70)/2, "");
+    for (int i = 0; i < 70; i++) printf("-");
+    printf("\n");
+
+    if (vehicle_mechanic_jobs(mechanic_username, print_assigned_car, NULL) == 0) {
+        center_print("[!] No cars assigned to you.");
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * View and manage car profiles
+ */
+void view_car_profile() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] CAR PROFILE MANAGEMENT");
+    print_separator();
+
+    int choice;
+    center_print("1  [*]  View Car Profile");
+    center_print("2  [+]  Add Car Profile");
+    center_print("3  [-]  Delete Car Profile");
+    center_print("4  [<]  Back");
+
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-20)/2, "");
+    printf("Enter choice: ");
+    scanf("%d", &choice);
+
+    switch (choice) {
+        case 1: {
+            char car_number[20];
+            printf("\n");
+            printf("%*s", (CONSOLE_WIDTH-25)/2, "");
+            printf("Enter Car Number: ");
+            scanf("%s", car_number);
+
+            if (vehicle_records(car_number, VEHICLE_KIND(VEHICLE_PROFILE), print_car_profile, NULL) == 0) {
+                center_print("[!] Car profile not found.");
+            }
+            break;
+        }
+        case 2: {
+            char car_number[20];
+            printf("\n");
+            printf("%*s", (CONSOLE_WIDTH-25)/2, "");
+            printf("Enter Car Number: ");
+            scanf("%s", car_number);
+            add_car_profile(car_number);
+            break;
+        }
+        case 3: {
+            delete_car_profile();
+            break;
+        }
+        case 4:
+            return;
+        default:
+            center_print("[X] Invalid choice.");
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Show one car profile ("owner model engine"); stops after the first
+ */
+int print_car_profile(const VehicleRecord *record, void *context) {
+    char owner[50] = "-", model[50] = "-", engine[50] = "-";
+    (void)context;
+
+    sscanf(record->detail, "%49s %49s %49s", owner, model, engine);
+    printf("\n");
+    center_print("=== CAR PROFILE ===");
+    printf("%*s", (CONSOLE_WIDTH-40)/2, "");
+    printf("Car Number: %s\n", record->car_number);
+    printf("%*s", (CONSOLE_WIDTH-40)/2, "");
+    printf("Owner: %s\n", owner);
+    printf("%*s", (CONSOLE_WIDTH-40)/2, "");
+    printf("Model: %s\n", model);
+    printf("%*s", (CONSOLE_WIDTH-40)/2, "");
+    printf("Engine: %s\n", engine);
+    return 1;
+}
+
+/**
+ * Add car profile
+ */
+void add_car_profile(const char *car_number) {
+    FILE *f = fopen(CAR_PROFILES_FILE, "a");
+    if (!f) {
+        center_print("[X] Error opening car profiles file.");
+        return;
+    }
+
+    char owner[50], model[50], engine[50];
+
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
+    printf("Owner Name: ");
+    scanf("%s", owner);
+
+    printf("%*s", (CONSOLE_WIDTH-20)/2, "");
+    printf("Car Model: ");
+    scanf("%s", model);
+
+    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
+    printf("Engine Number: ");
+    scanf("%s", engine);
+
+    fprintf(f, "%s %s %s %s\n", car_number, owner, model, engine);
+    fclose(f);
+
+    // Auto-add initial service progress
+    auto_add_service_progress(car_number, "CAR_ADDED");
+
+    center_print("[+] Car profile added successfully!");
+    center_print("[+] Initial service progress recorded!");
+}
+
+/**
+ * One timeline row: date, kind of record, and the record itself
+ */
+int print_vehicle_record(const VehicleRecord *record, void *context) {
+    char date[GARAGE_DATE_TEXT];
+    (void)context;
+
+    garage_format_date_key(record->date, date, sizeof(date));
+    printf("%*s", (CONSOLE_WIDTH-80)/2, "");
+    printf("%-12s %-11s %.55s\n", date, vehicle_kind_name(record->kind), record->detail);
+    return 0;
+}
+
+/**
+ * View vehicle history: profile, services, progress, deadlines,
+ * reminders, parking and mechanic assignments in date order
+ */
+void view_vehicle_history() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] VEHICLE SERVICE HISTORY");
+    print_separator();
+
+    char car_number[20];
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
+    printf("Enter Car Number: ");
+    scanf("%19s", car_number);
+
+    printf("\n");
+    center_print("=== VEHICLE TIMELINE ===");
+    printf("%*s", (CONSOLE_WIDTH-80)/2, "");
+    printf("%-12s %-11s %s\n", "DATE", "KIND", "DETAILS");
+    printf("%*s", (CONSOLE_WIDTH-80)/2, "");
+    for (int i = 0; i < 80; i++) printf("-");
+    printf("\n");
+
+    if (vehicle_records(car_number, VEHICLE_ALL, print_vehicle_record, NULL) == 0) {
+        center_print("[!] No history for this car.");
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Update service progress
+ */
+void update_progress() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] UPDATE SERVICE PROGRESS");
+    print_separator();
+
+    char car_number[20], progress[100];
+    int percentage;
+
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
+    printf("Car Number: ");
+    scanf("%s", car_number);
+
+    printf("%*s", (CONSOLE_WIDTH-30)/2, "");
+    printf("Progress Percentage (0-100): ");
+    scanf("%d", &percentage);
+
+    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
+    printf("Progress Description: ");
+    getchar(); // consume newline
+    fgets(progress, sizeof(progress), stdin);
+    progress[strcspn(progress, "\n")] = '\0'; // remove newline
+
+    FILE *f = fopen(PROGRESS_FILE, "a");
+    if (!f) {
+        center_print("[X] Error opening progress file.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    time_t now = time(NULL);
+    char date[20];
+    strftime(date, sizeof(date), "%Y-%m-%d", localtime(&now));
+
+    fprintf(f, "%s %s %d%% %s\n", car_number, date, percentage, progress);
+    fclose(f);
+
+    center_print("[+] Progress updated successfully!");
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * "date - pct%: description"
+ */
+int print_progress_record(const VehicleRecord *record, void *context) {
+    char date[GARAGE_DATE_TEXT], percentage[10] = "";
+    int skip = 0;
+    (void)context;
+
+    garage_format_date_key(record->date, date, sizeof(date));
+    sscanf(record->detail, "%9s %n", percentage, &skip);
+    printf("%*s", (CONSOLE_WIDTH-50)/2, "");
+    printf("%s - %s: %s\n", date, percentage, record->detail + skip);
+    return 0;
+}
+
+/**
+ * "service: date"
+ */
+int print_deadline_record(const VehicleRecord *record, void *context) {
+    char date[GARAGE_DATE_TEXT];
+    (void)context;
+
+    garage_format_date_key(record->date, date, sizeof(date));
+    printf("%*s", (CONSOLE_WIDTH-40)/2, "");
+    printf("%s: %s\n", record->detail, date);
+    return 0;
+}
+
+/**
+ * View progress and deadlines
+ */
+void view_progress() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] SERVICE PROGRESS & DEADLINES");
+    print_separator();
+
+    char car_number[20];
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
+    printf("Enter Car Number: ");
+    scanf("%s", car_number);
+
+    // Show Progress
+    printf("\n");
+    center_print("=== PROGRESS HISTORY ===");
+    if (vehicle_records(car_number, VEHICLE_KIND(VEHICLE_PROGRESS), print_progress_record, NULL) == 0) {
+        center_print("[!] No progress records found.");
+    }
+
+    // Show Deadlines
+    printf("\n");
+    center_print("=== DEADLINES ===");
+    if (vehicle_records(car_number, VEHICLE_KIND(VEHICLE_DEADLINE), print_deadline_record, NULL) == 0) {
+        center_print("[!] No deadlines set.");
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Set service deadline
+ */
+void set_deadline() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] SET SERVICE DEADLINE");
+    print_separator();
+
+    char car_number[20], deadline[20], service[50];
+
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
+    printf("Car Number: ");
+    scanf("%s", car_number);
+
+    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
+    printf("Service Type: ");
+    scanf("%s", service);
+
+    printf("%*s", (CONSOLE_WIDTH-35)/2, "");
+    printf("Deadline (YYYY-MM-DD): ");
+    scanf("%s", deadline);
+
+    FILE *f = fopen(DEADLINES_FILE, "a");
+    if (!f) {
+        center_print("[X] Error opening deadlines file.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    fprintf(f, "%s %s %s\n", car_number, deadline, service);
+    fclose(f);
+
+    center_print("[+] Deadline set successfully!");
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * One calendar row: date, car, type and service
+ */
+int print_calendar_event(const CalendarEvent *event, void *context) {
+    char date[GARAGE_DATE_TEXT];
+    (void)context;
+
+    garage_format_date_key(event->date, date, sizeof(date));
+    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+    printf("%-12s %-15s %-9s %s\n", date, event->car_number,
+           event->kind == CALENDAR_REMINDER ? "Reminder" : "Service", event->service);
+    return 0;
+}
+
+/**
+ * Calendar events of the given kinds: due today, next 7 days, overdue,
+ * a date range or everything
+ */
+void view_calendar_events(unsigned kinds, const char *title) {
+    clear_screen();
+    display_ascii_logo();
+    center_print(title);
+    print_separator();
+
+    int choice;
+    center_print("1  [*]  Due Today");
+    center_print("2  [*]  Next 7 Days");
+    center_print("3  [!]  Overdue");
+    center_print("4  [*]  Date Range");
+    center_print("5  [*]  All");
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-20)/2, "");
+    printf("Enter choice: ");
+    scanf("%d", &choice);
+
+    long today = calendar_today();
+    long from = 0, to = 0;
+    switch (choice) {
+        case 1: from = today; to = today; break;
+        case 2: from = calendar_add_days(today, 1); to = calendar_add_days(today, 7); break;
+        case 3: to = calendar_add_days(today, -1); break;
+        case 4:
+            printf("\n");
+            from = read_date_filter("From date (YYYY-MM-DD, 0 = any): ");
+            to = read_date_filter("To date (YYYY-MM-DD, 0 = any): ");
+            if (from < 0 || to < 0) {
+                center_print("[X] Invalid date.");
+                printf("\n");
+                center_print("Press any key to continue...");
+                getchar(); getchar();
+                return;
+            }
+            break;
+        case 5: break;
+        default:
+            center_print("[X] Invalid choice.");
+            printf("\n");
+            center_print("Press any key to continue...");
+            getchar(); getchar();
+            return;
+    }
+
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+    printf("%-12s %-15s %-9s %s\n", "DATE", "CAR", "TYPE", "SERVICE");
+    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+    for (int i = 0; i < 60; i++) printf("-");
+    printf("\n");
+
+    if (calendar_between(kinds, from, to, print_calendar_event, NULL) == 0) {
+        center_print("[!] No events found.");
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Dashboard line for a reminder that is due; stops after five
+ */
+int print_due_reminder(const CalendarEvent *event, void *context) {
+    int *shown = context;
+    char date[GARAGE_DATE_TEXT], line[200];
+
+    garage_format_date_key(event->date, date, sizeof(date));
+    snprintf(line, sizeof(line), "[!] Reminder due %s: %s - %s", date, event->car_number, event->service);
+    center_print(line);
+    return ++*shown >= 5;
+}
+
+/**
+ * View service calendar (service events and reminders)
+ */
+void view_service_calendar() {
+    view_calendar_events(CALENDAR_ALL, "[*] SERVICE CALENDAR");
+}
+
+/**
+ * Set maintenance reminder
+ */
+void set_maintenance_reminder() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] SET MAINTENANCE REMINDER");
+    print_separator();
+
+    char car_number[20], reminder_date[20], service_type[50];
+
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
+    printf("Car Number: ");
+    scanf("%s", car_number);
+
+    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
+    printf("Service Type: ");
+    scanf("%s", service_type);
+
+    printf("%*s", (CONSOLE_WIDTH-35)/2, "");
+    printf("Reminder Date (YYYY-MM-DD): ");
+    scanf("%s", reminder_date);
+
+    FILE *f = fopen(MAINTENANCE_REMINDERS_FILE, "a");
+    if (!f) {
+        center_print("[X] Error opening reminders file.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    fprintf(f, "%s %s %s\n", car_number, reminder_date, service_type);
+    fclose(f);
+
+    center_print("[+] Maintenance reminder set successfully!");
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * View maintenance reminders
+ */
+void view_maintenance_reminders() {
+    view_calendar_events(CALENDAR_KIND(CALENDAR_REMINDER), "[*] MAINTENANCE REMINDERS");
+}
+
+/**
+ * Customer view maintenance reminders (overdue first, then upcoming)
+ */
+void customer_view_maintenance_reminders() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] MAINTENANCE ALERTS & REMINDERS");
+    print_separator();
+
+    long today = calendar_today();
+    unsigned reminders = CALENDAR_KIND(CALENDAR_REMINDER);
+    int overdue = calendar_between(reminders, 0, calendar_add_days(today, -1), NULL, NULL);
+
+    if (overdue > 0) {
+        printf("\n");
+        center_print("[!] OVERDUE MAINTENANCE");
+        printf("\n");
+        printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+        printf("%-12s %-15s %-9s %s\n", "DATE", "CAR", "TYPE", "SERVICE");
+        printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+        for (int i = 0; i < 60; i++) printf("=");
+        printf("\n");
+        calendar_between(reminders, 0, calendar_add_days(today, -1), print_calendar_event, NULL);
+    }
+
+    printf("\n");
+    center_print("UPCOMING MAINTENANCE SCHEDULE");
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+    printf("%-12s %-15s %-9s %s\n", "DATE", "CAR", "TYPE", "SERVICE");
+    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+    for (int i = 0; i < 60; i++) printf("=");
+    printf("\n");
+
+    int upcoming = calendar_between(reminders, today, 0, print_calendar_event, NULL);
+
+    if (overdue + upcoming == 0) {
+        printf("%*s", (CONSOLE_WIDTH-40)/2, "");
+        printf("No scheduled maintenance found.\n");
+        printf("%*s", (CONSOLE_WIDTH-40)/2, "");
+        printf("Your vehicle is up to date!\n");
+    } else {
+        printf("\n");
+        center_print("TIP: Regular maintenance keeps your car running smoothly!");
+        center_print("Contact us to schedule your service appointment.");
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Manage Q&A system
+ */
+void manage_qna() {
+    int choice;
+
+    while (1) {
+        clear_screen();
+        display_ascii_logo();
+        center_print("[*] Q&A MANAGEMENT");
+        print_separator();
+
+        center_print("1  [+]  Add Q&A");
+        center_print("2  [*]  View All Q&A");
+        center_print("3  [<]  Back");
+
+        printf("\n");
+        printf("%*s", (CONSOLE_WIDTH-20)/2, "");
+        printf("Enter choice: ");
+        scanf("%d", &choice);
+
+        switch (choice) {
+            case 1: add_qna(); break;
+            case 2: view_qna(); break;
+            case 3: return;
+            default:
+                center_print("[X] Invalid choice.");
+                printf("\n");
+                center_print("Press any key to continue...");
+                getchar(); getchar();
+        }
+    }
+}
+
+/**
+ * Add Q&A entry
+ */
+void add_qna() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[+] ADD Q&A ENTRY");
+    print_separator();
+
+    char question[200], answer[300];
+
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-15)/2, "");
+    printf("Question: ");
+    getchar(); // consume newline
+    fgets(question, sizeof(question), stdin);
+    question[strcspn(question, "\n")] = '\0';
+
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-15)/2, "");
+    printf("Answer: ");
+    fgets(answer, sizeof(answer), stdin);
+    answer[strcspn(answer, "\n")] = '\0';
+
+    FILE *f = fopen(QNA_FILE, "a");
+    if (!f) {
+        center_print("[X] Error opening Q&A file.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    fprintf(f, "Q: %s\nA: %s\n---\n", question, answer);
+    fclose(f);
+
+    center_print("[+] Q&A added successfully!");
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * View all Q&A entries
+ */
+void view_qna() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] Q&A DATABASE");
+    print_separator();
+
+    FILE *f = fopen(QNA_FILE, "r");
+    if (!f) {
+        center_print("[!] No Q&A entries found.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    char line[500];
+    printf("\n");
+
+    while (fgets(line, sizeof(line), f)) {
+        if (strstr(line, "Q: ") == line) {
+            printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+            printf("[?] %s", line + 3);
+        } else if (strstr(line, "A: ") == line) {
+            printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+            printf("[>] %s", line + 3);
+        } else if (strstr(line, "---") == line) {
+            printf("\n");
+        }
+    }
+
+    fclose(f);
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Customer view Q&A (for customer dashboard): search by keywords, or list
+ * every question when nothing is typed
+ */
+void customer_view_qna() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] TROUBLESHOOTING Q&A");
+    print_separator();
+
+    int question_count = qna_count();
+    if (question_count == 0) {
+        center_print("[!] No Q&A available.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    char query[200];
+    printf("\n");
+    center_prompt("Describe the problem (Enter to list all): ");
+    getchar(); // consume newline
+    if (!fgets(query, sizeof(query), stdin)) query[0] = '\0';
+    query[strcspn(query, "\n")] = '\0';
+
+    QnaHit hits[QNA_MAX_HITS];
+    int shown = question_count;
+
+    printf("\n");
+    if (query[0]) {
+        shown = qna_search(query, hits, QNA_MAX_HITS);
+        if (shown == 0) {
+            center_print("[!] No answers match those words. Try other words or list all.");
+            printf("\n");
+            center_print("Press any key to continue...");
+            getchar();
+            return;
+        }
+        center_print("Best Matches:");
+    } else {
+        center_print("Available Questions:");
+    }
+    printf("\n");
+
+    for (int i = 0; i < shown; i++) {
+        printf("%*s", (CONSOLE_WIDTH-70)/2, "");
+        printf("%d. %s\n", i + 1, qna_question(query[0] ? hits[i].id : i));
+    }
+
+    // Let customer select a question
+    int choice;
+    printf("\n");
+    char prompt[50];
+    sprintf(prompt, "Select question (1-%d): ", shown);
+    center_prompt(prompt);
+    scanf("%d", &choice);
+
+    if (choice < 1 || choice > shown) {
+        center_print("[X] Invalid choice.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    int id = query[0] ? hits[choice - 1].id : choice - 1;
+    printf("\n");
+    center_print("=== SELECTED Q&A ===");
+    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+    printf("[?] %s\n", qna_question(id));
+    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+    printf("[>] %s\n", qna_answer(id));
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+// ==================== CAR PARKING FUNCTIONS ====================
+
+/**
+ * Add car parking entry
+ */
+void add_car_parking(const char *username) {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[+] CAR PARKING REGISTRATION");
+    print_separator();
+
+    GarageParking parking;
+    strcpy(parking.username, username);
+
+    printf("\n");
+    center_prompt("Car Number: ");
+    scanf("%19s", parking.car_number);
+
+    center_prompt("Entry Time (HH:MM): ");
+    scanf("%19s", parking.entry_time);
+
+    center_prompt("Car Manufacturer Company: ");
+    // Clear the input buffer first
+    while (getchar() != '\n');
+    // Now read the manufacturer name
+    fgets(parking.manufacturer, sizeof(parking.manufacturer), stdin);
+    // Remove the trailing newline character
+    parking.manufacturer[strcspn(parking.manufacturer, "\n")] = '\0';
+
+    // Today's date is filled in when the record is saved
+    parking.date[0] = '\0';
+
+    if (!garage_add_parking(&parking)) {
+        center_print("[X] Error opening car parking file.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    // Auto-add service progress for parking
+    auto_add_service_progress(parking.car_number, "PARKING_BOOKED");
+
+    printf("\n");
+    center_print("[+] Car parking registered successfully!");
+    center_print("[+] Service progress updated automatically!");
+    printf("\n");
+    char parking_msg[100];
+    sprintf(parking_msg, "[*] %s parked at %s on %s", parking.car_number, parking.entry_time, parking.date);
+    center_print(parking_msg);
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Parking lines, optionally narrowed to the YYYYMMDD date in `context`
+ */
+int parking_line_matches(const char *line, void *context) {
+    const long *date_key = context;
+    GarageParking parking;
+
+    if (!garage_parse_parking(line, &parking)) return 0;
+    return !date_key || garage_date_key(parking.date) == *date_key;
+}
+
+long parking_line_date(const char *line) {
+    GarageParking parking;
+    return garage_parse_parking(line, &parking) ? garage_date_key(parking.date) : 0;
+}
+
+void print_parking_header() {
+    screen_pad((CONSOLE_WIDTH-80)/2, ' ');
+    screen_printf("%-12s %-12s %-12s %-8s %s\n", "CUSTOMER", "CAR NUMBER", "DATE", "TIME", "MANUFACTURER");
+    screen_pad((CONSOLE_WIDTH-80)/2, ' ');
+    screen_pad(80, '-');
+    screen_puts("\n");
+}
+
+void render_parking_line(const char *line, void *context) {
+    GarageParking parking;
+    (void)context;
+    if (!garage_parse_parking(line, &parking)) return;
+
+    screen_pad((CONSOLE_WIDTH-80)/2, ' ');
+    screen_printf("%-12s %-12s %-12s %-8s %s\n", parking.username, parking.car_number,
+                  parking.date, parking.entry_time, parking.manufacturer);
+}
+
+void print_stay_header() {
+    printf("%*s", (CONSOLE_WIDTH-80)/2, "");
+    printf("%-12s %-12s %-17s %-17s %s\n", "CUSTOMER", "CAR NUMBER", "ENTRY", "EXIT", "MANUFACTURER");
+    printf("%*s", (CONSOLE_WIDTH-80)/2, "");
+    for (int i = 0; i < 80; i++) printf("-");
+    printf("\n");
+}
+
+/**
+ * One stay; the exit is "PARKED" while the car is in and "-" when no exit
+ * was recorded
+ */
+int print_stay_row(const ParkingStay *stay, void *context) {
+    char entry[20], exit_text[20] = "-";
+    (void)context;
+
+    strftime(entry, sizeof(entry), "%Y-%m-%d %H:%M", localtime(&stay->entry));
+    if (stay->open) strcpy(exit_text, "PARKED");
+    else if (stay->exit_recorded) strftime(exit_text, sizeof(exit_text), "%Y-%m-%d %H:%M", localtime(&stay->exit));
+
+    printf("%*s", (CONSOLE_WIDTH-80)/2, "");
+    printf("%-12s %-12s %-17s %-17s %s\n", stay->username, stay->car_number, entry, exit_text, stay->manufacturer);
+    return 0;
+}
+
+/**
+ * Cars in the garage at one moment
+ */
+void view_parked_at(time_t when, const char *title) {
+    clear_screen();
+    display_ascii_logo();
+    center_print(title);
+    print_separator();
+    printf("\n");
+
+    print_stay_header();
+    int count = parking_parked_at(when, print_stay_row, NULL);
+
+    printf("\n");
+    if (count == 0) {
+        center_print("[!] No cars were parked at that time.");
+    } else {
+        char summary[60];
+        sprintf(summary, "[*] %d car%s parked", count, count == 1 ? "" : "s");
+        center_print(summary);
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+void view_parking_history() {
+    char car_number[20];
+
+    printf("\n");
+    center_prompt("Car Number: ");
+    scanf("%19s", car_number);
+
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] PARKING HISTORY");
+    print_separator();
+    printf("\n");
+
+    print_stay_header();
+    if (parking_history(car_number, print_stay_row, NULL) == 0) {
+        printf("\n");
+        center_print("[!] No parking records found for this car.");
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Entries and peak occupancy per day, for capacity planning
+ */
+void view_daily_occupancy() {
+    printf("\n");
+    long from = read_date_filter("From date (YYYY-MM-DD): ");
+    long to = read_date_filter("To date (YYYY-MM-DD): ");
+
+    if (from <= 0 || to <= 0 || to < from) {
+        center_print("[X] Enter both dates as YYYY-MM-DD, oldest first.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    ParkingDay days[31];
+    int count = parking_daily_occupancy(from, to, days, 31);
+
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] DAILY PARKING OCCUPANCY");
+    print_separator();
+    printf("\n");
+
+    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+    printf("%-12s %-8s %-6s %s\n", "DATE", "ENTRIES", "PEAK", "");
+    printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+    for (int i = 0; i < 60; i++) printf("-");
+    printf("\n");
+
+    char date[GARAGE_DATE_TEXT];
+    for (int i = 0; i < count; i++) {
+        garage_format_date_key(days[i].date, date, sizeof(date));
+        printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+        printf("%-12s %-8d %-6d ", date, days[i].entries, days[i].peak);
+        for (int j = 0; j < days[i].peak && j < 30; j++) printf("#");
+        printf("\n");
+    }
+    if (count == 31 && days[30].date < to) {
+        printf("\n");
+        center_print("[*] Showing the first 31 days of the range.");
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+void check_out_car() {
+    char car_number[20], message[80];
+
+    printf("\n");
+    center_prompt("Car Number: ");
+    scanf("%19s", car_number);
+
+    int result = parking_check_out(car_number, time(NULL));
+
+    printf("\n");
+    if (result == 1) {
+        sprintf(message, "[+] %s checked out.", car_number);
+        center_print(message);
+    } else if (result == 0) {
+        center_print("[!] That car is not parked right now.");
+    } else {
+        center_print("[X] Error opening parking exits file.");
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+void view_car_parking() {
+    screen_begin();
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] CAR PARKING RECORDS");
+    print_separator();
+
+    screen_puts("\n");
+    center_print("1  [*]  View All Parking Records");
+    center_print("2  [F]  Filter by Date");
+    center_print("3  [*]  Cars Parked Now");
+    center_print("4  [*]  Cars Parked at a Date and Time");
+    center_print("5  [*]  Parking History for a Car");
+    center_print("6  [*]  Daily Occupancy");
+    center_print("7  [-]  Check Out a Car");
+    center_print("8  [<]  Back to Menu");
+    screen_puts("\n");
+
+    int choice;
+    center_prompt("Select option (1-8): ");
+    screen_end();
+    scanf("%d", &choice);
+
+    if (choice == 1) {
+        // View all parking records
+        PagedTable table = {
+            "[*] ALL CAR PARKING RECORDS", NULL, CAR_PARKING_FILE, "[!] No parking records found.",
+            print_parking_header, render_parking_line, parking_line_matches, parking_line_date, NULL
+        };
+        browse_table(&table);
+
+    } else if (choice == 2) {
+        // Filter by date
+        screen_puts("\n");
+        long date_key = read_date_filter("Enter date to search (YYYY-MM-DD): ");
+        if (date_key <= 0) {
+            center_print("[X] Invalid date.");
+            printf("\n");
+            center_print("Press any key to continue...");
+            getchar(); getchar();
+            return;
+        }
+
+        char date[GARAGE_DATE_TEXT], filter_msg[100];
+        garage_format_date_key(date_key, date, sizeof(date));
+        sprintf(filter_msg, "Showing parking records for: %s", date);
+
+        PagedTable table = {
+            "[F] FILTERED PARKING RECORDS BY DATE", filter_msg, CAR_PARKING_FILE,
+            "[!] No parking records found for the specified date.",
+            print_parking_header, render_parking_line, parking_line_matches, NULL, &date_key
+        };
+        browse_table(&table);
+
+    } else if (choice == 3) {
+        view_parked_at(time(NULL), "[*] CARS PARKED NOW");
+
+    } else if (choice == 4) {
+        char date[20], clock[20];
+        printf("\n");
+        center_prompt("Date (YYYY-MM-DD): ");
+        scanf("%19s", date);
+        center_prompt("Time (HH:MM): ");
+        scanf("%19s", clock);
+
+        time_t when = parking_entry_time(date, clock);
+        if (when == (time_t)-1) {
+            center_print("[X] Invalid date.");
+            printf("\n");
+            center_print("Press any key to continue...");
+            getchar(); getchar();
+            return;
+        }
+
+        char title[80];
+        sprintf(title, "[*] CARS PARKED AT %s %s", date, clock);
+        view_parked_at(when, title);
+
+    } else if (choice == 5) {
+        view_parking_history();
+    } else if (choice == 6) {
+        view_daily_occupancy();
+    } else if (choice == 7) {
+        check_out_car();
+    } else if (choice != 8) {
+        center_print("[X] Invalid choice.");
+        screen_puts("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+    }
+}
+
+/**
+ * Initialize default Q&A entries
+ */
+void initialize_default_qna() {
+    FILE *f = fopen(QNA_FILE, "r");
+    if (f) {
+        fclose(f);
+        return; // File exists, don't overwrite
+    }
+
+    f = fopen(QNA_FILE, "w");
+    if (f) {
+        fprintf(f, "Q: My car engine is overheating. What should I do?\n");
+        fprintf(f, "A: Turn off the AC, turn on the heater, pull over safely, turn off the engine, check coolant level (when cool), and call for help if needed.\n\n");
+
+        fprintf(f, "Q: My car won't start. What are the possible causes?\n");
+        fprintf(f, "A: Check battery connections, try jump-starting, check fuel level, ensure the gear is in Park/Neutral, and verify the starter motor.\n\n");
+
+        fprintf(f, "Q: Why are my brakes making squeaking noises?\n");
+        fprintf(f, "A: Usually indicates worn brake pads. Have them inspected immediately as this is a safety issue. May also be due to dust or moisture.\n\n");
+
+        fprintf(f, "Q: How often should I change my car's oil?\n");
+        fprintf(f, "A: Generally every 3,000-7,500 miles depending on oil type. Synthetic oil lasts longer. Check your owner's manual for specific recommendations.\n\n");
+
+        fprintf(f, "Q: My car is pulling to one side while driving. What's wrong?\n");
+        fprintf(f, "A: Could be tire pressure imbalance, wheel alignment issues, or brake problems. Check tire pressure first, then visit a mechanic.\n\n");
+
+        fprintf(f, "Q: What should I do if my car battery dies?\n");
+        fprintf(f, "A: Use jumper cables with another car, call roadside assistance, or use a portable battery pack. Replace old batteries preventively.\n\n");
+
+        fprintf(f, "Q: How can I improve my car's fuel efficiency?\n");
+        fprintf(f, "A: Maintain proper tire pressure, regular oil changes, remove excess weight, drive smoothly, and keep up with regular maintenance.\n\n");
+
+        fprintf(f, "Q: My check engine light is on. Is it serious?\n");
+        fprintf(f, "A: It varies. If blinking, stop driving immediately. If steady, get it diagnosed soon. Could range from loose gas cap to serious engine issues.\n\n");
+
+        fclose(f);
+    }
+}
+
+/**
+ * Generate QR Receipt for services
+ */
+void generate_qr_receipt(const char *username, const char *service_details, float amount) {
+    FILE *f = fopen(QR_RECEIPTS_FILE, "a");
+    if (!f) return;
+
+    time_t now = time(NULL);
+    char date[20];
+    strftime(date, sizeof(date), "%d/%m/%Y", localtime(&now));
+
+    // Generate simple QR code representation (text-based)
+    char qr_code[50];
+    sprintf(qr_code, "QR_%s_%ld", username, now);
+
+    fprintf(f, "%s|%s|%s|%.2f|%s\n", qr_code, username, date, amount, service_details);
+    fclose(f);
+
+    printf("\n");
+    center_print("[+] Digital QR Receipt Generated!");
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-40)/2, "");
+    printf("QR Code: %s\n", qr_code);
+    printf("%*s", (CONSOLE_WIDTH-40)/2, "");
+    printf("Scan this code to view service details\n");
+}
+
+void print_receipts_header() {
+    screen_pad((CONSOLE_WIDTH-80)/2, ' ');
+    screen_printf("%-15s %-12s %-10s %s\n", "QR CODE", "DATE", "AMOUNT", "SERVICE DETAILS");
+    screen_pad((CONSOLE_WIDTH-80)/2, ' ');
+    screen_pad(80, '-');
+    screen_puts("\n");
+}
+
+/**
+ * One row of the receipt listing (visitor for receipts_for_user)
+ */
+int print_receipt_row(const GarageReceipt *receipt, void *context) {
+    (void)context;
+    screen_pad((CONSOLE_WIDTH-80)/2, ' ');
+    screen_printf("%-15s %-12s $%-9.2f %s\n", receipt->qr_code, receipt->date, receipt->amount, receipt->details);
+    return 0;
+}
+
+/**
+ * View QR Receipts for customer, a page at a time from the receipt index
+ */
+void view_qr_receipts(const char *username) {
+    int rows = page_rows();
+    int first = 0;
+
+    while (1) {
+        screen_begin();
+        clear_screen();
+        display_ascii_logo();
+        center_print("[*] YOUR QR RECEIPTS");
+        print_separator();
+        screen_puts("\n");
+        print_receipts_header();
+
+        int total = receipts_for_user(username, first, rows, print_receipt_row, NULL);
+        if (total == 0) {
+            center_print("[-] No QR receipts found for your account.");
+            screen_puts("\n");
+            center_print("Press any key to continue...");
+            screen_end();
+            getchar(); getchar();
+            return;
+        }
+
+        char status[100];
+        int pages = (total + rows - 1) / rows;
+        sprintf(status, "Page %d of %d  (%d receipts)", first / rows + 1, pages, total);
+        screen_puts("\n");
+        center_print(status);
+        center_print("[N] Next  [P] Previous  [F] First  [Q] Back");
+        screen_puts("\n");
+        center_prompt("Select option: ");
+        screen_end();
+
+        char command[20];
+        if (scanf("%19s", command) != 1) return;
+
+        switch (tolower((unsigned char)command[0])) {
+            case 'n': if (first + rows < total) first += rows; break;
+            case 'p': first = first >= rows ? first - rows : 0; break;
+            case 'f': first = 0; break;
+            case 'q': return;
+        }
+    }
+}
+
+/**
+ * Verify a QR receipt by its code (front desk)
+ */
+void verify_qr_receipt() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[QR] VERIFY QR RECEIPT");
+    print_separator();
+
+    char qr_code[50];
+    printf("\n");
+    center_prompt("QR Code: ");
+    scanf("%49s", qr_code);
+
+    GarageReceipt receipt;
+    printf("\n");
+    if (receipts_find(qr_code, &receipt)) {
+        char detail_msg[250];
+        center_print("[+] Receipt verified - this is a genuine receipt.");
+        printf("\n");
+        sprintf(detail_msg, "Customer: %s", receipt.username);
+        center_print(detail_msg);
+        sprintf(detail_msg, "Date: %s", receipt.date);
+        center_print(detail_msg);
+        sprintf(detail_msg, "Amount: $%.2f", receipt.amount);
+        center_print(detail_msg);
+        sprintf(detail_msg, "Details: %s", receipt.details);
+        center_print(detail_msg);
+    } else {
+        center_print("[X] No receipt with this QR code. It may be forged or mistyped.");
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Smart Parts Recommendation System
+ */
+void smart_parts_recommendation(const char *username) {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] SMART PARTS RECOMMENDATIONS");
+    print_separator();
+
+    // Initialize compatibility and seasonal data
+    initialize_car_compatibility();
+    initialize_seasonal_recommendations();
+
+    printf("\n");
+    center_print("[+] Personalized Recommendations for You:");
+    printf("\n");
+
+    // Parts bought by customers who bought the same parts as this one
+    Recommendation picks[RECOMMEND_MAX];
+    int count = recommend_for_customer(username, 5, picks);
+    char line[200];
+
+    if (count == 0) {
+        center_print("No orders yet - see the most popular parts below.");
+    }
+    for (int i = 0; i < count; i++) {
+        if (picks[i].because[0]) {
+            snprintf(line, sizeof(line), "* %.49s - because you bought %.49s (together by %d customer%s)",
+                     picks[i].part, picks[i].because, picks[i].customers, picks[i].customers == 1 ? "" : "s");
+        } else {
+            snprintf(line, sizeof(line), "* %.49s - bought by %d customer%s",
+                     picks[i].part, picks[i].customers, picks[i].customers == 1 ? "" : "s");
+        }
+        printf("%*s%s\n", (CONSOLE_WIDTH-60)/2, "", line);
+    }
+
+    // Parts listed for the customer's car brands and for this season
+    time_t now = time(NULL);
+    int month = localtime(&now)->tm_mon + 1;
+    CompatPick fits[COMPAT_MAX_PICKS];
+    int fit_count = compat_recommend(username, month, fits, COMPAT_MAX_PICKS);
+
+    printf("\n");
+    center_print("[CARS & SEASON] For Your Cars and the Season:");
+    printf("\n");
+
+    if (fit_count == 0) {
+        center_print("Park a car with us to see the parts that fit it.");
+    }
+    for (int i = 0; i < fit_count; i++) {
+        if (fits[i].in_stock) {
+            snprintf(line, sizeof(line), "* %.49s [%.59s] - in stock, $%.2f", fits[i].part, fits[i].reason, fits[i].price);
+        } else {
+            snprintf(line, sizeof(line), "* %.49s [%.59s] - ask us to order it", fits[i].part, fits[i].reason);
+        }
+        printf("%*s%s\n", (CONSOLE_WIDTH-60)/2, "", line);
+    }
+
+    printf("\n");
+    center_print("[POPULAR] Most Popular with Customers:");
+    printf("\n");
+    count = recommend_popular(3, picks);
+    for (int i = 0; i < count; i++) {
+        snprintf(line, sizeof(line), "* %.49s (bought by %d customer%s)",
+                 picks[i].part, picks[i].customers, picks[i].customers == 1 ? "" : "s");
+        printf("%*s%s\n", (CONSOLE_WIDTH-60)/2, "", line);
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Initialize car compatibility data
+ */
+void initialize_car_compatibility() {
+    FILE *f = fopen(CAR_COMPATIBILITY_FILE, "r");
+    if (f) {
+        fclose(f);
+        return; // File exists, no need to initialize
+    }
+
+    f = fopen(CAR_COMPATIBILITY_FILE, "w");
+    if (f) {
+        fprintf(f, "Toyota|Engine_Oil|Brake_Pads|Air_Filter|Spark_Plugs\n");
+        fprintf(f, "Honda|Engine_Oil|Brake_Pads|Transmission_Fluid|Timing_Belt\n");
+        fprintf(f, "Ford|Engine_Oil|Brake_Pads|Power_Steering_Fluid|Fuel_Filter\n");
+        fprintf(f, "BMW|Synthetic_Oil|Performance_Brake_Pads|Premium_Air_Filter|Ignition_Coils\n");
+        fprintf(f, "Mercedes|Synthetic_Oil|Ceramic_Brake_Pads|HEPA_Air_Filter|Premium_Spark_Plugs\n");
+        fclose(f);
+    }
+}
+
+/**
+ * Initialize seasonal recommendations
+ */
+void initialize_seasonal_recommendations() {
+    FILE *f = fopen(SEASONAL_RECOMMENDATIONS_FILE, "r");
+    if (f) {
+        fclose(f);
+        return; // File exists
+    }
+
+    f = fopen(SEASONAL_RECOMMENDATIONS_FILE, "w");
+    if (f) {
+        fprintf(f, "Winter|Winter_Tires|Battery_Check|Antifreeze|Windshield_Fluid\n");
+        fprintf(f, "Summer|AC_Service|Coolant_Check|UV_Protection|Tire_Pressure\n");
+        fprintf(f, "Spring|Wiper_Blades|Oil_Change|Tire_Rotation|Brake_Inspection\n");
+        fprintf(f, "Fall|Wiper_Blades|Heater_Check|Tire_Rotation|Battery_Test\n");
+        fclose(f);
+    }
+}
+
+/**
+ * Loyalty System Menu
+ */
+void loyalty_system_menu(const char *username) {
+    int choice;
+
+    while (1) {
+        clear_screen();
+        display_ascii_logo();
+        center_print("[*] LOYALTY REWARDS SYSTEM");
+        print_separator();
+
+        printf("\n");
+        center_print("1. View My Points");
+        center_print("2. View My Badges");
+        center_print("3. Redeem Points");
+        center_print("4. Back to Main Menu");
+        printf("\n");
+        center_prompt("Enter choice: ");
+        scanf("%d", &choice);
+
+        switch (choice) {
+            case 1:
+                view_loyalty_points(username);
+                break;
+            case 2:
+                view_customer_badges(username);
+                break;
+            case 3:
+                redeem_loyalty_points(username);
+                break;
+            case 4:
+                return;
+            default:
+                center_print("[X] Invalid choice!");
+                printf("\n");
+                center_print("Press any key to continue...");
+                getchar(); getchar();
+        }
+    }
+}
+
+/**
+ * Add loyalty points for customer
+ */
+void add_loyalty_points(const char *username, int points) {
+    if (!leaderboard_add_points(username, points, NULL)) return;
+
+    // Check for badge achievements
+    check_and_award_badges(username);
+}
+
+/**
+ * View loyalty points
+ */
+void view_loyalty_points(const char *username) {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] YOUR LOYALTY POINTS");
+    print_separator();
+
+    if (!garage_has_file(LOYALTY_POINTS_FILE)) {
+        center_print("[-] No loyalty points found.");
+        printf("\n");
+        center_print("You'll earn points with each purchase!");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    LeaderboardEntry account;
+
+    if (leaderboard_rank(username, &account)) {
+        printf("\n");
+        char points_msg[100];
+        sprintf(points_msg, "LOYALTY Your Current Points: %d", account.points);
+        center_print(points_msg);
+        sprintf(points_msg, "Leaderboard Rank: #%d of %d customers", account.rank, leaderboard_count());
+        center_print(points_msg);
+
+        printf("\n");
+        center_print("Redemption Options:");
+        center_print("$ 100 points = $5 discount");
+        center_print("$ 200 points = $12 discount");
+        center_print("$ 500 points = $30 discount");
+    } else {
+        center_print("[-] No loyalty points found.");
+        printf("\n");
+        center_print("Start shopping to earn points!");
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Redeem loyalty points
+ */
+void redeem_loyalty_points(const char *username) {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] REDEEM LOYALTY POINTS");
+    print_separator();
+
+    // First show current points
+    if (!garage_has_file(LOYALTY_POINTS_FILE)) {
+        center_print("[-] No loyalty points to redeem.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    int current_points = garage_get_loyalty_points(username);
+
+    if (current_points <= 0) {
+        center_print("[-] No points available for redemption.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    printf("\n");
+    char points_msg[100];
+    sprintf(points_msg, "Available Points: %d", current_points);
+    center_print(points_msg);
+
+    printf("\n");
+    center_print("Redemption Options:");
+    center_print("1. 100 points -> $5 discount");
+    center_print("2. 200 points -> $12 discount");
+    center_print("3. 500 points -> $30 discount");
+    center_print("4. Cancel");
+
+    printf("\n");
+    center_prompt("Choose option: ");
+    int choice;
+    scanf("%d", &choice);
+
+    int points_needed = 0;
+    float discount = 0;
+
+    switch (choice) {
+        case 1: points_needed = 100; discount = 5.0; break;
+        case 2: points_needed = 200; discount = 12.0; break;
+        case 3: points_needed = 500; discount = 30.0; break;
+        case 4: return;
+        default:
+            center_print("[X] Invalid choice!");
+            printf("\n");
+            center_print("Press any key to continue...");
+            getchar(); getchar();
+            return;
+    }
+
+    // Deduct points and record the redemption
+    int redeemed = leaderboard_redeem(username, points_needed, discount);
+    if (redeemed != 1) {
+        center_print(redeemed == 0 ? "[X] Insufficient points!" : "[X] Could not update loyalty points.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    printf("\n");
+    char success_msg[100];
+    sprintf(success_msg, "[+] Successfully redeemed %d points for $%.2f discount!", points_needed, discount);
+    center_print(success_msg);
+
+    // Issue a personal single-use code instead of a shared one
+    PromoCode reward;
+    memset(&reward, 0, sizeof(reward));
+    reward.percent = 10.0f;
+    reward.max_uses = 1;
+    reward.per_customer = 1;
+
+    time_t expiry_time = time(NULL) + 30L * 24 * 60 * 60;
+    struct tm *expiry = localtime(&expiry_time);
+    reward.expires = (long)(expiry->tm_year + 1900) * 10000 + (expiry->tm_mon + 1) * 100 + expiry->tm_mday;
+
+    unsigned int serial = (unsigned int)time(NULL) % 1000000;
+    do {
+        sprintf(reward.code, "LOYAL%06u", serial);
+        serial = (serial + 1) % 1000000;
+    } while (promo_find(reward.code) != NULL);
+
+    if (promo_add(&reward)) {
+        char code_msg[100];
+        sprintf(code_msg, "Your discount code: %s", reward.code);
+        center_print(code_msg);
+        center_print("Use this code in your next order within 30 days for 10% additional discount!");
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * View customer badges
+ */
+void view_customer_badges(const char *username) {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] YOUR ACHIEVEMENT BADGES");
+    print_separator();
+
+    FILE *f = fopen(CUSTOMER_BADGES_FILE, "r");
+    if (!f) {
+        center_print("[-] No badges earned yet.");
+        printf("\n");
+        center_print("Keep shopping to unlock achievements!");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    char user[30], badge[50], date[20];
+    int found = 0;
+
+    printf("\n");
+    center_print("ACHIEVEMENTS YOUR ACHIEVEMENTS:");
+    printf("\n");
+
+    while (fscanf(f, "%s %s %s", user, badge, date) == 3) {
+        if (strcmp(user, username) == 0) {
+            found = 1;
+            printf("%*s", (CONSOLE_WIDTH-50)/2, "");
+            printf("*  %s (Earned: %s)\n", badge, date);
+        }
+    }
+    fclose(f);
+
+    if (!found) {
+        center_print("[-] No badges earned yet.");
+        printf("\n");
+        center_print("Available Badges:");
+        center_print("BRONZE First Purchase - Make your first order");
+        center_print("SILVER Regular Customer - Make 5 orders");
+        center_print("GOLD VIP Customer - Make 10 orders");
+        center_print("PLATINUM Platinum Member - Make 20 orders");
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Check and award badges based on activity
+ */
+void check_and_award_badges(const char *username) {
+    // Count user orders
+    if (!garage_has_file(ORDERS_FILE)) return;
+
+    HistorySummary summary;
+    int order_count = history_get(username, &summary);
+
+    // Check existing badges
+    FILE *badges = fopen(CUSTOMER_BADGES_FILE, "r");
+    char badge_user[30], badge_name[50], badge_date[20];
+    int has_first = 0, has_regular = 0, has_vip = 0, has_platinum = 0;
+
+    if (badges) {
+        while (fscanf(badges, "%s %s %s", badge_user, badge_name, badge_date) == 3) {
+            if (strcmp(badge_user, username) == 0) {
+                if (strcmp(badge_name, "First_Purchase") == 0) has_first = 1;
+                if (strcmp(badge_name, "Regular_Customer") == 0) has_regular = 1;
+                if (strcmp(badge_name, "VIP_Customer") == 0) has_vip = 1;
+                if (strcmp(badge_name, "Platinum_Member") == 0) has_platinum = 1;
+            }
+        }
+        fclose(badges);
+    }
+
+    // Award new badges
+    FILE *badge_file = fopen(CUSTOMER_BADGES_FILE, "a");
+    if (badge_file) {
+        time_t now = time(NULL);
+        char date[20];
+        strftime(date, sizeof(date), "%d/%m/%Y", localtime(&now));
+
+        if (order_count >= 1 && !has_first) {
+            fprintf(badge_file, "%s First_Purchase %s\n", username, date);
+        }
+        if (order_count >= 5 && !has_regular) {
+            fprintf(badge_file, "%s Regular_Customer %s\n", username, date);
+        }
+        if (order_count >= 10 && !has_vip) {
+            fprintf(badge_file, "%s VIP_Customer %s\n", username, date);
+        }
+        if (order_count >= 20 && !has_platinum) {
+            fprintf(badge_file, "%s Platinum_Member %s\n", username, date);
+        }
+        fclose(badge_file);
+    }
+}
+
+/**
+ * Admin loyalty dashboard
+ */
+void admin_loyalty_dashboard() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] LOYALTY SYSTEM DASHBOARD");
+    print_separator();
+
+    printf("\n");
+    center_print("=== CUSTOMER LOYALTY STATISTICS ===");
+    printf("\n");
+
+    // Show top customers by points
+    int customers = garage_has_file(LOYALTY_POINTS_FILE) ? leaderboard_count() : 0;
+    if (customers > 0) {
+        LeaderboardEntry top[LOYALTY_TOP_COUNT];
+        int count = leaderboard_top(top, LOYALTY_TOP_COUNT);
+
+        center_print("TOP CUSTOMERS BY POINTS:");
+        printf("\n");
+        printf("%*s", (CONSOLE_WIDTH-40)/2, "");
+        printf("%-6s %-20s %s\n", "RANK", "CUSTOMER", "POINTS");
+        printf("%*s", (CONSOLE_WIDTH-40)/2, "");
+        for (int i = 0; i < 40; i++) printf("-");
+        printf("\n");
+
+        for (int i = 0; i < count; i++) {
+            printf("%*s", (CONSOLE_WIDTH-40)/2, "");
+            printf("#%-5d %-20s %d\n", top[i].rank, top[i].username, top[i].points);
+        }
+
+        char stats_msg[150];
+        printf("\n");
+        sprintf(stats_msg, "%d customers  |  Median: %d  |  90th percentile: %d  |  99th percentile: %d",
+                customers, leaderboard_percentile(50), leaderboard_percentile(90), leaderboard_percentile(99));
+        center_print(stats_msg);
+    } else {
+        center_print("[-] No loyalty points found.");
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+// ==================== DELETE FUNCTIONS ====================
+
+/**
+ * Delete car profile
+ */
+void delete_car_profile() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] DELETE CAR PROFILE");
+    print_separator();
+
+    char car_number[20];
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
+    printf("Enter Car Number to Delete: ");
+    scanf("%s", car_number);
+
+    FILE *f = fopen(CAR_PROFILES_FILE, "r");
+    if (!f) {
+        center_print("[!] No car profiles found.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    FILE *temp = fopen("temp_profiles.txt", "w");
+    if (!temp) {
+        center_print("[X] Error creating temporary file.");
+        fclose(f);
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    char line[300];
+    int found = 0;
+
+    while (fgets(line, sizeof(line), f)) {
+        char stored_car[20];
+        sscanf(line, "%s", stored_car);
+
+        if (strcmp(stored_car, car_number) != 0) {
+            fputs(line, temp);
+        } else {
+            found = 1;
+        }
+    }
+
+    fclose(f);
+    fclose(temp);
+
+    if (found) {
+        remove(CAR_PROFILES_FILE);
+        rename("temp_profiles.txt", CAR_PROFILES_FILE);
+        center_print("[+] Car profile deleted successfully!");
+    } else {
+        remove("temp_profiles.txt");
+        center_print("[!] Car profile not found.");
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Delete progress record
+ */
+void delete_progress_record() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] DELETE PROGRESS RECORD");
+    print_separator();
+
+    char car_number[20];
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-35)/2, "");
+    printf("Enter Car Number: ");
+    scanf("%s", car_number);
+
+    FILE *f = fopen(PROGRESS_FILE, "r");
+    if (!f) {
+        center_print("[!] No progress records found.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    // First show existing records for this car
+    printf("\n");
+    center_print("=== EXISTING PROGRESS RECORDS ===");
+    char line[300];
+    int record_count = 0;
+
+    while (fgets(line, sizeof(line), f)) {
+        char stored_car[20], date[20], percentage[10], description[100];
+        sscanf(line, "%s %s %s %s", stored_car, date, percentage, description);
+        if (strcmp(stored_car, car_number) == 0) {
+            printf("%*s", (CONSOLE_WIDTH-60)/2, "");
+            printf("%d. %s - %s: %s\n", ++record_count, date, percentage, description);
+        }
+    }
+
+    if (record_count == 0) {
+        center_print("[!] No progress records found for this car.");
+        fclose(f);
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    fclose(f);
+
+    char date_to_delete[20];
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-40)/2, "");
+    printf("Enter date to delete (YYYY-MM-DD): ");
+    scanf("%s", date_to_delete);
+
+    f = fopen(PROGRESS_FILE, "r");
+    FILE *temp = fopen("temp_progress.txt", "w");
+    if (!temp) {
+        center_print("[X] Error creating temporary file.");
+        fclose(f);
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    int found = 0;
+    while (fgets(line, sizeof(line), f)) {
+        char stored_car[20], date[20];
+        sscanf(line, "%s %s", stored_car, date);
+
+        if (strcmp(stored_car, car_number) == 0 && strcmp(date, date_to_delete) == 0) {
+            found = 1;
+        } else {
+            fputs(line, temp);
+        }
+    }
+
+    fclose(f);
+    fclose(temp);
+
+    if (found) {
+        remove(PROGRESS_FILE);
+        rename("temp_progress.txt", PROGRESS_FILE);
+        center_print("[+] Progress record deleted successfully!");
+    } else {
+        remove("temp_progress.txt");
+        center_print("[!] Progress record not found.");
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Delete order history
+ */
+void delete_order_history(const char *username) {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] DELETE ORDER HISTORY");
+    print_separator();
+
+    FILE *f = fopen(ORDERS_FILE, "r");
+    if (!f) {
+        center_print("[!] No order history found.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    // First show existing orders for this user
+    printf("\n");
+    center_print("=== YOUR ORDER HISTORY ===");
+    char line[500];
+    int order_count = 0;
+
+    while (fgets(line, sizeof(line), f)) {
+        char stored_user[30];
+        sscanf(line, "%s", stored_user);
+        if (strcmp(stored_user, username) == 0) {
+            char date[20], time[10], parts[200];
+            float amount;
+            sscanf(line, "%s %s %s %f %[^\n]", stored_user, date, time, &amount, parts);
+            printf("%*s", (CONSOLE_WIDTH-80)/2, "");
+            printf("%d. %s %s - $%.2f - %s\n", ++order_count, date, time, amount, parts);
+        }
+    }
+
+    if (order_count == 0) {
+        center_print("[!] No order history found for your account.");
+        fclose(f);
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    fclose(f);
+
+    printf("\n");
+    center_print("1  [-]  Delete Specific Order");
+    center_print("2  [-]  Delete All My Orders");
+    center_print("3  [<]  Back");
+
+    int choice;
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-20)/2, "");
+    printf("Enter choice: ");
+    scanf("%d", &choice);
+
+    switch (choice) {
+        case 1: {
+            char date_to_delete[20], time_to_delete[10];
+            printf("\n");
+            printf("%*s", (CONSOLE_WIDTH-30)/2, "");
+            printf("Enter date (YYYY-MM-DD): ");
+            scanf("%s", date_to_delete);
+            printf("%*s", (CONSOLE_WIDTH-25)/2, "");
+            printf("Enter time (HH:MM): ");
+            scanf("%s", time_to_delete);
+
+            f = fopen(ORDERS_FILE, "r");
+            FILE *temp = fopen("temp_orders.txt", "w");
+            if (!temp) {
+                center_print("[X] Error creating temporary file.");
+                fclose(f);
+                break;
+            }
+
+            int found = 0;
+            while (fgets(line, sizeof(line), f)) {
+                char stored_user[30], date[20], time[10];
+                sscanf(line, "%s %s %s", stored_user, date, time);
+
+                if (strcmp(stored_user, username) == 0 &&
+                    strcmp(date, date_to_delete) == 0 &&
+                    strcmp(time, time_to_delete) == 0) {
+                    found = 1;
+                } else {
+                    fputs(line, temp);
+                }
+            }
+
+            fclose(f);
+            fclose(temp);
+
+            if (found) {
+                remove(ORDERS_FILE);
+                rename("temp_orders.txt", ORDERS_FILE);
+                center_print("[+] Order deleted successfully!");
+            } else {
+                remove("temp_orders.txt");
+                center_print("[!] Order not found.");
+            }
+            break;
+        }
+        case 2: {
+            printf("\n");
+            center_print("[!] WARNING: This will delete ALL your orders!");
+            printf("%*s", (CONSOLE_WIDTH-35)/2, "");
+            printf("Type 'DELETE' to confirm: ");
+            char confirm[20];
+            scanf("%s", confirm);
+
+            if (strcmp(confirm, "DELETE") == 0) {
+                f = fopen(ORDERS_FILE, "r");
+                FILE *temp = fopen("temp_orders.txt", "w");
+                if (!temp) {
+                    center_print("[X] Error creating temporary file.");
+                    fclose(f);
+                    break;
+                }
+
+                int deleted_count = 0;
+                while (fgets(line, sizeof(line), f)) {
+                    char stored_user[30];
+                    sscanf(line, "%s", stored_user);
+
+                    if (strcmp(stored_user, username) != 0) {
+                        fputs(line, temp);
+                    } else {
+                        deleted_count++;
+                    }
+                }
+
+                fclose(f);
+                fclose(temp);
+
+                if (deleted_count > 0) {
+                    remove(ORDERS_FILE);
+                    rename("temp_orders.txt", ORDERS_FILE);
+                    char msg[100];
+                    sprintf(msg, "[+] %d orders deleted successfully!", deleted_count);
+                    center_print(msg);
+                } else {
+                    remove("temp_orders.txt");
+                    center_print("[!] No orders found to delete.");
+                }
+            } else {
+                center_print("[!] Deletion cancelled.");
+            }
+            break;
+        }
+        case 3:
+            return;
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Delete parking record
+ */
+void delete_parking_record() {
+    clear_screen();
+    display_ascii_logo();
+    center_print("[*] DELETE PARKING RECORD");
+    print_separator();
+
+    char car_number[20];
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-25)/2, "");
+    printf("Enter Car Number: ");
+    scanf("%s", car_number);
+
+    // First show existing parking records for this car
+    printf("\n");
+    center_print("=== EXISTING PARKING RECORDS ===");
+    print_stay_header();
+    int record_count = parking_history(car_number, print_stay_row, NULL);
+
+    if (record_count == 0) {
+        center_print("[!] No parking records found for this car.");
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    char date_to_delete[20];
+    printf("\n");
+    printf("%*s", (CONSOLE_WIDTH-40)/2, "");
+    printf("Enter date to delete (YYYY-MM-DD): ");
+    scanf("%s", date_to_delete);
+
+    long delete_key = garage_date_key(date_to_delete);
+    char line[GARAGE_LINE_MAX];
+    FILE *f = fopen(CAR_PARKING_FILE, "r");
+    FILE *temp = f ? fopen("temp_parking.txt", "w") : NULL;
+    if (!temp) {
+        center_print("[X] Error creating temporary file.");
+        if (f) fclose(f);
+        printf("\n");
+        center_print("Press any key to continue...");
+        getchar(); getchar();
+        return;
+    }
+
+    int found = 0;
+    while (fgets(line, sizeof(line), f)) {
+        GarageParking parking;
+
+        if (garage_parse_parking(line, &parking) && strcmp(parking.car_number, car_number) == 0 &&
+            delete_key != 0 && garage_date_key(parking.date) == delete_key) {
+            found = 1;
+        } else {
+            fputs(line, temp);
+        }
+    }
+
+    fclose(f);
+    fclose(temp);
+
+    if (found) {
+        remove(CAR_PARKING_FILE);
+        rename("temp_parking.txt", CAR_PARKING_FILE);
+        center_print("[+] Parking record deleted successfully!");
+    } else {
+        remove("temp_parking.txt");
+        center_print("[!] Parking record not found.");
+    }
+
+    printf("\n");
+    center_print("Press any key to continue...");
+    getchar(); getchar();
+}
+
+/**
+ * Auto-add service progress when cars are added or orders are made
+ */
+void auto_add_service_progress(const char *car_number, const char *service_type) {
+    FILE *f = fopen(PROGRESS_FILE, "a");
+    if (!f) return;
+
+    time_t now = time(NULL);
+    char date[20];
+    strftime(date, sizeof(date), "%Y-%m-%d", localtime(&now));
+
+    if (strcmp(service_type, "CAR_ADDED") == 0) {
+        fprintf(f, "%s %s 10%% Car_profile_created_initial_inspection_pending\n", car_number, date);
+    } else if (strcmp(service_type, "ORDER_PLACED") == 0) {
+        fprintf(f, "%s %s 25%% Parts_ordered_waiting_for_delivery\n", car_number, date);
+    } else if (strcmp(service_type, "PARKING_BOOKED") == 0) {
+        fprintf(f, "%s %s 5%% Parking_slot_reserved_car_inspection_scheduled\n", car_number, date);
+    }
+
+    fclose(f);
+}
+
+/**
+ * Main function
+ */
+int main() {
+    // Set up the console backend before anything is drawn
+    screen_init();
+
+    // Create default admin user (no need to store in file)
+    // Default credentials: username=admin, password=admin123
+
+    // Initialize default discount codes
+    initialize_default_discounts();
+
+    // Initialize default Q&A entries
+    initialize_default_qna();
+    //5800loc
+
+    main_menu();
+    return 0;
+}
@@ -0,0 +1,237 @@
+/**
+ * calendar.c - Date-ordered service calendar and reminders for the Smart Garage system
+ *
+ * Events are stored in the order they were read, so their indexes never
+ * change; `order` holds those indexes sorted by date and `heap` the
+ * reminders not surfaced yet, earliest at the top.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "garage.h"
+#include "calendar.h"
+
+#define MIN_EVENTS 64
+
+typedef struct {
+    const char *path;
+    CalendarKind kind;
+    int date_field;             // Word holding the date; the other of the
+    int car_field;              // first two holds the car
+    GarageTail tail;
+} Source;
+
+static Source sources[CALENDAR_KIND_COUNT] = {
+    {SERVICE_CALENDAR_FILE, CALENDAR_SERVICE, 0, 1, {{0, 0, 0}, 0, 0}},
+    {MAINTENANCE_REMINDERS_FILE, CALENDAR_REMINDER, 1, 0, {{0, 0, 0}, 0, 0}},
+};
+
+static CalendarEvent *events;
+static int *order;              // Indexes into events by date
+static int *heap;               // Reminder indexes, min-heap by date
+static int event_count, heap_count, capacity;
+static long surfaced_until;     // Latest day passed to calendar_due()
+
+// ==================== DATES ====================
+
+long calendar_today(void) {
+    time_t now = time(NULL);
+    struct tm *local = localtime(&now);
+    return (local->tm_year + 1900) * 10000L + (local->tm_mon + 1) * 100L + local->tm_mday;
+}
+
+long calendar_add_days(long date, int days) {
+    struct tm day = {0};
+
+    day.tm_year = (int)(date / 10000) - 1900;
+    day.tm_mon = (int)(date / 100 % 100) - 1;
+    day.tm_mday = (int)(date % 100) + days;
+    day.tm_hour = 12;           // Clear of daylight saving changes
+    day.tm_isdst = -1;
+    if (mktime(&day) == (time_t)-1) return date;
+
+    return (day.tm_year + 1900) * 10000L + (day.tm_mon + 1) * 100L + day.tm_mday;
+}
+
+// ==================== ORDERING ====================
+
+// Earlier date first; the same day keeps the order the lines were read
+static int earlier(int a, int b) {
+    if (events[a].date != events[b].date) return events[a].date < events[b].date;
+    return a < b;
+}
+
+static int compare_order(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return earlier(x, y) ? -1 : earlier(y, x);
+}
+
+static void heap_push(int index) {
+    int i = heap_count++;
+    heap[i] = index;
+
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!earlier(heap[i], heap[parent])) break;
+        int swap = heap[i]; heap[i] = heap[parent]; heap[parent] = swap;
+        i = parent;
+    }
+}
+
+static void heap_pop(void) {
+    heap[0] = heap[--heap_count];
+
+    int i = 0;
+    for (;;) {
+        int smallest = i, left = 2 * i + 1, right = left + 1;
+        if (left < heap_count && earlier(heap[left], heap[smallest])) smallest = left;
+        if (right < heap_count && earlier(heap[right], heap[smallest])) smallest = right;
+        if (smallest == i) break;
+
+        int swap = heap[i]; heap[i] = heap[smallest]; heap[smallest] = swap;
+        i = smallest;
+    }
+}
+
+// First position in `order` dated on or after `date`
+static int lower_bound(long date) {
+    int low = 0, high = event_count;
+
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        if (events[order[mid]].date < date) low = mid + 1;
+        else high = mid;
+    }
+    return low;
+}
+
+// ==================== LOADING ====================
+
+static int reserve(int needed) {
+    if (needed <= capacity) return 1;
+
+    int grown = capacity ? capacity : MIN_EVENTS;
+    while (grown < needed) grown *= 2;
+
+    CalendarEvent *new_events = realloc(events, (size_t)grown * sizeof(*events));
+    if (!new_events) return 0;
+    events = new_events;
+
+    int *new_order = realloc(order, (size_t)grown * sizeof(*order));
+    if (!new_order) return 0;
+    order = new_order;
+
+    int *new_heap = realloc(heap, (size_t)grown * sizeof(*heap));
+    if (!new_heap) return 0;
+    heap = new_heap;
+
+    capacity = grown;
+    return 1;
+}
+
+/**
+ * One line into the next free event; 0 when it holds no dated event
+ */
+static int parse_event(const Source *source, const char *line, CalendarEvent *event) {
+    char first[20], second[20], service[100] = "";
+
+    if (sscanf(line, "%19s %19s %99[^\r\n]", first, second, service) < 2 || first[0] == '#') return 0;
+
+    const char *date = source->date_field == 0 ? first : second;
+    const char *car = source->car_field == 0 ? first : second;
+
+    event->kind = source->kind;
+    event->date = garage_date_key(date);
+    snprintf(event->car_number, sizeof(event->car_number), "%s", car);
+    snprintf(event->service, sizeof(event->service), "%s", service[0] ? service : "-");
+    return event->date != 0;
+}
+
+/**
+ * One line appended to a source since the last call; new reminders go on
+ * the heap
+ */
+static void read_line(char *line, long offset, void *context) {
+    const Source *source = context;
+    (void)offset;
+
+    if (reserve(event_count + 1) && parse_event(source, line, &events[event_count])) {
+        int index = event_count++;
+        order[index] = index;
+        if (source->kind == CALENDAR_REMINDER) heap_push(index);
+    }
+}
+
+static void refresh(void) {
+    int changed[CALENDAR_KIND_COUNT];
+    int rebuild = 0;
+
+    for (int i = 0; i < CALENDAR_KIND_COUNT; i++) {
+        changed[i] = garage_tail_changed(sources[i].path, &sources[i].tail);
+        if (changed[i] == GARAGE_TAIL_REWRITTEN) rebuild = 1;
+    }
+
+    if (rebuild) {
+        event_count = heap_count = 0;
+        for (int i = 0; i < CALENDAR_KIND_COUNT; i++) garage_tail_reset(&sources[i].tail);
+    }
+
+    int sorted_until = event_count;
+    for (int i = 0; i < CALENDAR_KIND_COUNT; i++) {
+        if (rebuild || changed[i] != GARAGE_TAIL_SAME) {
+            garage_tail_read(sources[i].path, &sources[i].tail, read_line, &sources[i]);
+        }
+    }
+
+    // Re-sort only when the new events do not simply follow the old ones
+    for (int i = sorted_until > 0 ? sorted_until : 1; i < event_count; i++) {
+        if (earlier(order[i], order[i - 1])) {
+            qsort(order, (size_t)event_count, sizeof(*order), compare_order);
+            break;
+        }
+    }
+
+    // After a rebuild, reminders surfaced before are not surfaced again
+    if (rebuild && surfaced_until) {
+        int kept = 0;
+        for (int i = 0; i < heap_count; i++) {
+            if (events[heap[i]].date > surfaced_until) heap[kept++] = heap[i];
+        }
+        heap_count = 0;
+        for (int i = 0; i < kept; i++) heap_push(heap[i]);
+    }
+}
+
+// ==================== QUERIES ====================
+
+int calendar_between(unsigned kinds, long from, long to, CalendarVisitor visit, void *context) {
+    int count = 0;
+
+    refresh();
+    for (int i = from ? lower_bound(from) : 0; i < event_count; i++) {
+        const CalendarEvent *event = &events[order[i]];
+        if (to && event->date > to) break;
+        if (!(kinds & CALENDAR_KIND(event->kind))) continue;
+
+        count++;
+        if (visit && visit(event, context)) break;
+    }
+    return count;
+}
+
+int calendar_due(long today, CalendarVisitor visit, void *context) {
+    int count = 0;
+
+    refresh();
+    if (today > surfaced_until) surfaced_until = today;
+
+    while (heap_count > 0 && events[heap[0]].date <= today) {
+        const CalendarEvent *event = &events[heap[0]];
+        heap_pop();
+
+        count++;
+        if (visit && visit(event, context)) break;
+    }
+    return count;
+}
@@ -0,0 +1,60 @@
+/**
+ * calendar.h - Date-ordered service calendar and reminders for the Smart Garage system
+ *
+ * Events from service_calendar.txt (date car service) and
+ * maintenance_reminders.txt (car date service) are kept in one list sorted
+ * by date, so "due today", "next 7 days" and "overdue" are a binary search
+ * plus the matching events. Reminders also wait in a min-heap by date;
+ * calendar_due() pops the ones whose day has come, so each is surfaced once
+ * without looking at the rest.
+ *
+ * Lines appended to either file are picked up on the next call; if a file
+ * was otherwise changed, both are read again.
+ *
+ * Usage:
+ *   static int show(const CalendarEvent *event, void *context) {
+ *       printf("%ld %s %s\n", event->date, event->car_number, event->service);
+ *       return 0;
+ *   }
+ *   long today = calendar_today();
+ *   calendar_between(CALENDAR_ALL, today, calendar_add_days(today, 7), show, NULL);
+ */
+#ifndef CALENDAR_H
+#define CALENDAR_H
+
+typedef enum {
+    CALENDAR_SERVICE,           // service_calendar.txt
+    CALENDAR_REMINDER,          // maintenance_reminders.txt
+    CALENDAR_KIND_COUNT
+} CalendarKind;
+
+// Masks for calendar_between()
+#define CALENDAR_KIND(kind) (1u << (kind))
+#define CALENDAR_ALL ((1u << CALENDAR_KIND_COUNT) - 1)
+
+typedef struct {
+    CalendarKind kind;
+    long date;                  // YYYYMMDD
+    char car_number[20];
+    char service[100];
+} CalendarEvent;
+
+// Visitors return 0 to continue and non-zero to stop
+typedef int (*CalendarVisitor)(const CalendarEvent *event, void *context);
+
+// Today as YYYYMMDD
+long calendar_today(void);
+
+// `date` (YYYYMMDD) moved by `days`, which may be negative
+long calendar_add_days(long date, int days);
+
+// Events of the given kinds dated from..to (YYYYMMDD, inclusive, 0 = open
+// end), earliest first; returns how many
+int calendar_between(unsigned kinds, long from, long to, CalendarVisitor visit, void *context);
+
+// Reminders dated on or before `today` that no earlier call returned,
+// earliest first; returns how many. A visitor that stops leaves the rest
+// for the next call.
+int calendar_due(long today, CalendarVisitor visit, void *context);
+
+#endif
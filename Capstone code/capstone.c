@@ -13,8 +13,8 @@
 
 // --- Global Constants & Macros ---
 // Using #define for constants makes the code easier to read and modify.
-#define MAX_USERS 100
-#define MAX_CARS_PER_USER 3
+#define MIN_USERS 64          // Starting size of the user table; it grows as needed
+#define MIN_CARS 2            // Starting size of each user's car list
 #define MAX_NAME_LEN 50
 #define MAX_ID_LEN 20
 #define MAX_PLATE_LEN 15
@@ -26,7 +26,10 @@
 #define MAX_QUERY_LEN 200
 
 // File names for data persistence
-#define USERS_FILE "users.dat"
+#define USERS_FILE "users.dat"          // Full checkpoint of every user
+#define USERS_LOG_FILE "users.log"      // Users changed since the checkpoint
+#define USERS_TEMP_FILE "users.tmp"     // Next checkpoint while it is written
+#define CHECKPOINT_EVERY 500            // Log records before a new checkpoint
 #define APPOINTMENTS_FILE "appointments.dat"
 #define PARKING_FILE "parking.dat"
 #define REFUELING_FILE "refueling.dat"
@@ -51,9 +54,11 @@ typedef struct {
     char email[MAX_NAME_LEN];
     char phone[MAX_ID_LEN];
     char address[100];
-    Car cars[MAX_CARS_PER_USER];
+    Car *cars;    // Grows with addCar(); NULL until the first car
     int numCars;
+    int carCapacity;
     int isAdmin; // 0 for customer, 1 for admin, 2 for mechanic
+    int isDirty; // 1 if changed since it was last saved
 } User;
 
 typedef struct {
@@ -96,9 +101,21 @@ typedef struct {
 } ParkingRecord;
 
 // --- Global Variables & Pointers ---
-// Global arrays act as our in-memory database.
-User users[MAX_USERS];
+// Global arrays act as our in-memory database. The user table is allocated
+// with malloc/realloc so it can hold any number of users; a hash index on
+// the user ID finds a user without scanning the whole table.
+User *users = NULL;
 int numUsers = 0;
+int userCapacity = 0;
+int *userIndex = NULL;   // Hash slot -> position in users + 1, 0 = empty slot
+int userIndexSize = 0;   // Power of two, kept at least twice numUsers
+
+// Users changed since the last save, by position in users (positions do not
+// change when the array grows, addresses do).
+int *dirtyUsers = NULL;
+int numDirty = 0;
+int dirtyCapacity = 0;
+int logRecords = 0;      // Records in USERS_LOG_FILE since the last checkpoint
 
 // Sample parts inventory
 Part partsInventory[] = {
@@ -115,12 +132,19 @@ int numParts = 8;
 
 // This is a POINTER to a User struct. It will point to the specific user
 // in the 'users' array who is currently logged in. It's NULL if no one is logged in.
+// addUser() moves it along when the array grows.
 User *loggedInUser = NULL;
 
 // --- Function Prototypes ---
 // Declaring functions before use is good practice in C.
 void loadAllData();
 void saveAllData();
+User *findUser(const char *userID);
+User *addUser(const User *user);
+Car *addCar(User *user, const Car *car);
+void markUserDirty(User *user);
+void saveUsers();
+void checkpointUsers();
 void registerUser();
 void loginUser();
 void loggedInMenu();
@@ -184,63 +208,264 @@ void generateUniqueId(char *id_buffer, const char *prefix, int count) {
     sprintf(id_buffer, "%s%ld%03d", prefix, time(NULL), count % 1000);
 }
 
+// --- User Table Functions ---
+
+// FNV-1a hash of a user ID, used to pick its slot in userIndex.
+unsigned long hashUserID(const char *userID) {
+    unsigned long hash = 2166136261UL;
+    while (*userID) {
+        hash ^= (unsigned char)*userID++;
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+// Returns the slot holding userID, or the empty slot where it would go.
+// Collisions move on to the next slot (linear probing).
+int findUserSlot(const char *userID) {
+    int mask = userIndexSize - 1;
+    int slot = (int)(hashUserID(userID) & (unsigned long)mask);
+
+    while (userIndex[slot] != 0 && strcmp(users[userIndex[slot] - 1].userID, userID) != 0) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+// Returns the user with this ID, or NULL if there is none.
+User *findUser(const char *userID) {
+    if (userIndexSize == 0) return NULL;
+
+    int slot = findUserSlot(userID);
+    return userIndex[slot] != 0 ? &users[userIndex[slot] - 1] : NULL;
+}
+
+// Appends a copy of 'user' to the table and indexes it. Returns the stored
+// user, or NULL if memory ran out. The caller checks for duplicate IDs.
+User *addUser(const User *user) {
+    if (numUsers == userCapacity) {
+        int newCapacity = userCapacity ? userCapacity * 2 : MIN_USERS;
+        int loggedInAt = loggedInUser ? (int)(loggedInUser - users) : -1;
+        User *grown = realloc(users, newCapacity * sizeof(User));
+        if (grown == NULL) return NULL;
+        users = grown;
+        userCapacity = newCapacity;
+        // realloc may have moved the array, so re-point into the new one.
+        if (loggedInAt >= 0) loggedInUser = &users[loggedInAt];
+    }
+
+    if ((numUsers + 1) * 2 > userIndexSize) {
+        int newSize = userIndexSize ? userIndexSize * 2 : MIN_USERS * 2;
+        int *newIndex = calloc(newSize, sizeof(int));
+        if (newIndex == NULL) return NULL;
+        free(userIndex);
+        userIndex = newIndex;
+        userIndexSize = newSize;
+        for (int i = 0; i < numUsers; i++) {
+            userIndex[findUserSlot(users[i].userID)] = i + 1;
+        }
+    }
+
+    users[numUsers] = *user;
+    int slot = findUserSlot(user->userID);
+    if (userIndex[slot] == 0) userIndex[slot] = numUsers + 1; // The first of a duplicate ID wins
+    return &users[numUsers++];
+}
+
+// Appends a copy of 'car' to the user's car list. Returns the stored car,
+// or NULL if memory ran out.
+Car *addCar(User *user, const Car *car) {
+    if (user->numCars == user->carCapacity) {
+        int newCapacity = user->carCapacity ? user->carCapacity * 2 : MIN_CARS;
+        Car *grown = realloc(user->cars, newCapacity * sizeof(Car));
+        if (grown == NULL) return NULL;
+        user->cars = grown;
+        user->carCapacity = newCapacity;
+    }
+    user->cars[user->numCars] = *car;
+    return &user->cars[user->numCars++];
+}
+
+// Remembers that 'user' changed so the next saveUsers() writes it.
+// Call it after every change to a user or their cars.
+void markUserDirty(User *user) {
+    if (user == NULL || user->isDirty) return;
+
+    if (numDirty == dirtyCapacity) {
+        int newCapacity = dirtyCapacity ? dirtyCapacity * 2 : MIN_USERS;
+        int *grown = realloc(dirtyUsers, newCapacity * sizeof(int));
+        if (grown == NULL) {
+            // Cannot track this one change, so save everything next time instead.
+            logRecords = CHECKPOINT_EVERY;
+            return;
+        }
+        dirtyUsers = grown;
+        dirtyCapacity = newCapacity;
+    }
+    user->isDirty = 1;
+    dirtyUsers[numDirty++] = (int)(user - users);
+}
+
 // --- File Handling Functions ---
 
-void saveUsers() {
+// users.dat and users.log hold the same records: one user line followed by
+// one line per car.
+void writeUserRecord(FILE *file, const User *user) {
+    // fprintf is like printf, but it writes to a file.
+    fprintf(file, "%s %s %s %d %s %s %s %d %d\n",
+            user->userID, user->password, user->fullName,
+            user->age, user->email, user->phone, user->address,
+            user->isAdmin, user->numCars);
+    for (int j = 0; j < user->numCars; j++) {
+        fprintf(file, "%s %s %s %d\n",
+                user->cars[j].plateNumber, user->cars[j].carModel,
+                user->cars[j].engineType, user->cars[j].year);
+    }
+}
+
+// Reads one record into 'record', allocating its car list. Returns 1 on
+// success and 0 at the end of the file or on a malformed record.
+int readUserRecord(FILE *file, User *record) {
+    int carsInFile;
+
+    // The check `fscanf(...) == 9` ensures we read a full, valid user record.
+    // If it returns a different number, the line is malformed or we're at EOF.
+    if (fscanf(file, "%19s %19s %49s %d %49s %19s %99s %d %d",
+               record->userID, record->password,
+               record->fullName, &record->age,
+               record->email, record->phone, record->address,
+               &record->isAdmin, &carsInFile) != 9) {
+        return 0;
+    }
+    record->cars = NULL;
+    record->numCars = 0;
+    record->carCapacity = 0;
+    record->isDirty = 0;
+
+    for (int j = 0; j < carsInFile; j++) {
+        Car car;
+        // Check the return value of fscanf to ensure we read car data correctly.
+        if (fscanf(file, "%14s %29s %49s %d",
+                  car.plateNumber, car.carModel,
+                  car.engineType, &car.year) != 4) {
+             printf("Error reading car data for user %s.\n", record->userID);
+             break;
+        }
+        addCar(record, &car);
+    }
+    return 1;
+}
+
+// Writes every user to a fresh USERS_FILE and empties the change log.
+void checkpointUsers() {
     // 'w' mode: write mode. It creates the file if it doesn't exist,
-    // or TRUNCATES (empties) it if it does. This is good for saving the
-    // entire state, as it prevents duplicate entries from previous saves.
-    FILE *file = fopen(USERS_FILE, "w");
+    // or TRUNCATES (empties) it if it does. The checkpoint is written to a
+    // temporary file first, so a crash halfway leaves the old one intact.
+    FILE *file = fopen(USERS_TEMP_FILE, "w");
     if (file == NULL) {
         perror("Error opening users file for writing");
         return;
     }
     // Loop through the in-memory array and write each user to the file.
     for (int i = 0; i < numUsers; i++) {
-        // fprintf is like printf, but it writes to a file.
-        fprintf(file, "%s %s %s %d %s %s %s %d %d\n", 
-                users[i].userID, users[i].password, users[i].fullName, 
-                users[i].age, users[i].email, users[i].phone, users[i].address,
-                users[i].isAdmin, users[i].numCars);
-        for (int j = 0; j < users[i].numCars; j++) {
-            fprintf(file, "%s %s %s %d\n", 
-                    users[i].cars[j].plateNumber, users[i].cars[j].carModel,
-                    users[i].cars[j].engineType, users[i].cars[j].year);
-        }
+        writeUserRecord(file, &users[i]);
     }
-    fclose(file); // Always close a file when you're done.
+    if (fclose(file) != 0) {  // Always close a file when you're done.
+        perror("Error writing users file");
+        return;
+    }
+#ifdef _WIN32
+    remove(USERS_FILE); // rename() does not replace an existing file on Windows
+#endif
+    if (rename(USERS_TEMP_FILE, USERS_FILE) != 0) {
+        perror("Error replacing users file");
+        return;
+    }
+
+    // Everything in the log is in the checkpoint now.
+    file = fopen(USERS_LOG_FILE, "w");
+    if (file != NULL) fclose(file);
+    logRecords = 0;
+    for (int i = 0; i < numDirty; i++) {
+        users[dirtyUsers[i]].isDirty = 0;
+    }
+    numDirty = 0;
+}
+
+// Saves the users changed since the last save. Each one is appended to
+// USERS_LOG_FILE, so a profile edit writes one record instead of the whole
+// database; every CHECKPOINT_EVERY records the log is folded into a new
+// USERS_FILE by checkpointUsers().
+void saveUsers() {
+    if (numDirty == 0) return;
+
+    FILE *checkpoint = fopen(USERS_FILE, "r");
+    if (checkpoint == NULL || logRecords + numDirty > CHECKPOINT_EVERY) {
+        if (checkpoint != NULL) fclose(checkpoint);
+        checkpointUsers();
+        return;
+    }
+    fclose(checkpoint);
+
+    // 'a' mode: append mode. New records go after the existing ones.
+    FILE *file = fopen(USERS_LOG_FILE, "a");
+    if (file == NULL) {
+        perror("Error opening users log for writing");
+        return;
+    }
+    for (int i = 0; i < numDirty; i++) {
+        User *user = &users[dirtyUsers[i]];
+        writeUserRecord(file, user);
+        user->isDirty = 0;
+    }
+    if (fclose(file) != 0) {
+        perror("Error writing users log");
+    }
+    logRecords += numDirty;
+    numDirty = 0;
 }
 
 void loadUsers() {
     // 'r' mode: read mode. The file must exist.
     FILE *file = fopen(USERS_FILE, "r");
-    if (file == NULL) {
-        // This is not necessarily an error on first run, so we just return.
-        return;
+    // Start from an empty table, keeping the memory already allocated.
+    for (int i = 0; i < numUsers; i++) {
+        free(users[i].cars);
     }
-    // Loop until we reach the end of the file (EOF) or the array is full.
-    // The check `fscanf(...) == 9` ensures we read a full, valid user record.
-    // If it returns a different number, the line is malformed or we're at EOF.
     numUsers = 0;
-    while (numUsers < MAX_USERS &&
-           fscanf(file, "%s %s %s %d %s %s %s %d %d", 
-                  users[numUsers].userID, users[numUsers].password, 
-                  users[numUsers].fullName, &users[numUsers].age,
-                  users[numUsers].email, users[numUsers].phone, users[numUsers].address,
-                  &users[numUsers].isAdmin, &users[numUsers].numCars) == 9) {
-
-        for (int j = 0; j < users[numUsers].numCars; j++) {
-            // Check the return value of fscanf to ensure we read car data correctly.
-            if (fscanf(file, "%s %s %s %d", 
-                      users[numUsers].cars[j].plateNumber, 
-                      users[numUsers].cars[j].carModel,
-                      users[numUsers].cars[j].engineType,
-                      &users[numUsers].cars[j].year) != 4) {
-                 printf("Error reading car data for user %s.\n", users[numUsers].userID);
-                 break;
+    numDirty = 0;
+    logRecords = 0;
+    if (userIndexSize > 0) memset(userIndex, 0, userIndexSize * sizeof(int));
+
+    // Loop until we reach the end of the file (EOF); the table grows as needed.
+    // A missing file is not necessarily an error on first run.
+    User record;
+    if (file != NULL) {
+        while (readUserRecord(file, &record)) {
+            if (addUser(&record) == NULL) {
+                printf("Out of memory after loading %d users.\n", numUsers);
+                free(record.cars);
+                break;
             }
         }
-        numUsers++;
+        fclose(file);
+    }
+
+    // Then replay the changes saved since that checkpoint, oldest first;
+    // a later record of the same user replaces the earlier one.
+    file = fopen(USERS_LOG_FILE, "r");
+    if (file == NULL) return;
+    while (readUserRecord(file, &record)) {
+        User *user = findUser(record.userID);
+        logRecords++;
+        if (user != NULL) {
+            free(user->cars);
+            *user = record;
+        } else if (addUser(&record) == NULL) {
+            printf("Out of memory after loading %d users.\n", numUsers);
+            free(record.cars);
+            break;
+        }
     }
     fclose(file);
 }
@@ -272,24 +497,16 @@ void registerUser() {
     clearScreen();
     printf("--- Parkify: User Registration ---\n");
 
-    if (numUsers >= MAX_USERS) {
-        printf("System user limit reached. Cannot register.\n");
-        pressAnyKeyToContinue();
-        return;
-    }
-
     User newUser; // A temporary user struct on the stack.
 
     printf("Enter desired User ID: ");
     readLine(newUser.userID, sizeof(newUser.userID));
 
     // Check if user ID already exists
-    for (int i = 0; i < numUsers; i++) {
-        if (strcmp(users[i].userID, newUser.userID) == 0) {
-            printf("\nError: User ID '%s' is already taken.\n", newUser.userID);
-            pressAnyKeyToContinue();
-            return;
-        }
+    if (findUser(newUser.userID) != NULL) {
+        printf("\nError: User ID '%s' is already taken.\n", newUser.userID);
+        pressAnyKeyToContinue();
+        return;
     }
 
     printf("Enter password: ");
@@ -307,12 +524,20 @@ void registerUser() {
     printf("Enter your address (use '_' for spaces): ");
     readLine(newUser.address, sizeof(newUser.address));
 
+    newUser.cars = NULL;
     newUser.numCars = 0;
+    newUser.carCapacity = 0;
     newUser.isAdmin = 0; // New users are customers by default
+    newUser.isDirty = 0;
 
     // Add this new user to our global array
-    users[numUsers] = newUser;
-    numUsers++;
+    User *added = addUser(&newUser);
+    if (added == NULL) {
+        printf("\nNot enough memory to register a new user.\n");
+        pressAnyKeyToContinue();
+        return;
+    }
+    markUserDirty(added);
 
     printf("\nRegistration successful! Please log in to continue.\n");
     saveUsers(); // Save immediately to file
@@ -336,18 +561,17 @@ void loginUser() {
     printf("Enter Password: ");
     readLine(password, sizeof(password));
 
-    // Search for the user in our in-memory database
-    for (int i = 0; i < numUsers; i++) {
-        if (strcmp(users[i].userID, userID) == 0 && strcmp(users[i].password, password) == 0) {
-            // Login success!
-            // Make the global pointer 'loggedInUser' point to this user's memory location in the array.
-            loggedInUser = &users[i];
-            clearScreen();
-            printf("Login successful! Welcome, %s.\n", loggedInUser->fullName);
-            pressAnyKeyToContinue();
-            loggedInMenu(); // Proceed to the logged-in menu
-            return; // Return after the loggedInMenu is exited
-        }
+    // Look the user up in our in-memory database
+    User *user = findUser(userID);
+    if (user != NULL && strcmp(user->password, password) == 0) {
+        // Login success!
+        // Make the global pointer 'loggedInUser' point to this user's memory location in the array.
+        loggedInUser = user;
+        clearScreen();
+        printf("Login successful! Welcome, %s.\n", loggedInUser->fullName);
+        pressAnyKeyToContinue();
+        loggedInMenu(); // Proceed to the logged-in menu
+        return; // Return after the loggedInMenu is exited
     }
 
     printf("\nInvalid User ID or Password.\n");
@@ -684,22 +908,17 @@ void viewCustomerHistory() {
         }
     } else {
         // Find specific user
-        int found = 0;
-        for (int i = 0; i < numUsers; i++) {
-            if (strcmp(users[i].userID, userID) == 0) {
-                found = 1;
-                printf("\n--- CUSTOMER DETAILS ---\n");
-                printf("Name: %s\n", users[i].fullName);
-                printf("Email: %s\n", users[i].email);
-                printf("Phone: %s\n", users[i].phone);
-                printf("Cars Registered: %d\n", users[i].numCars);
-                for (int j = 0; j < users[i].numCars; j++) {
-                    printf("  Car %d: %s - %s\n", j+1, users[i].cars[j].plateNumber, users[i].cars[j].carModel);
-                }
-                break;
+        User *user = findUser(userID);
+        if (user != NULL) {
+            printf("\n--- CUSTOMER DETAILS ---\n");
+            printf("Name: %s\n", user->fullName);
+            printf("Email: %s\n", user->email);
+            printf("Phone: %s\n", user->phone);
+            printf("Cars Registered: %d\n", user->numCars);
+            for (int j = 0; j < user->numCars; j++) {
+                printf("  Car %d: %s - %s\n", j+1, user->cars[j].plateNumber, user->cars[j].carModel);
             }
-        }
-        if (!found) {
+        } else {
             printf("User not found!\n");
         }
     }
@@ -806,29 +1025,28 @@ void manageUserProfile() {
         while (getchar() != '\n');
 
         switch (choice) {
-            case 1:
-                if (loggedInUser->numCars >= MAX_CARS_PER_USER) {
-                    printf("Maximum cars limit reached!\n");
-                    pressAnyKeyToContinue();
-                    break;
-                }
+            case 1: {
+                Car newCar;
                 printf("Enter car plate number: ");
-                readLine(loggedInUser->cars[loggedInUser->numCars].plateNumber, 
-                        sizeof(loggedInUser->cars[loggedInUser->numCars].plateNumber));
+                readLine(newCar.plateNumber, sizeof(newCar.plateNumber));
                 printf("Enter car model: ");
-                readLine(loggedInUser->cars[loggedInUser->numCars].carModel, 
-                        sizeof(loggedInUser->cars[loggedInUser->numCars].carModel));
+                readLine(newCar.carModel, sizeof(newCar.carModel));
                 printf("Enter engine type: ");
-                readLine(loggedInUser->cars[loggedInUser->numCars].engineType, 
-                        sizeof(loggedInUser->cars[loggedInUser->numCars].engineType));
+                readLine(newCar.engineType, sizeof(newCar.engineType));
                 printf("Enter car year: ");
-                scanf("%d", &loggedInUser->cars[loggedInUser->numCars].year);
+                scanf("%d", &newCar.year);
                 while (getchar() != '\n');
-                loggedInUser->numCars++;
+                if (addCar(loggedInUser, &newCar) == NULL) {
+                    printf("Not enough memory to add another car!\n");
+                    pressAnyKeyToContinue();
+                    break;
+                }
                 printf("Car added successfully!\n");
+                markUserDirty(loggedInUser);
                 saveUsers();
                 pressAnyKeyToContinue();
                 break;
+            }
             case 2:
                 printf("\n=== YOUR CARS ===\n");
                 for (int i = 0; i < loggedInUser->numCars; i++) {
@@ -846,6 +1064,7 @@ void manageUserProfile() {
                 printf("Update Phone: ");
                 readLine(loggedInUser->phone, sizeof(loggedInUser->phone));
                 printf("Contact information updated!\n");
+                markUserDirty(loggedInUser);
                 saveUsers();
                 pressAnyKeyToContinue();
                 break;
@@ -1375,28 +1594,29 @@ int main() {
         printf("No users found. Creating default admin and mechanic...\n");
         
         // Create admin user
-        strcpy(users[0].userID, "admin");
-        strcpy(users[0].password, "admin");
-        strcpy(users[0].fullName, "Admin_User");
-        strcpy(users[0].email, "admin@parkify.com");
-        strcpy(users[0].phone, "555-0001");
-        strcpy(users[0].address, "Admin_Office");
-        users[0].age = 99;
-        users[0].isAdmin = 1;
-        users[0].numCars = 0;
+        User admin = {0};
+        strcpy(admin.userID, "admin");
+        strcpy(admin.password, "admin");
+        strcpy(admin.fullName, "Admin_User");
+        strcpy(admin.email, "admin@parkify.com");
+        strcpy(admin.phone, "555-0001");
+        strcpy(admin.address, "Admin_Office");
+        admin.age = 99;
+        admin.isAdmin = 1;
+        markUserDirty(addUser(&admin));
         
         // Create mechanic user
-        strcpy(users[1].userID, "mechanic");
-        strcpy(users[1].password, "mechanic");
-        strcpy(users[1].fullName, "Chief_Mechanic");
-        strcpy(users[1].email, "mechanic@parkify.com");
-        strcpy(users[1].phone, "555-0002");
-        strcpy(users[1].address, "Workshop_Area");
-        users[1].age = 35;
-        users[1].isAdmin = 2; // 2 for mechanic
-        users[1].numCars = 0;
+        User mechanic = {0};
+        strcpy(mechanic.userID, "mechanic");
+        strcpy(mechanic.password, "mechanic");
+        strcpy(mechanic.fullName, "Chief_Mechanic");
+        strcpy(mechanic.email, "mechanic@parkify.com");
+        strcpy(mechanic.phone, "555-0002");
+        strcpy(mechanic.address, "Workshop_Area");
+        mechanic.age = 35;
+        mechanic.isAdmin = 2; // 2 for mechanic
+        markUserDirty(addUser(&mechanic));
         
-        numUsers = 2;
         saveUsers(); // Save these new users to the file.
         printf("Default users created:\n");
         printf("Admin - UserID: admin, Password: admin\n");
@@ -1455,8 +1675,8 @@ SIDE NOTES: C CONCEPTS EXPLAINED
     ----------------
     -   `fopen(const char *filename, const char *mode)`: This is the function to open a file.
         -   `"r"` (read): Opens a file for reading. The file MUST exist.
-        -   `"w"` (write): Opens a file for writing. If the file exists, its contents are DESTROYED. If it doesn't exist, a new file is created. This is what we use in `saveUsers()` to write a fresh copy of all user data.
-        -   `"a"` (append): Opens a file for writing, but appends new data to the END of the file. If the file doesn't exist, it's created. This is useful for log files, like in `requestParking()`.
+        -   `"w"` (write): Opens a file for writing. If the file exists, its contents are DESTROYED. If it doesn't exist, a new file is created. This is what we use in `checkpointUsers()` to write a fresh copy of all user data.
+        -   `"a"` (append): Opens a file for writing, but appends new data to the END of the file. If the file doesn't exist, it's created. This is useful for log files, like in `requestParking()`, and for `saveUsers()`, which appends only the users that changed to `users.log`.
     -   `fprintf()` / `fscanf()`: These are for reading/writing FORMATTED text. They are perfect for saving and loading `struct` data where you know the exact layout (e.g., "string string integer").
     -   `fputs()` / `fgets()`: These are for reading/writing entire LINES of text (strings). `fgets()` is safer than `scanf()` for user input because you specify the maximum buffer size, preventing overflows.
     -   `fputc()` / `fgetc()`: These are for reading/writing a SINGLE character. They are less common for this type of application but are the building blocks of the other functions.
@@ -1466,7 +1686,7 @@ SIDE NOTES: C CONCEPTS EXPLAINED
     ----------------
     -   A pointer is a variable that stores the MEMORY ADDRESS of another variable.
     -   In this code, `User *loggedInUser;` declares a pointer named `loggedInUser` that can hold the address of a `User` struct.
-    -   When a user logs in successfully, we do `loggedInUser = &users[i];`. The `&` operator gets the memory address of the user's struct in the `users` array.
+    -   When a user logs in successfully, we do `loggedInUser = user;`, where `user` is the address `findUser()` returned for that user's struct in the `users` array (`&users[i]`; the `&` operator gets the memory address).
     -   Now, `loggedInUser` doesn't hold a copy of the user; it holds the address of the ORIGINAL user data.
     -   When we want to access a member of the struct through the pointer, we use the arrow operator `->`, like `loggedInUser->fullName`. This is shorthand for `(*loggedInUser).fullName`. Using pointers is more efficient than passing large structs by value (copying them) to functions.
 
@@ -1476,11 +1696,17 @@ SIDE NOTES: C CONCEPTS EXPLAINED
     -   A common but slightly risky way to read a file is `while (!feof(file))`. The problem is that the EOF flag is only set AFTER you try to read past the end of the file.
     -   A much better and safer way is to check the return value of the read function itself.
         -   `fgets()` returns `NULL` on failure or when it reaches the end of the file. So, `while (fgets(...) != NULL)` is a robust loop.
-        -   `fscanf()` returns the number of items it successfully read. So, `while (fscanf(...) == 6)` is a great way to loop, as it ensures you're reading a full, valid record each time. If it reaches the end of the file or finds a malformed line, it will return a number other than 6, and the loop will correctly terminate. This is the method used in `loadUsers()`.
+        -   `fscanf()` returns the number of items it successfully read. So, `while (fscanf(...) == 6)` is a great way to loop, as it ensures you're reading a full, valid record each time. If it reaches the end of the file or finds a malformed line, it will return a number other than 6, and the loop will correctly terminate. This is the method used in `readUserRecord()`.
 
 4.  Buffers:
     ----------
     -   A buffer is simply a block of memory used for temporary storage. In C, we most often create buffers using character arrays.
     -   Example: `char lineBuffer[256];` creates a buffer that can hold 255 characters plus the null terminator (`\0`).
     -   When you use `fgets(lineBuffer, 256, stdin)`, you are telling the function to read a line of input from the keyboard (`stdin`) and store it temporarily in `lineBuffer`, but to stop after 255 characters to prevent overflowing the buffer and corrupting memory. This is a fundamental concept for safe programming in C.
+
+5.  Dynamic Memory and Hashing:
+    -----------------------------
+    -   A fixed array like `User users[100]` silently runs out of room. Instead, `users` (and each user's `cars`) is allocated with `realloc()`, which doubles the block whenever it is full, so adding an item costs O(1) on average.
+    -   `realloc()` may MOVE the block to a new address, so any pointer into the old block is stale afterwards. That is why `addUser()` re-points `loggedInUser` after growing the table.
+    -   `findUser()` does not compare the ID against every user. `hashUserID()` turns the ID into a number that picks a slot in `userIndex`; if that slot is taken by another ID, the next slot is tried. With the index kept at most half full, a lookup checks only a slot or two even with hundreds of thousands of users.
 */
\ No newline at end of file
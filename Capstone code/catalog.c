@@ -0,0 +1,325 @@
+/**
+ * catalog.c - Part search for the Smart Garage order screen
+ *
+ * Each trie node is reached by an edge labelled with a slice of `labels`;
+ * splitting an edge only splits the slice, so keys are copied into the
+ * pool once. Children are kept in alphabetical order and a node's own
+ * parts come before its children's, so shorter keys are listed first.
+ *
+ * The fuzzy pass carries one row of the edit distance table per trie
+ * character: row[j] is the cost of turning the first j query characters
+ * into the key so far. Once row[m] is within the limit, every key below
+ * starts with a near-copy of the query; once the whole row is over it,
+ * nothing below can match.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "garage.h"
+#include "catalog.h"
+
+#define MIN_NODES 64
+
+typedef struct {
+    int label;                  // Offset of the edge label in labels
+    int length;
+    int child;                  // First child, -1 = none
+    int sibling;                // Next child of the same parent, -1 = none
+    int postings;               // First part ending here, -1 = none
+    int last_posting;           // Kept so parts stay in file order
+} Node;
+
+typedef struct {
+    int part;
+    int next;
+} Posting;
+
+static GaragePart *parts;
+static int part_count, part_capacity;
+
+static Node *nodes;
+static int node_count, node_capacity;
+static Posting *postings;
+static int posting_count, posting_capacity;
+static char *labels;
+static int label_size, label_capacity;
+
+static int *seen;               // Search number that last returned each part
+static int search_number;
+static GarageFileStamp stamp;
+
+// A search in progress
+typedef struct {
+    const char *query;
+    int length;
+    CatalogHit *out;
+    int max;
+    int count;
+    int limit;                  // Edits allowed in the fuzzy pass
+} Search;
+
+// ==================== BUILDING ====================
+
+static int grow(void **array, int *capacity, int needed, size_t item_size) {
+    if (needed <= *capacity) return 1;
+
+    int grown = *capacity ? *capacity : MIN_NODES;
+    while (grown < needed) grown *= 2;
+
+    void *resized = realloc(*array, (size_t)grown * item_size);
+    if (!resized) return 0;
+    *array = resized;
+    *capacity = grown;
+    return 1;
+}
+
+static int new_node(int label, int length) {
+    if (!grow((void **)&nodes, &node_capacity, node_count + 1, sizeof(Node))) return -1;
+
+    Node *node = &nodes[node_count];
+    node->label = label;
+    node->length = length;
+    node->child = node->sibling = node->postings = node->last_posting = -1;
+    return node_count++;
+}
+
+static void add_posting(int node, int part) {
+    // A part whose name and spec share a word reaches the same node twice
+    int last = nodes[node].last_posting;
+    if (last >= 0 && postings[last].part == part) return;
+    if (!grow((void **)&postings, &posting_capacity, posting_count + 1, sizeof(Posting))) return;
+
+    postings[posting_count].part = part;
+    postings[posting_count].next = -1;
+    if (last >= 0) postings[last].next = posting_count;
+    else nodes[node].postings = posting_count;
+    nodes[node].last_posting = posting_count++;
+}
+
+static void insert_key(const char *key, int part) {
+    int node = 0, position = 0, length = (int)strlen(key);
+
+    while (position < length) {
+        // Find the child whose label starts with the next character,
+        // or the child to insert a new one after (alphabetical order)
+        int previous = -1, child = nodes[node].child;
+        while (child >= 0 && labels[nodes[child].label] < key[position]) {
+            previous = child;
+            child = nodes[child].sibling;
+        }
+
+        if (child < 0 || labels[nodes[child].label] != key[position]) {
+            int rest = length - position;
+            if (!grow((void **)&labels, &label_capacity, label_size + rest, 1)) return;
+            memcpy(labels + label_size, key + position, (size_t)rest);
+
+            int leaf = new_node(label_size, rest);
+            if (leaf < 0) return;
+            label_size += rest;
+
+            nodes[leaf].sibling = child;
+            if (previous < 0) nodes[node].child = leaf;
+            else nodes[previous].sibling = leaf;
+            add_posting(leaf, part);
+            return;
+        }
+
+        int common = 0;
+        while (common < nodes[child].length && position + common < length &&
+               labels[nodes[child].label + common] == key[position + common]) {
+            common++;
+        }
+
+        if (common < nodes[child].length) {
+            // Split the edge: a new node takes the shared start of the label
+            int middle = new_node(nodes[child].label, common);
+            if (middle < 0) return;
+
+            nodes[middle].sibling = nodes[child].sibling;
+            nodes[middle].child = child;
+            nodes[child].label += common;
+            nodes[child].length -= common;
+            nodes[child].sibling = -1;
+            if (previous < 0) nodes[node].child = middle;
+            else nodes[previous].sibling = middle;
+            child = middle;
+        }
+
+        node = child;
+        position += common;
+    }
+    add_posting(node, part);
+}
+
+// Lower case, with spaces as underscores like the names in the file
+static void normalize(const char *text, char *key, size_t size) {
+    size_t length = 0;
+
+    while (*text == ' ') text++;
+    for (; *text && length + 1 < size; text++) {
+        key[length++] = *text == ' ' ? '_' : (char)tolower((unsigned char)*text);
+    }
+    while (length > 0 && key[length - 1] == '_') length--;
+    key[length] = '\0';
+}
+
+// The whole text, and each of its words when it has more than one
+static void insert_words(const char *text, int part) {
+    char key[CATALOG_QUERY_MAX + 20];
+
+    normalize(text, key, sizeof(key));
+    if (!key[0]) return;
+    insert_key(key, part);
+
+    if (!strpbrk(key, "_-")) return;
+    for (char *word = strtok(key, "_-"); word; word = strtok(NULL, "_-")) {
+        insert_key(word, part);
+    }
+}
+
+static int add_part(const GaragePart *part, void *context) {
+    (void)context;
+    if (!grow((void **)&parts, &part_capacity, part_count + 1, sizeof(GaragePart))) return 1;
+
+    parts[part_count] = *part;
+    insert_words(part->name, part_count);
+    insert_words(part->spec, part_count);
+    part_count++;
+    return 0;
+}
+
+static void refresh(void) {
+    if (!garage_file_changed(PARTS_FILE, &stamp)) return;
+
+    part_count = node_count = posting_count = label_size = 0;
+    new_node(0, 0);             // Root
+    garage_for_each_part(add_part, NULL);
+
+    free(seen);
+    seen = calloc((size_t)(part_count ? part_count : 1), sizeof(int));
+    search_number = 0;
+}
+
+// ==================== SEARCH ====================
+
+// 1 when out[] is full
+static int add_hit(Search *search, int part, int distance) {
+    if (seen && seen[part] == search_number) return search->count >= search->max;
+    if (search->count >= search->max) return 1;
+
+    if (seen) seen[part] = search_number;
+    search->out[search->count].id = part;
+    search->out[search->count].distance = distance;
+    return ++search->count >= search->max;
+}
+
+// Every part at or below `node`; 1 when out[] filled up
+static int collect(Search *search, int node, int distance) {
+    for (int p = nodes[node].postings; p >= 0; p = postings[p].next) {
+        if (add_hit(search, postings[p].part, distance)) return 1;
+    }
+    for (int child = nodes[node].child; child >= 0; child = nodes[child].sibling) {
+        if (collect(search, child, distance)) return 1;
+    }
+    return 0;
+}
+
+// The node whose subtree holds every key starting with the query, -1 = none
+static int find_prefix(const char *query, int length) {
+    int node = 0, position = 0;
+
+    while (position < length) {
+        int child = nodes[node].child;
+        while (child >= 0 && labels[nodes[child].label] != query[position]) child = nodes[child].sibling;
+        if (child < 0) return -1;
+
+        for (int i = 0; i < nodes[child].length && position < length; i++, position++) {
+            if (labels[nodes[child].label + i] != query[position]) return -1;
+        }
+        node = child;
+    }
+    return node;
+}
+
+/**
+ * Fuzzy pass below `node`; `row` is the edit distance row for the key up
+ * to (not including) the node's label. Returns 1 when out[] filled up.
+ */
+static int search_near(Search *search, int node, const int *row) {
+    int m = search->length;
+    int current[CATALOG_QUERY_MAX + 1], next[CATALOG_QUERY_MAX + 1];
+
+    memcpy(current, row, (size_t)(m + 1) * sizeof(int));
+
+    for (int i = 0; i < nodes[node].length; i++) {
+        char ch = labels[nodes[node].label + i];
+        int lowest;
+
+        next[0] = lowest = current[0] + 1;
+        for (int j = 1; j <= m; j++) {
+            int cost = current[j - 1] + (search->query[j - 1] != ch);
+            if (current[j] + 1 < cost) cost = current[j] + 1;
+            if (next[j - 1] + 1 < cost) cost = next[j - 1] + 1;
+            next[j] = cost;
+            if (cost < lowest) lowest = cost;
+        }
+        memcpy(current, next, (size_t)(m + 1) * sizeof(int));
+
+        if (current[m] <= search->limit) return collect(search, node, current[m]);
+        if (lowest > search->limit) return 0;
+    }
+
+    for (int child = nodes[node].child; child >= 0; child = nodes[child].sibling) {
+        if (search_near(search, child, current)) return 1;
+    }
+    return 0;
+}
+
+int catalog_count(void) {
+    refresh();
+    return part_count;
+}
+
+const GaragePart *catalog_part(int id) {
+    refresh();
+    return id >= 0 && id < part_count ? &parts[id] : NULL;
+}
+
+int catalog_search(const char *query, CatalogHit out[], int max) {
+    char key[CATALOG_QUERY_MAX + 1];
+    Search search;
+
+    refresh();
+    normalize(query, key, sizeof(key));
+    search.query = key;
+    search.length = (int)strlen(key);
+    search.out = out;
+    search.max = max;
+    search.count = 0;
+    search_number++;
+
+    if (max <= 0 || part_count == 0 || node_count == 0) return 0;
+
+    if (search.length == 0) {
+        for (int i = 0; i < part_count && !add_hit(&search, i, 0); i++) {
+        }
+        return search.count;
+    }
+
+    int node = find_prefix(key, search.length);
+    if (node >= 0 && collect(&search, node, 0)) return search.count;
+
+    // Short queries match too much when letters may change
+    int most = search.length >= 7 ? 2 : search.length >= 4 ? 1 : 0;
+    int row[CATALOG_QUERY_MAX + 1];
+    for (int j = 0; j <= search.length; j++) row[j] = j;
+
+    // One edit first, so the closest spellings are listed first
+    for (search.limit = 1; search.limit <= most; search.limit++) {
+        for (int child = nodes[0].child; child >= 0; child = nodes[child].sibling) {
+            if (search_near(&search, child, row)) return search.count;
+        }
+    }
+    return search.count;
+}
@@ -0,0 +1,44 @@
+/**
+ * catalog.h - Part search for the Smart Garage order screen
+ *
+ * inventory.txt is loaded into a compressed trie (radix tree) keyed on
+ * each part's name, its spec, and the words of either ("Engine_Oil" is
+ * also found as "oil"), ignoring case. A search walks the query down the
+ * trie and returns the parts below where it ends, so the cost depends on
+ * the query and the number of hits, not on the catalog size.
+ *
+ * When fewer parts than asked for start with the query, words within a
+ * small edit distance are tried as well (one typo from four letters, two
+ * from seven), so "ceet" and "tires" still find Ceat tyres. The trie is
+ * rebuilt only after inventory.txt changes.
+ *
+ * Usage:
+ *   CatalogHit hits[CATALOG_MAX_HITS];
+ *   int count = catalog_search("ceat", hits, CATALOG_MAX_HITS);
+ *   for (int i = 0; i < count; i++) printf("%s\n", catalog_part(hits[i].id)->name);
+ */
+#ifndef CATALOG_H
+#define CATALOG_H
+
+#include "garage.h"
+
+#define CATALOG_MAX_HITS 10
+#define CATALOG_QUERY_MAX 40
+
+typedef struct {
+    int id;                     // Part number, 0-based in file order
+    int distance;               // 0 = starts with the query, else edits needed
+} CatalogHit;
+
+// Parts in inventory.txt
+int catalog_count(void);
+
+// Part `id`; NULL when out of range
+const GaragePart *catalog_part(int id);
+
+// Parts matching `query`, prefix matches first, then the closest
+// misspellings; an empty query lists the catalog from the top. Returns
+// how many were written to out[].
+int catalog_search(const char *query, CatalogHit out[], int max);
+
+#endif
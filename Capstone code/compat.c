@@ -0,0 +1,277 @@
+/**
+ * compat.c - Brand and seasonal part tables for the Smart Garage system
+ *
+ * Five small hash tables: brand and season lines, car profiles by car
+ * number, each customer's cars, and inventory parts. Names are matched
+ * on their letters and digits only, ignoring case, so "Engine_Oil",
+ * "engine oil" and "ENGINE-OIL" are the same part.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "garage.h"
+#include "compat.h"
+
+#define KEY_MAX 50
+
+typedef struct {
+    char key[KEY_MAX];
+    CompatList list;
+} ListEntry;
+
+// car_profiles.txt: car owner model engine
+typedef struct {
+    char car[20];
+    char model[50];
+} Profile;
+
+typedef struct {
+    char username[50];
+    char cars[COMPAT_MAX_CARS][20];
+    char makers[COMPAT_MAX_CARS][50]; // Manufacturer from parking, may be empty
+    int car_count;
+} Owner;
+
+typedef struct {
+    char key[KEY_MAX];
+    float price;
+} StockPart;
+
+static GarageTable brands = GARAGE_TABLE(ListEntry);
+static GarageTable seasons = GARAGE_TABLE(ListEntry);
+static GarageTable profiles = GARAGE_TABLE(Profile);
+static GarageTable owners = GARAGE_TABLE(Owner);
+static GarageTable stock = GARAGE_TABLE(StockPart);
+
+static GarageFileStamp brand_stamp, season_stamp, profile_stamp, stock_stamp;
+static GarageTail parking_tail;
+
+// ==================== KEYS ====================
+
+// Letters and digits of `text`, upper-cased
+static void make_key(char *key, size_t size, const char *text) {
+    size_t n = 0;
+    for (; *text && n + 1 < size; text++) {
+        if (isalnum((unsigned char)*text)) key[n++] = (char)toupper((unsigned char)*text);
+    }
+    key[n] = '\0';
+}
+
+// ==================== LOADING ====================
+
+static char *trim(char *text) {
+    while (isspace((unsigned char)*text)) text++;
+    size_t length = strlen(text);
+    while (length > 0 && isspace((unsigned char)text[length - 1])) text[--length] = '\0';
+    return text;
+}
+
+/**
+ * NAME|PART|PART... lines into `table`; '#' lines are comments
+ */
+static void load_lists(GarageTable *table, const char *path) {
+    char line[GARAGE_LINE_MAX], key[KEY_MAX];
+    FILE *f = fopen(path, "r");
+
+    garage_table_clear(table);
+    if (!f) return;
+
+    while (fgets(line, sizeof(line), f)) {
+        char *field = strtok(line, "|");
+        if (!field || trim(field)[0] == '#') continue;
+
+        make_key(key, sizeof(key), field);
+        if (!key[0]) continue;
+
+        // A repeated name adds to the line already read
+        int index = garage_table_find(table, key);
+        ListEntry *entry = index >= 0 ? garage_table_at(table, index)
+                                      : garage_table_add(table, key, sizeof(key));
+        if (!entry) break;
+        if (index < 0) snprintf(entry->list.name, sizeof(entry->list.name), "%s", trim(field));
+
+        while ((field = strtok(NULL, "|")) != NULL && entry->list.part_count < COMPAT_MAX_PARTS) {
+            field = trim(field);
+            if (field[0]) {
+                snprintf(entry->list.parts[entry->list.part_count++], sizeof(entry->list.parts[0]), "%s", field);
+            }
+        }
+    }
+    fclose(f);
+}
+
+static int add_stock_part(const GaragePart *part, void *context) {
+    char key[KEY_MAX];
+    (void)context;
+
+    make_key(key, sizeof(key), part->name);
+    if (!key[0] || garage_table_find(&stock, key) >= 0) return 0;
+
+    StockPart *entry = garage_table_add(&stock, key, sizeof(key));
+    if (entry) entry->price = part->price;
+    return entry == NULL;
+}
+
+static void remember_car(const char *username, const char *car, const char *maker) {
+    int index = garage_table_find(&owners, username);
+    Owner *owner = index >= 0 ? garage_table_at(&owners, index)
+                              : garage_table_add(&owners, username, sizeof(((Owner *)0)->username));
+    if (!owner) return;
+
+    for (int i = 0; i < owner->car_count; i++) {
+        if (strcmp(owner->cars[i], car) == 0) {
+            if (maker[0]) snprintf(owner->makers[i], sizeof(owner->makers[i]), "%s", maker);
+            return;
+        }
+    }
+    if (owner->car_count == COMPAT_MAX_CARS) return;
+
+    snprintf(owner->cars[owner->car_count], sizeof(owner->cars[0]), "%s", car);
+    snprintf(owner->makers[owner->car_count], sizeof(owner->makers[0]), "%s", maker);
+    owner->car_count++;
+}
+
+static void load_profiles(void) {
+    char line[GARAGE_LINE_MAX], car[20], owner[50], model[50];
+    FILE *f = fopen(CAR_PROFILES_FILE, "r");
+
+    garage_table_clear(&profiles);
+    if (!f) return;
+
+    while (fgets(line, sizeof(line), f)) {
+        if (sscanf(line, "%19s %49s %49s", car, owner, model) != 3 || car[0] == '#') continue;
+
+        int index = garage_table_find(&profiles, car);
+        Profile *profile = index >= 0 ? garage_table_at(&profiles, index)
+                                      : garage_table_add(&profiles, car, sizeof(((Profile *)0)->car));
+        if (!profile) break;
+        snprintf(profile->model, sizeof(profile->model), "%s", model);
+        remember_car(owner, car, "");
+    }
+    fclose(f);
+}
+
+// One parking record appended since the last call
+static void read_parking(char *line, long offset, void *context) {
+    GarageParking parking;
+    (void)offset;
+    (void)context;
+    if (garage_parse_parking(line, &parking)) {
+        remember_car(parking.username, parking.car_number, parking.manufacturer);
+    }
+}
+
+static void refresh(void) {
+    if (garage_file_changed(CAR_COMPATIBILITY_FILE, &brand_stamp)) load_lists(&brands, CAR_COMPATIBILITY_FILE);
+    if (garage_file_changed(SEASONAL_RECOMMENDATIONS_FILE, &season_stamp)) load_lists(&seasons, SEASONAL_RECOMMENDATIONS_FILE);
+    if (garage_file_changed(PARTS_FILE, &stock_stamp)) {
+        garage_table_clear(&stock);
+        garage_for_each_part(add_stock_part, NULL);
+    }
+
+    // Customers' cars come from both files: start over when a profile
+    // changed or parking records were deleted, else read the new records
+    int parking = garage_tail_changed(CAR_PARKING_FILE, &parking_tail);
+
+    if (garage_file_changed(CAR_PROFILES_FILE, &profile_stamp) || parking == GARAGE_TAIL_REWRITTEN) {
+        garage_table_clear(&owners);
+        garage_tail_reset(&parking_tail);
+        load_profiles();
+        parking = GARAGE_TAIL_REWRITTEN;
+    }
+    if (parking != GARAGE_TAIL_SAME) garage_tail_read(CAR_PARKING_FILE, &parking_tail, read_parking, NULL);
+}
+
+// ==================== LOOKUPS ====================
+
+static const CompatList *find_list(GarageTable *table, const char *name) {
+    char key[KEY_MAX];
+
+    make_key(key, sizeof(key), name);
+    int index = garage_table_find(table, key);
+    return index >= 0 ? &((ListEntry *)garage_table_at(table, index))->list : NULL;
+}
+
+const CompatList *compat_for_brand(const char *brand) {
+    refresh();
+    return find_list(&brands, brand);
+}
+
+const CompatList *compat_for_season(const char *season) {
+    refresh();
+    return find_list(&seasons, season);
+}
+
+const char *compat_season_of(int month) {
+    if (month >= 11 || month <= 2) return "Winter";
+    if (month <= 5) return "Spring";
+    if (month <= 8) return "Summer";
+    return "Fall";
+}
+
+/**
+ * Brand line for `text` itself or for its first word ("Toyota_Corolla",
+ * "TOYOTA Axio")
+ */
+static const CompatList *brand_in(const char *text) {
+    char word[50];
+    const CompatList *list = find_list(&brands, text);
+
+    if (list || !text[0]) return list;
+    snprintf(word, sizeof(word), "%s", text);
+    word[strcspn(word, " _-")] = '\0';
+    return find_list(&brands, word);
+}
+
+static void add_picks(const CompatList *list, const char *reason, CompatPick out[], int *count, int max) {
+    char key[KEY_MAX], other[KEY_MAX];
+
+    for (int i = 0; i < list->part_count && *count < max; i++) {
+        make_key(key, sizeof(key), list->parts[i]);
+
+        int seen = 0;
+        for (int j = 0; j < *count && !seen; j++) {
+            make_key(other, sizeof(other), out[j].part);
+            seen = strcmp(key, other) == 0;
+        }
+        if (seen) continue;
+
+        CompatPick *pick = &out[(*count)++];
+        int index = garage_table_find(&stock, key);
+        snprintf(pick->part, sizeof(pick->part), "%s", list->parts[i]);
+        snprintf(pick->reason, sizeof(pick->reason), "%s", reason);
+        pick->in_stock = index >= 0;
+        pick->price = index >= 0 ? ((StockPart *)garage_table_at(&stock, index))->price : 0;
+    }
+}
+
+int compat_recommend(const char *username, int month, CompatPick out[], int max) {
+    char reason[60];
+    int count = 0;
+
+    refresh();
+
+    int owner_index = garage_table_find(&owners, username);
+    if (owner_index >= 0) {
+        const Owner *owner = garage_table_at(&owners, owner_index);
+
+        for (int i = 0; i < owner->car_count; i++) {
+            int profile_index = garage_table_find(&profiles, owner->cars[i]);
+            const CompatList *list = NULL;
+
+            if (profile_index >= 0) {
+                list = brand_in(((const Profile *)garage_table_at(&profiles, profile_index))->model);
+            }
+            if (!list) list = brand_in(owner->makers[i]);
+            if (!list) continue;
+
+            snprintf(reason, sizeof(reason), "%s %s", list->name, owner->cars[i]);
+            add_picks(list, reason, out, &count, max);
+        }
+    }
+
+    const CompatList *season = find_list(&seasons, compat_season_of(month));
+    if (season) add_picks(season, season->name, out, &count, max);
+    return count;
+}
@@ -0,0 +1,50 @@
+/**
+ * compat.h - Brand and seasonal part tables for the Smart Garage system
+ *
+ * car_compatibility.txt (BRAND|PART|PART...) and
+ * seasonal_recommendations.txt (SEASON|PART|...) are parsed once into hash
+ * tables keyed by brand and season. A customer's cars come from their
+ * parking records, with the brand taken from car_profiles.txt when the car
+ * has a profile and from the parking record's manufacturer otherwise.
+ * Picks are joined against inventory.txt for stock and price.
+ *
+ * Each file is read again only when it changed on disk; parking records
+ * appended since the last call are read on their own.
+ *
+ * Usage:
+ *   CompatPick picks[COMPAT_MAX_PICKS];
+ *   int count = compat_recommend("Ashis_01", 12, picks, COMPAT_MAX_PICKS);
+ */
+#ifndef COMPAT_H
+#define COMPAT_H
+
+#define COMPAT_MAX_PARTS 8      // Parts per brand or season
+#define COMPAT_MAX_CARS 8       // Cars remembered per customer
+#define COMPAT_MAX_PICKS 16
+
+// One line of a table: a brand or season and its parts
+typedef struct {
+    char name[30];
+    char parts[COMPAT_MAX_PARTS][50];
+    int part_count;
+} CompatList;
+
+typedef struct {
+    char part[50];
+    char reason[60];            // "TOYOTA 242-35-407" or "Winter"
+    int in_stock;               // Listed in inventory.txt
+    float price;                // Inventory price when in stock
+} CompatPick;
+
+// Table line for a brand or season (any case), NULL when there is none
+const CompatList *compat_for_brand(const char *brand);
+const CompatList *compat_for_season(const char *season);
+
+// "Winter", "Spring", "Summer" or "Fall" for a month 1-12
+const char *compat_season_of(int month);
+
+// Parts for the customer's cars, then for the season of `month`, each part
+// once; returns how many were written to out[]
+int compat_recommend(const char *username, int month, CompatPick out[], int max);
+
+#endif
@@ -0,0 +1,279 @@
+/**
+ * customers.c - Customer 360 view for the Smart Garage system
+ *
+ * One profile per username holds the totals of the files that have no
+ * index of their own. Each file is a source read from where it was left;
+ * a rewritten source, or the loyalty file (rewritten on every change),
+ * has its totals cleared in every profile and is read again. A user's
+ * line offset is checked against the username when it is read, so a
+ * rewritten user_data.txt is re-indexed on the first stale lookup.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "garage.h"
+#include "history.h"
+#include "receipts.h"
+#include "customers.h"
+
+typedef struct {
+    char username[30];
+    long user_offset;           // Line in user_data.txt, -1 = not registered
+    int loyalty_points;
+    int badge_count;
+    char latest_badge[50];
+    int redemptions;
+    int points_redeemed;
+    float discount_total;
+    int parking_stays;
+    char last_car[20];
+    char last_parking[20];
+    int pass;                   // Last customers_for_each() pass that visited it
+} Profile;
+
+typedef struct {
+    const char *path;
+    void (*add)(const char *line, long offset);
+    void (*clear)(Profile *profile);
+    int rewritten;              // Rewritten on every change: always read again
+    GarageTail tail;
+} Source;
+
+static GarageTable profiles = GARAGE_TABLE(Profile);
+static int pass_number;
+
+// ==================== PROFILES ====================
+
+static Profile *profile_at(int index) {
+    return garage_table_at(&profiles, index);
+}
+
+static int find_profile(const char *username) {
+    return garage_table_find(&profiles, username);
+}
+
+// The username's profile, added empty when new; NULL when out of memory
+static Profile *add_profile(const char *username) {
+    int index = find_profile(username);
+    if (index >= 0) return profile_at(index);
+
+    Profile *profile = garage_table_add(&profiles, username, sizeof(profile->username));
+    if (profile) profile->user_offset = -1;
+    return profile;
+}
+
+// ==================== SOURCES ====================
+
+static void add_user(const char *line, long offset) {
+    GarageUser user;
+    if (!garage_parse_user(line, &user)) return;
+
+    // Older data has usernames registered twice; the first record counts
+    Profile *profile = add_profile(user.username);
+    if (profile && profile->user_offset < 0) profile->user_offset = offset;
+}
+
+static void clear_user(Profile *profile) {
+    profile->user_offset = -1;
+}
+
+static void add_loyalty(const char *line, long offset) {
+    GarageLoyalty account;
+    (void)offset;
+    if (!garage_parse_loyalty(line, &account)) return;
+
+    Profile *profile = add_profile(account.username);
+    if (profile) profile->loyalty_points = account.points;
+}
+
+static void clear_loyalty(Profile *profile) {
+    profile->loyalty_points = 0;
+}
+
+// customer_badges.txt: username badge date
+static void add_badge(const char *line, long offset) {
+    char username[30], badge[50];
+    (void)offset;
+    if (line[0] == '#' || sscanf(line, "%29s %49s", username, badge) != 2) return;
+
+    Profile *profile = add_profile(username);
+    if (!profile) return;
+    profile->badge_count++;
+    strcpy(profile->latest_badge, badge);
+}
+
+static void clear_badges(Profile *profile) {
+    profile->badge_count = 0;
+    profile->latest_badge[0] = '\0';
+}
+
+// redemption_history.txt: username points discount date
+static void add_redemption(const char *line, long offset) {
+    char username[30];
+    int points;
+    float discount;
+    (void)offset;
+    if (line[0] == '#' || sscanf(line, "%29s %d %f", username, &points, &discount) != 3) return;
+
+    Profile *profile = add_profile(username);
+    if (!profile) return;
+    profile->redemptions++;
+    profile->points_redeemed += points;
+    profile->discount_total += discount;
+}
+
+static void clear_redemptions(Profile *profile) {
+    profile->redemptions = profile->points_redeemed = 0;
+    profile->discount_total = 0;
+}
+
+static void add_parking(const char *line, long offset) {
+    GarageParking parking;
+    (void)offset;
+    if (!garage_parse_parking(line, &parking)) return;
+
+    Profile *profile = add_profile(parking.username);
+    if (!profile) return;
+    profile->parking_stays++;
+    strcpy(profile->last_car, parking.car_number);
+    strcpy(profile->last_parking, parking.date);
+}
+
+static void clear_parking(Profile *profile) {
+    profile->parking_stays = 0;
+    profile->last_car[0] = profile->last_parking[0] = '\0';
+}
+
+enum { SOURCE_USERS, SOURCE_LOYALTY, SOURCE_BADGES, SOURCE_REDEMPTIONS, SOURCE_PARKING, SOURCE_COUNT };
+
+static Source sources[SOURCE_COUNT] = {
+    {USERS_FILE, add_user, clear_user, 0, {{0, 0, 0}, 0, 0}},
+    {LOYALTY_POINTS_FILE, add_loyalty, clear_loyalty, 1, {{0, 0, 0}, 0, 0}},
+    {CUSTOMER_BADGES_FILE, add_badge, clear_badges, 0, {{0, 0, 0}, 0, 0}},
+    {REDEMPTION_HISTORY_FILE, add_redemption, clear_redemptions, 0, {{0, 0, 0}, 0, 0}},
+    {CAR_PARKING_FILE, add_parking, clear_parking, 0, {{0, 0, 0}, 0, 0}},
+};
+
+static void add_line(char *line, long offset, void *context) {
+    const Source *source = context;
+    source->add(line, offset);
+}
+
+/**
+ * Add the lines appended since the last call
+ */
+static void read_source(Source *source) {
+    garage_tail_read(source->path, &source->tail, add_line, source);
+}
+
+static void reset_source(Source *source) {
+    for (int i = 0; i < profiles.count; i++) source->clear(profile_at(i));
+    garage_tail_reset(&source->tail);
+}
+
+static void refresh(void) {
+    for (int i = 0; i < SOURCE_COUNT; i++) {
+        Source *source = &sources[i];
+        int changed = garage_tail_changed(source->path, &source->tail);
+        if (changed == GARAGE_TAIL_SAME) continue;
+
+        if (source->rewritten || changed == GARAGE_TAIL_REWRITTEN) reset_source(source);
+        read_source(source);
+    }
+}
+
+// ==================== VIEWS ====================
+
+// 1 and the user when the line at `offset` still holds this username
+static int read_user_at(FILE *f, long offset, const char *username, GarageUser *user) {
+    char line[GARAGE_LINE_MAX];
+
+    if (fseek(f, offset, SEEK_SET) != 0 || !fgets(line, sizeof(line), f)) return 0;
+    return garage_parse_user(line, user) && strcmp(user->username, username) == 0;
+}
+
+static int load_user(Profile **profile, const char *username, GarageUser *user) {
+    if ((*profile)->user_offset < 0) return 0;
+
+    FILE *f = fopen(USERS_FILE, "rb");
+    if (!f) return 0;
+
+    int found = read_user_at(f, (*profile)->user_offset, username, user);
+    if (!found) {
+        // user_data.txt was rewritten since it was indexed
+        reset_source(&sources[SOURCE_USERS]);
+        read_source(&sources[SOURCE_USERS]);
+
+        int index = find_profile(username);
+        *profile = index >= 0 ? profile_at(index) : NULL;
+        found = *profile && (*profile)->user_offset >= 0 &&
+                read_user_at(f, (*profile)->user_offset, username, user);
+    }
+    fclose(f);
+    return found;
+}
+
+static void fill_view(const Profile *profile, CustomerView *view) {
+    HistorySummary orders;
+    const char *username = view->user.username;
+
+    view->order_count = history_totals(username, &orders);
+    view->total_spent = orders.total_spent;
+    strcpy(view->last_order, orders.last_order);
+    view->receipt_count = receipts_for_user(username, 0, 0, NULL, NULL);
+    if (!profile) return;
+
+    view->loyalty_points = profile->loyalty_points;
+    view->badge_count = profile->badge_count;
+    strcpy(view->latest_badge, profile->latest_badge);
+    view->redemptions = profile->redemptions;
+    view->points_redeemed = profile->points_redeemed;
+    view->discount_total = profile->discount_total;
+    view->parking_stays = profile->parking_stays;
+    strcpy(view->last_car, profile->last_car);
+    strcpy(view->last_parking, profile->last_parking);
+}
+
+int customers_get(const char *username, CustomerView *view) {
+    memset(view, 0, sizeof(*view));
+    snprintf(view->user.username, sizeof(view->user.username), "%s", username);
+
+    refresh();
+
+    int index = find_profile(username);
+    Profile *profile = index >= 0 ? profile_at(index) : NULL;
+    if (profile && load_user(&profile, username, &view->user)) view->registered = 1;
+
+    fill_view(profile, view);
+    return view->registered || profile || view->order_count > 0 || view->receipt_count > 0;
+}
+
+int customers_for_each(CustomerViewVisitor visit, void *context) {
+    char line[GARAGE_LINE_MAX];
+    CustomerView view;
+
+    refresh();
+
+    FILE *f = fopen(USERS_FILE, "rb");
+    if (!f) return -1;
+
+    int visited = 0;
+    pass_number++;
+    while (fgets(line, sizeof(line), f)) {
+        memset(&view, 0, sizeof(view));
+        if (!garage_parse_user(line, &view.user) || strcmp(view.user.role, "Customer") != 0) continue;
+
+        // Older data has usernames registered twice; the first record counts
+        Profile *profile = add_profile(view.user.username);
+        if (profile) {
+            if (profile->pass == pass_number) continue;
+            profile->pass = pass_number;
+        }
+
+        view.registered = 1;
+        fill_view(profile, &view);
+        visited++;
+        if (visit(&view, context)) break;
+    }
+    fclose(f);
+    return visited;
+}
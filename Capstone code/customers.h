@@ -0,0 +1,56 @@
+/**
+ * customers.h - Customer 360 view for the Smart Garage system
+ *
+ * Everything the garage knows about a customer in one record: the user
+ * details, order totals, loyalty balance, badges, redemptions, QR
+ * receipts and parking stays. Orders and receipts come from their own
+ * indexes (history.h, receipts.h); the rest is summed per username from
+ * the badge, redemption, parking and loyalty files as they grow, and each
+ * user's line in user_data.txt is remembered. Looking a customer up is a
+ * few hash lookups and one line read, not a scan of seven files.
+ *
+ * customers_for_each() is the batch form: one pass over user_data.txt,
+ * joining every customer with the same per-username totals.
+ *
+ * Usage:
+ *   CustomerView view;
+ *   if (customers_get("Ashis_01", &view)) {
+ *       printf("%s: %d orders, %d points\n", view.user.name, view.order_count, view.loyalty_points);
+ *   }
+ */
+#ifndef CUSTOMERS_H
+#define CUSTOMERS_H
+
+#include "garage.h"
+
+typedef struct {
+    GarageUser user;            // Only the username is set when not registered
+    int registered;
+    int order_count;
+    double total_spent;
+    char last_order[32];        // ctime() text, "" when none or legacy
+    int loyalty_points;
+    int badge_count;
+    char latest_badge[50];
+    int redemptions;
+    int points_redeemed;
+    float discount_total;
+    int receipt_count;
+    int parking_stays;
+    char last_car[20];          // Car of the latest parking entry
+    char last_parking[20];      // Its date as written
+} CustomerView;
+
+// Visitors return 0 to continue and non-zero to stop
+typedef int (*CustomerViewVisitor)(const CustomerView *view, void *context);
+
+// 1 and the view when the username is registered or has any records,
+// 0 otherwise
+int customers_get(const char *username, CustomerView *view);
+
+// Every customer in user_data.txt, in file order (a username registered
+// twice is visited once); returns how many, or -1 when the file cannot
+// be opened
+int customers_for_each(CustomerViewVisitor visit, void *context);
+
+#endif
@@ -10,7 +10,7 @@
 #include <time.h>
 
 // --- Constants ---
-#define MAX_USERS 100
+#define MIN_USERS 64 // Starting size of the user table; it grows as needed
 #define MAX_CARS 200
 #define MAX_PARTS 50
 #define MAX_APPOINTMENTS 100
@@ -18,6 +18,16 @@
 #define MAX_DASHBOARD_ITEMS 20
 #define DASHBOARD_WIDTH 80
 #define CHART_HEIGHT 10
+#define SERVICE_BAYS 10
+#define JOBS_PER_MECHANIC 4
+#define LOW_STOCK_LEVEL 5
+#define PARKING_HOURLY_RATE 5.00
+#define ACTIVITY_LOG_SIZE 5
+
+// --- Data Files ---
+#define PARTS_FILE "parts.dat"
+#define APPOINTMENTS_FILE "appointments.dat"
+#define PARKING_FILE "parking.dat"
 
 // --- Data Structures ---
 typedef struct {
@@ -58,6 +68,8 @@ typedef struct {
     char exitTime[20];
     int isParked;
     double fee;
+    time_t entryAt;
+    time_t exitAt;
 } ParkingRecord;
 
 typedef struct {
@@ -75,6 +87,18 @@ typedef struct {
     int outOfStockParts;
     double totalRevenue;
     int mechanicsOnDuty;
+
+    // Kept current by the writers, so a dashboard refresh costs O(1)
+    long dayKey;            // YYYYMMDD the daily totals belong to
+    long monthKey;          // YYYYMM
+    long yearKey;           // YYYY
+    double dailyRevenue;
+    double monthlyRevenue;
+    double ytdRevenue;
+    int dailyPayments;
+    int totalAppointments;
+    int totalParts;
+    int lowStockParts;
 } DashboardStats;
 
 // --- Function Prototypes ---
@@ -124,21 +148,52 @@ void displayRecentActivity();
 void displaySystemStatus();
 void printDashboardHeader(const char* title);
 void printSeparatorLine();
+void printStatCell(const char* text);
+
+// Dashboard views (updated by the writers)
+long dateKey(time_t when);
+void rollRevenuePeriods(long today);
+void refreshDashboardStats();
+void recordRevenue(double amount, time_t when);
+void recordUser(const User* user);
+void countPartStock(int quantity, int delta);
+void recordPartQuantity(int oldQuantity, int newQuantity);
+void recordAppointment(const ServiceAppointment* appointment);
+int recordParking(ParkingRecord parking);
+void recordActivity(const char* text);
+void loadDashboardData();
 
 // Utility functions
 void clearScreen();
 void pauseScreen();
 User* findUser(const char* username);
+User* addUser(const User* user);
 void saveUserToFile(User user);
 int loadUsersFromFile();
 void saveAppointmentToFile(ServiceAppointment appointment);
 void saveParkingToFile(ParkingRecord parking);
+void savePartsToFile();
+Part* findPart(const char* partName);
+int findParkedCar(const char* licensePlate);
 
 // --- Global Variables ---
-User users[MAX_USERS];
+User* users = NULL;     // Grows with addUser(); pointers into it move when it does
 int userCount = 0;
+int userCapacity = 0;
+int* userIndex = NULL;  // Username hash: slot -> user index + 1, 0 = empty
+int userIndexSize = 0;  // Power of two, at least twice userCount
 User loggedInUser;
 
+Part parts[MAX_PARTS];
+int partCount = 0;
+ServiceAppointment appointments[MAX_APPOINTMENTS];
+int appointmentCount = 0;
+ParkingRecord parkingSpaces[MAX_PARKING]; // Space number - 1
+DashboardStats dashboardStats;
+char recentActivity[ACTIVITY_LOG_SIZE][100];
+int activityCount = 0;
+time_t startedAt;
+
 // --- Main System Implementation ---
 
 void clearScreen() {
@@ -240,8 +295,17 @@ void registerUser() {
     scanf("%d", &newUser.isAdmin);
     getchar();
     
+    if (addUser(&newUser) == NULL) {
+        printf("❌ Not enough memory to register a new account!\n");
+        pauseScreen();
+        return;
+    }
     saveUserToFile(newUser);
-    users[userCount++] = newUser;
+    recordUser(&newUser);
+
+    char activity[100];
+    snprintf(activity, sizeof(activity), "New account '%s' registered", newUser.username);
+    recordActivity(activity);
     
     printf("✅ Registration successful! You can now login.\n");
     pauseScreen();
@@ -588,6 +652,14 @@ void bookAppointment(User currentUser) {
     
     strcpy(appointment.status, "Scheduled");
     
+    saveAppointmentToFile(appointment);
+    if (appointmentCount < MAX_APPOINTMENTS) appointments[appointmentCount++] = appointment;
+    recordAppointment(&appointment);
+
+    char activity[100];
+    snprintf(activity, sizeof(activity), "New appointment booked for %.40s", appointment.serviceType);
+    recordActivity(activity);
+    
     printf("✅ Appointment booked successfully!\n");
     pauseScreen();
 }
@@ -599,9 +671,15 @@ void viewAppointments(User currentUser) {
     printf("Service Type\t\tDate\t\tTime\t\tStatus\n");
     printf("─────────────────────────────────────────────────────────────\n");
     
-    // Placeholder data
-    printf("Oil Change\t\t2025-07-28\t14:00\t\tScheduled\n");
-    printf("Brake Service\t\t2025-07-30\t10:30\t\tCompleted\n");
+    int found = 0;
+    for (int i = 0; i < appointmentCount; i++) {
+        if (strcmp(appointments[i].customerUsername, currentUser.username) == 0) {
+            printf("%-20s\t%s\t%s\t\t%s\n", appointments[i].serviceType, appointments[i].date,
+                   appointments[i].time, appointments[i].status);
+            found = 1;
+        }
+    }
+    if (!found) printf("No appointments yet.\n");
     
     pauseScreen();
 }
@@ -613,9 +691,11 @@ void manageAppointments() {
     printf("Customer\t\tService Type\t\tDate\t\tStatus\n");
     printf("─────────────────────────────────────────────────────────────────\n");
     
-    // Placeholder data
-    printf("john_doe\t\tOil Change\t\t2025-07-28\tScheduled\n");
-    printf("jane_smith\t\tBrake Service\t\t2025-07-30\tIn Progress\n");
+    for (int i = 0; i < appointmentCount; i++) {
+        printf("%-16s\t%-20s\t%s\t%s\n", appointments[i].customerUsername, appointments[i].serviceType,
+               appointments[i].date, appointments[i].status);
+    }
+    if (appointmentCount == 0) printf("No appointments yet.\n");
     
     pauseScreen();
 }
@@ -631,8 +711,38 @@ void parkCar(User currentUser) {
     fgets(licensePlate, sizeof(licensePlate), stdin);
     licensePlate[strcspn(licensePlate, "\n")] = 0;
     
-    printf("✅ Car %s parked successfully in space #15!\n", licensePlate);
-    printf("💰 Parking fee: $5.00 per hour\n");
+    if (licensePlate[0] == '\0' || strchr(licensePlate, ' ') != NULL) {
+        printf("❌ Enter the license plate without spaces!\n");
+        pauseScreen();
+        return;
+    }
+    if (findParkedCar(licensePlate) >= 0) {
+        printf("❌ Car %s is already parked!\n", licensePlate);
+        pauseScreen();
+        return;
+    }
+    
+    ParkingRecord parking = {0};
+    strcpy(parking.licensePlate, licensePlate);
+    parking.entryAt = time(NULL);
+    strftime(parking.entryTime, sizeof(parking.entryTime), "%Y-%m-%d %H:%M", localtime(&parking.entryAt));
+    strcpy(parking.exitTime, "-");
+    parking.isParked = 1;
+    
+    int space = recordParking(parking);
+    if (space == 0) {
+        printf("❌ Parking is full! Please try again later.\n");
+        pauseScreen();
+        return;
+    }
+    saveParkingToFile(parking);
+
+    char activity[100];
+    snprintf(activity, sizeof(activity), "Customer '%s' checked in car %s", currentUser.username, licensePlate);
+    recordActivity(activity);
+    
+    printf("✅ Car %s parked successfully in space #%d!\n", licensePlate, space);
+    printf("💰 Parking fee: $%.2f per hour\n", PARKING_HOURLY_RATE);
     pauseScreen();
 }
 
@@ -646,9 +756,32 @@ void unparkCar(User currentUser) {
     fgets(licensePlate, sizeof(licensePlate), stdin);
     licensePlate[strcspn(licensePlate, "\n")] = 0;
     
+    int space = findParkedCar(licensePlate);
+    if (space < 0) {
+        printf("❌ Car %s is not parked here!\n", licensePlate);
+        pauseScreen();
+        return;
+    }
+    
+    ParkingRecord parking = parkingSpaces[space];
+    parking.exitAt = time(NULL);
+    strftime(parking.exitTime, sizeof(parking.exitTime), "%Y-%m-%d %H:%M", localtime(&parking.exitAt));
+    parking.isParked = 0;
+    
+    long minutes = (long)difftime(parking.exitAt, parking.entryAt) / 60;
+    parking.fee = minutes / 60.0 * PARKING_HOURLY_RATE;
+    
+    recordParking(parking);
+    saveParkingToFile(parking);
+
+    char activity[100];
+    snprintf(activity, sizeof(activity), "Customer '%.30s' checked out car %s ($%.2f)",
+             currentUser.username, licensePlate, parking.fee);
+    recordActivity(activity);
+    
     printf("✅ Car %s unparked successfully!\n", licensePlate);
-    printf("⏰ Parking duration: 3 hours 45 minutes\n");
-    printf("💰 Total fee: $18.75\n");
+    printf("⏰ Parking duration: %ld hours %ld minutes\n", minutes / 60, minutes % 60);
+    printf("💰 Total fee: $%.2f\n", parking.fee);
     pauseScreen();
 }
 
@@ -659,10 +792,14 @@ void viewParkingStatus() {
     printf("Space\tLicense Plate\tEntry Time\t\tDuration\n");
     printf("─────────────────────────────────────────────────────────\n");
     
-    // Placeholder data
-    printf("15\tABC123\t\t10:30\t\t\t2h 15m\n");
-    printf("23\tXYZ789\t\t12:45\t\t\t45m\n");
-    printf("Available spaces: 47/50\n");
+    time_t now = time(NULL);
+    for (int i = 0; i < MAX_PARKING; i++) {
+        if (!parkingSpaces[i].isParked) continue;
+        long minutes = (long)difftime(now, parkingSpaces[i].entryAt) / 60;
+        printf("%d\t%-12s\t%s\t%ldh %ldm\n", i + 1, parkingSpaces[i].licensePlate,
+               parkingSpaces[i].entryTime, minutes / 60, minutes % 60);
+    }
+    printf("Available spaces: %d/%d\n", MAX_PARKING - dashboardStats.parkedCars, MAX_PARKING);
     
     pauseScreen();
 }
@@ -690,6 +827,25 @@ void addPart() {
     fgets(newPart.supplier, sizeof(newPart.supplier), stdin);
     newPart.supplier[strcspn(newPart.supplier, "\n")] = 0;
     
+    if (findPart(newPart.partName) != NULL) {
+        printf("❌ Part already exists! Use Update Quantity instead.\n");
+        pauseScreen();
+        return;
+    }
+    if (partCount >= MAX_PARTS || strchr(newPart.partName, '|') || strchr(newPart.supplier, '|')) {
+        printf("❌ Part cannot be added!\n");
+        pauseScreen();
+        return;
+    }
+    
+    parts[partCount++] = newPart;
+    savePartsToFile();
+    recordPartQuantity(-1, newPart.quantity);
+
+    char activity[100];
+    snprintf(activity, sizeof(activity), "Parts received: %.40s x%d", newPart.partName, newPart.quantity);
+    recordActivity(activity);
+    
     printf("✅ Part added successfully!\n");
     pauseScreen();
 }
@@ -701,11 +857,11 @@ void viewParts() {
     printf("Part Name\t\tQuantity\tPrice\t\tSupplier\n");
     printf("─────────────────────────────────────────────────────────────\n");
     
-    // Placeholder data
-    printf("Brake Pads\t\t25\t\t$45.99\t\tABC Auto\n");
-    printf("Engine Oil\t\t50\t\t$24.99\t\tXYZ Parts\n");
-    printf("Air Filter\t\t15\t\t$19.99\t\tABC Auto\n");
-    printf("Spark Plugs\t\t0\t\t$12.99\t\tXYZ Parts\n");
+    for (int i = 0; i < partCount; i++) {
+        printf("%-20s\t%d\t\t$%.2f\t\t%s\n", parts[i].partName, parts[i].quantity,
+               parts[i].price, parts[i].supplier);
+    }
+    if (partCount == 0) printf("No parts in inventory.\n");
     
     pauseScreen();
 }
@@ -722,10 +878,27 @@ void updatePartQuantity() {
     fgets(partName, sizeof(partName), stdin);
     partName[strcspn(partName, "\n")] = 0;
     
+    Part* part = findPart(partName);
+    if (part == NULL) {
+        printf("❌ Part %s not found!\n", partName);
+        pauseScreen();
+        return;
+    }
+    
     printf("Enter new quantity: ");
     scanf("%d", &newQuantity);
     getchar();
     
+    if (newQuantity < 0) {
+        printf("❌ Quantity cannot be negative!\n");
+        pauseScreen();
+        return;
+    }
+    
+    recordPartQuantity(part->quantity, newQuantity);
+    part->quantity = newQuantity;
+    savePartsToFile();
+    
     printf("✅ Quantity updated successfully for %s!\n", partName);
     pauseScreen();
 }
@@ -787,13 +960,63 @@ void qaSection() {
 }
 
 // --- Utility Functions ---
+// FNV-1a hash of a username
+unsigned long hashUsername(const char* username) {
+    unsigned long hash = 2166136261UL;
+    while (*username) {
+        hash ^= (unsigned char)*username++;
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+// Slot holding username, or the empty slot where it would go
+int findUserSlot(const char* username) {
+    int mask = userIndexSize - 1;
+    int slot = (int)(hashUsername(username) & (unsigned long)mask);
+
+    while (userIndex[slot] != 0 && strcmp(users[userIndex[slot] - 1].username, username) != 0) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
 User* findUser(const char* username) {
-    for (int i = 0; i < userCount; i++) {
-        if (strcmp(users[i].username, username) == 0) {
-            return &users[i];
+    if (userIndexSize == 0) return NULL;
+
+    int slot = findUserSlot(username);
+    return userIndex[slot] != 0 ? &users[userIndex[slot] - 1] : NULL;
+}
+
+/**
+ * Append a copy of user to the table and index it; returns the stored
+ * user, or NULL when out of memory. The caller checks for duplicates.
+ */
+User* addUser(const User* user) {
+    if (userCount == userCapacity) {
+        int grown = userCapacity ? userCapacity * 2 : MIN_USERS;
+        User* newUsers = realloc(users, (size_t)grown * sizeof(User));
+        if (newUsers == NULL) return NULL;
+        users = newUsers;
+        userCapacity = grown;
+    }
+
+    if ((userCount + 1) * 2 > userIndexSize) {
+        int size = userIndexSize ? userIndexSize * 2 : MIN_USERS * 2;
+        int* newIndex = calloc((size_t)size, sizeof(int));
+        if (newIndex == NULL) return NULL;
+        free(userIndex);
+        userIndex = newIndex;
+        userIndexSize = size;
+        for (int i = 0; i < userCount; i++) {
+            userIndex[findUserSlot(users[i].username)] = i + 1;
         }
     }
-    return NULL;
+
+    users[userCount] = *user;
+    int slot = findUserSlot(user->username);
+    if (userIndex[slot] == 0) userIndex[slot] = userCount + 1; // First one wins
+    return &users[userCount++];
 }
 
 void saveUserToFile(User user) {
@@ -809,15 +1032,17 @@ void saveUserToFile(User user) {
 int loadUsersFromFile() {
     FILE* file = fopen("users.dat", "r");
     if (file != NULL) {
+        User user;
         userCount = 0;
-        while (fscanf(file, "%s %s %s %s %s %d", 
-                      users[userCount].username,
-                      users[userCount].password,
-                      users[userCount].name,
-                      users[userCount].email,
-                      users[userCount].phone,
-                      &users[userCount].isAdmin) == 6 && userCount < MAX_USERS) {
-            userCount++;
+        if (userIndexSize) memset(userIndex, 0, (size_t)userIndexSize * sizeof(int));
+        while (fscanf(file, "%49s %49s %99s %99s %14s %d",
+                      user.username,
+                      user.password,
+                      user.name,
+                      user.email,
+                      user.phone,
+                      &user.isAdmin) == 6) {
+            if (addUser(&user) == NULL) break;
         }
         fclose(file);
         return 1;
@@ -825,6 +1050,223 @@ int loadUsersFromFile() {
     return 0;
 }
 
+void saveAppointmentToFile(ServiceAppointment appointment) {
+    FILE* file = fopen(APPOINTMENTS_FILE, "a");
+    if (file != NULL) {
+        fprintf(file, "%s|%s|%s|%s|%s\n",
+                appointment.customerUsername, appointment.serviceType,
+                appointment.date, appointment.time, appointment.status);
+        fclose(file);
+    }
+}
+
+// One line per check-in (isParked 1) and per check-out with its fee
+void saveParkingToFile(ParkingRecord parking) {
+    FILE* file = fopen(PARKING_FILE, "a");
+    if (file != NULL) {
+        fprintf(file, "%s %ld %ld %d %.2f\n",
+                parking.licensePlate, (long)parking.entryAt, (long)parking.exitAt,
+                parking.isParked, parking.fee);
+        fclose(file);
+    }
+}
+
+void savePartsToFile() {
+    FILE* file = fopen(PARTS_FILE, "w");
+    if (file != NULL) {
+        for (int i = 0; i < partCount; i++) {
+            fprintf(file, "%s|%d|%.2f|%s\n",
+                    parts[i].partName, parts[i].quantity, parts[i].price, parts[i].supplier);
+        }
+        fclose(file);
+    }
+}
+
+Part* findPart(const char* partName) {
+    for (int i = 0; i < partCount; i++) {
+        if (strcmp(parts[i].partName, partName) == 0) {
+            return &parts[i];
+        }
+    }
+    return NULL;
+}
+
+// Index of the space the car is parked in, or -1
+int findParkedCar(const char* licensePlate) {
+    for (int i = 0; i < MAX_PARKING; i++) {
+        if (parkingSpaces[i].isParked && strcmp(parkingSpaces[i].licensePlate, licensePlate) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// --- Dashboard Views ---
+// The dashboards read dashboardStats as is. Every writer (registration,
+// bookings, check-in/out, parts) updates the figures it affects, and the
+// data files are replayed through the same functions once at startup.
+
+long dateKey(time_t when) {
+    struct tm tm = *localtime(&when);
+    return (tm.tm_year + 1900) * 10000L + (tm.tm_mon + 1) * 100L + tm.tm_mday;
+}
+
+// Start new daily, monthly and yearly totals once their period is over
+void rollRevenuePeriods(long today) {
+    if (dashboardStats.yearKey != today / 10000) {
+        dashboardStats.yearKey = today / 10000;
+        dashboardStats.ytdRevenue = 0;
+    }
+    if (dashboardStats.monthKey != today / 100) {
+        dashboardStats.monthKey = today / 100;
+        dashboardStats.monthlyRevenue = 0;
+    }
+    if (dashboardStats.dayKey != today) {
+        dashboardStats.dayKey = today;
+        dashboardStats.dailyRevenue = 0;
+        dashboardStats.dailyPayments = 0;
+    }
+}
+
+void refreshDashboardStats() {
+    rollRevenuePeriods(dateKey(time(NULL)));
+}
+
+void recordRevenue(double amount, time_t when) {
+    long day = dateKey(when);
+
+    refreshDashboardStats();
+    dashboardStats.totalRevenue += amount;
+    if (day / 10000 == dashboardStats.yearKey) dashboardStats.ytdRevenue += amount;
+    if (day / 100 == dashboardStats.monthKey) dashboardStats.monthlyRevenue += amount;
+    if (day == dashboardStats.dayKey) {
+        dashboardStats.dailyRevenue += amount;
+        dashboardStats.dailyPayments++;
+    }
+}
+
+void recordUser(const User* user) {
+    if (user->isAdmin == 0) dashboardStats.totalCustomers++;
+    if (user->isAdmin == 2) dashboardStats.mechanicsOnDuty++;
+}
+
+// Count (delta 1) or uncount (delta -1) one part at this stock level
+void countPartStock(int quantity, int delta) {
+    if (quantity > 0) {
+        dashboardStats.availableParts += delta;
+        if (quantity <= LOW_STOCK_LEVEL) dashboardStats.lowStockParts += delta;
+    } else {
+        dashboardStats.outOfStockParts += delta;
+    }
+}
+
+// A part's stock changed; oldQuantity is -1 for a new part
+void recordPartQuantity(int oldQuantity, int newQuantity) {
+    if (oldQuantity < 0) {
+        dashboardStats.totalParts++;
+    } else {
+        countPartStock(oldQuantity, -1);
+    }
+    countPartStock(newQuantity, 1);
+}
+
+void recordAppointment(const ServiceAppointment* appointment) {
+    dashboardStats.totalAppointments++;
+    if (strcmp(appointment->status, "Completed") != 0) dashboardStats.activeAppointments++;
+}
+
+/**
+ * Apply a check-in or check-out to the parking spaces and the views;
+ * returns the space number, or 0 when parking is full or the car is not
+ * parked
+ */
+int recordParking(ParkingRecord parking) {
+    if (parking.isParked) {
+        for (int i = 0; i < MAX_PARKING; i++) {
+            if (!parkingSpaces[i].isParked) {
+                parkingSpaces[i] = parking;
+                dashboardStats.parkedCars++;
+                return i + 1;
+            }
+        }
+        return 0;
+    }
+
+    int space = findParkedCar(parking.licensePlate);
+    if (space < 0) return 0;
+
+    parkingSpaces[space].isParked = 0;
+    dashboardStats.parkedCars--;
+    recordRevenue(parking.fee, parking.exitAt);
+    return space + 1;
+}
+
+void recordActivity(const char* text) {
+    time_t now = time(NULL);
+    struct tm tm = *localtime(&now);
+
+    snprintf(recentActivity[activityCount % ACTIVITY_LOG_SIZE], sizeof(recentActivity[0]),
+             "%02d:%02d - %s", tm.tm_hour, tm.tm_min, text);
+    activityCount++;
+}
+
+/**
+ * Build the views from the data files; called once at startup
+ */
+void loadDashboardData() {
+    char line[256];
+    FILE* file;
+
+    startedAt = time(NULL);
+    refreshDashboardStats();
+
+    for (int i = 0; i < userCount; i++) recordUser(&users[i]);
+
+    file = fopen(PARTS_FILE, "r");
+    if (file != NULL) {
+        while (fgets(line, sizeof(line), file) && partCount < MAX_PARTS) {
+            Part part = {0};
+            if (sscanf(line, "%49[^|]|%d|%lf|%49[^\n]", part.partName, &part.quantity,
+                       &part.price, part.supplier) >= 3) {
+                parts[partCount++] = part;
+                recordPartQuantity(-1, part.quantity);
+            }
+        }
+        fclose(file);
+    }
+
+    file = fopen(APPOINTMENTS_FILE, "r");
+    if (file != NULL) {
+        while (fgets(line, sizeof(line), file)) {
+            ServiceAppointment appointment = {0};
+            if (sscanf(line, "%49[^|]|%99[^|]|%19[^|]|%9[^|]|%19[^\n]", appointment.customerUsername,
+                       appointment.serviceType, appointment.date, appointment.time,
+                       appointment.status) == 5) {
+                if (appointmentCount < MAX_APPOINTMENTS) appointments[appointmentCount++] = appointment;
+                recordAppointment(&appointment);
+            }
+        }
+        fclose(file);
+    }
+
+    file = fopen(PARKING_FILE, "r");
+    if (file != NULL) {
+        while (fgets(line, sizeof(line), file)) {
+            ParkingRecord parking = {0};
+            long entryAt, exitAt;
+            if (sscanf(line, "%19s %ld %ld %d %lf", parking.licensePlate, &entryAt, &exitAt,
+                       &parking.isParked, &parking.fee) == 5) {
+                parking.entryAt = (time_t)entryAt;
+                parking.exitAt = (time_t)exitAt;
+                strftime(parking.entryTime, sizeof(parking.entryTime), "%Y-%m-%d %H:%M",
+                         localtime(&parking.entryAt));
+                recordParking(parking);
+            }
+        }
+        fclose(file);
+    }
+}
+
 // --- Dashboard Implementation ---
 
 void printDashboardHeader(const char* title) {
@@ -843,8 +1285,17 @@ void printSeparatorLine() {
     printf("\n");
 }
 
+// One 21-column statistics table cell, centered
+void printStatCell(const char* text) {
+    int length = (int)strlen(text);
+    int left = (21 - length) / 2;
+    if (left < 0) left = 0;
+    printf("│%*s%s%*s", left, "", text, 21 - left - length > 0 ? 21 - left - length : 0, "");
+}
+
 void drawProgressBar(int current, int max, int width) {
-    int filled = (current * width) / max;
+    int filled = max > 0 ? (current * width) / max : 0;
+    if (filled > width) filled = width;
     printf("[");
     for (int i = 0; i < width; i++) {
         if (i < filled) {
@@ -870,13 +1321,22 @@ void displayMainDashboard() {
     printSeparatorLine();
     
     // Quick Stats Section
+    refreshDashboardStats();
+    char cell[6][32];
+    snprintf(cell[0], sizeof(cell[0]), "%d", dashboardStats.totalCustomers);
+    snprintf(cell[1], sizeof(cell[1]), "%d", dashboardStats.parkedCars);
+    snprintf(cell[2], sizeof(cell[2]), "%d", dashboardStats.activeAppointments);
+    snprintf(cell[3], sizeof(cell[3]), "$%.2f", dashboardStats.dailyRevenue);
+    snprintf(cell[4], sizeof(cell[4]), "%d", dashboardStats.totalAppointments);
+    snprintf(cell[5], sizeof(cell[5]), "%d", dashboardStats.mechanicsOnDuty);
+
     printf("📊 QUICK STATISTICS\n");
     printf("┌─────────────────────┬─────────────────────┬─────────────────────┐\n");
     printf("│ 👥 Total Customers  │ 🚗 Parked Cars      │ 🔧 Active Services  │\n");
-    printf("│        25           │        12           │         8           │\n");
+    printStatCell(cell[0]); printStatCell(cell[1]); printStatCell(cell[2]); printf("│\n");
     printf("├─────────────────────┼─────────────────────┼─────────────────────┤\n");
     printf("│ 💰 Today's Revenue  │ 📋 Appointments     │ 👨‍🔧 Mechanics        │\n");
-    printf("│      $1,250         │         15          │         4           │\n");
+    printStatCell(cell[3]); printStatCell(cell[4]); printStatCell(cell[5]); printf("│\n");
     printf("└─────────────────────┴─────────────────────┴─────────────────────┘\n");
     
     printSeparatorLine();
@@ -884,33 +1344,33 @@ void displayMainDashboard() {
     // Capacity Indicators
     printf("📈 CAPACITY INDICATORS\n");
     printf("Parking Spaces: ");
-    drawProgressBar(12, 50, 30);
-    printf(" (24%% Full)\n");
+    drawProgressBar(dashboardStats.parkedCars, MAX_PARKING, 30);
+    printf(" (%d%% Full)\n", dashboardStats.parkedCars * 100 / MAX_PARKING);
     
     printf("Service Bays:   ");
-    drawProgressBar(8, 10, 30);
-    printf(" (80%% Busy)\n");
+    drawProgressBar(dashboardStats.activeAppointments, SERVICE_BAYS, 30);
+    printf(" (%d%% Busy)\n", dashboardStats.activeAppointments * 100 / SERVICE_BAYS);
     
     printf("Parts Stock:    ");
-    drawProgressBar(45, 60, 30);
-    printf(" (75%% Stocked)\n");
+    drawProgressBar(dashboardStats.availableParts, dashboardStats.totalParts, 30);
+    printf(" (%d%% Stocked)\n", dashboardStats.totalParts > 0 ? dashboardStats.availableParts * 100 / dashboardStats.totalParts : 0);
     
     printSeparatorLine();
     
-    // Recent Activity
+    // Recent Activity, newest first
     printf("📋 RECENT ACTIVITY\n");
-    printf("• 10:30 - Customer 'john_doe' checked in car ABC123\n");
-    printf("• 10:15 - Oil change completed for car XYZ789\n");
-    printf("• 09:45 - New appointment booked for brake service\n");
-    printf("• 09:30 - Parts order received: Brake Pads x20\n");
-    printf("• 09:00 - Mechanic 'mike_tech' started shift\n");
+    for (int i = 1; i <= ACTIVITY_LOG_SIZE && i <= activityCount; i++) {
+        printf("• %s\n", recentActivity[(activityCount - i) % ACTIVITY_LOG_SIZE]);
+    }
+    if (activityCount == 0) printf("• No activity since the system started\n");
     
     printSeparatorLine();
     
     // System Status
+    long uptime = (long)difftime(time(NULL), startedAt) / 60;
     printf("🔧 SYSTEM STATUS\n");
-    printf("Database: 🟢 Online | Backup: 🟢 Up to date | Network: 🟢 Connected\n");
-    printf("Last Backup: 2025-07-26 08:00 | Uptime: 15h 23m\n");
+    printf("Database: 🟢 Online | Network: 🟢 Connected\n");
+    printf("Uptime: %ldh %ldm\n", uptime / 60, uptime % 60);
     
     printf("\nPress Enter to continue...");
     getchar();
@@ -968,19 +1428,31 @@ void displayMechanicDashboard() {
     printSeparatorLine();
     
     // Today's Workload
+    refreshDashboardStats();
+    char cell[3][32];
+    snprintf(cell[0], sizeof(cell[0]), "%d", dashboardStats.totalAppointments - dashboardStats.activeAppointments);
+    snprintf(cell[1], sizeof(cell[1]), "%d", dashboardStats.activeAppointments);
+    snprintf(cell[2], sizeof(cell[2]), "%.1f", dashboardStats.mechanicsOnDuty > 0
+             ? (double)dashboardStats.activeAppointments / dashboardStats.mechanicsOnDuty : 0.0);
+
     printf("📋 TODAY'S WORKLOAD\n");
     printf("┌─────────────────────┬─────────────────────┬─────────────────────┐\n");
-    printf("│ ✅ Completed Jobs   │ 🔄 In Progress      │ ⏳ Pending Jobs     │\n");
-    printf("│         5           │         3           │         7           │\n");
+    printf("│ ✅ Completed Jobs   │ ⏳ Pending Jobs     │ 🔧 Jobs / Mechanic  │\n");
+    printStatCell(cell[0]); printStatCell(cell[1]); printStatCell(cell[2]); printf("│\n");
     printf("└─────────────────────┴─────────────────────┴─────────────────────┘\n");
     
     printSeparatorLine();
     
-    // Current Assignments
+    // Current Assignments: the open appointments, first booked first
     printf("🔧 CURRENT ASSIGNMENTS\n");
-    printf("• Bay 1: Engine Diagnostics (Car DEF456) - 45 min remaining\n");
-    printf("• Bay 2: Brake Repair (Car GHI789) - 1h 20m remaining\n");
-    printf("• Bay 3: Oil Change (Car JKL012) - 15 min remaining\n");
+    int shown = 0;
+    for (int i = 0; i < appointmentCount && shown < 3; i++) {
+        if (strcmp(appointments[i].status, "Completed") == 0) continue;
+        printf("• Bay %d: %s (%s) - %s %s\n", shown + 1, appointments[i].serviceType,
+               appointments[i].customerUsername, appointments[i].date, appointments[i].time);
+        shown++;
+    }
+    if (shown == 0) printf("• No open jobs\n");
     
     printSeparatorLine();
     
@@ -995,10 +1467,16 @@ void displayMechanicDashboard() {
     
     // Parts Needed
     printf("📦 PARTS NEEDED TODAY\n");
-    printf("• Brake Pads (2 sets) - Available\n");
-    printf("• Engine Oil (5 liters) - Available\n");
-    printf("• Air Filter (3 units) - ⚠️ Low Stock\n");
-    printf("• Spark Plugs (1 set) - 🔴 Out of Stock\n");
+    for (int i = 0; i < partCount; i++) {
+        if (parts[i].quantity == 0) {
+            printf("• %s - 🔴 Out of Stock\n", parts[i].partName);
+        } else if (parts[i].quantity <= LOW_STOCK_LEVEL) {
+            printf("• %s (%d left) - ⚠️ Low Stock\n", parts[i].partName, parts[i].quantity);
+        }
+    }
+    if (dashboardStats.outOfStockParts + dashboardStats.lowStockParts == 0) {
+        printf("• All parts in stock\n");
+    }
     
     printf("\nPress Enter to continue...");
     getchar();
@@ -1013,53 +1491,75 @@ void displayAdminDashboard() {
     printSeparatorLine();
     
     // Business Overview
+    refreshDashboardStats();
+    char cell[6][32];
+    snprintf(cell[0], sizeof(cell[0]), "$%.2f", dashboardStats.dailyRevenue);
+    snprintf(cell[1], sizeof(cell[1]), "$%.2f", dashboardStats.monthlyRevenue);
+    snprintf(cell[2], sizeof(cell[2]), "$%.2f", dashboardStats.ytdRevenue);
+    snprintf(cell[3], sizeof(cell[3]), "%d", dashboardStats.totalCustomers);
+    snprintf(cell[4], sizeof(cell[4]), "%d", dashboardStats.totalAppointments);
+    snprintf(cell[5], sizeof(cell[5]), "%d", dashboardStats.mechanicsOnDuty);
+
     printf("💼 BUSINESS OVERVIEW\n");
     printf("┌─────────────────────┬─────────────────────┬─────────────────────┐\n");
     printf("│ 📈 Daily Revenue    │ 📊 Monthly Revenue  │ 📅 YTD Revenue      │\n");
-    printf("│      $1,250         │      $28,500        │     $185,000        │\n");
+    printStatCell(cell[0]); printStatCell(cell[1]); printStatCell(cell[2]); printf("│\n");
     printf("├─────────────────────┼─────────────────────┼─────────────────────┤\n");
-    printf("│ 👥 Total Customers  │ 🚗 Cars Serviced   │ ⭐ Avg Rating       │\n");
-    printf("│        156          │        1,250        │       4.8/5         │\n");
+    printf("│ 👥 Total Customers  │ 📋 Appointments     │ 👨‍🔧 Mechanics        │\n");
+    printStatCell(cell[3]); printStatCell(cell[4]); printStatCell(cell[5]); printf("│\n");
     printf("└─────────────────────┴─────────────────────┴─────────────────────┘\n");
     
     printSeparatorLine();
     
     // Department Status
+    int staffCapacity = dashboardStats.mechanicsOnDuty * JOBS_PER_MECHANIC;
     printf("🏢 DEPARTMENT STATUS\n");
     printf("Service Department: ");
-    drawProgressBar(8, 10, 20);
-    printf(" (80%% Capacity)\n");
+    drawProgressBar(dashboardStats.activeAppointments, SERVICE_BAYS, 20);
+    printf(" (%d%% Capacity)\n", dashboardStats.activeAppointments * 100 / SERVICE_BAYS);
     
     printf("Parking Management: ");
-    drawProgressBar(12, 50, 20);
-    printf(" (24%% Occupied)\n");
+    drawProgressBar(dashboardStats.parkedCars, MAX_PARKING, 20);
+    printf(" (%d%% Occupied)\n", dashboardStats.parkedCars * 100 / MAX_PARKING);
     
     printf("Parts Inventory:    ");
-    drawProgressBar(45, 60, 20);
-    printf(" (75%% Stocked)\n");
+    drawProgressBar(dashboardStats.availableParts, dashboardStats.totalParts, 20);
+    printf(" (%d%% Stocked)\n", dashboardStats.totalParts > 0 ? dashboardStats.availableParts * 100 / dashboardStats.totalParts : 0);
     
-    printf("Staff on Duty:      ");
-    drawProgressBar(8, 12, 20);
-    printf(" (67%% Staffed)\n");
+    printf("Staff Load:         ");
+    drawProgressBar(dashboardStats.activeAppointments, staffCapacity, 20);
+    printf(" (%d%% Loaded)\n", staffCapacity > 0 ? dashboardStats.activeAppointments * 100 / staffCapacity : 0);
     
     printSeparatorLine();
     
     // Financial Summary
     printf("💰 FINANCIAL SUMMARY\n");
-    printf("• Service Revenue: $950 (76%%)\n");
-    printf("• Parking Revenue: $200 (16%%)\n");
-    printf("• Parts Revenue: $100 (8%%)\n");
-    printf("• Operating Costs: $400\n");
-    printf("• Net Profit: $850\n");
+    printf("• Parking Revenue Today: $%.2f from %d cars\n", dashboardStats.dailyRevenue, dashboardStats.dailyPayments);
+    printf("• Average Ticket Today: $%.2f\n", dashboardStats.dailyPayments > 0
+           ? dashboardStats.dailyRevenue / dashboardStats.dailyPayments : 0.0);
+    printf("• All-Time Revenue: $%.2f\n", dashboardStats.totalRevenue);
     
     printSeparatorLine();
     
     // Alerts & Notifications
     printf("🚨 ALERTS & NOTIFICATIONS\n");
-    printf("⚠️ Spark Plugs out of stock - Order required\n");
-    printf("⚠️ Service Bay 4 - Equipment maintenance due\n");
-    printf("🔔 5 customer feedback forms pending review\n");
-    printf("🔔 Monthly report generation scheduled for tomorrow\n");
+    for (int i = 0; i < partCount; i++) {
+        if (parts[i].quantity == 0) printf("⚠️ %s out of stock - Order required\n", parts[i].partName);
+    }
+    if (dashboardStats.lowStockParts > 0) {
+        printf("🔔 %d parts running low on stock\n", dashboardStats.lowStockParts);
+    }
+    if (dashboardStats.parkedCars * 10 >= MAX_PARKING * 9) {
+        printf("⚠️ Parking is %d%% full\n", dashboardStats.parkedCars * 100 / MAX_PARKING);
+    }
+    if (staffCapacity > 0 && dashboardStats.activeAppointments > staffCapacity) {
+        printf("⚠️ Mechanics are overbooked\n");
+    }
+    if (dashboardStats.outOfStockParts + dashboardStats.lowStockParts == 0
+        && dashboardStats.parkedCars * 10 < MAX_PARKING * 9
+        && (staffCapacity == 0 || dashboardStats.activeAppointments <= staffCapacity)) {
+        printf("✅ No alerts\n");
+    }
     
     printf("\nPress Enter to continue...");
     getchar();
@@ -1070,6 +1570,9 @@ int main() {
     // Load existing users from file
     loadUsersFromFile();
     
+    // Build the dashboard views from the data files
+    loadDashboardData();
+    
     // Start the main menu
     mainMenu();
     
@@ -1088,6 +1591,7 @@ PARKIFY: ONE STOP SOLUTION TO YOUR CAR - COMPLETE SYSTEM FEATURES
    - New user registration with role selection (Customer/Admin/Mechanic)
    - Secure login system with username/password validation
    - Role-based access control and personalized menus
+   - Any number of accounts, looked up by username through a hash index
 
 2. Car Management:
    - Add new cars with license plate, model, color, and year
@@ -1133,8 +1637,14 @@ PARKIFY: ONE STOP SOLUTION TO YOUR CAR - COMPLETE SYSTEM FEATURES
 
 10. File System Integration:
     - User data persistence (users.dat)
-    - Appointment records storage
-    - Parts inventory tracking
+    - Appointment records storage (appointments.dat)
+    - Parking check-ins and check-outs with fees (parking.dat)
+    - Parts inventory tracking (parts.dat)
+
+11. Live Dashboards:
+    - Figures kept up to date by every booking, check-in/out and parts change
+    - Daily, monthly and YTD revenue, parking occupancy, stock coverage
+      and staff load without rescanning the data files
 
 🎯 WELCOME MESSAGE: "PARKIFY: ONE STOP SOLUTION TO YOUR CAR"
 
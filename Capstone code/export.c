@@ -0,0 +1,396 @@
+/**
+ * export.c - CSV and JSON report export for the Smart Garage system
+ *
+ * Rows are written into one fixed buffer that goes to disk with a single
+ * fwrite() whenever it fills, instead of a formatted write per field.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "garage.h"
+#include "customers.h"
+#include "export.h"
+
+#define EXPORT_BUFFER_SIZE 65536
+#define MAX_PAYMENT_METHODS 16
+
+// Buffered output for one export file
+typedef struct {
+    FILE *file;
+    ExportFormat format;
+    const char *const *columns;
+    int column_count;
+    int column;                 // Next column of the current row
+    int rows;
+    int failed;
+    size_t used;
+    char buffer[EXPORT_BUFFER_SIZE];
+} ExportWriter;
+
+// One export runs at a time; the buffer is kept off the stack
+static ExportWriter output;
+
+// ==================== BUFFERED WRITER ====================
+
+static void flush_buffer(ExportWriter *writer) {
+    if (writer->used > 0 && fwrite(writer->buffer, 1, writer->used, writer->file) != writer->used) {
+        writer->failed = 1;
+    }
+    writer->used = 0;
+}
+
+static void put(ExportWriter *writer, const char *text, size_t length) {
+    while (length > 0) {
+        size_t space = EXPORT_BUFFER_SIZE - writer->used;
+        size_t chunk = length < space ? length : space;
+
+        memcpy(writer->buffer + writer->used, text, chunk);
+        writer->used += chunk;
+        text += chunk;
+        length -= chunk;
+
+        if (writer->used == EXPORT_BUFFER_SIZE) flush_buffer(writer);
+    }
+}
+
+static void put_text(ExportWriter *writer, const char *text) {
+    put(writer, text, strlen(text));
+}
+
+static void put_char(ExportWriter *writer, char ch) {
+    put(writer, &ch, 1);
+}
+
+/**
+ * Quote a CSV value only when it holds a separator, quote or line break
+ */
+static void put_csv_value(ExportWriter *writer, const char *value) {
+    if (!strpbrk(value, ",\"\r\n")) {
+        put_text(writer, value);
+        return;
+    }
+
+    put_char(writer, '"');
+    for (const char *p = value; *p; p++) {
+        if (*p == '"') put_char(writer, '"');
+        put_char(writer, *p);
+    }
+    put_char(writer, '"');
+}
+
+static void put_json_string(ExportWriter *writer, const char *value) {
+    char escaped[8];
+
+    put_char(writer, '"');
+    for (const char *p = value; *p; p++) {
+        unsigned char ch = (unsigned char)*p;
+
+        if (ch == '"' || ch == '\\') {
+            put_char(writer, '\\');
+            put_char(writer, (char)ch);
+        } else if (ch < 0x20) {
+            snprintf(escaped, sizeof(escaped), "\\u%04x", ch);
+            put_text(writer, escaped);
+        } else {
+            put_char(writer, (char)ch);
+        }
+    }
+    put_char(writer, '"');
+}
+
+/**
+ * Create the output file and write the CSV header line or JSON opening
+ */
+static int writer_open(ExportWriter *writer, const char *path, ExportFormat format,
+                       const char *const *columns, int column_count) {
+    writer->file = fopen(path, "w");
+    if (!writer->file) return 0;
+
+    writer->format = format;
+    writer->columns = columns;
+    writer->column_count = column_count;
+    writer->column = 0;
+    writer->rows = 0;
+    writer->failed = 0;
+    writer->used = 0;
+
+    if (format == EXPORT_CSV) {
+        for (int i = 0; i < column_count; i++) {
+            if (i > 0) put_char(writer, ',');
+            put_text(writer, columns[i]);
+        }
+        put_char(writer, '\n');
+    } else {
+        put_char(writer, '[');
+    }
+    return 1;
+}
+
+static void begin_row(ExportWriter *writer) {
+    if (writer->format == EXPORT_JSON) {
+        put_text(writer, writer->rows > 0 ? ",\n  {" : "\n  {");
+    }
+    writer->column = 0;
+}
+
+/**
+ * Separator and (for JSON) key before the next value of the row
+ */
+static void begin_field(ExportWriter *writer) {
+    if (writer->format == EXPORT_CSV) {
+        if (writer->column > 0) put_char(writer, ',');
+    } else {
+        if (writer->column > 0) put_text(writer, ", ");
+        put_json_string(writer, writer->columns[writer->column]);
+        put_text(writer, ": ");
+    }
+    writer->column++;
+}
+
+static void field_text(ExportWriter *writer, const char *value) {
+    begin_field(writer);
+    if (writer->format == EXPORT_CSV) put_csv_value(writer, value);
+    else put_json_string(writer, value);
+}
+
+static void field_int(ExportWriter *writer, long value) {
+    char number[24];
+    snprintf(number, sizeof(number), "%ld", value);
+    begin_field(writer);
+    put_text(writer, number);
+}
+
+static void field_money(ExportWriter *writer, double value) {
+    char number[32];
+    snprintf(number, sizeof(number), "%.2f", value);
+    begin_field(writer);
+    put_text(writer, number);
+}
+
+static void end_row(ExportWriter *writer) {
+    put_char(writer, writer->format == EXPORT_CSV ? '\n' : '}');
+    writer->rows++;
+}
+
+/**
+ * Finish the file; returns the row count or EXPORT_WRITE_FAILED
+ */
+static int writer_close(ExportWriter *writer) {
+    if (writer->format == EXPORT_JSON) {
+        put_text(writer, writer->rows > 0 ? "\n]\n" : "]\n");
+    }
+    flush_buffer(writer);
+    if (fclose(writer->file) != 0) writer->failed = 1;
+
+    return writer->failed ? EXPORT_WRITE_FAILED : writer->rows;
+}
+
+// ==================== HELPERS ====================
+
+const char *export_extension(ExportFormat format) {
+    return format == EXPORT_CSV ? "csv" : "json";
+}
+
+static int in_range(long date_key, long from_date, long to_date) {
+    if (from_date == 0 && to_date == 0) return 1;
+    if (date_key == 0) return 0;
+    if (from_date != 0 && date_key < from_date) return 0;
+    if (to_date != 0 && date_key > to_date) return 0;
+    return 1;
+}
+
+// State shared by the date-filtered exports
+typedef struct {
+    ExportWriter *writer;
+    long from_date;
+    long to_date;
+} RangeExport;
+
+// ==================== ORDERS ====================
+
+static int write_order(const GarageOrder *order, void *context) {
+    RangeExport *ctx = context;
+    long date_key = garage_order_date_key(order);
+    char date[GARAGE_DATE_TEXT];
+
+    if (!in_range(date_key, ctx->from_date, ctx->to_date)) return 0;
+    if (date_key) garage_format_date_key(date_key, date, sizeof(date));
+    else date[0] = '\0'; // Legacy order: empty cell
+
+    begin_row(ctx->writer);
+    field_text(ctx->writer, order->username);
+    field_text(ctx->writer, order->part);
+    field_int(ctx->writer, order->quantity);
+    field_money(ctx->writer, order->total);
+    field_text(ctx->writer, order->payment);
+    field_text(ctx->writer, date);
+    field_text(ctx->writer, order->date_time);
+    end_row(ctx->writer);
+    return 0;
+}
+
+int export_orders(const char *path, ExportFormat format, long from_date, long to_date) {
+    static const char *const columns[] = {
+        "username", "part", "quantity", "total", "payment", "date", "ordered_at"
+    };
+    RangeExport ctx = {&output, from_date, to_date};
+
+    if (!garage_has_file(ORDERS_FILE)) return EXPORT_NO_SOURCE;
+    if (!writer_open(&output, path, format, columns, 7)) return EXPORT_WRITE_FAILED;
+
+    garage_for_each_order(write_order, &ctx);
+    return writer_close(&output);
+}
+
+// ==================== REVENUE BY PAYMENT ====================
+
+typedef struct {
+    char method[20];
+    long orders;
+    double revenue;
+} PaymentTotal;
+
+typedef struct {
+    PaymentTotal totals[MAX_PAYMENT_METHODS];
+    int count;
+    long from_date;
+    long to_date;
+} PaymentTotals;
+
+static int add_payment(const GarageOrder *order, void *context) {
+    PaymentTotals *ctx = context;
+    const char *method = order->payment;
+    int i;
+
+    if (!in_range(garage_order_date_key(order), ctx->from_date, ctx->to_date)) return 0;
+
+    for (i = 0; i < ctx->count; i++) {
+        if (strcmp(ctx->totals[i].method, method) == 0) break;
+    }
+
+    if (i == ctx->count) {
+        // Unexpected payment values beyond the table share the last slot
+        if (ctx->count == MAX_PAYMENT_METHODS) {
+            i = MAX_PAYMENT_METHODS - 1;
+            strcpy(ctx->totals[i].method, "Other");
+        } else {
+            snprintf(ctx->totals[i].method, sizeof(ctx->totals[i].method), "%s", method);
+            ctx->count++;
+        }
+    }
+
+    ctx->totals[i].orders++;
+    ctx->totals[i].revenue += order->total;
+    return 0;
+}
+
+int export_revenue_by_payment(const char *path, ExportFormat format, long from_date, long to_date) {
+    static const char *const columns[] = {"payment", "orders", "revenue"};
+    PaymentTotals totals;
+
+    if (!garage_has_file(ORDERS_FILE)) return EXPORT_NO_SOURCE;
+
+    memset(&totals, 0, sizeof(totals));
+    totals.from_date = from_date;
+    totals.to_date = to_date;
+    garage_for_each_order(add_payment, &totals);
+
+    if (!writer_open(&output, path, format, columns, 3)) return EXPORT_WRITE_FAILED;
+    for (int i = 0; i < totals.count; i++) {
+        begin_row(&output);
+        field_text(&output, totals.totals[i].method);
+        field_int(&output, totals.totals[i].orders);
+        field_money(&output, totals.totals[i].revenue);
+        end_row(&output);
+    }
+    return writer_close(&output);
+}
+
+// ==================== LOYALTY ====================
+
+static int write_loyalty(const GarageLoyalty *account, void *context) {
+    ExportWriter *writer = context;
+
+    begin_row(writer);
+    field_text(writer, account->username);
+    field_int(writer, account->points);
+    end_row(writer);
+    return 0;
+}
+
+int export_loyalty_balances(const char *path, ExportFormat format) {
+    static const char *const columns[] = {"username", "points"};
+
+    if (!garage_has_file(LOYALTY_POINTS_FILE)) return EXPORT_NO_SOURCE;
+    if (!writer_open(&output, path, format, columns, 2)) return EXPORT_WRITE_FAILED;
+
+    garage_for_each_loyalty(write_loyalty, &output);
+    return writer_close(&output);
+}
+
+// ==================== PARKING ====================
+
+static int write_parking(const GarageParking *parking, void *context) {
+    RangeExport *ctx = context;
+
+    if (!in_range(garage_date_key(parking->date), ctx->from_date, ctx->to_date)) return 0;
+
+    begin_row(ctx->writer);
+    field_text(ctx->writer, parking->username);
+    field_text(ctx->writer, parking->car_number);
+    field_text(ctx->writer, parking->date);
+    field_text(ctx->writer, parking->entry_time);
+    field_text(ctx->writer, parking->manufacturer);
+    end_row(ctx->writer);
+    return 0;
+}
+
+int export_parking_log(const char *path, ExportFormat format, long from_date, long to_date) {
+    static const char *const columns[] = {
+        "username", "car_number", "date", "entry_time", "manufacturer"
+    };
+    RangeExport ctx = {&output, from_date, to_date};
+
+    if (!garage_has_file(CAR_PARKING_FILE)) return EXPORT_NO_SOURCE;
+    if (!writer_open(&output, path, format, columns, 5)) return EXPORT_WRITE_FAILED;
+
+    garage_for_each_parking(write_parking, &ctx);
+    return writer_close(&output);
+}
+
+// ==================== CUSTOMERS ====================
+
+static int write_customer(const CustomerView *view, void *context) {
+    ExportWriter *writer = context;
+
+    begin_row(writer);
+    field_text(writer, view->user.username);
+    field_text(writer, view->user.name);
+    field_text(writer, view->user.email);
+    field_text(writer, view->user.phone);
+    field_int(writer, view->order_count);
+    field_money(writer, view->total_spent);
+    field_text(writer, view->last_order);
+    field_int(writer, view->loyalty_points);
+    field_int(writer, view->badge_count);
+    field_int(writer, view->redemptions);
+    field_money(writer, view->discount_total);
+    field_int(writer, view->receipt_count);
+    field_int(writer, view->parking_stays);
+    field_text(writer, view->last_car);
+    end_row(writer);
+    return 0;
+}
+
+int export_customers(const char *path, ExportFormat format) {
+    static const char *const columns[] = {
+        "username", "name", "email", "phone", "orders", "total_spent", "last_order",
+        "loyalty_points", "badges", "redemptions", "discounts", "receipts",
+        "parking_stays", "last_car"
+    };
+
+    if (!garage_has_file(USERS_FILE)) return EXPORT_NO_SOURCE;
+    if (!writer_open(&output, path, format, columns, 14)) return EXPORT_WRITE_FAILED;
+
+    customers_for_each(write_customer, &output);
+    return writer_close(&output);
+}
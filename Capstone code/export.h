@@ -0,0 +1,47 @@
+/**
+ * export.h - CSV and JSON report export for the Smart Garage system
+ *
+ * Each export streams its source file through the garage_for_each_* scans
+ * and writes rows through a fixed size output buffer, so memory use stays
+ * the same however many rows are exported and nothing is drawn on screen.
+ *
+ * Date ranges are YYYYMMDD keys (see garage_date_key); 0 leaves that end
+ * open. Legacy orders carry no date, so any range excludes them.
+ *
+ * Usage:
+ *   int rows = export_orders("orders.csv", EXPORT_CSV, 20250801, 20250831);
+ *   if (rows < 0) {
+ *       // source missing (EXPORT_NO_SOURCE) or output not written (EXPORT_WRITE_FAILED)
+ *   }
+ */
+#ifndef EXPORT_H
+#define EXPORT_H
+
+typedef enum {
+    EXPORT_CSV,
+    EXPORT_JSON
+} ExportFormat;
+
+// Negative results of the export functions
+#define EXPORT_NO_SOURCE -1
+#define EXPORT_WRITE_FAILED -2
+
+// File extension for a format, without the dot
+const char *export_extension(ExportFormat format);
+
+// Each returns the number of rows written, or one of the errors above
+
+// username, part, quantity, total, payment, date, ordered_at
+int export_orders(const char *path, ExportFormat format, long from_date, long to_date);
+// payment, orders, revenue (one row per payment method)
+int export_revenue_by_payment(const char *path, ExportFormat format, long from_date, long to_date);
+// username, points
+int export_loyalty_balances(const char *path, ExportFormat format);
+// username, car_number, date, entry_time, manufacturer
+int export_parking_log(const char *path, ExportFormat format, long from_date, long to_date);
+// username, name, email, phone, orders, total_spent, last_order, loyalty_points,
+// badges, redemptions, discounts, receipts, parking_stays, last_car
+// (one row per customer, see customers.h)
+int export_customers(const char *path, ExportFormat format);
+
+#endif
@@ -0,0 +1,809 @@
+/**
+ * garage.c - Core data API for the Smart Garage system (libgarage)
+ *
+ * Every file is read line by line: a malformed or blank line only skips
+ * that record instead of throwing the rest of the file out of step, and
+ * Windows line endings are accepted on any platform.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include <sys/stat.h>
+#include "garage.h"
+#include "platform.h"
+
+#define MAX_FIELDS 16
+#define TABLE_MIN_SLOTS 64
+#define FINGERPRINT_BYTES 64
+#define LOYALTY_TEMP_FILE "temp_loyalty.txt"
+#define LOYALTY_LOCK_FILE "loyalty_points.lock" // loyalty_points.txt is replaced on every change
+
+// A whitespace separated field inside a line (not NUL terminated)
+typedef struct {
+    const char *start;
+    int length;
+} Field;
+
+// ==================== LINE HELPERS ====================
+
+/**
+ * Split a line into whitespace separated fields; returns the field count
+ */
+static int split_fields(const char *line, Field fields[], int max_fields) {
+    int count = 0;
+    const char *p = line;
+
+    while (*p && count < max_fields) {
+        while (*p && isspace((unsigned char)*p)) p++;
+        if (!*p) break;
+
+        fields[count].start = p;
+        while (*p && !isspace((unsigned char)*p)) p++;
+        fields[count].length = (int)(p - fields[count].start);
+        count++;
+    }
+    return count;
+}
+
+/**
+ * Copy the text from the start of one field to the end of another,
+ * keeping the spacing in between (names, dates)
+ */
+static void copy_text(char *dest, size_t size, const char *start, size_t length) {
+    if (length >= size) length = size - 1;
+    memcpy(dest, start, length);
+    dest[length] = '\0';
+}
+
+static void copy_span(char *dest, size_t size, const Field *first, const Field *last) {
+    copy_text(dest, size, first->start, (size_t)(last->start + last->length - first->start));
+}
+
+static void copy_field(char *dest, size_t size, const Field *field) {
+    copy_span(dest, size, field, field);
+}
+
+/**
+ * Copy everything from a field to the end of the line, minus the line ending
+ */
+static void copy_rest(char *dest, size_t size, const Field *first) {
+    size_t length = strlen(first->start);
+    while (length > 0 && isspace((unsigned char)first->start[length - 1])) length--;
+    if (length >= size) length = size - 1;
+    memcpy(dest, first->start, length);
+    dest[length] = '\0';
+}
+
+static int field_is_number(const Field *field) {
+    int i = 0;
+    if (field->length > 0 && (field->start[0] == '-' || field->start[0] == '+')) i++;
+    if (i == field->length) return 0;
+    for (; i < field->length; i++) {
+        if (!isdigit((unsigned char)field->start[i]) && field->start[i] != '.') return 0;
+    }
+    return 1;
+}
+
+static int split_record(const char *line, Field fields[]) {
+    int count = split_fields(line, fields, MAX_FIELDS);
+    if (count > 0 && fields[0].start[0] == '#') return 0; // Header comment
+    return count;
+}
+
+unsigned long garage_hash(const char *text) {
+    unsigned long hash = 2166136261UL;
+    while (*text) {
+        hash ^= (unsigned char)*text++;
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+int garage_has_file(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) return 0;
+    fclose(f);
+    return 1;
+}
+
+int garage_file_changed(const char *path, GarageFileStamp *stamp) {
+    struct stat info;
+    long size = -1, mtime = 0;
+
+    if (stat(path, &info) == 0) {
+        size = (long)info.st_size;
+        mtime = (long)info.st_mtime;
+    }
+    if (stamp->seen && size == stamp->size && mtime == stamp->mtime) return 0;
+
+    stamp->size = size;
+    stamp->mtime = mtime;
+    stamp->seen = 1;
+    return 1;
+}
+
+// ==================== TABLES ====================
+
+void *garage_table_at(const GarageTable *table, int index) {
+    return table->items + (size_t)index * table->stride;
+}
+
+int garage_table_find(const GarageTable *table, const char *key) {
+    if (!table->slots) return -1;
+
+    unsigned long mask = (unsigned long)(table->slot_count - 1);
+    unsigned long slot = garage_hash(key) & mask;
+
+    while (table->slots[slot]) {
+        int index = table->slots[slot] - 1;
+        if (strcmp(garage_table_at(table, index), key) == 0) return index;
+        slot = (slot + 1) & mask;
+    }
+    return -1;
+}
+
+static void put_slot(GarageTable *table, int index) {
+    unsigned long mask = (unsigned long)(table->slot_count - 1);
+    unsigned long slot = garage_hash(garage_table_at(table, index)) & mask;
+    while (table->slots[slot]) slot = (slot + 1) & mask;
+    table->slots[slot] = index + 1;
+}
+
+void *garage_table_add(GarageTable *table, const char *key, size_t key_size) {
+    if (!table->slots || (table->count + 1) * 4 > table->slot_count * 3) {
+        int slot_count = table->slot_count ? table->slot_count * 2 : TABLE_MIN_SLOTS;
+        int *slots = calloc((size_t)slot_count, sizeof(int));
+        if (!slots) return NULL;
+
+        free(table->slots);
+        table->slots = slots;
+        table->slot_count = slot_count;
+        for (int i = 0; i < table->count; i++) put_slot(table, i);
+    }
+    if (table->count == table->capacity) {
+        int capacity = table->capacity ? table->capacity * 2 : TABLE_MIN_SLOTS;
+        char *items = realloc(table->items, (size_t)capacity * table->stride);
+        if (!items) return NULL;
+        table->items = items;
+        table->capacity = capacity;
+    }
+
+    char *item = table->items + (size_t)table->count * table->stride;
+    memset(item, 0, table->stride);
+    snprintf(item, key_size, "%s", key);
+    put_slot(table, table->count++);
+    return item;
+}
+
+void garage_table_clear(GarageTable *table) {
+    table->count = 0;
+    if (table->slots) memset(table->slots, 0, (size_t)table->slot_count * sizeof(int));
+}
+
+void garage_table_free(GarageTable *table) {
+    free(table->items);
+    free(table->slots);
+    table->items = NULL;
+    table->slots = NULL;
+    table->count = table->capacity = table->slot_count = 0;
+}
+
+// ==================== APPEND-ONLY FILES ====================
+
+static unsigned long fingerprint_before(FILE *f, long offset) {
+    char last[FINGERPRINT_BYTES + 1];
+    long start = offset > FINGERPRINT_BYTES ? offset - FINGERPRINT_BYTES : 0;
+
+    fseek(f, start, SEEK_SET);
+    size_t length = fread(last, 1, (size_t)(offset - start), f);
+    last[length] = '\0';
+    return garage_hash(last);
+}
+
+void garage_tail_reset(GarageTail *tail) {
+    tail->read = 0;
+    tail->fingerprint = 0;
+}
+
+int garage_tail_rewritten(FILE *f, const GarageTail *tail) {
+    fseek(f, 0, SEEK_END);
+    if (ftell(f) < tail->read) return 1;
+    return tail->read > 0 && fingerprint_before(f, tail->read) != tail->fingerprint;
+}
+
+int garage_tail_changed(const char *path, GarageTail *tail) {
+    if (!garage_file_changed(path, &tail->stamp)) return GARAGE_TAIL_SAME;
+
+    // Appends only ever make the file longer and keep what was read;
+    // anything else is a rewrite
+    long size = tail->stamp.size > 0 ? tail->stamp.size : 0;
+    FILE *f = size > tail->read ? fopen(path, "rb") : NULL;
+    int rewritten = !f || garage_tail_rewritten(f, tail);
+    if (f) fclose(f);
+
+    if (rewritten) {
+        garage_tail_reset(tail);
+        return GARAGE_TAIL_REWRITTEN;
+    }
+    return GARAGE_TAIL_APPENDED;
+}
+
+void garage_tail_read_file(FILE *f, GarageTail *tail, GarageLineReader read, void *context) {
+    char line[GARAGE_LINE_MAX];
+    long offset = tail->read;
+
+    fseek(f, offset, SEEK_SET);
+    while (fgets(line, sizeof(line), f)) {
+        if (!strchr(line, '\n')) {
+            int ch;
+            if (feof(f)) break; // Last line still being written
+            while ((ch = fgetc(f)) != EOF && ch != '\n') {
+            }
+        } else {
+            read(line, offset, context);
+        }
+        offset = ftell(f);
+    }
+
+    if (offset != tail->read) {
+        tail->read = offset;
+        tail->fingerprint = fingerprint_before(f, offset);
+    }
+}
+
+int garage_tail_read(const char *path, GarageTail *tail, GarageLineReader read, void *context) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return 0;
+
+    garage_tail_read_file(f, tail, read, context);
+    fclose(f);
+    return 1;
+}
+
+// ==================== PARSING ====================
+
+int garage_parse_user(const char *line, GarageUser *user) {
+    Field f[MAX_FIELDS];
+    int n = split_record(line, f);
+    if (n < 6) return 0;
+
+    copy_field(user->role, sizeof(user->role), &f[0]);
+    copy_field(user->username, sizeof(user->username), &f[1]);
+    copy_field(user->password, sizeof(user->password), &f[2]);
+    copy_span(user->name, sizeof(user->name), &f[3], &f[n - 3]);
+    copy_field(user->email, sizeof(user->email), &f[n - 2]);
+    copy_field(user->phone, sizeof(user->phone), &f[n - 1]);
+    return 1;
+}
+
+int garage_parse_order(const char *line, GarageOrder *order) {
+    Field f[MAX_FIELDS];
+    int n = split_record(line, f);
+    if (n < 4 || !field_is_number(&f[2]) || !field_is_number(&f[3])) return 0;
+
+    copy_field(order->username, sizeof(order->username), &f[0]);
+    copy_field(order->part, sizeof(order->part), &f[1]);
+    order->quantity = atoi(f[2].start);
+    order->total = (float)atof(f[3].start);
+
+    if (n >= 6) {
+        copy_field(order->payment, sizeof(order->payment), &f[4]);
+        copy_rest(order->date_time, sizeof(order->date_time), &f[5]);
+        order->legacy = 0;
+    } else {
+        strcpy(order->payment, "Cash"); // Old orders default to cash
+        order->date_time[0] = '\0';
+        order->legacy = 1;
+    }
+    return 1;
+}
+
+int garage_parse_part(const char *line, GaragePart *part) {
+    Field f[MAX_FIELDS];
+    int n = split_record(line, f);
+    if (n < 3 || !field_is_number(&f[n - 1])) return 0;
+
+    copy_field(part->name, sizeof(part->name), &f[0]);
+    copy_span(part->spec, sizeof(part->spec), &f[1], &f[n - 2]);
+    part->price = (float)atof(f[n - 1].start);
+    return 1;
+}
+
+int garage_parse_mechanic(const char *line, GarageMechanic *mechanic) {
+    Field f[MAX_FIELDS];
+    int n = split_record(line, f);
+    if (n < 5 || !field_is_number(&f[n - 2])) return 0;
+
+    copy_span(mechanic->name, sizeof(mechanic->name), &f[0], &f[n - 5]);
+    copy_field(mechanic->username, sizeof(mechanic->username), &f[n - 4]);
+    copy_field(mechanic->password, sizeof(mechanic->password), &f[n - 3]);
+    mechanic->age = atoi(f[n - 2].start);
+    copy_field(mechanic->phone, sizeof(mechanic->phone), &f[n - 1]);
+    return 1;
+}
+
+int garage_parse_parking(const char *line, GarageParking *parking) {
+    Field f[MAX_FIELDS];
+    int n = split_record(line, f);
+    if (n < 4) return 0;
+
+    copy_field(parking->username, sizeof(parking->username), &f[0]);
+    copy_field(parking->car_number, sizeof(parking->car_number), &f[1]);
+    copy_field(parking->date, sizeof(parking->date), &f[2]);
+    copy_field(parking->entry_time, sizeof(parking->entry_time), &f[3]);
+    if (n > 4) {
+        copy_rest(parking->manufacturer, sizeof(parking->manufacturer), &f[4]);
+    } else {
+        parking->manufacturer[0] = '\0';
+    }
+    return 1;
+}
+
+int garage_parse_loyalty(const char *line, GarageLoyalty *account) {
+    Field f[MAX_FIELDS];
+    int n = split_record(line, f);
+    if (n < 2 || !field_is_number(&f[1])) return 0;
+
+    copy_field(account->username, sizeof(account->username), &f[0]);
+    account->points = atoi(f[1].start);
+    return 1;
+}
+
+int garage_parse_receipt(const char *line, GarageReceipt *receipt) {
+    const char *start[5];
+    size_t length[5];
+    const char *p = line;
+
+    if (*p == '#' || *p == '\r' || *p == '\n' || *p == '\0') return 0;
+
+    // Pipe separated; the service details run to the end of the line
+    for (int i = 0; i < 5; i++) {
+        const char *end = (i < 4) ? strchr(p, '|') : p + strcspn(p, "\r\n");
+        if (!end) return 0;
+        start[i] = p;
+        length[i] = (size_t)(end - p);
+        p = end + 1;
+    }
+
+    copy_text(receipt->qr_code, sizeof(receipt->qr_code), start[0], length[0]);
+    copy_text(receipt->username, sizeof(receipt->username), start[1], length[1]);
+    copy_text(receipt->date, sizeof(receipt->date), start[2], length[2]);
+    receipt->amount = (float)atof(start[3]);
+    copy_text(receipt->details, sizeof(receipt->details), start[4], length[4]);
+    return 1;
+}
+
+// ==================== DATES ====================
+
+static int month_number(const char *name) {
+    static const char *months = "JanFebMarAprMayJunJulAugSepOctNovDec";
+    const char *found;
+
+    if (strlen(name) != 3) return 0;
+    found = strstr(months, name);
+    return (found && (found - months) % 3 == 0) ? (int)((found - months) / 3) + 1 : 0;
+}
+
+long garage_date_key(const char *text) {
+    int year, month, day;
+    char weekday[8], month_name[8];
+
+    if (!text) return 0;
+    while (isspace((unsigned char)*text)) text++;
+
+    if (sscanf(text, "%4d-%2d-%2d", &year, &month, &day) == 3 ||
+        (sscanf(text, "%2d/%2d/%4d", &day, &month, &year) == 3)) {
+        // YYYY-MM-DD or DD/MM/YYYY
+    } else if (sscanf(text, "%7s %7s %d %*d:%*d:%*d %d", weekday, month_name, &day, &year) == 4) {
+        month = month_number(month_name); // ctime(): "Sun Aug 10 01:05:01 2025"
+    } else {
+        return 0;
+    }
+
+    if (month < 1 || month > 12 || day < 1 || day > 31 || year < 1900) return 0;
+    return (long)year * 10000 + month * 100 + day;
+}
+
+long garage_order_date_key(const GarageOrder *order) {
+    return order->legacy ? 0 : garage_date_key(order->date_time);
+}
+
+void garage_format_date_key(long date_key, char *text, size_t size) {
+    // Four-digit years only, so the text always fits GARAGE_DATE_TEXT
+    if (date_key <= 0 || date_key > 99991231) {
+        snprintf(text, size, "-");
+        return;
+    }
+    int year = (int)(date_key / 10000), month = (int)(date_key / 100 % 100), day = (int)(date_key % 100);
+    snprintf(text, size, "%04d-%02d-%02d", year, month, day);
+}
+
+// ==================== STREAMING ====================
+
+/**
+ * Shared scan loop: parse each line of `path` into a `type` record and hand
+ * it to `visit` (a macro so every visitor keeps its own record type)
+ */
+#define SCAN_FILE(path, type, parse, visit, context) \
+    do { \
+        FILE *f = fopen(path, "r"); \
+        char line[GARAGE_LINE_MAX]; \
+        type record; \
+        int count = 0; \
+        if (!f) return -1; \
+        while (fgets(line, sizeof(line), f)) { \
+            if (!parse(line, &record)) continue; \
+            count++; \
+            if (visit && visit(&record, context)) break; \
+        } \
+        fclose(f); \
+        return count; \
+    } while (0)
+
+int garage_for_each_user(GarageUserVisitor visit, void *context) {
+    SCAN_FILE(USERS_FILE, GarageUser, garage_parse_user, visit, context);
+}
+
+int garage_for_each_order(GarageOrderVisitor visit, void *context) {
+    SCAN_FILE(ORDERS_FILE, GarageOrder, garage_parse_order, visit, context);
+}
+
+int garage_for_each_part(GaragePartVisitor visit, void *context) {
+    SCAN_FILE(PARTS_FILE, GaragePart, garage_parse_part, visit, context);
+}
+
+int garage_for_each_mechanic(GarageMechanicVisitor visit, void *context) {
+    SCAN_FILE(MECHANICS_FILE, GarageMechanic, garage_parse_mechanic, visit, context);
+}
+
+int garage_for_each_parking(GarageParkingVisitor visit, void *context) {
+    SCAN_FILE(CAR_PARKING_FILE, GarageParking, garage_parse_parking, visit, context);
+}
+
+int garage_for_each_loyalty(GarageLoyaltyVisitor visit, void *context) {
+    SCAN_FILE(LOYALTY_POINTS_FILE, GarageLoyalty, garage_parse_loyalty, visit, context);
+}
+
+int garage_for_each_receipt(GarageReceiptVisitor visit, void *context) {
+    SCAN_FILE(QR_RECEIPTS_FILE, GarageReceipt, garage_parse_receipt, visit, context);
+}
+
+// ==================== USERS AND MECHANICS ====================
+
+typedef struct {
+    const char *username;
+    const char *password; // NULL matches any password
+    const char *role;     // NULL matches any role
+    void *result;
+    int found;
+} LookupContext;
+
+static int match_user(const GarageUser *user, void *context) {
+    LookupContext *lookup = context;
+
+    if (strcmp(user->username, lookup->username) != 0) return 0;
+    if (lookup->password && strcmp(user->password, lookup->password) != 0) return 0;
+    if (lookup->role && strcmp(user->role, lookup->role) != 0) return 0;
+
+    if (lookup->result) *(GarageUser *)lookup->result = *user;
+    lookup->found = 1;
+    return 1;
+}
+
+int garage_find_user(const char *username, GarageUser *user) {
+    LookupContext lookup = {username, NULL, NULL, user, 0};
+    garage_for_each_user(match_user, &lookup);
+    return lookup.found;
+}
+
+/**
+ * Check credentials; usernames are not unique in older data files, so
+ * every record with the username is tried
+ */
+int garage_authenticate_user(const char *username, const char *password,
+                             const char *role, GarageUser *user) {
+    LookupContext lookup = {username, password, role, user, 0};
+    garage_for_each_user(match_user, &lookup);
+    return lookup.found;
+}
+
+int garage_add_user(const GarageUser *user) {
+    FILE *f = fopen(USERS_FILE, "a");
+    if (!f) return 0;
+
+    fprintf(f, "%s %s %s %s %s %s\n", user->role, user->username, user->password,
+            user->name, user->email, user->phone);
+    fclose(f);
+    return 1;
+}
+
+static int match_mechanic(const GarageMechanic *mechanic, void *context) {
+    LookupContext *lookup = context;
+
+    if (strcmp(mechanic->username, lookup->username) != 0) return 0;
+    if (lookup->password && strcmp(mechanic->password, lookup->password) != 0) return 0;
+
+    if (lookup->result) *(GarageMechanic *)lookup->result = *mechanic;
+    lookup->found = 1;
+    return 1;
+}
+
+int garage_find_mechanic(const char *username, GarageMechanic *mechanic) {
+    LookupContext lookup = {username, NULL, NULL, mechanic, 0};
+    garage_for_each_mechanic(match_mechanic, &lookup);
+    return lookup.found;
+}
+
+int garage_authenticate_mechanic(const char *username, const char *password,
+                                 GarageMechanic *mechanic) {
+    LookupContext lookup = {username, password, NULL, mechanic, 0};
+    garage_for_each_mechanic(match_mechanic, &lookup);
+    return lookup.found;
+}
+
+int garage_add_mechanic(const GarageMechanic *mechanic) {
+    FILE *f = fopen(MECHANICS_FILE, "a");
+    if (!f) return 0;
+
+    fprintf(f, "%s %s %s %d %s\n", mechanic->name, mechanic->username,
+            mechanic->password, mechanic->age, mechanic->phone);
+    fclose(f);
+    return 1;
+}
+
+// ==================== PARTS, ORDERS AND PARKING ====================
+
+int garage_add_part(const GaragePart *part) {
+    FILE *f = fopen(PARTS_FILE, "a");
+    if (!f) return 0;
+
+    fprintf(f, "%s %s %.2f\n", part->name, part->spec, part->price);
+    fclose(f);
+    return 1;
+}
+
+int garage_add_order(GarageOrder *order) {
+    if (order->date_time[0] == '\0') {
+        time_t now = time(NULL);
+        strncpy(order->date_time, ctime(&now), sizeof(order->date_time) - 1);
+        order->date_time[sizeof(order->date_time) - 1] = '\0';
+        order->date_time[strcspn(order->date_time, "\n")] = '\0';
+    }
+    order->legacy = 0;
+
+    FILE *f = fopen(ORDERS_FILE, "a");
+    if (!f) return 0;
+
+    fprintf(f, "%s %s %d %.2f %s %s\n", order->username, order->part, order->quantity,
+            order->total, order->payment, order->date_time);
+    fclose(f);
+    return 1;
+}
+
+int garage_add_parking(GarageParking *parking) {
+    if (parking->date[0] == '\0') {
+        time_t now = time(NULL);
+        strftime(parking->date, sizeof(parking->date), "%Y-%m-%d", localtime(&now));
+    }
+
+    FILE *f = fopen(CAR_PARKING_FILE, "a");
+    if (!f) return 0;
+
+    fprintf(f, "%s %s %s %s %s\n", parking->username, parking->car_number,
+            parking->date, parking->entry_time, parking->manufacturer);
+    fclose(f);
+    return 1;
+}
+
+// ==================== LOYALTY ====================
+
+static int match_loyalty(const GarageLoyalty *account, void *context) {
+    LookupContext *lookup = context;
+    if (strcmp(account->username, lookup->username) != 0) return 0;
+    *(GarageLoyalty *)lookup->result = *account;
+    lookup->found = 1;
+    return 1;
+}
+
+int garage_find_loyalty(const char *username, GarageLoyalty *account) {
+    LookupContext lookup = {username, NULL, NULL, account, 0};
+    garage_for_each_loyalty(match_loyalty, &lookup);
+    return lookup.found;
+}
+
+int garage_get_loyalty_points(const char *username) {
+    GarageLoyalty account;
+    return garage_find_loyalty(username, &account) ? account.points : 0;
+}
+
+/**
+ * Wait for the loyalty lock; NULL when it cannot be taken. Every change to
+ * the balances is made under it, so a check and the write that follows
+ * it cannot interleave with another program's.
+ */
+static FILE *lock_loyalty(void) {
+    FILE *lock = fopen(LOYALTY_LOCK_FILE, "a");
+    if (!lock) return NULL;
+
+    if (!platform_lock_file(lock)) {
+        fclose(lock);
+        return NULL;
+    }
+    return lock;
+}
+
+static void unlock_loyalty(FILE *lock) {
+    platform_unlock_file(lock);
+    fclose(lock);
+}
+
+/**
+ * Add (or with a negative value, remove) points; rewrites the file through
+ * a temp file so a failed write never truncates the balances. The caller
+ * holds the loyalty lock.
+ */
+static int change_points(const char *username, int points, int *balance) {
+    FILE *f = fopen(LOYALTY_POINTS_FILE, "r");
+    FILE *temp = fopen(LOYALTY_TEMP_FILE, "w");
+    char line[GARAGE_LINE_MAX];
+    GarageLoyalty account;
+    int found = 0;
+    int new_balance = points;
+
+    if (!temp) {
+        if (f) fclose(f);
+        return 0;
+    }
+
+    if (f) {
+        while (fgets(line, sizeof(line), f)) {
+            if (!garage_parse_loyalty(line, &account)) continue;
+            if (strcmp(account.username, username) == 0) {
+                account.points += points;
+                new_balance = account.points;
+                found = 1;
+            }
+            fprintf(temp, "%s %d\n", account.username, account.points);
+        }
+        fclose(f);
+    }
+
+    if (!found) fprintf(temp, "%s %d\n", username, points);
+
+    if (fclose(temp) != 0) {
+        remove(LOYALTY_TEMP_FILE);
+        return 0;
+    }
+    remove(LOYALTY_POINTS_FILE);
+    if (rename(LOYALTY_TEMP_FILE, LOYALTY_POINTS_FILE) != 0) return 0;
+    if (balance) *balance = new_balance;
+    return 1;
+}
+
+int garage_add_loyalty_points(const char *username, int points, int *balance) {
+    FILE *lock = lock_loyalty();
+    if (!lock) return 0;
+
+    int done = change_points(username, points, balance);
+    unlock_loyalty(lock);
+    return done;
+}
+
+int garage_spend_loyalty_points(const char *username, int points, int *balance) {
+    FILE *lock = lock_loyalty();
+    if (!lock) return -1;
+
+    int result = 0;
+    if (garage_get_loyalty_points(username) >= points) {
+        result = change_points(username, -points, balance) ? 1 : -1;
+    }
+    unlock_loyalty(lock);
+    return result;
+}
+
+void garage_record_redemption(const char *username, int points, float discount) {
+    FILE *redemption = fopen(REDEMPTION_HISTORY_FILE, "a");
+    if (redemption) {
+        time_t now = time(NULL);
+        struct tm *local = localtime(&now);
+        fprintf(redemption, "%s %d %.2f %02d/%02d/%04d\n",
+                username, points, discount,
+                local->tm_mday, local->tm_mon + 1, local->tm_year + 1900);
+        fclose(redemption);
+    }
+}
+
+/**
+ * Spend points on a discount and record it in the redemption history
+ */
+int garage_redeem_loyalty_points(const char *username, int points, float discount) {
+    int result = garage_spend_loyalty_points(username, points, NULL);
+    if (result == 1) garage_record_redemption(username, points, discount);
+    return result;
+}
+
+// ==================== REPORTS ====================
+
+static int count_user(const GarageUser *user, void *context) {
+    GarageStats *stats = context;
+    stats->total_users++;
+    if (strcmp(user->role, "Customer") == 0) stats->customers++;
+    else if (strcmp(user->role, "Admin") == 0) stats->admins++;
+    return 0;
+}
+
+typedef struct {
+    GarageStats *stats;
+    const char *date_filter;
+} OrderStatsContext;
+
+static int count_order(const GarageOrder *order, void *context) {
+    OrderStatsContext *ctx = context;
+    GarageStats *stats = ctx->stats;
+
+    // Legacy orders carry no date, so a date filter never matches them
+    if (ctx->date_filter && strstr(order->date_time, ctx->date_filter) == NULL) return 0;
+
+    stats->total_orders++;
+    stats->total_revenue += order->total;
+
+    if (strcmp(order->payment, "Cash") == 0) {
+        stats->cash_payments++;
+        stats->cash_revenue += order->total;
+    } else if (strcmp(order->payment, "Online") == 0) {
+        stats->online_payments++;
+        stats->online_revenue += order->total;
+    }
+    return 0;
+}
+
+static int count_lines(const char *path) {
+    FILE *f = fopen(path, "r");
+    char line[GARAGE_LINE_MAX];
+    int count = 0;
+
+    if (!f) return 0;
+    while (fgets(line, sizeof(line), f)) count++;
+    fclose(f);
+    return count;
+}
+
+void garage_count_records(GarageStats *stats) {
+    memset(stats, 0, sizeof(*stats));
+    garage_for_each_user(count_user, stats);
+
+    int parts = garage_for_each_part(NULL, NULL);
+    stats->total_parts = parts > 0 ? parts : 0;
+    stats->total_cars = count_lines(CARS_FILE);
+}
+
+void garage_compute_stats(const char *date_filter, GarageStats *stats) {
+    OrderStatsContext ctx = {stats, date_filter};
+
+    garage_count_records(stats);
+    garage_for_each_order(count_order, &ctx);
+}
+
+typedef struct {
+    const char *username;
+    GarageCustomerSummary *summary;
+} SummaryContext;
+
+static int sum_customer_order(const GarageOrder *order, void *context) {
+    SummaryContext *ctx = context;
+    if (strcmp(order->username, ctx->username) == 0) {
+        ctx->summary->order_count++;
+        ctx->summary->total_spent += order->total;
+    }
+    return 0;
+}
+
+void garage_customer_summary(const char *username, GarageCustomerSummary *summary) {
+    SummaryContext ctx = {username, summary};
+
+    memset(summary, 0, sizeof(*summary));
+    garage_for_each_order(sum_customer_order, &ctx);
+    summary->loyalty_points = garage_get_loyalty_points(username);
+}
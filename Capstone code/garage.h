@@ -0,0 +1,298 @@
+/**
+ * garage.h - Core data API for the Smart Garage system (libgarage)
+ *
+ * Reads and writes the garage data files and hands back plain structs,
+ * with no console output and no prompts. The menu program is one client;
+ * a service mode or a benchmark can link the same code without the UI.
+ *
+ * Listings are streamed: garage_for_each_*() parses one line at a time
+ * and passes each record to a visitor, so memory use does not grow with
+ * the size of the data files.
+ *
+ * Usage:
+ *   static int print_order(const GarageOrder *order, void *context) {
+ *       printf("%s %s %.2f\n", order->username, order->part, order->total);
+ *       return 0;                    // non-zero stops the scan early
+ *   }
+ *
+ *   if (garage_for_each_order(print_order, NULL) < 0) {
+ *       // orders file missing or unreadable
+ *   }
+ */
+#ifndef GARAGE_H
+#define GARAGE_H
+
+#include <stdio.h>
+
+// Data files (relative to the working directory)
+#define USERS_FILE "user_data.txt"
+#define PARTS_FILE "inventory.txt"
+#define NOT_AVAILABLE_FILE "not_available.txt"
+#define STOCK_FILE "stock.txt"
+#define USERNAME_BLOOM_FILE "usernames.bloom"
+#define ORDERS_FILE "orders.txt"
+#define DISCOUNTS_FILE "discounts.txt"
+#define PROMO_USAGE_FILE "promo_usage.txt"
+#define MECHANICS_FILE "mechanics.txt"
+#define APPOINTMENTS_FILE "appointments.txt"
+#define CAR_PROFILES_FILE "car_profiles.txt"
+#define VEHICLE_HISTORY_FILE "vehicle_history.txt"
+#define PROGRESS_FILE "progress.txt"
+#define DEADLINES_FILE "deadlines.txt"
+#define SERVICE_CALENDAR_FILE "service_calendar.txt"
+#define MAINTENANCE_REMINDERS_FILE "maintenance_reminders.txt"
+#define QNA_FILE "qna.txt"
+#define CAR_PARKING_FILE "car_parking.txt"
+#define PARKING_EXITS_FILE "parking_exits.txt"
+#define QR_RECEIPTS_FILE "qr_receipts.txt"
+#define QR_INDEX_FILE "qr_index.txt"
+#define CAR_COMPATIBILITY_FILE "car_compatibility.txt"
+#define SEASONAL_RECOMMENDATIONS_FILE "seasonal_recommendations.txt"
+#define LOYALTY_POINTS_FILE "loyalty_points.txt"
+#define CUSTOMER_BADGES_FILE "customer_badges.txt"
+#define REDEMPTION_HISTORY_FILE "redemption_history.txt"
+#define CARS_FILE "cars.txt"
+
+#define GARAGE_LINE_MAX 512
+
+// 1 when a data file exists and can be read
+int garage_has_file(const char *path);
+
+// String hash (FNV-1a) for the in-memory indexes built over the data files
+unsigned long garage_hash(const char *text);
+
+// A data file's size and modification time as last seen by an index
+typedef struct {
+    long size;           // -1 = missing
+    long mtime;
+    int seen;
+} GarageFileStamp;
+
+// 1 when the file was created, changed or removed since the stamp was
+// taken (always on the first call); the stamp is updated
+int garage_file_changed(const char *path, GarageFileStamp *stamp);
+
+// ==================== TABLES ====================
+// A growable array of records that each start with their key string,
+// with an open-addressing hash index over the keys. Records move when
+// the array grows, so keep indexes, not pointers, across adds.
+
+typedef struct {
+    char *items;
+    size_t stride;              // Record size
+    int count, capacity;
+    int *slots;                 // Index into items + 1, 0 = empty
+    int slot_count;
+} GarageTable;
+
+#define GARAGE_TABLE(type) {NULL, sizeof(type), 0, 0, NULL, 0}
+
+void *garage_table_at(const GarageTable *table, int index);
+int garage_table_find(const GarageTable *table, const char *key); // Index, -1 when absent
+// Append a zeroed record holding `key` (at most key_size bytes); NULL when
+// out of memory
+void *garage_table_add(GarageTable *table, const char *key, size_t key_size);
+void garage_table_clear(GarageTable *table);                      // Memory is kept
+void garage_table_free(GarageTable *table);                       // Empty again, memory released
+
+// ==================== APPEND-ONLY FILES ====================
+// Indexes over files that only grow read each line once: a GarageTail
+// remembers how far the file was read and fingerprints the last bytes of
+// that part, and later calls read only what was appended since. Any other
+// change is a rewrite, and the index is rebuilt.
+
+typedef struct {
+    GarageFileStamp stamp;
+    long read;                  // Bytes of whole lines already read
+    unsigned long fingerprint;  // Hash of the last bytes of that part
+} GarageTail;
+
+// Called with each line read (in the reader's buffer, which it may
+// change) and the offset the line starts at
+typedef void (*GarageLineReader)(char *line, long offset, void *context);
+
+#define GARAGE_TAIL_SAME 0      // Not changed since the last call
+#define GARAGE_TAIL_APPENDED 1  // Lines may have been added
+#define GARAGE_TAIL_REWRITTEN 2 // Lines already read were changed or removed
+
+// How the file changed since the last call. On GARAGE_TAIL_REWRITTEN the
+// tail is reset: clear what was built from the file, then read it again.
+int garage_tail_changed(const char *path, GarageTail *tail);
+void garage_tail_reset(GarageTail *tail);
+
+// 1 when the first tail->read bytes of the open file are no longer the
+// ones read (shorter, or a different fingerprint)
+int garage_tail_rewritten(FILE *f, const GarageTail *tail);
+
+// Pass each whole line from tail->read on to read(); a last line still
+// being written is left for the next call and overlong lines are skipped.
+// garage_tail_read() returns 0 when the file cannot be opened.
+int garage_tail_read(const char *path, GarageTail *tail, GarageLineReader read, void *context);
+void garage_tail_read_file(FILE *f, GarageTail *tail, GarageLineReader read, void *context);
+
+// ==================== RECORDS ====================
+
+// user_data.txt: role username password name... email phone
+typedef struct {
+    char role[20];
+    char username[30];
+    char password[30];
+    char name[50];       // May contain spaces ("Ashis Rahman")
+    char email[50];
+    char phone[20];
+} GarageUser;
+
+// orders.txt: username part quantity total [payment date_time]
+typedef struct {
+    char username[30];
+    char part[50];
+    int quantity;
+    float total;
+    char payment[20];    // "Cash" for legacy orders
+    char date_time[100]; // ctime() text, empty for legacy orders
+    int legacy;          // Written before payment and date were recorded
+} GarageOrder;
+
+// inventory.txt: name spec price
+typedef struct {
+    char name[50];
+    char spec[50];
+    float price;
+} GaragePart;
+
+// mechanics.txt: name... username password age phone
+typedef struct {
+    char name[50];
+    char username[30];
+    char password[30];
+    int age;
+    char phone[20];
+} GarageMechanic;
+
+// car_parking.txt: username car date time manufacturer...
+typedef struct {
+    char username[30];
+    char car_number[20];
+    char date[20];       // YYYY-MM-DD
+    char entry_time[20];
+    char manufacturer[50];
+} GarageParking;
+
+// qr_receipts.txt: QR_CODE|USERNAME|DATE|AMOUNT|SERVICE_DETAILS
+typedef struct {
+    char qr_code[50];
+    char username[30];
+    char date[20];       // DD/MM/YYYY
+    float amount;
+    char details[200];
+} GarageReceipt;
+
+// loyalty_points.txt: username points
+typedef struct {
+    char username[30];
+    int points;
+} GarageLoyalty;
+
+// Totals behind the statistics and dashboard screens
+typedef struct {
+    int total_users;
+    int customers;
+    int admins;
+    int total_parts;
+    int total_cars;
+    int total_orders;
+    int cash_payments;
+    int online_payments;
+    float total_revenue;
+    float cash_revenue;
+    float online_revenue;
+} GarageStats;
+
+// One customer's order activity
+typedef struct {
+    int order_count;
+    float total_spent;
+    int loyalty_points;
+} GarageCustomerSummary;
+
+// ==================== PARSING ====================
+// Each returns 1 when the line holds a record, 0 for blank, comment or
+// malformed lines
+
+int garage_parse_user(const char *line, GarageUser *user);
+int garage_parse_order(const char *line, GarageOrder *order);
+int garage_parse_part(const char *line, GaragePart *part);
+int garage_parse_mechanic(const char *line, GarageMechanic *mechanic);
+int garage_parse_parking(const char *line, GarageParking *parking);
+int garage_parse_loyalty(const char *line, GarageLoyalty *account);
+int garage_parse_receipt(const char *line, GarageReceipt *receipt);
+
+// Dates in any of the stored forms (YYYY-MM-DD, DD/MM/YYYY or ctime text)
+// as a sortable YYYYMMDD number; 0 when the text holds no date
+long garage_date_key(const char *text);
+long garage_order_date_key(const GarageOrder *order);
+
+// A date key as YYYY-MM-DD, or "-" for no date; GARAGE_DATE_TEXT bytes hold it
+#define GARAGE_DATE_TEXT 11
+void garage_format_date_key(long date_key, char *text, size_t size);
+
+// ==================== STREAMING ====================
+// Visitors return 0 to continue and non-zero to stop. The scans return the
+// number of records visited, or -1 when the file cannot be opened.
+
+typedef int (*GarageUserVisitor)(const GarageUser *user, void *context);
+typedef int (*GarageOrderVisitor)(const GarageOrder *order, void *context);
+typedef int (*GaragePartVisitor)(const GaragePart *part, void *context);
+typedef int (*GarageMechanicVisitor)(const GarageMechanic *mechanic, void *context);
+typedef int (*GarageParkingVisitor)(const GarageParking *parking, void *context);
+typedef int (*GarageLoyaltyVisitor)(const GarageLoyalty *account, void *context);
+typedef int (*GarageReceiptVisitor)(const GarageReceipt *receipt, void *context);
+
+int garage_for_each_user(GarageUserVisitor visit, void *context);
+int garage_for_each_order(GarageOrderVisitor visit, void *context);
+int garage_for_each_part(GaragePartVisitor visit, void *context);
+int garage_for_each_mechanic(GarageMechanicVisitor visit, void *context);
+int garage_for_each_parking(GarageParkingVisitor visit, void *context);
+int garage_for_each_loyalty(GarageLoyaltyVisitor visit, void *context);
+int garage_for_each_receipt(GarageReceiptVisitor visit, void *context);
+
+// ==================== USERS AND MECHANICS ====================
+// Lookups return 1 when found (and fill the record), 0 otherwise
+
+int garage_find_user(const char *username, GarageUser *user);
+int garage_authenticate_user(const char *username, const char *password,
+                             const char *role, GarageUser *user);
+int garage_add_user(const GarageUser *user);
+
+int garage_find_mechanic(const char *username, GarageMechanic *mechanic);
+int garage_authenticate_mechanic(const char *username, const char *password,
+                                 GarageMechanic *mechanic);
+int garage_add_mechanic(const GarageMechanic *mechanic);
+
+// ==================== PARTS, ORDERS AND PARKING ====================
+// Writers return 1 on success, 0 when the file cannot be written
+
+int garage_add_part(const GaragePart *part);
+int garage_add_order(GarageOrder *order);       // Stamps date_time when empty
+int garage_add_parking(GarageParking *parking); // Stamps date when empty
+
+// ==================== LOYALTY ====================
+
+int garage_find_loyalty(const char *username, GarageLoyalty *account);
+int garage_get_loyalty_points(const char *username);            // 0 when no account
+int garage_add_loyalty_points(const char *username, int points, int *balance); // 1 and the new balance, 0 on error
+// Check the balance and take the points in one step under the loyalty
+// lock: 1 and the new balance, 0 too few points, -1 on error
+int garage_spend_loyalty_points(const char *username, int points, int *balance);
+void garage_record_redemption(const char *username, int points, float discount); // redemption_history.txt
+int garage_redeem_loyalty_points(const char *username, int points, float discount); // Spend and record; as spend
+
+// ==================== REPORTS ====================
+
+// Users, parts and cars only; the order totals are left at zero
+void garage_count_records(GarageStats *stats);
+// date_filter matches part of the order date ("Aug 09"); NULL counts everything
+void garage_compute_stats(const char *date_filter, GarageStats *stats);
+void garage_customer_summary(const char *username, GarageCustomerSummary *summary);
+
+#endif
@@ -0,0 +1,198 @@
+/**
+ * history.c - Per-customer order summaries for the Smart Garage system
+ *
+ * Customers sit in a GarageTable keyed by username. The line offsets of
+ * all orders share one array of links; each customer chains its own from
+ * first to last, so a new order is linked in O(1) and a customer's orders
+ * are found without touching anyone else's.
+ * The recent orders are a ring: slot order_count % HISTORY_RECENT is
+ * overwritten by the next one.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "garage.h"
+#include "history.h"
+
+#define MIN_LINKS 64
+
+typedef struct {
+    long offset;                // Start of the order line
+    int next;                   // Next order of the same customer, -1 = end
+} Link;
+
+typedef struct {
+    char username[30];
+    HistorySummary summary;
+    int first, last;            // Chain of Links, -1 = none
+    HistoryOrder recent[HISTORY_RECENT];
+    int name_generation;        // users_generation the name was read in, 0 = never
+} Customer;
+
+static GarageTable customers = GARAGE_TABLE(Customer);
+
+static Link *links;
+static int link_count, link_capacity;
+
+static GarageTail orders_tail;
+
+static GarageFileStamp users_stamp;
+static int users_generation;    // Bumped when user_data.txt changes
+
+// ==================== CUSTOMERS ====================
+
+static Customer *customer_at(int index) {
+    return garage_table_at(&customers, index);
+}
+
+static int find_customer(const char *username) {
+    return garage_table_find(&customers, username);
+}
+
+// The customer's entry, added with no orders when new; -1 when out of memory
+static int add_customer(const char *username) {
+    int index = find_customer(username);
+    if (index >= 0) return index;
+
+    Customer *customer = garage_table_add(&customers, username, sizeof(customer->username));
+    if (!customer) return -1;
+    customer->first = customer->last = -1;
+    return customers.count - 1;
+}
+
+// ==================== ORDERS ====================
+
+static void add_order(const GarageOrder *order, long offset) {
+    int index = add_customer(order->username);
+    if (index < 0) return;
+
+    if (link_count == link_capacity) {
+        int capacity = link_capacity ? link_capacity * 2 : MIN_LINKS;
+        Link *grown = realloc(links, (size_t)capacity * sizeof(Link));
+        if (!grown) return;
+        links = grown;
+        link_capacity = capacity;
+    }
+
+    Customer *customer = customer_at(index);
+    links[link_count].offset = offset;
+    links[link_count].next = -1;
+    if (customer->last >= 0) links[customer->last].next = link_count;
+    else customer->first = link_count;
+    customer->last = link_count++;
+
+    HistoryOrder *recent = &customer->recent[customer->summary.order_count % HISTORY_RECENT];
+    snprintf(recent->part, sizeof(recent->part), "%s", order->part);
+    recent->quantity = order->quantity;
+    recent->total = order->total;
+    snprintf(recent->payment, sizeof(recent->payment), "%s", order->payment);
+    snprintf(recent->date_time, sizeof(recent->date_time), "%.24s", order->date_time);
+
+    customer->summary.order_count++;
+    customer->summary.total_spent += order->total;
+    snprintf(customer->summary.last_order, sizeof(customer->summary.last_order), "%.24s", order->date_time);
+}
+
+// Add one order appended since the last call
+static void read_order(char *line, long offset, void *context) {
+    GarageOrder order;
+    (void)context;
+    if (garage_parse_order(line, &order)) add_order(&order, offset);
+}
+
+static void refresh(void) {
+    if (garage_file_changed(USERS_FILE, &users_stamp)) users_generation++;
+
+    int orders = garage_tail_changed(ORDERS_FILE, &orders_tail);
+    if (orders == GARAGE_TAIL_SAME) return;
+
+    if (orders == GARAGE_TAIL_REWRITTEN) {
+        // Customers are kept (with their names); only the orders go
+        for (int i = 0; i < customers.count; i++) {
+            Customer *customer = customer_at(i);
+            memset(customer->recent, 0, sizeof(customer->recent));
+            customer->summary.order_count = 0;
+            customer->summary.total_spent = 0;
+            customer->summary.last_order[0] = '\0';
+            customer->first = customer->last = -1;
+        }
+        link_count = 0;
+    }
+    garage_tail_read(ORDERS_FILE, &orders_tail, read_order, NULL);
+}
+
+// ==================== QUERIES ====================
+
+int history_get(const char *username, HistorySummary *summary) {
+    GarageUser user;
+
+    refresh();
+
+    int index = find_customer(username);
+    if (index < 0) {
+        // No orders: look the name up without keeping an entry for it
+        memset(summary, 0, sizeof(*summary));
+        strcpy(summary->name, garage_find_user(username, &user) ? user.name : "Unknown");
+        return 0;
+    }
+
+    Customer *customer = customer_at(index);
+    if (customer->name_generation != users_generation) {
+        strcpy(customer->summary.name, garage_find_user(username, &user) ? user.name : "Unknown");
+        customer->name_generation = users_generation;
+    }
+    *summary = customer->summary;
+    return summary->order_count;
+}
+
+int history_totals(const char *username, HistorySummary *summary) {
+    refresh();
+
+    int index = find_customer(username);
+    if (index < 0) {
+        memset(summary, 0, sizeof(*summary));
+        return 0;
+    }
+    *summary = customer_at(index)->summary;
+    summary->name[0] = '\0';
+    return summary->order_count;
+}
+
+int history_recent(const char *username, HistoryOrder out[], int max) {
+    refresh();
+
+    int index = find_customer(username);
+    if (index < 0) return 0;
+
+    const Customer *customer = customer_at(index);
+    int count = customer->summary.order_count;
+    if (max > HISTORY_RECENT) max = HISTORY_RECENT;
+
+    int written = 0;
+    for (; written < max && written < count; written++) {
+        out[written] = customer->recent[(count - 1 - written) % HISTORY_RECENT];
+    }
+    return written;
+}
+
+int history_for_each(const char *username, GarageOrderVisitor visit, void *context) {
+    refresh();
+
+    FILE *f = fopen(ORDERS_FILE, "rb");
+    if (!f) return -1;
+
+    int index = find_customer(username);
+    int visited = 0;
+    char line[GARAGE_LINE_MAX];
+    GarageOrder order;
+
+    for (int link = index >= 0 ? customer_at(index)->first : -1; link >= 0; link = links[link].next) {
+        if (fseek(f, links[link].offset, SEEK_SET) != 0 || !fgets(line, sizeof(line), f)) break;
+        if (!garage_parse_order(line, &order)) continue;
+
+        visited++;
+        if (visit(&order, context)) break;
+    }
+    fclose(f);
+    return visited;
+}
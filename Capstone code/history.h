@@ -0,0 +1,60 @@
+/**
+ * history.h - Per-customer order summaries for the Smart Garage system
+ *
+ * Each customer's order count, total spent and newest order are kept in
+ * memory, with the last HISTORY_RECENT orders and the position of every
+ * order line in orders.txt. The history and estimation screens read the
+ * summary and then only that customer's lines, instead of the whole file.
+ *
+ * Orders appended since the last call are added on the next call; if
+ * orders already read changed (orders deleted), the summaries are
+ * rebuilt. The customer's full name is looked up in user_data.txt once,
+ * and again only after that file changes. Usernames with no orders are
+ * looked up on each call and not kept.
+ *
+ * Usage:
+ *   HistorySummary summary;
+ *   if (history_get("Ashis_01", &summary) > 0) {
+ *       printf("%d orders, $%.2f\n", summary.order_count, summary.total_spent);
+ *   }
+ */
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include "garage.h"
+
+#define HISTORY_RECENT 5
+
+typedef struct {
+    char name[50];              // Full name, "Unknown" when not in user_data.txt
+    int order_count;
+    double total_spent;
+    char last_order[32];        // ctime() text of the newest order, "" for legacy orders
+} HistorySummary;
+
+// One of the recent orders
+typedef struct {
+    char part[50];
+    int quantity;
+    float total;
+    char payment[20];
+    char date_time[32];         // ctime() text
+} HistoryOrder;
+
+// The customer's summary; returns the order count
+int history_get(const char *username, HistorySummary *summary);
+
+// As history_get() without the name lookup (name left empty), for callers
+// that already have the user record
+int history_totals(const char *username, HistorySummary *summary);
+
+// The customer's newest orders, newest first (at most HISTORY_RECENT);
+// returns the number written
+int history_recent(const char *username, HistoryOrder out[], int max);
+
+// The customer's orders, oldest first, read straight from their lines.
+// The visitor returns 0 to continue; returns the number visited, or -1
+// when orders.txt cannot be opened.
+int history_for_each(const char *username, GarageOrderVisitor visit, void *context);
+
+#endif
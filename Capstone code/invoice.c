@@ -0,0 +1,362 @@
+/**
+ * invoice.c - Month-end batch invoicing for the Smart Garage system
+ *
+ * Customers live in a GarageTable by username (first order first). Each
+ * customer's invoice lines are a list through a shared line array, one
+ * line per distinct part, so memory grows with customers x parts rather
+ * than with the number of orders.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include "garage.h"
+#include "platform.h"
+#include "invoice.h"
+
+#define MIN_LINES 256
+#define FLUSH_SIZE 65536
+
+// One part on a customer's invoice (all orders of that part summed)
+typedef struct {
+    char part[50];
+    int quantity;
+    double amount;
+    int next;                   // Next line of the same invoice, -1 = last
+} InvoiceLine;
+
+typedef struct {
+    char username[30];
+    char name[50];
+    char email[50];
+    char phone[20];
+    int first_line;
+    int last_line;
+    int order_count;
+    double subtotal;
+} CustomerInvoice;
+
+// Text on its way to a file: flushed in FLUSH_SIZE blocks when `file` is
+// set, otherwise kept whole until the batch writes it out
+typedef struct {
+    char *data;
+    size_t used;
+    size_t capacity;
+    FILE *file;
+    int failed;
+} OutputBuffer;
+
+typedef struct {
+    const InvoiceBatchOptions *options;
+
+    GarageTable customers;      // CustomerInvoice by username
+
+    InvoiceLine *lines;
+    int line_count, line_capacity;
+
+    int orders;
+    int out_of_memory;
+
+    time_t now;
+    char date[40];              // DD/MM/YYYY, as on single receipts
+    char period[64];
+
+    int workers;
+    OutputBuffer invoices[PLATFORM_MAX_WORKERS];
+    OutputBuffer receipts[PLATFORM_MAX_WORKERS];
+} InvoiceBatch;
+
+// ==================== OUTPUT BUFFERS ====================
+
+static void buffer_flush(OutputBuffer *buffer) {
+    if (buffer->used > 0 && fwrite(buffer->data, 1, buffer->used, buffer->file) != buffer->used) {
+        buffer->failed = 1;
+    }
+    buffer->used = 0;
+}
+
+static void buffer_printf(OutputBuffer *buffer, const char *format, ...) {
+    va_list args;
+    int length;
+
+    if (buffer->failed) return;
+
+    va_start(args, format);
+    length = vsnprintf(NULL, 0, format, args);
+    va_end(args);
+    if (length < 0) return;
+
+    if (buffer->used + (size_t)length + 1 > buffer->capacity) {
+        size_t capacity = buffer->capacity ? buffer->capacity : FLUSH_SIZE;
+        while (buffer->used + (size_t)length + 1 > capacity) capacity *= 2;
+
+        char *grown = realloc(buffer->data, capacity);
+        if (!grown) {
+            buffer->failed = 1;
+            return;
+        }
+        buffer->data = grown;
+        buffer->capacity = capacity;
+    }
+
+    va_start(args, format);
+    vsnprintf(buffer->data + buffer->used, (size_t)length + 1, format, args);
+    va_end(args);
+    buffer->used += (size_t)length;
+
+    if (buffer->file && buffer->used >= FLUSH_SIZE) buffer_flush(buffer);
+}
+
+// ==================== GROUPING ====================
+
+static CustomerInvoice *customer_at(InvoiceBatch *batch, int index) {
+    return garage_table_at(&batch->customers, index);
+}
+
+/**
+ * Index of a customer's invoice; with `create`, a new empty invoice is
+ * added when there is none. -1 when missing (or out of memory).
+ */
+static int find_customer(InvoiceBatch *batch, const char *username, int create) {
+    int index = garage_table_find(&batch->customers, username);
+    if (index >= 0 || !create) return index;
+
+    CustomerInvoice *customer = garage_table_add(&batch->customers, username, sizeof(customer->username));
+    if (!customer) return -1;
+    strcpy(customer->name, "N/A");
+    strcpy(customer->email, "N/A");
+    strcpy(customer->phone, "N/A");
+    customer->first_line = -1;
+    customer->last_line = -1;
+    return batch->customers.count - 1;
+}
+
+static int add_line(InvoiceBatch *batch, CustomerInvoice *customer, const GarageOrder *order) {
+    for (int i = customer->first_line; i >= 0; i = batch->lines[i].next) {
+        if (strcmp(batch->lines[i].part, order->part) == 0) {
+            batch->lines[i].quantity += order->quantity;
+            batch->lines[i].amount += order->total;
+            return 1;
+        }
+    }
+
+    if (batch->line_count == batch->line_capacity) {
+        int capacity = batch->line_capacity ? batch->line_capacity * 2 : MIN_LINES;
+        InvoiceLine *grown = realloc(batch->lines, (size_t)capacity * sizeof(InvoiceLine));
+        if (!grown) return 0;
+        batch->lines = grown;
+        batch->line_capacity = capacity;
+    }
+
+    int index = batch->line_count++;
+    InvoiceLine *line = &batch->lines[index];
+    snprintf(line->part, sizeof(line->part), "%s", order->part);
+    line->quantity = order->quantity;
+    line->amount = order->total;
+    line->next = -1;
+
+    if (customer->last_line >= 0) batch->lines[customer->last_line].next = index;
+    else customer->first_line = index;
+    customer->last_line = index;
+    return 1;
+}
+
+static int collect_order(const GarageOrder *order, void *context) {
+    InvoiceBatch *batch = context;
+    const InvoiceBatchOptions *options = batch->options;
+
+    // Legacy orders carry no date, so any date range leaves them out
+    if (options->from_date || options->to_date) {
+        long date_key = garage_order_date_key(order);
+        if (!date_key) return 0;
+        if (options->from_date && date_key < options->from_date) return 0;
+        if (options->to_date && date_key > options->to_date) return 0;
+    }
+
+    int index = find_customer(batch, order->username, 1);
+    if (index < 0 || !add_line(batch, customer_at(batch, index), order)) {
+        batch->out_of_memory = 1;
+        return 1;
+    }
+
+    customer_at(batch, index)->order_count++;
+    customer_at(batch, index)->subtotal += order->total;
+    batch->orders++;
+    return 0;
+}
+
+static int fill_contact(const GarageUser *user, void *context) {
+    InvoiceBatch *batch = context;
+    int index = find_customer(batch, user->username, 0);
+
+    if (index >= 0) {
+        CustomerInvoice *customer = customer_at(batch, index);
+        snprintf(customer->name, sizeof(customer->name), "%s", user->name);
+        snprintf(customer->email, sizeof(customer->email), "%s", user->email);
+        snprintf(customer->phone, sizeof(customer->phone), "%s", user->phone);
+    }
+    return 0;
+}
+
+// ==================== WRITING ====================
+
+static void write_invoice(InvoiceBatch *batch, int worker, const CustomerInvoice *customer) {
+    OutputBuffer *out = &batch->invoices[worker];
+    double vat = customer->subtotal * batch->options->vat_rate;
+    double total = customer->subtotal + vat;
+    char qr_code[50];
+
+    snprintf(qr_code, sizeof(qr_code), "QR_%s_%ld", customer->username, (long)batch->now);
+
+    buffer_printf(out, "==============================================================\n");
+    buffer_printf(out, "OFFICIAL INVOICE                         %s\n", batch->date);
+    buffer_printf(out, "Customer: %s (%s)\n", customer->name, customer->username);
+    buffer_printf(out, "Email: %s\n", customer->email);
+    buffer_printf(out, "Phone: %s\n", customer->phone);
+    buffer_printf(out, "Period: %s\n", batch->period);
+    buffer_printf(out, "--------------------------------------------------------------\n");
+    buffer_printf(out, "%-20s %-10s %s\n", "PART", "QUANTITY", "TOTAL ($)");
+
+    for (int i = customer->first_line; i >= 0; i = batch->lines[i].next) {
+        const InvoiceLine *line = &batch->lines[i];
+        buffer_printf(out, "%-20s %-10d %.2f\n", line->part, line->quantity, line->amount);
+    }
+
+    buffer_printf(out, "--------------------------------------------------------------\n");
+    buffer_printf(out, "Orders: %d\n", customer->order_count);
+    buffer_printf(out, "Subtotal: $%.2f\n", customer->subtotal);
+    buffer_printf(out, "VAT (%.0f%%): $%.2f\n", batch->options->vat_rate * 100, vat);
+    buffer_printf(out, "TOTAL WITH VAT: $%.2f\n", total);
+    buffer_printf(out, "QR Code: %s\n\n", qr_code);
+
+    if (batch->options->write_receipts) {
+        buffer_printf(&batch->receipts[worker], "%s|%s|%s|%.2f|Invoice_Total:$%.2f_VAT:$%.2f_Customer:%s\n",
+                      qr_code, customer->username, batch->date, total, total, vat, customer->name);
+    }
+}
+
+/**
+ * Format one worker's share of the customers (a PlatformTask)
+ */
+static void format_share(int worker, void *context) {
+    InvoiceBatch *batch = context;
+    int first = (int)((long)batch->customers.count * worker / batch->workers);
+    int last = (int)((long)batch->customers.count * (worker + 1) / batch->workers);
+
+    for (int i = first; i < last; i++) {
+        write_invoice(batch, worker, customer_at(batch, i));
+    }
+}
+
+static void describe_period(InvoiceBatch *batch) {
+    const InvoiceBatchOptions *options = batch->options;
+    long from = options->from_date, to = options->to_date;
+
+    if (from && to) {
+        snprintf(batch->period, sizeof(batch->period), "%04ld-%02ld-%02ld to %04ld-%02ld-%02ld",
+                 from / 10000, (from / 100) % 100, from % 100, to / 10000, (to / 100) % 100, to % 100);
+    } else if (from) {
+        snprintf(batch->period, sizeof(batch->period), "From %04ld-%02ld-%02ld",
+                 from / 10000, (from / 100) % 100, from % 100);
+    } else if (to) {
+        snprintf(batch->period, sizeof(batch->period), "Up to %04ld-%02ld-%02ld",
+                 to / 10000, (to / 100) % 100, to % 100);
+    } else {
+        strcpy(batch->period, "All orders");
+    }
+}
+
+static void free_batch(InvoiceBatch *batch) {
+    for (int i = 0; i < PLATFORM_MAX_WORKERS; i++) {
+        free(batch->invoices[i].data);
+        free(batch->receipts[i].data);
+    }
+    garage_table_free(&batch->customers);
+    free(batch->lines);
+}
+
+/**
+ * Write the buffered output of every worker to its file, in worker order
+ */
+static int write_out(InvoiceBatch *batch, OutputBuffer buffers[], FILE *file) {
+    int failed = 0;
+
+    for (int i = 0; i < batch->workers; i++) {
+        buffers[i].file = file;
+        buffer_flush(&buffers[i]);
+        if (buffers[i].failed) failed = 1;
+    }
+    return !failed;
+}
+
+int invoice_run_batch(const InvoiceBatchOptions *options, InvoiceBatchResult *result) {
+    InvoiceBatch batch;
+    FILE *invoices, *receipts = NULL;
+    int ok = 1;
+
+    memset(result, 0, sizeof(*result));
+    memset(&batch, 0, sizeof(batch));
+    batch.options = options;
+    batch.customers = (GarageTable)GARAGE_TABLE(CustomerInvoice);
+
+    if (!garage_has_file(ORDERS_FILE)) return INVOICE_NO_ORDERS;
+
+    // Pass 1: orders grouped by customer and part; pass 2: contact details
+    garage_for_each_order(collect_order, &batch);
+    if (!batch.out_of_memory) garage_for_each_user(fill_contact, &batch);
+
+    invoices = batch.out_of_memory ? NULL : fopen(options->invoices_path, "w");
+    if (invoices && options->write_receipts) {
+        receipts = fopen(QR_RECEIPTS_FILE, "a");
+        if (!receipts) {
+            fclose(invoices);
+            invoices = NULL;
+        }
+    }
+    if (!invoices) {
+        free_batch(&batch);
+        return INVOICE_WRITE_FAILED;
+    }
+
+    batch.now = time(NULL);
+    struct tm *local = localtime(&batch.now);
+    snprintf(batch.date, sizeof(batch.date), "%02d/%02d/%04d",
+             local->tm_mday, local->tm_mon + 1, local->tm_year + 1900);
+    describe_period(&batch);
+
+    fprintf(invoices, "SMART GARAGE MANAGEMENT SYSTEM - INVOICES\n");
+    fprintf(invoices, "Period: %s | Customers: %d | Orders: %d\n\n",
+            batch.period, batch.customers.count, batch.orders);
+
+    batch.workers = options->workers;
+    if (batch.workers > PLATFORM_MAX_WORKERS) batch.workers = PLATFORM_MAX_WORKERS;
+    if (batch.workers > batch.customers.count) batch.workers = batch.customers.count;
+    if (batch.workers < 1) batch.workers = 1;
+
+    if (batch.workers == 1) {
+        // Stream straight to the files in FLUSH_SIZE blocks
+        batch.invoices[0].file = invoices;
+        batch.receipts[0].file = receipts;
+        format_share(0, &batch);
+    } else {
+        platform_run_parallel(batch.workers, format_share, &batch);
+    }
+
+    if (!write_out(&batch, batch.invoices, invoices)) ok = 0;
+    if (receipts && !write_out(&batch, batch.receipts, receipts)) ok = 0;
+    if (fclose(invoices) != 0) ok = 0;
+    if (receipts && fclose(receipts) != 0) ok = 0;
+
+    for (int i = 0; i < batch.customers.count; i++) {
+        double vat = customer_at(&batch, i)->subtotal * options->vat_rate;
+        result->subtotal += customer_at(&batch, i)->subtotal;
+        result->vat += vat;
+    }
+    result->total = result->subtotal + result->vat;
+    result->customers = batch.customers.count;
+    result->orders = batch.orders;
+
+    free_batch(&batch);
+    return ok ? result->customers : INVOICE_WRITE_FAILED;
+}
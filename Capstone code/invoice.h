@@ -0,0 +1,47 @@
+/**
+ * invoice.h - Month-end batch invoicing for the Smart Garage system
+ *
+ * One run reads orders.txt once and groups the orders by customer and part
+ * in a hash table, then reads user_data.txt once for the contact details.
+ * It writes every invoice to one text file and appends one QR receipt per
+ * customer, in large blocks rather than a write per line. The cost is one
+ * pass over each file, not one orders scan per customer.
+ *
+ * With workers > 1 the invoice text is formatted on that many threads (each
+ * takes a share of the customers) and written out in customer order.
+ *
+ * Usage:
+ *   InvoiceBatchOptions options = {20250801, 20250831, 0.15f, "invoices.txt", 1, 4};
+ *   InvoiceBatchResult result;
+ *   if (invoice_run_batch(&options, &result) < 0) {
+ *       // INVOICE_NO_ORDERS or INVOICE_WRITE_FAILED
+ *   }
+ */
+#ifndef INVOICE_H
+#define INVOICE_H
+
+// Negative results of invoice_run_batch()
+#define INVOICE_NO_ORDERS -1
+#define INVOICE_WRITE_FAILED -2
+
+typedef struct {
+    long from_date;             // YYYYMMDD, 0 = open (see garage_date_key)
+    long to_date;
+    float vat_rate;             // 0.15 for 15%
+    const char *invoices_path;
+    int write_receipts;         // Append a QR receipt per invoice
+    int workers;                // Formatting threads; 1 or less runs inline
+} InvoiceBatchOptions;
+
+typedef struct {
+    int customers;
+    int orders;
+    double subtotal;
+    double vat;
+    double total;
+} InvoiceBatchResult;
+
+// Returns the number of invoices written, or one of the errors above
+int invoice_run_batch(const InvoiceBatchOptions *options, InvoiceBatchResult *result);
+
+#endif
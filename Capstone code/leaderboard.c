@@ -0,0 +1,247 @@
+/**
+ * leaderboard.c - Loyalty points leaderboard for the Smart Garage system
+ *
+ * Bucket b holds the customers with b points: counts[b] of them, chained
+ * from heads[b]. tree[] is the Fenwick tree over counts[] (1-based), so
+ * prefix(b) is the number of customers with at most b points. The bucket
+ * range is a power of two and doubles when a larger balance shows up.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "garage.h"
+#include "leaderboard.h"
+
+#define MIN_BUCKETS 1024
+
+typedef struct {
+    char username[30];
+    int points;
+    int prev, next;             // Chain of the same bucket, -1 = end
+} Account;
+
+static GarageTable accounts = GARAGE_TABLE(Account);
+
+static int *counts, *heads, *tree;
+static int bucket_count;
+
+static GarageFileStamp stamp;
+
+// ==================== FENWICK TREE ====================
+
+static void tree_add(int bucket, int delta) {
+    for (int i = bucket + 1; i <= bucket_count; i += i & -i) tree[i] += delta;
+}
+
+// Customers with at most `bucket` points
+static int prefix(int bucket) {
+    int sum = 0;
+    for (int i = bucket + 1; i > 0; i -= i & -i) sum += tree[i];
+    return sum;
+}
+
+// The lowest bucket with prefix(bucket) >= k (1 <= k <= accounts.count)
+static int lower_bound(int k) {
+    int position = 0;
+    for (int step = bucket_count; step > 0; step /= 2) {
+        if (position + step <= bucket_count && tree[position + step] < k) {
+            position += step;
+            k -= tree[position];
+        }
+    }
+    return position;            // Tree index position + 1, i.e. bucket `position`
+}
+
+static int bucket_of(int points) {
+    if (points < 0) return 0;
+    return points > LEADERBOARD_MAX_POINTS ? LEADERBOARD_MAX_POINTS : points;
+}
+
+/**
+ * Make room for `bucket`: double the range and rebuild the tree from the
+ * counts; 0 when out of memory
+ */
+static int grow_buckets(int bucket) {
+    if (bucket < bucket_count) return 1;
+
+    int grown = bucket_count ? bucket_count : MIN_BUCKETS;
+    while (grown <= bucket) grown *= 2;
+
+    int *new_counts = realloc(counts, (size_t)grown * sizeof(int));
+    if (!new_counts) return 0;
+    counts = new_counts;
+    int *new_heads = realloc(heads, (size_t)grown * sizeof(int));
+    if (!new_heads) return 0;
+    heads = new_heads;
+    int *new_tree = realloc(tree, (size_t)(grown + 1) * sizeof(int));
+    if (!new_tree) return 0;
+    tree = new_tree;
+
+    for (int b = bucket_count; b < grown; b++) {
+        counts[b] = 0;
+        heads[b] = -1;
+    }
+    bucket_count = grown;
+
+    // O(P) build: each node passes its sum up to its parent
+    tree[0] = 0;
+    for (int i = 1; i <= bucket_count; i++) tree[i] = counts[i - 1];
+    for (int i = 1; i <= bucket_count; i++) {
+        int parent = i + (i & -i);
+        if (parent <= bucket_count) tree[parent] += tree[i];
+    }
+    return 1;
+}
+
+// ==================== ACCOUNTS ====================
+
+static Account *account_at(int index) {
+    return garage_table_at(&accounts, index);
+}
+
+static void unlink_account(int index) {
+    Account *account = account_at(index);
+    int bucket = bucket_of(account->points);
+
+    if (account->prev >= 0) account_at(account->prev)->next = account->next;
+    else heads[bucket] = account->next;
+    if (account->next >= 0) account_at(account->next)->prev = account->prev;
+
+    counts[bucket]--;
+    tree_add(bucket, -1);
+}
+
+static void link_account(int index) {
+    Account *account = account_at(index);
+    int bucket = bucket_of(account->points);
+
+    account->prev = -1;
+    account->next = heads[bucket];
+    if (heads[bucket] >= 0) account_at(heads[bucket])->prev = index;
+    heads[bucket] = index;
+
+    counts[bucket]++;
+    tree_add(bucket, 1);
+}
+
+// Set the customer's balance, adding the account when new
+static void set_points(const char *username, int points) {
+    if (!grow_buckets(bucket_of(points))) return;
+
+    int index = garage_table_find(&accounts, username);
+    if (index >= 0) {
+        unlink_account(index);
+        account_at(index)->points = points;
+        link_account(index);
+        return;
+    }
+
+    Account *account = garage_table_add(&accounts, username, sizeof(account->username));
+    if (!account) return;
+    account->points = points;
+    link_account(accounts.count - 1);
+}
+
+static int load_account(const GarageLoyalty *account, void *context) {
+    (void)context;
+    set_points(account->username, account->points);
+    return 0;
+}
+
+static void refresh(void) {
+    if (!garage_file_changed(LOYALTY_POINTS_FILE, &stamp)) return;
+
+    garage_table_clear(&accounts);
+    for (int b = 0; b < bucket_count; b++) {
+        counts[b] = 0;
+        heads[b] = -1;
+    }
+    if (tree) memset(tree, 0, (size_t)(bucket_count + 1) * sizeof(int));
+
+    garage_for_each_loyalty(load_account, NULL);
+}
+
+// ==================== QUERIES ====================
+
+// Competition rank: one more than the customers with more points
+static int rank_of(int bucket) {
+    return accounts.count - prefix(bucket) + 1;
+}
+
+static void fill_entry(int index, LeaderboardEntry *entry) {
+    const Account *account = account_at(index);
+    strcpy(entry->username, account->username);
+    entry->points = account->points;
+    entry->rank = rank_of(bucket_of(entry->points));
+}
+
+int leaderboard_count(void) {
+    refresh();
+    return accounts.count;
+}
+
+int leaderboard_top(LeaderboardEntry out[], int max) {
+    refresh();
+
+    int written = 0;
+    int position = 1;           // Position of the next customer, highest first
+    while (written < max && position <= accounts.count) {
+        int bucket = lower_bound(accounts.count - position + 1);
+        for (int i = heads[bucket]; i >= 0 && written < max; i = account_at(i)->next) {
+            fill_entry(i, &out[written++]);
+        }
+        position += counts[bucket];
+    }
+    return written;
+}
+
+int leaderboard_rank(const char *username, LeaderboardEntry *entry) {
+    refresh();
+
+    int index = garage_table_find(&accounts, username);
+    if (index < 0) return 0;
+    fill_entry(index, entry);
+    return 1;
+}
+
+int leaderboard_percentile(int percent) {
+    refresh();
+    if (accounts.count == 0) return -1;
+
+    if (percent < 0) percent = 0;
+    if (percent > 100) percent = 100;
+    long k = ((long)percent * accounts.count + 99) / 100;
+    return lower_bound(k < 1 ? 1 : (int)k);
+}
+
+// ==================== UPDATES ====================
+
+int leaderboard_add_points(const char *username, int points, int *balance) {
+    refresh();
+
+    int new_balance;
+    if (!garage_add_loyalty_points(username, points, &new_balance)) return 0;
+
+    set_points(username, new_balance);
+    garage_file_changed(LOYALTY_POINTS_FILE, &stamp); // Our own write
+    if (balance) *balance = new_balance;
+    return 1;
+}
+
+int leaderboard_spend_points(const char *username, int points) {
+    refresh();
+
+    int new_balance;
+    int result = garage_spend_loyalty_points(username, points, &new_balance);
+    if (result != 1) return result;
+
+    set_points(username, new_balance);
+    garage_file_changed(LOYALTY_POINTS_FILE, &stamp);
+    return result;
+}
+
+int leaderboard_redeem(const char *username, int points, float discount) {
+    int result = leaderboard_spend_points(username, points);
+    if (result == 1) garage_record_redemption(username, points, discount);
+    return result;
+}
@@ -0,0 +1,55 @@
+/**
+ * leaderboard.h - Loyalty points leaderboard for the Smart Garage system
+ *
+ * Balances from loyalty_points.txt are counted per point value in a
+ * Fenwick (binary indexed) tree, so "how many customers have more points
+ * than this" and "which balance is the k-th highest" are O(log P) for
+ * balances up to P. That gives a customer's rank, the top K and the
+ * point percentiles without sorting the file.
+ *
+ * Balance changes made through leaderboard_add_points(),
+ * leaderboard_spend_points() and leaderboard_redeem() move one customer
+ * in the tree. When another
+ * program changes loyalty_points.txt, the leaderboard is reloaded on the
+ * next call. Ties share a rank (1, 2, 2, 4) and are listed in no
+ * particular order. Balances above LEADERBOARD_MAX_POINTS count as that
+ * many for ranking.
+ *
+ * Usage:
+ *   LeaderboardEntry top[10];
+ *   int count = leaderboard_top(top, 10);
+ *   for (int i = 0; i < count; i++) printf("#%d %s %d\n", top[i].rank, top[i].username, top[i].points);
+ */
+#ifndef LEADERBOARD_H
+#define LEADERBOARD_H
+
+#define LEADERBOARD_MAX_POINTS (1 << 20)
+
+typedef struct {
+    char username[30];
+    int points;
+    int rank;                   // 1 = most points
+} LeaderboardEntry;
+
+// Customers with a loyalty account
+int leaderboard_count(void);
+
+// Up to `max` customers with the most points, highest first; returns the
+// number written
+int leaderboard_top(LeaderboardEntry out[], int max);
+
+// 1 and the customer's entry when they have an account, 0 otherwise
+int leaderboard_rank(const char *username, LeaderboardEntry *entry);
+
+// The balance `percent` (0-100) of the customers are at or below;
+// -1 when there are no accounts
+int leaderboard_percentile(int percent);
+
+// garage_add_loyalty_points(), garage_spend_loyalty_points() and
+// garage_redeem_loyalty_points() that also move the customer on the
+// leaderboard; same results
+int leaderboard_add_points(const char *username, int points, int *balance);
+int leaderboard_spend_points(const char *username, int points);
+int leaderboard_redeem(const char *username, int points, float discount);
+
+#endif
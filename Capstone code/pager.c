@@ -0,0 +1,214 @@
+/**
+ * pager.c - Page-at-a-time browsing of line based data files
+ *
+ * Files are opened in binary mode so offsets are plain byte positions on
+ * every platform (Windows text mode would make backward seeks unreliable);
+ * lines therefore keep any "\r\n" ending, which the row parsers ignore.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include "pager.h"
+
+#define PAGER_LINE_MAX 512
+#define PAGER_CHUNK 256
+
+/**
+ * Read the line starting at `offset`; returns 0 at end of file.
+ * Overlong lines are truncated and the rest of the line skipped.
+ */
+static int read_line_at(Pager *pager, long offset, char *line, int size, long *next) {
+    if (fseek(pager->file, offset, SEEK_SET) != 0) return 0;
+    if (!fgets(line, size, pager->file)) return 0;
+
+    if (!strchr(line, '\n')) {
+        int ch;
+        while ((ch = fgetc(pager->file)) != EOF && ch != '\n') {
+        }
+    }
+    *next = ftell(pager->file);
+    return 1;
+}
+
+static int accepts(const Pager *pager, const char *line) {
+    const char *p = line;
+    while (*p && isspace((unsigned char)*p)) p++;
+    if (*p == '\0' || *p == '#') return 0; // Blank line or header comment
+
+    return pager->filter ? pager->filter(line, pager->filter_context) : 1;
+}
+
+/**
+ * Offset where the line before the one at `offset` starts, -1 at the top
+ */
+static long previous_line_start(Pager *pager, long offset) {
+    char chunk[PAGER_CHUNK];
+    long pos = offset - 1; // Skip the newline that ends the previous line
+
+    if (offset <= 0) return -1;
+
+    while (pos > 0) {
+        long from = pos > PAGER_CHUNK ? pos - PAGER_CHUNK : 0;
+        size_t count = (size_t)(pos - from);
+
+        if (fseek(pager->file, from, SEEK_SET) != 0) return 0;
+        count = fread(chunk, 1, count, pager->file);
+
+        for (long i = (long)count - 1; i >= 0; i--) {
+            if (chunk[i] == '\n') return from + i + 1;
+        }
+        pos = from;
+    }
+    return 0;
+}
+
+/**
+ * Is there a row to show at or after `offset`?
+ */
+static int has_row_from(Pager *pager, long offset) {
+    char line[PAGER_LINE_MAX];
+    long next;
+
+    while (read_line_at(pager, offset, line, sizeof(line), &next)) {
+        if (accepts(pager, line)) return 1;
+        offset = next;
+    }
+    return 0;
+}
+
+static int has_row_before(Pager *pager, long offset) {
+    char line[PAGER_LINE_MAX];
+    long start, next;
+
+    while ((start = previous_line_start(pager, offset)) >= 0) {
+        if (read_line_at(pager, start, line, sizeof(line), &next) && accepts(pager, line)) return 1;
+        offset = start;
+    }
+    return 0;
+}
+
+int pager_open(Pager *pager, const char *path, int page_size,
+               PagerRowFilter filter, void *filter_context) {
+    memset(pager, 0, sizeof(*pager));
+
+    pager->file = fopen(path, "rb");
+    if (!pager->file) return 0;
+
+    fseek(pager->file, 0, SEEK_END);
+    pager->file_size = ftell(pager->file);
+
+    pager->page_size = page_size > 0 ? page_size : 1;
+    pager->filter = filter;
+    pager->filter_context = filter_context;
+    pager->page_number = 1;
+    return 1;
+}
+
+void pager_close(Pager *pager) {
+    if (pager->file) fclose(pager->file);
+    pager->file = NULL;
+}
+
+int pager_read_page(Pager *pager, PagerRowRender render, void *context) {
+    char line[PAGER_LINE_MAX];
+    long offset = pager->page_start;
+    long next;
+    int rows = 0;
+
+    while (rows < pager->page_size && read_line_at(pager, offset, line, sizeof(line), &next)) {
+        if (accepts(pager, line)) {
+            render(line, context);
+            rows++;
+        }
+        offset = next;
+    }
+
+    pager->page_end = offset;
+    pager->has_next = rows == pager->page_size && has_row_from(pager, offset);
+    return rows;
+}
+
+int pager_next(Pager *pager) {
+    if (!pager->has_next) return 0;
+
+    pager->page_start = pager->page_end;
+    if (pager->page_number > 0) pager->page_number++;
+    return 1;
+}
+
+/**
+ * Walk back one page of rows from the cursor, one line at a time
+ */
+int pager_prev(Pager *pager) {
+    char line[PAGER_LINE_MAX];
+    long offset = pager->page_start;
+    long next;
+    int rows = 0;
+
+    while (rows < pager->page_size) {
+        long start = previous_line_start(pager, offset);
+        if (start < 0) break;
+
+        if (read_line_at(pager, start, line, sizeof(line), &next) && accepts(pager, line)) rows++;
+        offset = start;
+    }
+
+    if (offset == pager->page_start) return 0;
+
+    pager->page_start = offset;
+    if (offset == 0 || !has_row_before(pager, offset)) {
+        pager->page_number = 1;
+    } else if (pager->page_number > 1) {
+        pager->page_number--;
+    }
+    return 1;
+}
+
+void pager_first(Pager *pager) {
+    pager->page_start = 0;
+    pager->page_number = 1;
+}
+
+/**
+ * Binary search over line starts for the first line dated on or after
+ * date_key. Lines without a date count as older than any date.
+ */
+void pager_seek_date(Pager *pager, long date_key, PagerRowDate date_of) {
+    char line[PAGER_LINE_MAX];
+    long low = 0, high = pager->file_size;
+    long next;
+
+    while (low < high) {
+        long mid = low + (high - low) / 2;
+        long start = mid;
+
+        // Move to the first line that starts at or after mid
+        if (mid > 0) {
+            if (!read_line_at(pager, mid - 1, line, sizeof(line), &start)) start = pager->file_size;
+        }
+
+        if (start >= high) {
+            // No line starts in [mid, high): settle the line at low directly
+            if (!read_line_at(pager, low, line, sizeof(line), &next)) break;
+            if (date_of(line) >= date_key) high = low;
+            else low = next;
+            continue;
+        }
+
+        if (!read_line_at(pager, start, line, sizeof(line), &next)) {
+            high = start;
+        } else if (date_of(line) < date_key) {
+            low = next;
+        } else {
+            high = start;
+        }
+    }
+
+    pager->page_start = low;
+    pager->page_number = (low == 0) ? 1 : 0;
+}
+
+int pager_percent(const Pager *pager) {
+    if (pager->file_size <= 0) return 100;
+    return (int)(pager->page_start * 100 / pager->file_size);
+}
@@ -0,0 +1,62 @@
+/**
+ * pager.h - Page-at-a-time browsing of line based data files
+ *
+ * A Pager keeps a cursor (the file offset of the first row on the
+ * current page) instead of loading the table. Each page is read straight
+ * from that offset, paging back walks the file backwards from the
+ * cursor, and jump-to-date binary searches the file by offset, so memory
+ * use is the same for ten rows or ten million.
+ *
+ * Usage:
+ *   Pager pager;
+ *   if (pager_open(&pager, ORDERS_FILE, 15, NULL, NULL)) {
+ *       pager_read_page(&pager, render_row, context);  // current page
+ *       pager_next(&pager);                            // then read again
+ *       pager_close(&pager);
+ *   }
+ */
+#ifndef PAGER_H
+#define PAGER_H
+
+#include <stdio.h>
+
+// 1 when a line is a row to show (data line that passes any filter)
+typedef int (*PagerRowFilter)(const char *line, void *context);
+// Draw one row
+typedef void (*PagerRowRender)(const char *line, void *context);
+// Date of a row as YYYYMMDD, 0 when it has none
+typedef long (*PagerRowDate)(const char *line);
+
+typedef struct {
+    FILE *file;
+    long file_size;
+    int page_size;
+    PagerRowFilter filter;  // NULL accepts every non-blank line
+    void *filter_context;
+
+    long page_start;        // Cursor: offset of the first row on the page
+    long page_end;          // Offset just past the last row read
+    int page_number;        // 1-based; 0 after a jump (unknown)
+    int has_next;           // More rows after page_end
+} Pager;
+
+int pager_open(Pager *pager, const char *path, int page_size,
+               PagerRowFilter filter, void *filter_context);
+void pager_close(Pager *pager);
+
+// Render the rows of the current page; returns how many were shown
+int pager_read_page(Pager *pager, PagerRowRender render, void *context);
+
+// Move the cursor; each returns 1 when it moved
+int pager_next(Pager *pager);
+int pager_prev(Pager *pager);
+void pager_first(Pager *pager);
+
+// Put the cursor on the first row dated on or after date_key (YYYYMMDD).
+// Assumes the file is in date order, which holds for append-only logs.
+void pager_seek_date(Pager *pager, long date_key, PagerRowDate date_of);
+
+// Cursor position through the file, 0-100
+int pager_percent(const Pager *pager);
+
+#endif
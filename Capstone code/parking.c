@@ -0,0 +1,398 @@
+/**
+ * parking.c - Parking occupancy index for the Smart Garage system
+ *
+ * The stays array is sorted by entry time; the implicit binary tree over
+ * it takes the middle of each range as the node, so no pointers are
+ * stored. latest_exit[i] is the latest exit in the subtree rooted at i. An
+ * overlap query skips a subtree when that exit is before the window, and
+ * skips right subtrees that start after it.
+ *
+ * Both data files are small next to orders.txt, so the index is rebuilt
+ * whenever either one changes.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "garage.h"
+#include "parking.h"
+
+#define MIN_STAYS 64
+#define OPEN_END ((long long)0x7fffffffffffffffLL)
+
+typedef struct {
+    char car_number[20];
+    int first;                  // Earliest stay, -1 = none
+} Plate;
+
+static ParkingStay *stays;
+static int stay_count, stay_capacity;
+static int *next_of_car;        // Next stay of the same car, -1 = last
+static long long *latest_exit;
+
+static GarageTable plates = GARAGE_TABLE(Plate);
+
+static GarageFileStamp parking_stamp, exits_stamp;
+static long loaded_day;         // Open stays depend on today's date
+
+// ==================== TIMES ====================
+
+static time_t day_start(long date_key, int days_later) {
+    struct tm day;
+
+    memset(&day, 0, sizeof(day));
+    day.tm_year = (int)(date_key / 10000) - 1900;
+    day.tm_mon = (int)(date_key / 100 % 100) - 1;
+    day.tm_mday = (int)(date_key % 100) + days_later;
+    day.tm_isdst = -1;
+    return mktime(&day);
+}
+
+static long date_key_of(time_t when) {
+    struct tm *local = localtime(&when);
+    return (long)(local->tm_year + 1900) * 10000 + (local->tm_mon + 1) * 100 + local->tm_mday;
+}
+
+static int is_meridiem(const char *text, int *pm) {
+    if (tolower((unsigned char)text[0]) == 'a' || tolower((unsigned char)text[0]) == 'p') {
+        if (tolower((unsigned char)text[1]) == 'm' && !isalnum((unsigned char)text[2])) {
+            *pm = tolower((unsigned char)text[0]) == 'p';
+            return 1;
+        }
+    }
+    return 0;
+}
+
+time_t parking_entry_time(const char *date, const char *time_text) {
+    long date_key = garage_date_key(date);
+    int hour = 0, minute = 0, used = 0, pm;
+
+    if (date_key == 0) return -1;
+
+    // "14:30", "4.01", "3.34AM", "2.00 pm"; anything else counts as midnight
+    if (sscanf(time_text, "%d%*[.:]%d%n", &hour, &minute, &used) == 2) {
+        const char *rest = time_text + used;
+        while (*rest == ' ') rest++;
+        if (is_meridiem(rest, &pm) && hour >= 1 && hour <= 12) hour = hour % 12 + (pm ? 12 : 0);
+        if (hour < 0 || hour > 23 || minute < 0 || minute > 59) hour = minute = 0;
+    } else {
+        hour = minute = 0;
+    }
+
+    time_t start = day_start(date_key, 0);
+    return start == (time_t)-1 ? -1 : start + hour * 3600 + minute * 60;
+}
+
+static long long end_of(const ParkingStay *stay) {
+    return stay->open ? OPEN_END : (long long)stay->exit;
+}
+
+// ==================== LOADING ====================
+
+static Plate *plate_at(int index) {
+    return garage_table_at(&plates, index);
+}
+
+static int find_plate(const char *car_number, int create) {
+    int index = garage_table_find(&plates, car_number);
+    if (index >= 0 || !create) return index;
+
+    Plate *plate = garage_table_add(&plates, car_number, sizeof(plate->car_number));
+    if (!plate) return -1;
+    plate->first = -1;
+    return plates.count - 1;
+}
+
+static int add_stay(const GarageParking *parking, void *context) {
+    const char *time_text = parking->entry_time;
+    const char *maker = parking->manufacturer;
+    char clock[40];
+    int pm;
+    (void)context;
+
+    // Older records split "4.01 AM": the AM landed in the manufacturer
+    if (is_meridiem(maker, &pm)) {
+        snprintf(clock, sizeof(clock), "%s %.2s", parking->entry_time, maker);
+        time_text = clock;
+        maker += 2;
+        while (*maker == ' ') maker++;
+    }
+
+    time_t entry = parking_entry_time(parking->date, time_text);
+    if (entry == (time_t)-1) return 0;
+
+    if (stay_count == stay_capacity) {
+        int capacity = stay_capacity ? stay_capacity * 2 : MIN_STAYS;
+        ParkingStay *grown = realloc(stays, (size_t)capacity * sizeof(ParkingStay));
+        if (!grown) return 1;
+        stays = grown;
+        stay_capacity = capacity;
+    }
+
+    ParkingStay *stay = &stays[stay_count++];
+    memset(stay, 0, sizeof(ParkingStay));
+    snprintf(stay->username, sizeof(stay->username), "%s", parking->username);
+    snprintf(stay->car_number, sizeof(stay->car_number), "%s", parking->car_number);
+    snprintf(stay->manufacturer, sizeof(stay->manufacturer), "%s", maker);
+    stay->entry = entry;
+    return 0;
+}
+
+static int compare_entry(const void *a, const void *b) {
+    const ParkingStay *x = a, *y = b;
+    if (x->entry != y->entry) return x->entry < y->entry ? -1 : 1;
+    return strcmp(x->car_number, y->car_number);
+}
+
+/**
+ * parking_exits.txt "CAR YYYY-MM-DD HH:MM": each exit closes the car's
+ * latest stay that began before it and has no exit yet
+ */
+static void apply_exits(void) {
+    char line[GARAGE_LINE_MAX], car[20], date[20], clock[20];
+    FILE *f = fopen(PARKING_EXITS_FILE, "r");
+
+    if (!f) return;
+    while (fgets(line, sizeof(line), f)) {
+        if (sscanf(line, "%19s %19s %19s", car, date, clock) != 3) continue;
+
+        time_t left_at = parking_entry_time(date, clock);
+        int plate = find_plate(car, 0);
+        if (left_at == (time_t)-1 || plate < 0) continue;
+
+        int latest = -1;
+        for (int i = plate_at(plate)->first; i >= 0 && stays[i].entry <= left_at; i = next_of_car[i]) {
+            if (!stays[i].exit_recorded) latest = i;
+        }
+        if (latest >= 0) {
+            stays[latest].exit = left_at;
+            stays[latest].exit_recorded = 1;
+        }
+    }
+    fclose(f);
+}
+
+/**
+ * Fill latest_exit[] for the subtree over stays[low, high); returns it
+ */
+static long long build_tree(int low, int high) {
+    if (low >= high) return -1;
+
+    int middle = low + (high - low) / 2;
+    long long latest = end_of(&stays[middle]);
+    long long left = build_tree(low, middle);
+    long long right = build_tree(middle + 1, high);
+
+    if (left > latest) latest = left;
+    if (right > latest) latest = right;
+    latest_exit[middle] = latest;
+    return latest;
+}
+
+static void rebuild(void) {
+    long today = date_key_of(time(NULL));
+
+    stay_count = 0;
+    garage_table_clear(&plates);
+
+    garage_for_each_parking(add_stay, NULL);
+    qsort(stays, (size_t)stay_count, sizeof(ParkingStay), compare_entry);
+
+    free(next_of_car);
+    free(latest_exit);
+    next_of_car = malloc((size_t)(stay_count ? stay_count : 1) * sizeof(int));
+    latest_exit = malloc((size_t)(stay_count ? stay_count : 1) * sizeof(long long));
+    if (!next_of_car || !latest_exit) {
+        stay_count = 0;
+        return;
+    }
+
+    // Chain each car's stays in entry order (walk backwards, push front)
+    for (int i = stay_count - 1; i >= 0; i--) {
+        int plate = find_plate(stays[i].car_number, 1);
+        next_of_car[i] = plate >= 0 ? plate_at(plate)->first : -1;
+        if (plate >= 0) plate_at(plate)->first = i;
+    }
+
+    apply_exits();
+
+    // No exit on file: gone by the car's next entry or by midnight, and
+    // still parked if it came in today
+    for (int i = 0; i < stay_count; i++) {
+        ParkingStay *stay = &stays[i];
+        if (stay->exit_recorded) continue;
+
+        long day = date_key_of(stay->entry);
+        stay->exit = day_start(day, 1);
+        if (next_of_car[i] >= 0 && stays[next_of_car[i]].entry < stay->exit) {
+            stay->exit = stays[next_of_car[i]].entry;
+        } else if (day >= today) {
+            stay->open = 1;
+        }
+    }
+
+    build_tree(0, stay_count);
+    loaded_day = today;
+}
+
+static void refresh(void) {
+    int changed = garage_file_changed(CAR_PARKING_FILE, &parking_stamp);
+    changed |= garage_file_changed(PARKING_EXITS_FILE, &exits_stamp);
+    if (changed || date_key_of(time(NULL)) != loaded_day) rebuild();
+}
+
+// ==================== QUERIES ====================
+
+typedef struct {
+    ParkingStayVisitor visit;
+    void *context;
+    int count;
+    int stopped;
+} Walk;
+
+/**
+ * Visit stays over [low, high) that overlap [from, to), in entry order
+ */
+static void overlapping(int low, int high, time_t from, time_t to, Walk *walk) {
+    if (low >= high || walk->stopped) return;
+
+    int middle = low + (high - low) / 2;
+    if (latest_exit[middle] <= (long long)from) return;
+
+    overlapping(low, middle, from, to, walk);
+    if (walk->stopped || stays[middle].entry >= to) return;
+
+    if (end_of(&stays[middle]) > (long long)from) {
+        walk->count++;
+        if (walk->visit && walk->visit(&stays[middle], walk->context)) {
+            walk->stopped = 1;
+            return;
+        }
+    }
+    overlapping(middle + 1, high, from, to, walk);
+}
+
+int parking_parked_at(time_t when, ParkingStayVisitor visit, void *context) {
+    Walk walk = {visit, context, 0, 0};
+
+    refresh();
+    overlapping(0, stay_count, when, when + 1, &walk);
+    return walk.count;
+}
+
+int parking_history(const char *car_number, ParkingStayVisitor visit, void *context) {
+    int count = 0;
+
+    refresh();
+    int plate = find_plate(car_number, 0);
+    if (plate < 0) return 0;
+
+    for (int i = plate_at(plate)->first; i >= 0; i = next_of_car[i]) {
+        count++;
+        if (visit && visit(&stays[i], context)) break;
+    }
+    return count;
+}
+
+// Arrivals (+1) and departures (-1) inside one day, for the peak sweep
+typedef struct {
+    time_t when;
+    int change;
+} Event;
+
+typedef struct {
+    Event *events;
+    int count;
+    time_t day_begin, day_end;
+} DayEvents;
+
+static int collect_event(const ParkingStay *stay, void *context) {
+    DayEvents *day = context;
+    Event *arrive = &day->events[day->count++];
+    Event *leave = &day->events[day->count++];
+
+    arrive->when = stay->entry < day->day_begin ? day->day_begin : stay->entry;
+    arrive->change = 1;
+    leave->when = stay->open || stay->exit > day->day_end ? day->day_end : stay->exit;
+    leave->change = -1;
+    return 0;
+}
+
+static int compare_event(const void *a, const void *b) {
+    const Event *x = a, *y = b;
+    if (x->when != y->when) return x->when < y->when ? -1 : 1;
+    return x->change - y->change; // Leave before arrive at the same instant
+}
+
+int parking_daily_occupancy(long from, long to, ParkingDay out[], int max) {
+    int days = 0;
+
+    refresh();
+    for (int n = 0; days < max; n++) {
+        time_t begin = day_start(from, n), end = day_start(from, n + 1);
+        long date = date_key_of(begin);
+        if (date > to || begin == (time_t)-1) break;
+
+        ParkingDay *day = &out[days++];
+        Walk walk = {NULL, NULL, 0, 0};
+        day->date = date;
+        day->entries = 0;
+        day->peak = 0;
+
+        overlapping(0, stay_count, begin, end, &walk);
+        if (walk.count == 0) continue;
+
+        DayEvents events = {malloc((size_t)walk.count * 2 * sizeof(Event)), 0, begin, end};
+        if (!events.events) continue;
+
+        walk.visit = collect_event;
+        walk.context = &events;
+        walk.count = 0;
+        overlapping(0, stay_count, begin, end, &walk);
+        qsort(events.events, (size_t)events.count, sizeof(Event), compare_event);
+
+        int parked = 0;
+        for (int i = 0; i < events.count; i++) {
+            parked += events.events[i].change;
+            if (parked > day->peak) day->peak = parked;
+        }
+        free(events.events);
+
+        // Entries that day: stays whose entry is inside [begin, end)
+        int low = 0, high = stay_count;
+        while (low < high) {
+            int middle = (low + high) / 2;
+            if (stays[middle].entry < begin) low = middle + 1;
+            else high = middle;
+        }
+        while (low < stay_count && stays[low].entry < end) {
+            day->entries++;
+            low++;
+        }
+    }
+    return days;
+}
+
+// ==================== EXITS ====================
+
+int parking_check_out(const char *car_number, time_t when) {
+    char date[20], clock[20];
+
+    refresh();
+    int plate = find_plate(car_number, 0);
+    int latest = -1;
+
+    if (plate >= 0) {
+        for (int i = plate_at(plate)->first; i >= 0 && stays[i].entry <= when; i = next_of_car[i]) latest = i;
+    }
+    if (latest < 0 || !stays[latest].open) return 0;
+
+    FILE *f = fopen(PARKING_EXITS_FILE, "a");
+    if (!f) return -1;
+
+    strftime(date, sizeof(date), "%Y-%m-%d", localtime(&when));
+    strftime(clock, sizeof(clock), "%H:%M", localtime(&when));
+    fprintf(f, "%s %s %s\n", car_number, date, clock);
+    fclose(f);
+    return 1;
+}
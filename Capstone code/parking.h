@@ -0,0 +1,62 @@
+/**
+ * parking.h - Parking occupancy index for the Smart Garage system
+ *
+ * Each car_parking.txt entry becomes a stay with entry and exit times in
+ * seconds since the epoch. Free-form entry times ("3.34AM", "4.01 AM",
+ * "14:30") are normalized once at load. Exits are recorded in
+ * parking_exits.txt. A stay with no exit ends at midnight after its entry
+ * day, or is still open when it started today.
+ *
+ * Stays are sorted by entry time and laid out as an interval tree (each
+ * node keeps the latest exit below it), so "who is parked at time T" visits
+ * only the stays that overlap T. A hash of plates lists each car's stays.
+ *
+ * Usage:
+ *   static int show(const ParkingStay *stay, void *context) {
+ *       printf("%s %s\n", stay->car_number, stay->username);
+ *       return 0;
+ *   }
+ *   parking_parked_at(time(NULL), show, NULL);
+ */
+#ifndef PARKING_H
+#define PARKING_H
+
+#include <time.h>
+
+typedef struct {
+    char username[30];
+    char car_number[20];
+    char manufacturer[50];
+    time_t entry;
+    time_t exit;                // Recorded or assumed exit; unused while open
+    int open;                   // Still parked
+    int exit_recorded;          // Exit came from parking_exits.txt
+} ParkingStay;
+
+typedef struct {
+    long date;                  // YYYYMMDD
+    int entries;                // Stays that started that day
+    int peak;                   // Most cars parked at once that day
+} ParkingDay;
+
+// Visitors return 0 to continue and non-zero to stop
+typedef int (*ParkingStayVisitor)(const ParkingStay *stay, void *context);
+
+// Entry time for a record's date and free-form time, -1 when the date is bad
+time_t parking_entry_time(const char *date, const char *time_text);
+
+// Stays that include `when`, earliest entry first; returns how many
+int parking_parked_at(time_t when, ParkingStayVisitor visit, void *context);
+
+// Every stay of one car, earliest first; returns how many
+int parking_history(const char *car_number, ParkingStayVisitor visit, void *context);
+
+// Entries and peak occupancy for each day from..to (YYYYMMDD, at most
+// `max` days); returns the number of days written
+int parking_daily_occupancy(long from, long to, ParkingDay out[], int max);
+
+// Record that a parked car left at `when`: 1 on success, 0 when the car is
+// not parked, -1 when the exits file cannot be written
+int parking_check_out(const char *car_number, time_t when);
+
+#endif
@@ -0,0 +1,412 @@
+/**
+ * platform.c - Windows console and POSIX terminal implementations
+ */
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include "platform.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <conio.h>
+#include <io.h>
+#ifndef ENABLE_VIRTUAL_TERMINAL_PROCESSING
+#define ENABLE_VIRTUAL_TERMINAL_PROCESSING 0x0004
+#endif
+#else
+#include <unistd.h>
+#include <time.h>
+#include <termios.h>
+#include <sys/ioctl.h>
+#include <sys/file.h>
+#include <pthread.h>
+#endif
+
+static int ansi_enabled = 0;
+static volatile sig_atomic_t console_resized = 1;
+
+// One worker of platform_run_parallel()
+typedef struct {
+    PlatformTask task;
+    int worker;
+    void *context;
+} ParallelTask;
+
+#ifdef _WIN32
+// ==================== WINDOWS CONSOLE ====================
+
+static COORD saved_cursor;
+
+void platform_init() {
+    HANDLE output = GetStdHandle(STD_OUTPUT_HANDLE);
+    HANDLE input = GetStdHandle(STD_INPUT_HANDLE);
+    DWORD mode;
+
+    // Windows 10+ consoles understand escape codes once asked to
+    ansi_enabled = GetConsoleMode(output, &mode) &&
+                   SetConsoleMode(output, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING);
+
+    // Needed to receive WINDOW_BUFFER_SIZE_EVENT records
+    if (GetConsoleMode(input, &mode)) {
+        SetConsoleMode(input, mode | ENABLE_WINDOW_INPUT);
+    }
+    console_resized = 1;
+}
+
+void platform_write(const char *data, size_t len) {
+    HANDLE output = GetStdHandle(STD_OUTPUT_HANDLE);
+    DWORD mode, written;
+
+    if (len == 0) return;
+
+    if (GetConsoleMode(output, &mode)) {
+        WriteConsoleA(output, data, (DWORD)len, &written, NULL);
+    } else {
+        fwrite(data, 1, len, stdout);
+        fflush(stdout);
+    }
+}
+
+void platform_set_text_attribute(int color) {
+    SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), (WORD)color);
+}
+
+void platform_clear_console() {
+    HANDLE output = GetStdHandle(STD_OUTPUT_HANDLE);
+    CONSOLE_SCREEN_BUFFER_INFO csbi;
+    COORD home = {0, 0};
+    DWORD written;
+
+    if (!GetConsoleScreenBufferInfo(output, &csbi)) return;
+
+    DWORD cells = (DWORD)csbi.dwSize.X * csbi.dwSize.Y;
+    FillConsoleOutputCharacterA(output, ' ', cells, home, &written);
+    FillConsoleOutputAttribute(output, csbi.wAttributes, cells, home, &written);
+    SetConsoleCursorPosition(output, home);
+}
+
+int platform_console_width() {
+    CONSOLE_SCREEN_BUFFER_INFO csbi;
+    if (!GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &csbi)) return 0;
+    return csbi.srWindow.Right - csbi.srWindow.Left + 1;
+}
+
+int platform_console_height() {
+    CONSOLE_SCREEN_BUFFER_INFO csbi;
+    if (!GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &csbi)) return 0;
+    return csbi.srWindow.Bottom - csbi.srWindow.Top + 1;
+}
+
+int platform_console_resized() {
+    HANDLE input = GetStdHandle(STD_INPUT_HANDLE);
+    INPUT_RECORD records[32];
+    DWORD count = 0;
+
+    // Peek only: the events are discarded by the next console read
+    if (PeekConsoleInput(input, records, 32, &count)) {
+        for (DWORD i = 0; i < count; i++) {
+            if (records[i].EventType == WINDOW_BUFFER_SIZE_EVENT) console_resized = 1;
+        }
+    }
+
+    if (!console_resized) return 0;
+    console_resized = 0;
+    return 1;
+}
+
+int platform_cursor_row() {
+    CONSOLE_SCREEN_BUFFER_INFO csbi;
+    if (!GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &csbi)) return -1;
+    return csbi.dwCursorPosition.Y;
+}
+
+void platform_save_cursor() {
+    CONSOLE_SCREEN_BUFFER_INFO csbi;
+    fflush(stdout);
+    if (GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &csbi)) {
+        saved_cursor = csbi.dwCursorPosition;
+    }
+}
+
+void platform_restore_cursor() {
+    fflush(stdout);
+    SetConsoleCursorPosition(GetStdHandle(STD_OUTPUT_HANDLE), saved_cursor);
+}
+
+int platform_getch() {
+    return _getch();
+}
+
+static int stdin_is_console() {
+    return 1; // _getch() always reads the console, even with stdin redirected
+}
+
+void platform_sleep_ms(int milliseconds) {
+    Sleep(milliseconds);
+}
+
+double platform_seconds() {
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+}
+
+static DWORD WINAPI run_parallel_task(LPVOID argument) {
+    ParallelTask *task = argument;
+    task->task(task->worker, task->context);
+    return 0;
+}
+
+void platform_run_parallel(int workers, PlatformTask task, void *context) {
+    HANDLE threads[PLATFORM_MAX_WORKERS];
+    ParallelTask tasks[PLATFORM_MAX_WORKERS];
+
+    if (workers > PLATFORM_MAX_WORKERS) workers = PLATFORM_MAX_WORKERS;
+
+    for (int i = 1; i < workers; i++) {
+        tasks[i].task = task;
+        tasks[i].worker = i;
+        tasks[i].context = context;
+        threads[i] = CreateThread(NULL, 0, run_parallel_task, &tasks[i], 0, NULL);
+        if (!threads[i]) task(i, context); // No thread: do that share here
+    }
+
+    task(0, context); // The calling thread is worker 0
+
+    for (int i = 1; i < workers; i++) {
+        if (threads[i]) {
+            WaitForSingleObject(threads[i], INFINITE);
+            CloseHandle(threads[i]);
+        }
+    }
+}
+
+int platform_lock_file(FILE *file) {
+    HANDLE handle = (HANDLE)_get_osfhandle(_fileno(file));
+    OVERLAPPED from_start = {0};
+    return LockFileEx(handle, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &from_start) != 0;
+}
+
+void platform_unlock_file(FILE *file) {
+    HANDLE handle = (HANDLE)_get_osfhandle(_fileno(file));
+    OVERLAPPED from_start = {0};
+    UnlockFileEx(handle, 0, MAXDWORD, MAXDWORD, &from_start);
+}
+
+#else
+// ==================== POSIX TERMINAL ====================
+
+static void handle_resize(int signal_number) {
+    (void)signal_number;
+    console_resized = 1;
+}
+
+void platform_init() {
+    struct sigaction action;
+    const char *term = getenv("TERM");
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = handle_resize;
+    action.sa_flags = SA_RESTART; // Don't interrupt scanf() on resize
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGWINCH, &action, NULL);
+
+    // Skip escape codes when output goes to a file or a dumb terminal
+    ansi_enabled = isatty(STDOUT_FILENO) && !(term && strcmp(term, "dumb") == 0);
+    console_resized = 1;
+}
+
+void platform_write(const char *data, size_t len) {
+    while (len > 0) {
+        ssize_t written = write(STDOUT_FILENO, data, len);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return;
+        }
+        data += written;
+        len -= (size_t)written;
+    }
+}
+
+void platform_set_text_attribute(int color) {
+    (void)color; // Colors are sent as escape codes on POSIX terminals
+}
+
+void platform_clear_console() {
+    if (ansi_enabled) platform_write("\x1b[H\x1b[2J\x1b[3J", 11);
+}
+
+int platform_console_width() {
+    struct winsize size;
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0 && size.ws_col > 0) {
+        return size.ws_col;
+    }
+    const char *columns = getenv("COLUMNS");
+    return columns ? atoi(columns) : 0;
+}
+
+int platform_console_height() {
+    struct winsize size;
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0 && size.ws_row > 0) {
+        return size.ws_row;
+    }
+    const char *lines = getenv("LINES");
+    return lines ? atoi(lines) : 0;
+}
+
+int platform_console_resized() {
+    if (!console_resized) return 0;
+    console_resized = 0;
+    return 1;
+}
+
+int platform_cursor_row() {
+    return -1; // Not queried: it would mean reading a reply from the terminal
+}
+
+void platform_save_cursor() {
+    fflush(stdout);
+    if (ansi_enabled) platform_write("\x1b" "7", 2);
+}
+
+void platform_restore_cursor() {
+    fflush(stdout);
+    if (ansi_enabled) platform_write("\x1b" "8", 2);
+}
+
+static int stdin_is_console() {
+    return isatty(STDIN_FILENO);
+}
+
+/**
+ * Read one key without echo (like _getch); falls back to stdio when
+ * stdin is not a terminal, e.g. when input is scripted
+ */
+int platform_getch() {
+    struct termios original, raw;
+    unsigned char ch;
+
+    if (!isatty(STDIN_FILENO) || tcgetattr(STDIN_FILENO, &original) != 0) {
+        return getchar();
+    }
+
+    raw = original;
+    raw.c_lflag &= ~(ICANON | ECHO);
+    raw.c_cc[VMIN] = 1;
+    raw.c_cc[VTIME] = 0;
+    tcsetattr(STDIN_FILENO, TCSANOW, &raw);
+
+    ssize_t count;
+    do {
+        count = read(STDIN_FILENO, &ch, 1);
+    } while (count < 0 && errno == EINTR);
+
+    tcsetattr(STDIN_FILENO, TCSANOW, &original);
+    return count == 1 ? ch : EOF;
+}
+
+void platform_sleep_ms(int milliseconds) {
+    struct timespec delay;
+    delay.tv_sec = milliseconds / 1000;
+    delay.tv_nsec = (long)(milliseconds % 1000) * 1000000L;
+    while (nanosleep(&delay, &delay) != 0 && errno == EINTR) {
+    }
+}
+
+double platform_seconds() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+static void *run_parallel_task(void *argument) {
+    ParallelTask *task = argument;
+    task->task(task->worker, task->context);
+    return NULL;
+}
+
+void platform_run_parallel(int workers, PlatformTask task, void *context) {
+    pthread_t threads[PLATFORM_MAX_WORKERS];
+    ParallelTask tasks[PLATFORM_MAX_WORKERS];
+    int started[PLATFORM_MAX_WORKERS] = {0};
+
+    if (workers > PLATFORM_MAX_WORKERS) workers = PLATFORM_MAX_WORKERS;
+
+    for (int i = 1; i < workers; i++) {
+        tasks[i].task = task;
+        tasks[i].worker = i;
+        tasks[i].context = context;
+        started[i] = pthread_create(&threads[i], NULL, run_parallel_task, &tasks[i]) == 0;
+        if (!started[i]) task(i, context); // No thread: do that share here
+    }
+
+    task(0, context); // The calling thread is worker 0
+
+    for (int i = 1; i < workers; i++) {
+        if (started[i]) pthread_join(threads[i], NULL);
+    }
+}
+
+// flock() rather than fcntl() locks: those belong to the process, so two
+// threads would both get one
+int platform_lock_file(FILE *file) {
+    int result;
+    do {
+        result = flock(fileno(file), LOCK_EX);
+    } while (result != 0 && errno == EINTR);
+    return result == 0;
+}
+
+void platform_unlock_file(FILE *file) {
+    flock(fileno(file), LOCK_UN);
+}
+#endif
+
+// ==================== SHARED ====================
+
+int platform_ansi_enabled() {
+    return ansi_enabled;
+}
+
+int platform_stdin_is_console() {
+    return stdin_is_console();
+}
+
+/**
+ * Hidden password input: echoes '*' and handles backspace
+ */
+void platform_read_password(char *password, int max_length) {
+    int i = 0;
+    int ch;
+
+    fflush(stdout);
+    while (i < max_length - 1) {
+        ch = platform_getch(); // Get character without displaying it
+
+        if (ch == EOF) {
+            break;
+        } else if (ch == '\r' || ch == '\n') { // Enter key pressed
+            // Scripted input still holds the newline left by the previous scanf
+            if (i == 0 && ch == '\n' && !stdin_is_console()) continue;
+            break;
+        } else if ((ch == '\b' || ch == 127) && i > 0) { // Backspace pressed
+            printf("\b \b"); // Erase the asterisk
+            fflush(stdout);
+            i--;
+        } else if (ch != '\b' && ch != 127) { // Normal character
+            password[i] = (char)ch;
+            printf("*"); // Display asterisk
+            fflush(stdout);
+            i++;
+        }
+    }
+    password[i] = '\0'; // Null terminate
+    printf("\n");
+}
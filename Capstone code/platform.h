@@ -0,0 +1,53 @@
+/**
+ * platform.h - Operating system layer for the Smart Garage system
+ *
+ * Everything that differs between the Windows console and a POSIX
+ * terminal lives behind these functions, so the rest of the program
+ * builds unchanged with MinGW on Windows and with gcc/clang on Linux
+ * (where it can be run under perf, valgrind or a scripted harness).
+ */
+#ifndef PLATFORM_H
+#define PLATFORM_H
+
+#include <stddef.h>
+#include <stdio.h>
+
+// Console setup (resize notifications, escape code support)
+void platform_init();
+int platform_ansi_enabled();
+
+// Console output
+void platform_write(const char *data, size_t len);
+void platform_set_text_attribute(int color);
+void platform_clear_console();
+
+// Console geometry (0 or -1 when unknown, e.g. output redirected)
+int platform_console_width();
+int platform_console_height();
+int platform_console_resized();
+int platform_cursor_row();
+void platform_save_cursor();
+void platform_restore_cursor();
+
+// Keyboard input
+int platform_getch();
+int platform_stdin_is_console();  // 0 when input is scripted (file or pipe)
+void platform_read_password(char *password, int max_length);
+
+// Timing
+void platform_sleep_ms(int milliseconds);
+double platform_seconds();        // Wall-clock seconds from an arbitrary start, for durations
+
+// Threads: run task(worker, context) for workers 0..workers-1 at the same
+// time and return when all are done (worker 0 runs on the calling thread)
+#define PLATFORM_MAX_WORKERS 16
+typedef void (*PlatformTask)(int worker, void *context);
+void platform_run_parallel(int workers, PlatformTask task, void *context);
+
+// File locks: wait for an exclusive lock on an open file (1 when held).
+// The lock belongs to this opening of the file, so it also keeps out
+// other threads that opened the same file themselves.
+int platform_lock_file(FILE *file);
+void platform_unlock_file(FILE *file);
+
+#endif
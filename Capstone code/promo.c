@@ -0,0 +1,445 @@
+/**
+ * promo.c - Promo code engine for the Smart Garage system
+ *
+ * Codes live in a GarageTable (file order, so listings and rewrites keep
+ * the admin's order). Per customer use counts sit in a second table keyed
+ * by "CODE USERNAME". Deleted codes stay in the table, flagged, until the
+ * next start.
+ *
+ * Usage log lines are "KIND CODE USERNAME id time":
+ *   HOLD code user 0 time    one use held for a checkout; id is the line's number
+ *   USED code user id time   hold id kept: the order was saved
+ *   FREE code user id time   hold id given back
+ *   BACK code user id time   a kept use given back (the order was not saved)
+ * Older "CODE USERNAME DATE" lines are finished uses. A held use counts
+ * against the limits until it is given back.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "garage.h"
+#include "platform.h"
+#include "promo.h"
+
+#define PROMO_TEMP_FILE "temp_discounts.txt"
+#define MIN_HOLDS 16
+
+#define USE_KEY_MAX (PROMO_CODE_MAX + 30)
+
+// How often one customer has used one code
+typedef struct {
+    char key[USE_KEY_MAX];      // "CODE USERNAME"
+    int count;
+} CustomerUse;
+
+static GarageTable codes = GARAGE_TABLE(PromoCode);
+static GarageTable uses = GARAGE_TABLE(CustomerUse);
+
+// A held use not yet kept or given back
+typedef struct {
+    long id;
+    int code;                   // Index into codes
+    char username[30];
+    long taken;                 // time_t when it was taken
+} UseHold;
+
+static UseHold *holds;
+static int hold_count, hold_capacity;
+
+static long lines_read;         // Usage lines applied; the next HOLD id is this + 1
+static GarageTail usage;        // How far promo_usage.txt is applied
+
+static int loaded;
+
+// ==================== TABLES ====================
+
+static PromoCode *code_at(int index) {
+    return garage_table_at(&codes, index);
+}
+
+static int find_code(const char *code) {
+    return garage_table_find(&codes, code);
+}
+
+static int append_code(const PromoCode *promo) {
+    PromoCode *added = garage_table_add(&codes, promo->code, sizeof(added->code));
+    if (!added) return -1;
+
+    *added = *promo;
+    return codes.count - 1;
+}
+
+/**
+ * Use count of one customer for one code; with `create`, a zero entry is
+ * added when there is none. NULL when missing (or out of memory).
+ */
+static CustomerUse *find_use(const char *code, const char *username, int create) {
+    char key[USE_KEY_MAX];
+    snprintf(key, sizeof(key), "%s %s", code, username);
+
+    int index = garage_table_find(&uses, key);
+    if (index >= 0) return garage_table_at(&uses, index);
+    return create ? garage_table_add(&uses, key, sizeof(key)) : NULL;
+}
+
+// ==================== FILES ====================
+
+static long today_key(void) {
+    time_t now = time(NULL);
+    struct tm *local = localtime(&now);
+    return (long)(local->tm_year + 1900) * 10000 + (local->tm_mon + 1) * 100 + local->tm_mday;
+}
+
+static int parse_code_line(const char *line, PromoCode *promo) {
+    char expires[20] = "-";
+
+    memset(promo, 0, sizeof(*promo));
+    if (sscanf(line, "%19s %f %19s %d %d", promo->code, &promo->percent,
+               expires, &promo->max_uses, &promo->per_customer) < 2) {
+        return 0;
+    }
+    if (promo->code[0] == '#') return 0;
+
+    if (strcmp(expires, "-") != 0) promo->expires = garage_date_key(expires);
+    return 1;
+}
+
+static void write_code_line(FILE *f, const PromoCode *promo) {
+    if (!promo->expires && !promo->max_uses && !promo->per_customer) {
+        fprintf(f, "%s %.1f\n", promo->code, promo->percent);
+        return;
+    }
+
+    char expires[32] = "-";
+    if (promo->expires) {
+        snprintf(expires, sizeof(expires), "%04ld-%02ld-%02ld",
+                 promo->expires / 10000, (promo->expires / 100) % 100, promo->expires % 100);
+    }
+    fprintf(f, "%s %.1f %s %d %d\n", promo->code, promo->percent, expires,
+            promo->max_uses, promo->per_customer);
+}
+
+/**
+ * Load the codes; their use counts come from the usage log
+ */
+static void ensure_loaded(void) {
+    char line[GARAGE_LINE_MAX];
+    PromoCode promo;
+    FILE *f;
+
+    if (loaded) return;
+    loaded = 1;
+
+    f = fopen(DISCOUNTS_FILE, "r");
+    if (f) {
+        while (fgets(line, sizeof(line), f)) {
+            if (!parse_code_line(line, &promo)) continue;
+
+            int index = find_code(promo.code);
+            if (index >= 0) *code_at(index) = promo; // Later line wins
+            else append_code(&promo);
+        }
+        fclose(f);
+    }
+}
+
+/**
+ * Rewrite discounts.txt from the table through a temporary file
+ */
+static int save_codes(void) {
+    FILE *temp = fopen(PROMO_TEMP_FILE, "w");
+    if (!temp) return 0;
+
+    for (int i = 0; i < codes.count; i++) {
+        if (!code_at(i)->deleted) write_code_line(temp, code_at(i));
+    }
+    fclose(temp);
+
+    remove(DISCOUNTS_FILE);
+    return rename(PROMO_TEMP_FILE, DISCOUNTS_FILE) == 0;
+}
+
+// ==================== USAGE LOG ====================
+
+// Count (or with -1, give back) one use of `code` by `username`
+static void count_use(int index, const char *username, int change) {
+    CustomerUse *use = find_use(code_at(index)->code, username, 1);
+    code_at(index)->used += change;
+    if (use) use->count += change;
+}
+
+static int find_hold(long id) {
+    for (int i = 0; i < hold_count; i++) {
+        if (holds[i].id == id) return i;
+    }
+    return -1;
+}
+
+static void apply_line(const char *line) {
+    char kind[8], code[PROMO_CODE_MAX], username[30];
+    long id, when;
+
+    lines_read++;
+    if (sscanf(line, "%7s %19s %29s %ld %ld", kind, code, username, &id, &when) != 5) {
+        // Older "CODE USERNAME DATE" line: one finished use
+        int index = sscanf(line, "%19s %29s", code, username) == 2 ? find_code(code) : -1;
+        if (index >= 0) count_use(index, username, 1);
+        return;
+    }
+
+    int index = find_code(code);
+    if (index < 0) return;
+
+    if (strcmp(kind, "HOLD") == 0) {
+        if (hold_count == hold_capacity) {
+            int capacity = hold_capacity ? hold_capacity * 2 : MIN_HOLDS;
+            UseHold *grown = realloc(holds, (size_t)capacity * sizeof(UseHold));
+            if (!grown) return;
+            holds = grown;
+            hold_capacity = capacity;
+        }
+        UseHold *hold = &holds[hold_count++];
+        hold->id = lines_read;
+        hold->code = index;
+        snprintf(hold->username, sizeof(hold->username), "%s", username);
+        hold->taken = when;
+        count_use(index, username, 1);
+    } else if (strcmp(kind, "USED") == 0 || strcmp(kind, "FREE") == 0) {
+        int open = find_hold(id);
+        if (open < 0) return;   // Already used or given back
+
+        if (kind[0] == 'F') count_use(index, username, -1);
+        holds[open] = holds[--hold_count];
+    } else if (strcmp(kind, "BACK") == 0) {
+        count_use(index, username, -1);
+    }
+}
+
+static void read_line(char *line, long offset, void *context) {
+    (void)offset;
+    (void)context;
+    apply_line(line);
+}
+
+/**
+ * Apply the lines appended since the last call; if the lines already
+ * applied changed (rewritten by hand), count everything again
+ */
+static void catch_up(FILE *f) {
+    if (garage_tail_rewritten(f, &usage)) {
+        for (int i = 0; i < codes.count; i++) code_at(i)->used = 0;
+        garage_table_clear(&uses);
+        hold_count = 0;
+        lines_read = 0;
+        garage_tail_reset(&usage);
+    }
+    garage_tail_read_file(f, &usage, read_line, NULL);
+}
+
+/**
+ * promo_usage.txt opened, locked and caught up; NULL when it cannot be
+ */
+static FILE *open_usage(void) {
+    ensure_loaded();
+
+    FILE *f = fopen(PROMO_USAGE_FILE, "a+b");
+    if (!f) return NULL;
+
+    if (!platform_lock_file(f)) {
+        fclose(f);
+        return NULL;
+    }
+    catch_up(f);
+    return f;
+}
+
+static void close_usage(FILE *f) {
+    fflush(f);                  // Written before another process can lock
+    platform_unlock_file(f);
+    fclose(f);
+}
+
+// Bring the use counts up to date; they stay as they were if the log
+// cannot be read
+static void refresh_counts(void) {
+    FILE *f = open_usage();
+    if (f) close_usage(f);
+}
+
+/**
+ * Append one line and apply it; returns its line number (the id of a HOLD)
+ */
+static long write_line(FILE *f, const char *kind, const char *code, const char *username, long id) {
+    char line[128];
+
+    snprintf(line, sizeof(line), "%s %s %s %ld %ld\n", kind, code, username, id, (long)time(NULL));
+    fseek(f, 0, SEEK_END);
+    fputs(line, f);
+    fflush(f);
+    garage_tail_read_file(f, &usage, read_line, NULL); // Just this line: the file is locked
+    return lines_read;
+}
+
+/**
+ * Give back the holds older than PROMO_HOLD_SECONDS (checkouts abandoned
+ * or crashed)
+ */
+static void release_expired(FILE *f) {
+    long now = (long)time(NULL);
+
+    for (int i = hold_count - 1; i >= 0; i--) {
+        if (now - holds[i].taken >= PROMO_HOLD_SECONDS) {
+            // Removes holds[i]; the hold moved into its place was already checked
+            write_line(f, "FREE", code_at(holds[i].code)->code, holds[i].username, holds[i].id);
+        }
+    }
+}
+
+// ==================== CODES ====================
+
+const char *promo_status_text(PromoStatus status) {
+    switch (status) {
+        case PROMO_OK: return "Promo code accepted.";
+        case PROMO_EXPIRED: return "This promo code has expired.";
+        case PROMO_USED_UP: return "This promo code has been fully used.";
+        case PROMO_CUSTOMER_LIMIT: return "You have already used this promo code.";
+        case PROMO_RELEASED: return "Your promo code hold ran out. Please place the order again.";
+        case PROMO_ERROR: return "Promo codes could not be checked. Please try again.";
+        default: return "Invalid promo code!";
+    }
+}
+
+const PromoCode *promo_find(const char *code) {
+    refresh_counts();
+
+    int index = find_code(code);
+    return (index >= 0 && !code_at(index)->deleted) ? code_at(index) : NULL;
+}
+
+static PromoStatus check_use(int index, const char *username, long today) {
+    if (index < 0 || code_at(index)->deleted) return PROMO_UNKNOWN;
+
+    const PromoCode *promo = code_at(index);
+    if (promo->expires && today > promo->expires) return PROMO_EXPIRED;
+    if (promo->max_uses && promo->used >= promo->max_uses) return PROMO_USED_UP;
+
+    if (promo->per_customer) {
+        const CustomerUse *use = find_use(promo->code, username, 0);
+        if (use && use->count >= promo->per_customer) return PROMO_CUSTOMER_LIMIT;
+    }
+    return PROMO_OK;
+}
+
+PromoStatus promo_check(const char *code, const char *username) {
+    FILE *f = open_usage();
+    if (!f) return PROMO_ERROR;
+
+    PromoStatus status = check_use(find_code(code), username, today_key());
+    close_usage(f);
+    return status;
+}
+
+// ==================== HOLDS ====================
+
+PromoStatus promo_hold(const char *code, const char *username, PromoHold *hold) {
+    memset(hold, 0, sizeof(*hold));
+    snprintf(hold->code, sizeof(hold->code), "%s", code);
+    snprintf(hold->username, sizeof(hold->username), "%s", username);
+
+    FILE *f = open_usage();
+    if (!f) return PROMO_ERROR;
+
+    long today = today_key();
+    int index = find_code(code);
+    PromoStatus status = check_use(index, username, today);
+    if ((status == PROMO_USED_UP || status == PROMO_CUSTOMER_LIMIT) && hold_count > 0) {
+        release_expired(f);
+        status = check_use(index, username, today);
+    }
+
+    if (status == PROMO_OK) {
+        hold->id = write_line(f, "HOLD", code, username, 0);
+        hold->percent = code_at(index)->percent;
+    }
+    close_usage(f);
+    return status;
+}
+
+PromoStatus promo_commit(PromoHold *hold) {
+    if (hold->id == 0 || hold->kept) return PROMO_OK;
+
+    FILE *f = open_usage();
+    if (!f) return PROMO_ERROR;
+
+    PromoStatus status = PROMO_RELEASED;
+    if (find_hold(hold->id) >= 0) {
+        write_line(f, "USED", hold->code, hold->username, hold->id);
+        hold->kept = 1;
+        status = PROMO_OK;
+    }
+    close_usage(f);
+    return status;
+}
+
+PromoStatus promo_release(PromoHold *hold) {
+    if (hold->id == 0) return PROMO_OK;
+
+    FILE *f = open_usage();
+    if (!f) return PROMO_ERROR;
+
+    if (hold->kept) {
+        write_line(f, "BACK", hold->code, hold->username, hold->id);
+    } else if (find_hold(hold->id) >= 0) {
+        write_line(f, "FREE", hold->code, hold->username, hold->id);
+    }
+    hold->id = 0;               // Nothing held any more
+    close_usage(f);
+    return PROMO_OK;
+}
+
+int promo_add(const PromoCode *promo) {
+    ensure_loaded();
+
+    int index = find_code(promo->code);
+    if (index < 0) {
+        if (append_code(promo) < 0) return 0;
+
+        FILE *f = fopen(DISCOUNTS_FILE, "a");
+        if (!f) return 0;
+        write_code_line(f, promo);
+        fclose(f);
+        return 1;
+    }
+
+    // Existing (or deleted) code: new terms, same usage history
+    PromoCode *existing = code_at(index);
+    int used = existing->used;
+    *existing = *promo;
+    existing->used = used;
+    existing->deleted = 0;
+    return save_codes();
+}
+
+int promo_remove(const char *code) {
+    ensure_loaded();
+
+    int index = find_code(code);
+    if (index < 0 || code_at(index)->deleted) return 0;
+
+    code_at(index)->deleted = 1;
+    save_codes();
+    return 1;
+}
+
+int promo_for_each(PromoVisitor visit, void *context) {
+    int count = 0;
+
+    refresh_counts();
+    for (int i = 0; i < codes.count; i++) {
+        if (code_at(i)->deleted) continue;
+        count++;
+        if (visit && visit(code_at(i), context)) break;
+    }
+    return count;
+}
@@ -0,0 +1,97 @@
+/**
+ * promo.h - Promo code engine for the Smart Garage system
+ *
+ * discounts.txt is loaded once into a hash table keyed by code, so a
+ * checkout validates its code in constant time however many codes a
+ * campaign creates. Adding or deleting a code updates the table in place
+ * and then the file.
+ *
+ * Uses are appended to promo_usage.txt instead of rewriting the code
+ * file on every checkout. Every call that reads or changes the counts
+ * holds an exclusive lock on that file while it reads the lines other
+ * programs appended since its last call and writes its own, so two
+ * checkouts - in two programs or two threads - can never both take the
+ * last use of a code. A checkout holds its use when the code is applied,
+ * keeps it when the order goes through and gives it back otherwise;
+ * holds left longer than PROMO_HOLD_SECONDS are given back by the next
+ * checkout that needs the use.
+ *
+ * discounts.txt: CODE PERCENT [EXPIRES MAX_USES PER_CUSTOMER]
+ *   EXPIRES is YYYY-MM-DD or "-"; the use limits are counts, 0 for none.
+ *   Old two-field lines are codes without limits.
+ *
+ * Usage:
+ *   PromoHold hold;
+ *   if (promo_hold(code, username, &hold) == PROMO_OK) {
+ *       total -= total * hold.percent / 100.0f;
+ *   }
+ *   ...
+ *   if (promo_commit(&hold) != PROMO_OK) {
+ *       // the use was given back: do not save the order
+ *   } else if (!save_order()) {
+ *       promo_release(&hold);
+ *   }
+ */
+#ifndef PROMO_H
+#define PROMO_H
+
+#define PROMO_CODE_MAX 20
+#define PROMO_HOLD_SECONDS (15 * 60)     // Holds not kept by then may be given back
+
+typedef struct {
+    char code[PROMO_CODE_MAX];
+    float percent;
+    long expires;           // Last valid day as YYYYMMDD, 0 = never
+    int max_uses;           // 0 = unlimited
+    int per_customer;       // Uses allowed per customer, 0 = unlimited
+    int used;               // Redemptions so far
+    int deleted;
+} PromoCode;
+
+typedef enum {
+    PROMO_OK,
+    PROMO_UNKNOWN,
+    PROMO_EXPIRED,
+    PROMO_USED_UP,
+    PROMO_CUSTOMER_LIMIT,
+    PROMO_RELEASED,             // The hold outlived PROMO_HOLD_SECONDS and was given back
+    PROMO_ERROR                 // promo_usage.txt cannot be opened or locked
+} PromoStatus;
+
+typedef struct {
+    long id;                    // 0 when nothing is held
+    char code[PROMO_CODE_MAX];
+    char username[30];
+    float percent;              // The code's discount
+    int kept;                   // promo_commit() succeeded
+} PromoHold;
+
+// Message for a status, for the checkout screen
+const char *promo_status_text(PromoStatus status);
+
+// Look a code up; NULL when it does not exist
+const PromoCode *promo_find(const char *code);
+
+// Would `username` be allowed to use `code` today? Nothing is counted.
+PromoStatus promo_check(const char *code, const char *username);
+
+// Check the code and hold one use for `username` under the file lock;
+// fills the hold (and its discount) on PROMO_OK
+PromoStatus promo_hold(const char *code, const char *username, PromoHold *hold);
+
+// Keep the held use, or give it back (a kept one too, when the order could
+// not be saved). Both do nothing for an empty hold.
+PromoStatus promo_commit(PromoHold *hold);
+PromoStatus promo_release(PromoHold *hold);
+
+// Add a code, or replace the terms of an existing one (its usage count is
+// kept); returns 1 on success, 0 when the file cannot be written
+int promo_add(const PromoCode *promo);
+// Returns 1 when the code existed and was removed
+int promo_remove(const char *code);
+
+// Visit live codes in file order; the visitor returns non-zero to stop
+typedef int (*PromoVisitor)(const PromoCode *promo, void *context);
+int promo_for_each(PromoVisitor visit, void *context);
+
+#endif
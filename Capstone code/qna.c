@@ -0,0 +1,345 @@
+/**
+ * qna.c - Troubleshooting Q&A search for the Smart Garage system
+ *
+ * qna.txt holds "Q: ..." and "A: ..." lines, with blank or "---" lines
+ * between entries. Words are lower-cased runs of letters and digits;
+ * common words ("the", "my", "what") are not indexed. Each word keeps a
+ * posting list of (entry, weighted count); a sorted copy of the
+ * vocabulary finds every word with a given prefix by binary search.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "garage.h"
+#include "qna.h"
+
+#define WORD_MAX 32
+#define QUESTION_WEIGHT 2       // A word in the question counts this many times
+#define MIN_PREFIX 3            // Shorter query words only match whole words
+
+// BM25 parameters
+#define BM25_K1 1.2
+#define BM25_B 0.75
+
+typedef struct {
+    char *question;
+    char *answer;
+    int length;                 // Weighted words indexed
+} Entry;
+
+typedef struct {
+    int entry;
+    int count;                  // Weighted occurrences in the entry
+} Posting;
+
+typedef struct {
+    char word[WORD_MAX];
+    Posting *postings;
+    int posting_count, posting_capacity;
+} Term;
+
+static Entry *entries;
+static int entry_count, entry_capacity;
+static double average_length;
+
+static GarageTable terms = GARAGE_TABLE(Term);
+static int *sorted_terms;       // Term indexes in word order
+
+static GarageFileStamp stamp;
+
+static const char *stop_words[] = {
+    "a", "an", "and", "are", "as", "at", "be", "by", "can", "do", "does", "for",
+    "from", "how", "i", "if", "in", "is", "it", "its", "me", "my", "of", "on",
+    "or", "should", "so", "that", "the", "this", "to", "what", "when", "where",
+    "which", "why", "will", "with", "you", "your", NULL
+};
+
+// ==================== TEXT ====================
+
+static int is_stop_word(const char *word) {
+    for (int i = 0; stop_words[i]; i++) {
+        if (strcmp(stop_words[i], word) == 0) return 1;
+    }
+    return 0;
+}
+
+/**
+ * Copy the next word of *text into word[] and advance past it; 0 at the end
+ */
+static int next_word(const char **text, char word[WORD_MAX]) {
+    const char *p = *text;
+    int n = 0;
+
+    while (*p && !isalnum((unsigned char)*p)) p++;
+    if (!*p) {
+        *text = p;
+        return 0;
+    }
+    while (isalnum((unsigned char)*p)) {
+        if (n + 1 < WORD_MAX) word[n++] = (char)tolower((unsigned char)*p);
+        p++;
+    }
+    word[n] = '\0';
+    *text = p;
+    return 1;
+}
+
+/**
+ * Natural log for x >= 1 without libm: halve into [1, 2), then the atanh
+ * series, which converges quickly there
+ */
+static double log_of(double x) {
+    double result = 0;
+    while (x >= 2) {
+        x /= 2;
+        result += 0.69314718055994531;
+    }
+
+    double y = (x - 1) / (x + 1), y2 = y * y, term = y, sum = 0;
+    for (int k = 1; k < 40; k += 2) {
+        sum += term / k;
+        term *= y2;
+    }
+    return result + 2 * sum;
+}
+
+// ==================== INDEX ====================
+
+static Term *term_at(int index) {
+    return garage_table_at(&terms, index);
+}
+
+static int find_term(const char *word) {
+    return garage_table_find(&terms, word);
+}
+
+static int add_term(const char *word) {
+    Term *term = garage_table_add(&terms, word, sizeof(term->word));
+    return term ? terms.count - 1 : -1;
+}
+
+/**
+ * Count `weight` more uses of every indexed word of `text` in `entry`
+ */
+static void index_text(int entry, const char *text, int weight) {
+    char word[WORD_MAX];
+
+    while (next_word(&text, word)) {
+        if (word[1] == '\0' || is_stop_word(word)) continue;
+
+        int index = find_term(word);
+        if (index < 0) index = add_term(word);
+        if (index < 0) return;
+
+        Term *term = term_at(index);
+        // Entries are indexed in order, so this entry's posting is the last
+        if (term->posting_count == 0 || term->postings[term->posting_count - 1].entry != entry) {
+            if (term->posting_count == term->posting_capacity) {
+                int capacity = term->posting_capacity ? term->posting_capacity * 2 : 4;
+                Posting *grown = realloc(term->postings, (size_t)capacity * sizeof(Posting));
+                if (!grown) return;
+                term->postings = grown;
+                term->posting_capacity = capacity;
+            }
+            term->postings[term->posting_count].entry = entry;
+            term->postings[term->posting_count].count = 0;
+            term->posting_count++;
+        }
+        term->postings[term->posting_count - 1].count += weight;
+        entries[entry].length += weight;
+    }
+}
+
+static void clear_index(void) {
+    for (int i = 0; i < entry_count; i++) {
+        free(entries[i].question);
+        free(entries[i].answer);
+    }
+    for (int i = 0; i < terms.count; i++) free(term_at(i)->postings);
+    entry_count = 0;
+    garage_table_clear(&terms);
+    average_length = 0;
+    free(sorted_terms);
+    sorted_terms = NULL;
+}
+
+static char *copy_text(const char *text) {
+    char *copy = malloc(strlen(text) + 1);
+    if (copy) strcpy(copy, text);
+    return copy;
+}
+
+// Add `more` to the end of *text, separated by a space
+static void append_text(char **text, const char *more) {
+    size_t length = strlen(*text);
+    char *grown = realloc(*text, length + strlen(more) + 2);
+    if (!grown) return;
+
+    if (length > 0) grown[length++] = ' ';
+    strcpy(grown + length, more);
+    *text = grown;
+}
+
+static int compare_terms(const void *a, const void *b) {
+    return strcmp(term_at(*(const int *)a)->word, term_at(*(const int *)b)->word);
+}
+
+static void load(void) {
+    char line[GARAGE_LINE_MAX];
+    char **open_field = NULL;   // Field that continuation lines add to
+    long total_length = 0;
+    FILE *f = fopen(QNA_FILE, "r");
+
+    clear_index();
+    if (!f) return;
+
+    while (fgets(line, sizeof(line), f)) {
+        line[strcspn(line, "\r\n")] = '\0';
+
+        if (strncmp(line, "Q:", 2) == 0) {
+            if (entry_count == entry_capacity) {
+                int capacity = entry_capacity ? entry_capacity * 2 : 64;
+                Entry *grown = realloc(entries, (size_t)capacity * sizeof(Entry));
+                if (!grown) break;
+                entries = grown;
+                entry_capacity = capacity;
+            }
+            Entry *entry = &entries[entry_count];
+            entry->question = copy_text(line + 2 + (line[2] == ' '));
+            entry->answer = copy_text("");
+            entry->length = 0;
+            if (!entry->question || !entry->answer) {
+                free(entry->question);
+                free(entry->answer);
+                break;
+            }
+            entry_count++;
+            open_field = &entry->question;
+        } else if (strncmp(line, "A:", 2) == 0 && entry_count > 0) {
+            open_field = &entries[entry_count - 1].answer;
+            append_text(open_field, line + 2 + (line[2] == ' '));
+        } else if (line[0] == '\0' || strncmp(line, "---", 3) == 0) {
+            open_field = NULL;
+        } else if (open_field) {
+            append_text(open_field, line);
+        }
+    }
+    fclose(f);
+
+    for (int i = 0; i < entry_count; i++) {
+        index_text(i, entries[i].question, QUESTION_WEIGHT);
+        index_text(i, entries[i].answer, 1);
+        total_length += entries[i].length;
+    }
+    if (entry_count > 0) average_length = (double)total_length / entry_count;
+
+    sorted_terms = malloc((size_t)(terms.count ? terms.count : 1) * sizeof(int));
+    if (sorted_terms) {
+        for (int i = 0; i < terms.count; i++) sorted_terms[i] = i;
+        qsort(sorted_terms, (size_t)terms.count, sizeof(int), compare_terms);
+    }
+}
+
+static void refresh(void) {
+    if (garage_file_changed(QNA_FILE, &stamp)) load();
+}
+
+// ==================== SEARCH ====================
+
+int qna_count(void) {
+    refresh();
+    return entry_count;
+}
+
+const char *qna_question(int id) {
+    refresh();
+    return id >= 0 && id < entry_count ? entries[id].question : "";
+}
+
+const char *qna_answer(int id) {
+    refresh();
+    return id >= 0 && id < entry_count ? entries[id].answer : "";
+}
+
+/**
+ * Position of the first word in sorted order that is >= `prefix`
+ */
+static int lower_bound(const char *prefix) {
+    int low = 0, high = terms.count;
+    while (low < high) {
+        int middle = (low + high) / 2;
+        if (strcmp(term_at(sorted_terms[middle])->word, prefix) < 0) low = middle + 1;
+        else high = middle;
+    }
+    return low;
+}
+
+/**
+ * BM25 contribution of every entry that uses term `index`; an entry keeps
+ * the best of the words a query word matched
+ */
+static void score_term(int index, double best[]) {
+    const Term *term = term_at(index);
+    double n = term->posting_count;
+    double idf = log_of(1 + (entry_count - n + 0.5) / (n + 0.5));
+
+    for (int i = 0; i < term->posting_count; i++) {
+        const Posting *posting = &term->postings[i];
+        double length = entries[posting->entry].length / (average_length > 0 ? average_length : 1);
+        double tf = posting->count;
+        double score = idf * tf * (BM25_K1 + 1) / (tf + BM25_K1 * (1 - BM25_B + BM25_B * length));
+
+        if (score > best[posting->entry]) best[posting->entry] = score;
+    }
+}
+
+int qna_search(const char *query, QnaHit out[], int max) {
+    char word[WORD_MAX];
+    int count = 0;
+
+    refresh();
+    if (entry_count == 0 || !sorted_terms || max <= 0) return 0;
+
+    double *scores = calloc((size_t)entry_count, sizeof(double));
+    double *best = calloc((size_t)entry_count, sizeof(double));
+    if (!scores || !best) {
+        free(scores);
+        free(best);
+        return 0;
+    }
+
+    while (next_word(&query, word)) {
+        if (is_stop_word(word)) continue;
+        memset(best, 0, (size_t)entry_count * sizeof(double));
+
+        size_t length = strlen(word);
+        if (length < MIN_PREFIX) {
+            int index = find_term(word);
+            if (index >= 0) score_term(index, best);
+        } else {
+            for (int i = lower_bound(word); i < terms.count; i++) {
+                if (strncmp(term_at(sorted_terms[i])->word, word, length) != 0) break;
+                score_term(sorted_terms[i], best);
+            }
+        }
+        for (int i = 0; i < entry_count; i++) scores[i] += best[i];
+    }
+
+    // Keep the top `max` entries, highest score first
+    for (int i = 0; i < entry_count; i++) {
+        if (scores[i] <= 0 || (count == max && out[max - 1].score >= scores[i])) continue;
+
+        int position = count < max ? count++ : max - 1;
+        while (position > 0 && out[position - 1].score < scores[i]) {
+            out[position] = out[position - 1];
+            position--;
+        }
+        out[position].id = i;
+        out[position].score = (float)scores[i];
+    }
+
+    free(scores);
+    free(best);
+    return count;
+}
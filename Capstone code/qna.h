@@ -0,0 +1,38 @@
+/**
+ * qna.h - Troubleshooting Q&A search for the Smart Garage system
+ *
+ * qna.txt is loaded once into memory with an inverted index (word ->
+ * entries that use it). A search ranks entries with BM25, counting words
+ * in the question twice, and a query word also matches longer words that
+ * start with it ("overheat" finds "overheating"). The file is loaded again
+ * only after it changes.
+ *
+ * Usage:
+ *   QnaHit hits[QNA_MAX_HITS];
+ *   int count = qna_search("engine overheating", hits, QNA_MAX_HITS);
+ *   for (int i = 0; i < count; i++) {
+ *       printf("%s\n%s\n", qna_question(hits[i].id), qna_answer(hits[i].id));
+ *   }
+ */
+#ifndef QNA_H
+#define QNA_H
+
+#define QNA_MAX_HITS 10
+
+typedef struct {
+    int id;                     // Entry number, 0-based in file order
+    float score;
+} QnaHit;
+
+// Entries in qna.txt
+int qna_count(void);
+
+// Text of entry `id`; "" when out of range
+const char *qna_question(int id);
+const char *qna_answer(int id);
+
+// Best matches for the words in `query`, highest score first; returns how
+// many were written to out[] (0 when no word matches)
+int qna_search(const char *query, QnaHit out[], int max);
+
+#endif
@@ -0,0 +1,279 @@
+/**
+ * receipts.c - QR receipt index for the Smart Garage system
+ *
+ * qr_index.txt is append-only:
+ *   OFFSET USERNAME QR_CODE   one line per receipt
+ *   @ SIZE HASH               qr_receipts.txt is indexed up to SIZE bytes,
+ *                             whose last bytes hash to HASH
+ * The last "@" line wins. Entries only keep the code's hash and offset;
+ * a lookup confirms the code against the receipt line itself.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "garage.h"
+#include "receipts.h"
+
+#define MIN_SLOTS 256
+
+typedef struct {
+    unsigned long hash;         // garage_hash() of the QR code
+    long offset;                // Start of the line in qr_receipts.txt
+    int next;                   // Next receipt of the same customer, -1 = last
+} ReceiptEntry;
+
+typedef struct {
+    char username[30];
+    int first;
+    int last;
+    int count;
+} ReceiptOwner;
+
+static ReceiptEntry *entries;
+static int entry_count, entry_capacity;
+static int *entry_slots;        // Index into entries + 1, 0 = empty
+static int entry_slot_count;
+
+static GarageTable owners = GARAGE_TABLE(ReceiptOwner);
+
+static GarageTail indexed;      // How much of qr_receipts.txt is covered
+static int loaded;
+
+// ==================== HASH INDEX ====================
+
+/**
+ * Double a slot table (or create it) when it would pass 3/4 full
+ */
+static int grow_slots(int **slots, int *slot_count, int entries_used, unsigned long (*hash_of)(int index)) {
+    if (*slots && (entries_used + 1) * 4 <= *slot_count * 3) return 1;
+
+    int new_count = *slot_count ? *slot_count * 2 : MIN_SLOTS;
+    int *new_slots = calloc((size_t)new_count, sizeof(int));
+    if (!new_slots) return 0;
+
+    for (int i = 0; i < entries_used; i++) {
+        unsigned long slot = hash_of(i) & (unsigned long)(new_count - 1);
+        while (new_slots[slot]) slot = (slot + 1) & (unsigned long)(new_count - 1);
+        new_slots[slot] = i + 1;
+    }
+
+    free(*slots);
+    *slots = new_slots;
+    *slot_count = new_count;
+    return 1;
+}
+
+static void put_slot(int *slots, int slot_count, unsigned long hash, int index) {
+    unsigned long mask = (unsigned long)(slot_count - 1);
+    unsigned long slot = hash & mask;
+    while (slots[slot]) slot = (slot + 1) & mask;
+    slots[slot] = index + 1;
+}
+
+static unsigned long entry_hash_at(int index) {
+    return entries[index].hash;
+}
+
+static ReceiptOwner *find_owner(const char *username, int create) {
+    int index = garage_table_find(&owners, username);
+    if (index >= 0) return garage_table_at(&owners, index);
+    if (!create) return NULL;
+
+    ReceiptOwner *owner = garage_table_add(&owners, username, sizeof(owner->username));
+    if (!owner) return NULL;
+    owner->first = -1;
+    owner->last = -1;
+    return owner;
+}
+
+static void add_entry(const char *qr_code, const char *username, long offset) {
+    if (!grow_slots(&entry_slots, &entry_slot_count, entry_count, entry_hash_at)) return;
+    if (entry_count == entry_capacity) {
+        int capacity = entry_capacity ? entry_capacity * 2 : MIN_SLOTS;
+        ReceiptEntry *grown = realloc(entries, (size_t)capacity * sizeof(ReceiptEntry));
+        if (!grown) return;
+        entries = grown;
+        entry_capacity = capacity;
+    }
+
+    ReceiptOwner *owner = find_owner(username, 1);
+    if (!owner) return;
+
+    int index = entry_count++;
+    entries[index].hash = garage_hash(qr_code);
+    entries[index].offset = offset;
+    entries[index].next = -1;
+    put_slot(entry_slots, entry_slot_count, entries[index].hash, index);
+
+    if (owner->last >= 0) entries[owner->last].next = index;
+    else owner->first = index;
+    owner->last = index;
+    owner->count++;
+}
+
+static void clear_index(void) {
+    entry_count = 0;
+    garage_table_clear(&owners);
+    if (entry_slots) memset(entry_slots, 0, (size_t)entry_slot_count * sizeof(int));
+    garage_tail_reset(&indexed);
+}
+
+// ==================== INDEX FILE ====================
+
+static void load_index(void) {
+    char line[GARAGE_LINE_MAX], username[30], qr_code[50];
+    long offset;
+    int unmarked = 0;           // Entries after the last "@" line
+    FILE *f = fopen(QR_INDEX_FILE, "r");
+
+    if (!f) return;
+    while (fgets(line, sizeof(line), f)) {
+        if (line[0] == '@') {
+            // Older "@ SIZE" lines have no hash: the index is rebuilt once
+            indexed.fingerprint = 0;
+            sscanf(line + 1, "%ld %lu", &indexed.read, &indexed.fingerprint);
+            unmarked = 0;
+        } else if (sscanf(line, "%ld %29s %49s", &offset, username, qr_code) == 3) {
+            add_entry(qr_code, username, offset);
+            unmarked++;
+        }
+    }
+    fclose(f);
+
+    // An update that stopped half way: start the index again
+    if (unmarked > 0 || indexed.read == 0) clear_index();
+}
+
+// Index one receipt; `context` is the index file to append it to (or NULL)
+static void index_receipt(char *line, long offset, void *context) {
+    FILE *index = context;
+    GarageReceipt receipt;
+
+    if (!garage_parse_receipt(line, &receipt)) return;
+    add_entry(receipt.qr_code, receipt.username, offset);
+    if (index) fprintf(index, "%ld %s %s\n", offset, receipt.username, receipt.qr_code);
+}
+
+/**
+ * Index the receipts appended since the last call. Returns 0 when the
+ * receipts file no longer matches the index (shrunk or rewritten), so it
+ * must be rebuilt.
+ */
+static int catch_up(void) {
+    FILE *receipts = fopen(QR_RECEIPTS_FILE, "rb");
+
+    if (!receipts) {
+        return indexed.read == 0;
+    }
+
+    if (garage_tail_rewritten(receipts, &indexed)) {
+        fclose(receipts);
+        return 0;
+    }
+    fseek(receipts, 0, SEEK_END);
+    if (ftell(receipts) == indexed.read) {
+        fclose(receipts);
+        return 1;
+    }
+
+    FILE *index = fopen(QR_INDEX_FILE, indexed.read == 0 ? "w" : "a");
+    if (index && indexed.read == 0) {
+        fprintf(index, "# QR receipt index: OFFSET USERNAME QR_CODE; \"@ SIZE HASH\" = bytes of %s indexed\n",
+                QR_RECEIPTS_FILE);
+    }
+
+    long start = indexed.read;
+    garage_tail_read_file(receipts, &indexed, index_receipt, index);
+    fclose(receipts);
+
+    if (index && indexed.read > start) {
+        fprintf(index, "@ %ld %lu\n", indexed.read, indexed.fingerprint);
+    }
+    if (index) fclose(index);
+    return 1;
+}
+
+static void rebuild(void) {
+    clear_index();
+    catch_up();
+}
+
+static void refresh(void) {
+    if (!loaded) {
+        loaded = 1;
+        load_index();
+    }
+    if (!catch_up()) rebuild();
+}
+
+static int read_receipt_at(FILE *f, long offset, GarageReceipt *receipt) {
+    char line[GARAGE_LINE_MAX];
+
+    if (fseek(f, offset, SEEK_SET) != 0 || !fgets(line, sizeof(line), f)) return 0;
+    return garage_parse_receipt(line, receipt);
+}
+
+// ==================== LOOKUPS ====================
+
+/**
+ * Probe the code's slots; 1 = found, 0 = not indexed, -1 = the index
+ * points at a line that no longer holds a receipt (stale)
+ */
+static int lookup(FILE *f, const char *qr_code, GarageReceipt *receipt) {
+    if (!entry_slots) return 0;
+
+    unsigned long hash = garage_hash(qr_code);
+    unsigned long mask = (unsigned long)(entry_slot_count - 1);
+    unsigned long slot = hash & mask;
+
+    while (entry_slots[slot]) {
+        const ReceiptEntry *entry = &entries[entry_slots[slot] - 1];
+        if (entry->hash == hash) {
+            if (!read_receipt_at(f, entry->offset, receipt)) return -1;
+            if (strcmp(receipt->qr_code, qr_code) == 0) return 1;
+            // Another code with the same hash is fine; any other line is not
+            if (garage_hash(receipt->qr_code) != hash) return -1;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return 0;
+}
+
+int receipts_find(const char *qr_code, GarageReceipt *receipt) {
+    refresh();
+
+    FILE *f = fopen(QR_RECEIPTS_FILE, "rb");
+    if (!f) return 0;
+
+    int found = lookup(f, qr_code, receipt);
+    if (found < 0) {
+        rebuild();
+        found = lookup(f, qr_code, receipt);
+    }
+    fclose(f);
+    return found == 1;
+}
+
+int receipts_for_user(const char *username, int first, int max,
+                      GarageReceiptVisitor visit, void *context) {
+    GarageReceipt receipt;
+
+    refresh();
+
+    const ReceiptOwner *owner = find_owner(username, 0);
+    if (!owner) return 0;
+
+    FILE *f = fopen(QR_RECEIPTS_FILE, "rb");
+    if (!f) return 0;
+
+    int position = 0;
+    for (int i = owner->first; i >= 0 && max > 0; i = entries[i].next, position++) {
+        if (position < first) continue;
+        if (read_receipt_at(f, entries[i].offset, &receipt)) {
+            if (visit && visit(&receipt, context)) break;
+        }
+        max--;
+    }
+    fclose(f);
+    return owner->count;
+}
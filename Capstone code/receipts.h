@@ -0,0 +1,33 @@
+/**
+ * receipts.h - QR receipt index for the Smart Garage system
+ *
+ * qr_index.txt maps every receipt's QR code to its byte offset in
+ * qr_receipts.txt and records its owner. The index is loaded once into
+ * memory (a hash table by code and a receipt list per customer), so a
+ * receipt is verified with one lookup and one read, and a customer's
+ * receipts are read straight from their offsets instead of a full scan.
+ *
+ * Receipts appended by any writer are picked up on the next call by
+ * indexing only the new tail of qr_receipts.txt. If the file was rewritten
+ * (lines already indexed changed), the index is rebuilt.
+ *
+ * Usage:
+ *   GarageReceipt receipt;
+ *   if (receipts_find("QR_Ashis_01_1754763870", &receipt)) {
+ *       // genuine receipt: receipt.username, receipt.amount, ...
+ *   }
+ */
+#ifndef RECEIPTS_H
+#define RECEIPTS_H
+
+#include "garage.h"
+
+// 1 and the receipt when the QR code is on file, 0 otherwise
+int receipts_find(const char *qr_code, GarageReceipt *receipt);
+
+// Visit up to `max` of a customer's receipts, oldest first, starting with
+// the `first` (0-based); returns how many receipts the customer has
+int receipts_for_user(const char *username, int first, int max,
+                      GarageReceiptVisitor visit, void *context);
+
+#endif
@@ -0,0 +1,339 @@
+/**
+ * recommend.c - "Customers who bought X also bought Y" for the Smart Garage
+ *
+ * Each part keeps a row of (other part, customers who bought both); a pair
+ * index finds a cell of that sparse matrix directly. Each customer keeps
+ * the set of parts they have bought, so an order only updates the matrix
+ * the first time that customer buys that part. A pair scores
+ * shared^2 / (buyers(X) * buyers(Y)) - the squared cosine, which needs no
+ * libm - so that parts everyone buys do not crowd out the rest.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "garage.h"
+#include "recommend.h"
+
+#define MIN_SLOTS 64
+
+// One cell of a part's co-purchase row
+typedef struct {
+    int other;
+    int customers;
+} CoPurchase;
+
+typedef struct {
+    char name[50];
+    int buyers;
+    CoPurchase *row;
+    int row_count, row_capacity;
+} PartStats;
+
+typedef struct {
+    char username[30];
+    int *parts;
+    int part_count, part_capacity;
+} Buyer;
+
+// Pair index slot: cell `position` of part a's row holds part b
+typedef struct {
+    int a, b;
+    int position;               // -1 = empty slot
+} PairSlot;
+
+static GarageTable parts = GARAGE_TABLE(PartStats);
+static GarageTable buyers = GARAGE_TABLE(Buyer);
+
+static PairSlot *pair_slots;
+static int pair_slot_count, pair_count;
+
+static GarageTail orders_tail;
+static int out_of_memory;
+
+// ==================== TABLES ====================
+
+static int grow(void **array, int *capacity, int count, size_t size) {
+    if (count < *capacity) return 1;
+
+    int new_capacity = *capacity ? *capacity * 2 : MIN_SLOTS;
+    void *grown = realloc(*array, (size_t)new_capacity * size);
+    if (!grown) return 0;
+    *array = grown;
+    *capacity = new_capacity;
+    return 1;
+}
+
+static PartStats *part_at(int index) {
+    return garage_table_at(&parts, index);
+}
+
+static Buyer *buyer_at(int index) {
+    return garage_table_at(&buyers, index);
+}
+
+static int find_part(const char *name, int create) {
+    int index = garage_table_find(&parts, name);
+    if (index >= 0 || !create) return index;
+
+    PartStats *part = garage_table_add(&parts, name, sizeof(part->name));
+    if (!part) {
+        out_of_memory = 1;
+        return -1;
+    }
+    return parts.count - 1;
+}
+
+static int find_buyer(const char *username, int create) {
+    int index = garage_table_find(&buyers, username);
+    if (index >= 0 || !create) return index;
+
+    Buyer *buyer = garage_table_add(&buyers, username, sizeof(buyer->username));
+    if (!buyer) {
+        out_of_memory = 1;
+        return -1;
+    }
+    return buyers.count - 1;
+}
+
+// ==================== CO-PURCHASE MATRIX ====================
+
+static unsigned long pair_hash(int a, int b) {
+    return ((unsigned long)a * 2654435761UL) ^ ((unsigned long)b * 40503UL);
+}
+
+static PairSlot *pair_slot(int a, int b) {
+    unsigned long mask = (unsigned long)(pair_slot_count - 1);
+    unsigned long slot = pair_hash(a, b) & mask;
+
+    while (pair_slots[slot].position >= 0) {
+        if (pair_slots[slot].a == a && pair_slots[slot].b == b) break;
+        slot = (slot + 1) & mask;
+    }
+    return &pair_slots[slot];
+}
+
+static int grow_pair_slots(void) {
+    if (pair_slots && (pair_count + 1) * 4 <= pair_slot_count * 3) return 1;
+
+    PairSlot *old = pair_slots;
+    int old_count = pair_slot_count;
+    int new_count = pair_slot_count ? pair_slot_count * 2 : MIN_SLOTS;
+
+    pair_slots = malloc((size_t)new_count * sizeof(PairSlot));
+    if (!pair_slots) {
+        pair_slots = old;
+        return 0;
+    }
+    pair_slot_count = new_count;
+    for (int i = 0; i < new_count; i++) pair_slots[i].position = -1;
+
+    for (int i = 0; i < old_count; i++) {
+        if (old[i].position >= 0) *pair_slot(old[i].a, old[i].b) = old[i];
+    }
+    free(old);
+    return 1;
+}
+
+// One more customer bought both a and b
+static void count_pair(int a, int b) {
+    if (!grow_pair_slots()) {
+        out_of_memory = 1;
+        return;
+    }
+
+    PairSlot *slot = pair_slot(a, b);
+    if (slot->position >= 0) {
+        part_at(a)->row[slot->position].customers++;
+        return;
+    }
+
+    PartStats *part = part_at(a);
+    if (!grow((void **)&part->row, &part->row_capacity, part->row_count, sizeof(CoPurchase))) {
+        out_of_memory = 1;
+        return;
+    }
+    part->row[part->row_count].other = b;
+    part->row[part->row_count].customers = 1;
+
+    slot->a = a;
+    slot->b = b;
+    slot->position = part->row_count++;
+    pair_count++;
+}
+
+static void record_purchase(const char *username, const char *part_name) {
+    int part = find_part(part_name, 1);
+    int buyer_index = find_buyer(username, 1);
+    if (part < 0 || buyer_index < 0) return;
+
+    Buyer *buyer = buyer_at(buyer_index);
+    for (int i = 0; i < buyer->part_count; i++) {
+        if (buyer->parts[i] == part) return; // Already counted for this customer
+    }
+
+    for (int i = 0; i < buyer->part_count; i++) {
+        count_pair(part, buyer->parts[i]);
+        count_pair(buyer->parts[i], part);
+    }
+
+    if (!grow((void **)&buyer->parts, &buyer->part_capacity, buyer->part_count, sizeof(int))) {
+        out_of_memory = 1;
+        return;
+    }
+    buyer->parts[buyer->part_count++] = part;
+    part_at(part)->buyers++;
+}
+
+static void reset(void) {
+    for (int i = 0; i < parts.count; i++) free(part_at(i)->row);
+    for (int i = 0; i < buyers.count; i++) free(buyer_at(i)->parts);
+    garage_table_free(&parts);
+    garage_table_free(&buyers);
+    free(pair_slots);
+
+    pair_slots = NULL;
+    pair_count = pair_slot_count = 0;
+    garage_tail_reset(&orders_tail);
+    out_of_memory = 0;
+}
+
+static void read_order(char *line, long offset, void *context) {
+    GarageOrder order;
+    (void)offset;
+    (void)context;
+    if (garage_parse_order(line, &order)) record_purchase(order.username, order.part);
+}
+
+/**
+ * Count the orders appended since the last call (all of them the first
+ * time). Deleted or edited orders mean counting from scratch.
+ */
+static void refresh(void) {
+    int orders = garage_tail_changed(ORDERS_FILE, &orders_tail);
+
+    if (orders == GARAGE_TAIL_REWRITTEN || out_of_memory) {
+        reset();
+        orders = GARAGE_TAIL_REWRITTEN;
+    }
+    if (orders != GARAGE_TAIL_SAME) garage_tail_read(ORDERS_FILE, &orders_tail, read_order, NULL);
+}
+
+// ==================== QUERIES ====================
+
+static float similarity(int a, int b, int shared) {
+    return (float)((double)shared * shared / ((double)part_at(a)->buyers * part_at(b)->buyers));
+}
+
+/**
+ * Keep out[] sorted by score (highest first), at most k entries
+ */
+static void offer(Recommendation out[], int *count, int k, const Recommendation *pick) {
+    int i = *count < k ? (*count)++ : k;
+    if (i == k && (k == 0 || pick->score <= out[k - 1].score)) return;
+    if (i == k) i = k - 1;
+
+    while (i > 0 && out[i - 1].score < pick->score) {
+        out[i] = out[i - 1];
+        i--;
+    }
+    out[i] = *pick;
+}
+
+int recommend_also_bought(const char *part_name, int k, Recommendation out[]) {
+    Recommendation pick;
+    int count = 0;
+
+    refresh();
+    int part = find_part(part_name, 0);
+    if (part < 0) return 0;
+
+    for (int i = 0; i < part_at(part)->row_count; i++) {
+        const CoPurchase *cell = &part_at(part)->row[i];
+
+        snprintf(pick.part, sizeof(pick.part), "%s", part_at(cell->other)->name);
+        snprintf(pick.because, sizeof(pick.because), "%s", part_at(part)->name);
+        pick.customers = cell->customers;
+        pick.score = similarity(part, cell->other, cell->customers);
+        offer(out, &count, k, &pick);
+    }
+    return count;
+}
+
+int recommend_popular(int k, Recommendation out[]) {
+    Recommendation pick;
+    int count = 0;
+
+    refresh();
+    for (int i = 0; i < parts.count; i++) {
+        snprintf(pick.part, sizeof(pick.part), "%s", part_at(i)->name);
+        pick.because[0] = '\0';
+        pick.customers = part_at(i)->buyers;
+        pick.score = (float)part_at(i)->buyers;
+        offer(out, &count, k, &pick);
+    }
+    return count;
+}
+
+int recommend_for_customer(const char *username, int k, Recommendation out[]) {
+    Recommendation pick;
+    int count = 0;
+
+    refresh();
+    int buyer_index = find_buyer(username, 0);
+    if (buyer_index < 0 || parts.count == 0) return recommend_popular(k, out);
+
+    // Per candidate part: summed score and its strongest source
+    float *scores = calloc((size_t)parts.count, sizeof(float));
+    float *best = calloc((size_t)parts.count, sizeof(float));
+    int *source = malloc((size_t)parts.count * sizeof(int));
+    int *shared = malloc((size_t)parts.count * sizeof(int));
+    const Buyer *buyer = buyer_at(buyer_index);
+
+    if (scores && best && source && shared) {
+        for (int i = 0; i < buyer->part_count; i++) {
+            int owned = buyer->parts[i];
+
+            for (int j = 0; j < part_at(owned)->row_count; j++) {
+                const CoPurchase *cell = &part_at(owned)->row[j];
+                float score = similarity(owned, cell->other, cell->customers);
+
+                scores[cell->other] += score;
+                if (score > best[cell->other]) {
+                    best[cell->other] = score;
+                    source[cell->other] = owned;
+                    shared[cell->other] = cell->customers;
+                }
+            }
+        }
+
+        // Parts the customer already has are not recommended again
+        for (int i = 0; i < buyer->part_count; i++) scores[buyer->parts[i]] = -1;
+
+        for (int i = 0; i < parts.count; i++) {
+            if (scores[i] <= 0) continue;
+
+            snprintf(pick.part, sizeof(pick.part), "%s", part_at(i)->name);
+            snprintf(pick.because, sizeof(pick.because), "%s", part_at(source[i])->name);
+            pick.customers = shared[i];
+            pick.score = scores[i];
+            offer(out, &count, k, &pick);
+        }
+
+        // Nobody shares a part with this customer yet: popular parts they lack
+        int scored = count;
+        for (int i = 0; scored == 0 && i < parts.count; i++) {
+            if (scores[i] < 0) continue;
+            snprintf(pick.part, sizeof(pick.part), "%s", part_at(i)->name);
+            pick.because[0] = '\0';
+            pick.customers = part_at(i)->buyers;
+            pick.score = (float)part_at(i)->buyers;
+            offer(out, &count, k, &pick);
+        }
+    }
+
+    free(scores);
+    free(best);
+    free(source);
+    free(shared);
+    return count;
+}
@@ -0,0 +1,38 @@
+/**
+ * recommend.h - "Customers who bought X also bought Y" for the Smart Garage
+ *
+ * A sparse co-purchase matrix counts, for every pair of parts, how many
+ * customers bought both. It is built from orders.txt on first use and then
+ * kept current by reading only the orders appended since the last call, so
+ * a query costs one pass over a part's (short) row of co-purchases.
+ *
+ * Usage:
+ *   Recommendation picks[5];
+ *   int count = recommend_for_customer("Ashis_01", 5, picks);
+ *   for (int i = 0; i < count; i++) {
+ *       printf("%s (with %s)\n", picks[i].part, picks[i].because);
+ *   }
+ */
+#ifndef RECOMMEND_H
+#define RECOMMEND_H
+
+#define RECOMMEND_MAX 10
+
+typedef struct {
+    char part[50];
+    char because[50];           // Part of the customer's that led here; empty for popular picks
+    int customers;              // Customers who bought both (or the part, for popular picks)
+    float score;
+} Recommendation;
+
+// Top parts bought by customers who also bought `part`
+int recommend_also_bought(const char *part, int k, Recommendation out[]);
+
+// Top parts for a customer from everything they bought, leaving out parts
+// they already have; falls back to the most popular parts
+int recommend_for_customer(const char *username, int k, Recommendation out[]);
+
+// Parts bought by the most customers
+int recommend_popular(int k, Recommendation out[]);
+
+#endif
@@ -0,0 +1,277 @@
+/**
+ * rollup.c - Pre-aggregated order revenue for the Smart Garage system
+ *
+ * One hash table of cells keyed by grain, bucket and dimension
+ * ("D20251009|P|Cash"). Each bucket's total cell also chains the payment
+ * and part cells of that bucket, so a breakdown walks only those.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "garage.h"
+#include "rollup.h"
+
+#define KEY_MAX 72
+
+typedef struct {
+    char key[KEY_MAX];
+    RollupPoint point;
+    int first;                  // Total cells: first payment/part cell, -1 = none
+    int next;                   // Payment/part cells: next in the bucket, -1 = end
+} Cell;
+
+static GarageTable cells = GARAGE_TABLE(Cell);
+
+static GarageTail orders_tail;
+
+// Earliest and latest bucket with orders, 0 = none yet
+static long first_bucket[ROLLUP_GRAIN_COUNT], last_bucket[ROLLUP_GRAIN_COUNT];
+
+static const char grain_tags[ROLLUP_GRAIN_COUNT] = {'H', 'D', 'M', 'A'};
+static const char dimension_tags[] = {'T', 'P', 'A'};
+
+// ==================== CELLS ====================
+
+static void make_key(char *key, RollupGrain grain, long bucket, RollupDimension dimension, const char *name) {
+    snprintf(key, KEY_MAX, "%c%ld|%c|%s", grain_tags[grain], bucket, dimension_tags[dimension],
+             dimension == ROLLUP_ANY || !name ? "" : name);
+}
+
+static const Cell *find_cell(RollupGrain grain, long bucket, RollupDimension dimension, const char *name) {
+    char key[KEY_MAX];
+
+    make_key(key, grain, bucket, dimension, name);
+    int index = garage_table_find(&cells, key);
+    return index >= 0 ? garage_table_at(&cells, index) : NULL;
+}
+
+// ==================== BUCKETS ====================
+
+long rollup_bucket(RollupGrain grain, time_t when) {
+    struct tm *local = localtime(&when);
+    long day = (local->tm_year + 1900) * 10000L + (local->tm_mon + 1) * 100L + local->tm_mday;
+
+    switch (grain) {
+        case ROLLUP_HOUR: return day * 100 + local->tm_hour;
+        case ROLLUP_DAY: return day;
+        case ROLLUP_MONTH: return day / 100;
+        default: return 0;
+    }
+}
+
+// YYYYMMDD moved by `days`
+static long step_days(long day, int days) {
+    struct tm t = {0};
+
+    t.tm_year = (int)(day / 10000) - 1900;
+    t.tm_mon = (int)(day / 100 % 100) - 1;
+    t.tm_mday = (int)(day % 100) + days;
+    t.tm_hour = 12;             // Clear of daylight saving changes
+    t.tm_isdst = -1;
+    if (mktime(&t) == (time_t)-1) return day;
+
+    return (t.tm_year + 1900) * 10000L + (t.tm_mon + 1) * 100L + t.tm_mday;
+}
+
+long rollup_step(RollupGrain grain, long bucket, int steps) {
+    switch (grain) {
+        case ROLLUP_HOUR: {
+            int hour = (int)(bucket % 100) + steps;
+            int days = hour >= 0 ? hour / 24 : -((23 - hour) / 24);
+            return step_days(bucket / 100, days) * 100 + (hour - days * 24);
+        }
+        case ROLLUP_DAY:
+            return step_days(bucket, steps);
+        case ROLLUP_MONTH: {
+            long months = bucket / 100 * 12 + (bucket % 100 - 1) + steps;
+            return months / 12 * 100 + months % 12 + 1;
+        }
+        default:
+            return 0;
+    }
+}
+
+// Hour from ctime text ("Sat Aug 09 20:48:11 2025"), -1 when missing
+static int text_hour(const char *text) {
+    for (const char *p = text; p[0] && p[1] && p[2]; p++) {
+        if (isdigit((unsigned char)p[0]) && isdigit((unsigned char)p[1]) && p[2] == ':') {
+            return (p[0] - '0') * 10 + (p[1] - '0');
+        }
+    }
+    return -1;
+}
+
+// ==================== LOADING ====================
+
+/**
+ * Add the order to one cell; a new payment or part cell joins the chain of
+ * its bucket's total cell. Returns the cell's index, -1 when out of memory.
+ */
+static int add_to_cell(RollupGrain grain, long bucket, RollupDimension dimension,
+                       const char *name, const GarageOrder *order, int total) {
+    char key[KEY_MAX];
+
+    make_key(key, grain, bucket, dimension, name);
+    int index = garage_table_find(&cells, key);
+
+    if (index < 0) {
+        Cell *cell = garage_table_add(&cells, key, sizeof(key));
+        if (!cell) return -1;
+        index = cells.count - 1;
+        cell->point.bucket = bucket;
+        snprintf(cell->point.name, sizeof(cell->point.name), "%s", dimension == ROLLUP_ANY ? "" : name);
+        cell->first = cell->next = -1;
+
+        if (total >= 0) {
+            Cell *head = garage_table_at(&cells, total);
+            cell->next = head->first;
+            head->first = index;
+        }
+    }
+
+    Cell *cell = garage_table_at(&cells, index);
+    cell->point.revenue += order->total;
+    cell->point.orders++;
+    cell->point.units += order->quantity;
+    return index;
+}
+
+static void add_order(const GarageOrder *order) {
+    long day = garage_order_date_key(order);
+    int hour = day ? text_hour(order->date_time) : -1;
+
+    for (int grain = 0; grain < ROLLUP_GRAIN_COUNT; grain++) {
+        long bucket;
+        if (grain == ROLLUP_ALL) bucket = 0;
+        else if (!day) continue;
+        else if (grain == ROLLUP_DAY) bucket = day;
+        else if (grain == ROLLUP_MONTH) bucket = day / 100;
+        else if (hour >= 0) bucket = day * 100 + hour;
+        else continue;
+
+        int total = add_to_cell(grain, bucket, ROLLUP_ANY, NULL, order, -1);
+        if (total < 0) continue;
+        add_to_cell(grain, bucket, ROLLUP_PAYMENT, order->payment, order, total);
+        add_to_cell(grain, bucket, ROLLUP_PART, order->part, order, total);
+
+        if (!first_bucket[grain] || bucket < first_bucket[grain]) first_bucket[grain] = bucket;
+        if (bucket > last_bucket[grain]) last_bucket[grain] = bucket;
+    }
+}
+
+// Add one order appended since the last call
+static void read_order(char *line, long offset, void *context) {
+    GarageOrder order;
+    (void)offset;
+    (void)context;
+    if (garage_parse_order(line, &order)) add_order(&order);
+}
+
+static void refresh(void) {
+    int orders = garage_tail_changed(ORDERS_FILE, &orders_tail);
+    if (orders == GARAGE_TAIL_SAME) return;
+
+    if (orders == GARAGE_TAIL_REWRITTEN) {
+        garage_table_clear(&cells);
+        memset(first_bucket, 0, sizeof(first_bucket));
+        memset(last_bucket, 0, sizeof(last_bucket));
+    }
+    garage_tail_read(ORDERS_FILE, &orders_tail, read_order, NULL);
+}
+
+// ==================== QUERIES ====================
+
+int rollup_get(RollupGrain grain, long bucket, RollupDimension dimension, const char *name, RollupPoint *out) {
+    refresh();
+
+    const Cell *cell = find_cell(grain, bucket, dimension, name);
+    if (cell) {
+        *out = cell->point;
+        return out->orders;
+    }
+
+    memset(out, 0, sizeof(*out));
+    out->bucket = bucket;
+    if (dimension != ROLLUP_ANY && name) snprintf(out->name, sizeof(out->name), "%s", name);
+    return 0;
+}
+
+int rollup_series(RollupGrain grain, long from, long to, RollupDimension dimension,
+                  const char *name, RollupPoint out[], int max) {
+    refresh();
+    if (grain == ROLLUP_ALL) return max > 0 ? (rollup_get(grain, 0, dimension, name, &out[0]), 1) : 0;
+
+    if (!from) from = first_bucket[grain];
+    if (!to) to = last_bucket[grain];
+    if (!from || !to) return 0;
+
+    int count = 0;
+    for (long bucket = from; bucket <= to && count < max; bucket = rollup_step(grain, bucket, 1)) {
+        rollup_get(grain, bucket, dimension, name, &out[count++]);
+    }
+    return count;
+}
+
+int rollup_sum(RollupGrain grain, long from, long to, RollupDimension dimension,
+               const char *name, RollupPoint *out) {
+    RollupPoint point;
+
+    memset(out, 0, sizeof(*out));
+    refresh();
+    if (grain == ROLLUP_ALL) return rollup_get(grain, 0, dimension, name, out);
+
+    // Only the range that can hold orders is walked
+    if (!from || from < first_bucket[grain]) from = first_bucket[grain];
+    if (!to || to > last_bucket[grain]) to = last_bucket[grain];
+    if (!from || !to) return 0;
+
+    out->bucket = from;
+    for (long bucket = from; bucket <= to; bucket = rollup_step(grain, bucket, 1)) {
+        if (!rollup_get(grain, bucket, dimension, name, &point)) continue;
+        out->revenue += point.revenue;
+        out->orders += point.orders;
+        out->units += point.units;
+    }
+    if (dimension != ROLLUP_ANY && name) snprintf(out->name, sizeof(out->name), "%s", name);
+    return out->orders;
+}
+
+static int by_revenue(const void *a, const void *b) {
+    const RollupPoint *x = a, *y = b;
+    if (x->revenue != y->revenue) return x->revenue > y->revenue ? -1 : 1;
+    return strcmp(x->name, y->name);
+}
+
+int rollup_breakdown(RollupGrain grain, long bucket, RollupDimension dimension, RollupPoint out[], int max) {
+    refresh();
+
+    const Cell *total = find_cell(grain, bucket, ROLLUP_ANY, NULL);
+    if (!total || dimension == ROLLUP_ANY || max <= 0) return 0;
+
+    // Gather the bucket's cells of that dimension, then keep the best `max`
+    int count = 0, capacity = 0;
+    RollupPoint *all = NULL;
+    char prefix[KEY_MAX];
+    make_key(prefix, grain, bucket, dimension, "");
+    size_t prefix_length = strlen(prefix);
+
+    for (int i = total->first; i >= 0; i = ((const Cell *)garage_table_at(&cells, i))->next) {
+        const Cell *cell = garage_table_at(&cells, i);
+        if (strncmp(cell->key, prefix, prefix_length) != 0) continue;
+
+        if (count == capacity) {
+            capacity = capacity ? capacity * 2 : 16;
+            RollupPoint *grown = realloc(all, (size_t)capacity * sizeof(*all));
+            if (!grown) break;
+            all = grown;
+        }
+        all[count++] = cell->point;
+    }
+
+    if (count > 1) qsort(all, (size_t)count, sizeof(*all), by_revenue);
+    if (count > max) count = max;
+    if (count > 0) memcpy(out, all, (size_t)count * sizeof(*all));
+    free(all);
+    return count;
+}
@@ -0,0 +1,74 @@
+/**
+ * rollup.h - Pre-aggregated order revenue for the Smart Garage system
+ *
+ * Every order in orders.txt is added once to an hour, a day and a month
+ * bucket, and to the all-time totals: revenue, order count and units, for
+ * all orders and broken down by payment method and by part. Reports read
+ * the buckets instead of the orders, so a trend over N buckets costs N
+ * lookups however many orders there are.
+ *
+ * Orders appended since the last call are added on the next call; if
+ * orders already read changed (history deleted), the rollups are
+ * rebuilt. Legacy orders have no date and count in the all-time totals
+ * only.
+ *
+ * Buckets are numbers: YYYYMMDDHH, YYYYMMDD, YYYYMM, and 0 for all time.
+ *
+ * Usage:
+ *   RollupPoint hours[24];
+ *   long first = rollup_bucket(ROLLUP_HOUR, time(NULL)) / 100 * 100;
+ *   int n = rollup_series(ROLLUP_HOUR, first, first + 23, ROLLUP_ANY, NULL, hours, 24);
+ */
+#ifndef ROLLUP_H
+#define ROLLUP_H
+
+#include <time.h>
+
+typedef enum {
+    ROLLUP_HOUR,
+    ROLLUP_DAY,
+    ROLLUP_MONTH,
+    ROLLUP_ALL,
+    ROLLUP_GRAIN_COUNT
+} RollupGrain;
+
+typedef enum {
+    ROLLUP_ANY,                 // Every order
+    ROLLUP_PAYMENT,             // Orders paid by one method ("Cash", "Online")
+    ROLLUP_PART                 // Orders of one part
+} RollupDimension;
+
+typedef struct {
+    long bucket;
+    char name[50];              // Payment method or part, "" for ROLLUP_ANY
+    double revenue;
+    int orders;
+    int units;
+} RollupPoint;
+
+// The bucket holding `when`
+long rollup_bucket(RollupGrain grain, time_t when);
+
+// `bucket` moved by `steps` hours, days or months (negative goes back)
+long rollup_step(RollupGrain grain, long bucket, int steps);
+
+// Totals of one bucket for all orders, a payment method or a part;
+// returns the number of orders (0 leaves `out` zeroed)
+int rollup_get(RollupGrain grain, long bucket, RollupDimension dimension, const char *name, RollupPoint *out);
+
+// One point per bucket from..to (inclusive, at most `max`), empty buckets
+// included; 0 for either end means the first or last bucket with orders.
+// Returns the number of points written.
+int rollup_series(RollupGrain grain, long from, long to, RollupDimension dimension,
+                  const char *name, RollupPoint out[], int max);
+
+// Sum of the buckets from..to, ends as for rollup_series(); returns the
+// number of orders
+int rollup_sum(RollupGrain grain, long from, long to, RollupDimension dimension,
+               const char *name, RollupPoint *out);
+
+// The payment methods or parts (dimension) seen in one bucket, highest
+// revenue first; returns the number written
+int rollup_breakdown(RollupGrain grain, long bucket, RollupDimension dimension, RollupPoint out[], int max);
+
+#endif
@@ -0,0 +1,437 @@
+/**
+ * scheduler.c - Mechanic workload scheduler for the Smart Garage system
+ *
+ * appointments.txt lines are "CUSTOMER PART MECHANIC DATE". An order's
+ * open count is how many times the customer ordered the part minus the
+ * appointments already made for it. An appointment names no car, so it is
+ * finished once any car the customer parked reaches 100% in progress.txt
+ * on or after its date; until then it is one of the mechanic's jobs.
+ * mechanics.txt records no skills, so every mechanic on file can take any
+ * job.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "garage.h"
+#include "scheduler.h"
+
+typedef struct {
+    char key[82];               // "CUSTOMER PART"
+    char customer[30];
+    char part[50];
+    int ordered;
+    int assigned;
+} Job;
+
+typedef struct {
+    char username[30];
+    char name[50];
+    int jobs;
+    long next_due;
+    int heap_position;
+} Mechanic;
+
+// Earliest deadline of a car, or of all a customer's cars
+typedef struct {
+    char key[30];
+    long due;
+} Due;
+
+// Latest day a car, or any of a customer's cars, was finished (100%)
+typedef struct {
+    char key[30];
+    long date;
+} Done;
+
+static GarageTable jobs = GARAGE_TABLE(Job);
+static GarageTable mechanics = GARAGE_TABLE(Mechanic);
+static GarageTable car_dues = GARAGE_TABLE(Due);
+static GarageTable customer_dues = GARAGE_TABLE(Due);
+static GarageTable car_done = GARAGE_TABLE(Done);
+static GarageTable customer_done = GARAGE_TABLE(Done);
+
+static int *heap;               // Mechanic indexes, best first
+static int heap_capacity;
+
+static GarageFileStamp mechanic_stamp, appointment_stamp, deadline_stamp, progress_stamp, parking_stamp;
+static GarageTail orders_tail;
+
+// ==================== PRIORITY QUEUE ====================
+
+static Mechanic *mechanic_at(int index) {
+    return garage_table_at(&mechanics, index);
+}
+
+// Earlier-due sorts first; no deadline sorts last
+static int compare_due(long a, long b) {
+    if (a == b) return 0;
+    if (a == 0) return 1;
+    if (b == 0) return -1;
+    return a < b ? -1 : 1;
+}
+
+/**
+ * 1 when mechanic a should get the next job before b
+ */
+static int comes_first(int a, int b) {
+    const Mechanic *x = mechanic_at(a), *y = mechanic_at(b);
+
+    if (x->jobs != y->jobs) return x->jobs < y->jobs;
+    int due = compare_due(x->next_due, y->next_due);
+    if (due != 0) return due > 0; // The one with the later deadline is freer
+    return strcmp(x->username, y->username) < 0;
+}
+
+static void heap_set(int position, int index) {
+    heap[position] = index;
+    mechanic_at(index)->heap_position = position;
+}
+
+static void sift_down(int position) {
+    int index = heap[position];
+    for (;;) {
+        int child = position * 2 + 1;
+        if (child >= mechanics.count) break;
+        if (child + 1 < mechanics.count && comes_first(heap[child + 1], heap[child])) child++;
+        if (!comes_first(heap[child], index)) break;
+        heap_set(position, heap[child]);
+        position = child;
+    }
+    heap_set(position, index);
+}
+
+static void build_heap(void) {
+    if (mechanics.count > heap_capacity) {
+        int *grown = realloc(heap, (size_t)mechanics.count * sizeof(int));
+        if (!grown) {
+            garage_table_clear(&mechanics); // No queue: behave as if nobody can take jobs
+            return;
+        }
+        heap = grown;
+        heap_capacity = mechanics.count;
+    }
+    for (int i = 0; i < mechanics.count; i++) heap_set(i, i);
+    for (int i = mechanics.count / 2 - 1; i >= 0; i--) sift_down(i);
+}
+
+// ==================== LOADING ====================
+
+static long customer_due(const char *customer) {
+    int index = garage_table_find(&customer_dues, customer);
+    return index >= 0 ? ((Due *)garage_table_at(&customer_dues, index))->due : 0;
+}
+
+// 1 when the customer's appointment made on `date` (YYYYMMDD) is finished
+static int appointment_done(const char *customer, long date) {
+    int index = garage_table_find(&customer_done, customer);
+    return index >= 0 && date != 0 && ((Done *)garage_table_at(&customer_done, index))->date >= date;
+}
+
+static void keep_earliest(GarageTable *table, const char *key, size_t key_size, long due) {
+    int index = garage_table_find(table, key);
+    Due *entry = index >= 0 ? garage_table_at(table, index) : garage_table_add(table, key, key_size);
+    if (entry && compare_due(due, entry->due) < 0) entry->due = due;
+}
+
+static void keep_latest(GarageTable *table, const char *key, size_t key_size, long date) {
+    int index = garage_table_find(table, key);
+    Done *entry = index >= 0 ? garage_table_at(table, index) : garage_table_add(table, key, key_size);
+    if (entry && date > entry->date) entry->date = date;
+}
+
+static int add_parked_car(const GarageParking *parking, void *context) {
+    (void)context;
+    int index = garage_table_find(&car_dues, parking->car_number);
+    if (index >= 0) {
+        keep_earliest(&customer_dues, parking->username, sizeof(parking->username),
+                      ((Due *)garage_table_at(&car_dues, index))->due);
+    }
+    index = garage_table_find(&car_done, parking->car_number);
+    if (index >= 0) {
+        keep_latest(&customer_done, parking->username, sizeof(parking->username),
+                    ((Done *)garage_table_at(&car_done, index))->date);
+    }
+    return 0;
+}
+
+/**
+ * deadlines.txt "CAR YYYY-MM-DD SERVICE" and progress.txt "CAR YYYY-MM-DD
+ * PERCENT% STATUS" lines, then each customer's earliest deadline and
+ * latest finished day over the cars they parked
+ */
+static void load_cars(void) {
+    char line[GARAGE_LINE_MAX], car[20], date[20];
+    int percent;
+    long key;
+    FILE *f;
+
+    garage_table_clear(&car_dues);
+    garage_table_clear(&customer_dues);
+    garage_table_clear(&car_done);
+    garage_table_clear(&customer_done);
+
+    if ((f = fopen(DEADLINES_FILE, "r")) != NULL) {
+        while (fgets(line, sizeof(line), f)) {
+            if (sscanf(line, "%19s %19s", car, date) != 2 || (key = garage_date_key(date)) == 0) continue;
+            keep_earliest(&car_dues, car, sizeof(car), key);
+        }
+        fclose(f);
+    }
+    if ((f = fopen(PROGRESS_FILE, "r")) != NULL) {
+        while (fgets(line, sizeof(line), f)) {
+            if (sscanf(line, "%19s %19s %d", car, date, &percent) != 3 || percent < 100 ||
+                (key = garage_date_key(date)) == 0) {
+                continue;
+            }
+            keep_latest(&car_done, car, sizeof(car), key);
+        }
+        fclose(f);
+    }
+
+    garage_for_each_parking(add_parked_car, NULL);
+}
+
+static Job *find_job(const char *customer, const char *part, int create) {
+    char key[82];
+
+    snprintf(key, sizeof(key), "%s %s", customer, part);
+    int index = garage_table_find(&jobs, key);
+    if (index >= 0) return garage_table_at(&jobs, index);
+    if (!create) return NULL;
+
+    Job *job = garage_table_add(&jobs, key, sizeof(key));
+    if (job) {
+        snprintf(job->customer, sizeof(job->customer), "%s", customer);
+        snprintf(job->part, sizeof(job->part), "%s", part);
+    }
+    return job;
+}
+
+// Count one order appended since the last call
+static void read_order(char *line, long offset, void *context) {
+    GarageOrder order;
+    (void)offset;
+    (void)context;
+    if (!garage_parse_order(line, &order)) return;
+
+    Job *job = find_job(order.username, order.part, 1);
+    if (job) job->ordered++;
+}
+
+static int add_mechanic(const GarageMechanic *record, void *context) {
+    (void)context;
+    if (garage_table_find(&mechanics, record->username) >= 0) return 0;
+
+    Mechanic *mechanic = garage_table_add(&mechanics, record->username, sizeof(record->username));
+    if (!mechanic) return 1;
+    snprintf(mechanic->name, sizeof(mechanic->name), "%s", record->name);
+    return 0;
+}
+
+// An appointment made on `date`: the order is no longer waiting, and the
+// mechanic has one more job until the work is finished
+static void count_assignment(Job *job, Mechanic *mechanic, long date) {
+    long due = customer_due(job->customer);
+
+    job->assigned++;
+    if (appointment_done(job->customer, date)) return;
+    mechanic->jobs++;
+    if (compare_due(due, mechanic->next_due) < 0) mechanic->next_due = due;
+}
+
+/**
+ * Mechanics and their jobs from mechanics.txt and appointments.txt
+ */
+static void load_assignments(void) {
+    char line[GARAGE_LINE_MAX], customer[30], part[50], username[30], date[20];
+    FILE *f;
+
+    garage_table_clear(&mechanics);
+    garage_for_each_mechanic(add_mechanic, NULL);
+    for (int i = 0; i < jobs.count; i++) ((Job *)garage_table_at(&jobs, i))->assigned = 0;
+
+    if ((f = fopen(APPOINTMENTS_FILE, "r")) != NULL) {
+        while (fgets(line, sizeof(line), f)) {
+            date[0] = '\0';
+            if (sscanf(line, "%29s %49s %29s %19s", customer, part, username, date) < 3) continue;
+
+            int index = garage_table_find(&mechanics, username);
+            Job *job = find_job(customer, part, 1);
+            if (index >= 0 && job) count_assignment(job, mechanic_at(index), garage_date_key(date));
+        }
+        fclose(f);
+    }
+    build_heap();
+}
+
+static void refresh(void) {
+    int cars_changed = garage_file_changed(DEADLINES_FILE, &deadline_stamp);
+    cars_changed |= garage_file_changed(PROGRESS_FILE, &progress_stamp);
+    cars_changed |= garage_file_changed(CAR_PARKING_FILE, &parking_stamp);
+    if (cars_changed) load_cars();
+
+    // Deleted orders: count them all again
+    int orders = garage_tail_changed(ORDERS_FILE, &orders_tail);
+    int orders_reset = orders == GARAGE_TAIL_REWRITTEN;
+    if (orders_reset) garage_table_clear(&jobs);
+    if (orders != GARAGE_TAIL_SAME) garage_tail_read(ORDERS_FILE, &orders_tail, read_order, NULL);
+
+    int assignments_changed = garage_file_changed(MECHANICS_FILE, &mechanic_stamp);
+    assignments_changed |= garage_file_changed(APPOINTMENTS_FILE, &appointment_stamp);
+    if (assignments_changed || cars_changed || orders_reset) load_assignments();
+}
+
+// ==================== QUERIES ====================
+
+static void copy_mechanic(SchedulerMechanic *out, const Mechanic *mechanic) {
+    snprintf(out->username, sizeof(out->username), "%s", mechanic->username);
+    snprintf(out->name, sizeof(out->name), "%s", mechanic->name);
+    out->jobs = mechanic->jobs;
+    out->next_due = mechanic->next_due;
+}
+
+static void copy_order(SchedulerOrder *out, const Job *job) {
+    snprintf(out->customer, sizeof(out->customer), "%s", job->customer);
+    snprintf(out->part, sizeof(out->part), "%s", job->part);
+    out->open = job->ordered > job->assigned ? job->ordered - job->assigned : 0;
+    out->due = customer_due(job->customer);
+}
+
+int scheduler_suggest(SchedulerMechanic *mechanic) {
+    refresh();
+    if (mechanics.count == 0) return 0;
+    copy_mechanic(mechanic, mechanic_at(heap[0]));
+    return 1;
+}
+
+int scheduler_find_mechanic(const char *username, SchedulerMechanic *mechanic) {
+    refresh();
+    int index = garage_table_find(&mechanics, username);
+    if (index < 0) return 0;
+    copy_mechanic(mechanic, mechanic_at(index));
+    return 1;
+}
+
+static int compare_urgency(const void *a, const void *b) {
+    const SchedulerOrder *x = a, *y = b;
+    int due = compare_due(x->due, y->due);
+    if (due != 0) return due;
+    return strcmp(x->customer, y->customer);
+}
+
+/**
+ * All waiting orders, most urgent first; the caller frees the array
+ */
+static SchedulerOrder *waiting_orders(int *count) {
+    SchedulerOrder *orders = malloc((size_t)(jobs.count ? jobs.count : 1) * sizeof(SchedulerOrder));
+
+    *count = 0;
+    if (!orders) return NULL;
+
+    for (int i = 0; i < jobs.count; i++) {
+        const Job *job = garage_table_at(&jobs, i);
+        if (job->ordered > job->assigned) copy_order(&orders[(*count)++], job);
+    }
+    qsort(orders, (size_t)*count, sizeof(SchedulerOrder), compare_urgency);
+    return orders;
+}
+
+int scheduler_unassigned(SchedulerOrder out[], int max) {
+    int count;
+
+    refresh();
+    SchedulerOrder *orders = waiting_orders(&count);
+    if (!orders) return 0;
+
+    for (int i = 0; i < count && i < max; i++) out[i] = orders[i];
+    free(orders);
+    return count;
+}
+
+// ==================== ASSIGNING ====================
+
+static void today(char date[20]) {
+    time_t now = time(NULL);
+    struct tm *local = localtime(&now);
+    strftime(date, 20, "%Y-%m-%d", local);
+}
+
+/**
+ * Record one assignment in memory and in the open appointments file
+ */
+static void assign(FILE *appointments, Job *job, int mechanic_index, const char *date) {
+    Mechanic *mechanic = mechanic_at(mechanic_index);
+
+    fprintf(appointments, "%s %s %s %s\n", job->customer, job->part, mechanic->username, date);
+    count_assignment(job, mechanic, garage_date_key(date));
+    sift_down(mechanic->heap_position); // Only ever gets busier
+}
+
+static FILE *open_appointments(void) {
+    return fopen(APPOINTMENTS_FILE, "a");
+}
+
+// The file now matches memory: do not read it back on the next call
+static void close_appointments(FILE *appointments) {
+    fclose(appointments);
+    garage_file_changed(APPOINTMENTS_FILE, &appointment_stamp);
+}
+
+int scheduler_assign(const char *customer, const char *part, const char *mechanic) {
+    char date[20];
+
+    refresh();
+
+    int index = mechanic ? garage_table_find(&mechanics, mechanic) : (mechanics.count ? heap[0] : -1);
+    if (index < 0) return SCHEDULER_UNKNOWN_MECHANIC;
+
+    Job *job = find_job(customer, part, 0);
+    if (!job || job->ordered == 0) return SCHEDULER_NO_ORDER;
+
+    FILE *appointments = open_appointments();
+    if (!appointments) return SCHEDULER_WRITE_FAILED;
+
+    today(date);
+    assign(appointments, job, index, date);
+    close_appointments(appointments);
+    return 1;
+}
+
+int scheduler_assign_all(SchedulerAssignVisitor visit, void *context) {
+    SchedulerMechanic chosen;
+    char date[20];
+    int count, assigned = 0;
+
+    refresh();
+    if (mechanics.count == 0) return SCHEDULER_UNKNOWN_MECHANIC;
+
+    SchedulerOrder *orders = waiting_orders(&count);
+    if (!orders) return 0;
+
+    FILE *appointments = open_appointments();
+    if (!appointments) {
+        free(orders);
+        return SCHEDULER_WRITE_FAILED;
+    }
+
+    today(date);
+    for (int i = 0; i < count; i++) {
+        Job *job = find_job(orders[i].customer, orders[i].part, 0);
+
+        // One appointment per order, each to whoever is freest then
+        for (int n = 0; job && n < orders[i].open; n++) {
+            int index = heap[0];
+            assign(appointments, job, index, date);
+            assigned++;
+
+            if (visit) {
+                copy_mechanic(&chosen, mechanic_at(index));
+                visit(&orders[i], &chosen, context);
+            }
+        }
+    }
+    close_appointments(appointments);
+    free(orders);
+    return assigned;
+}
@@ -0,0 +1,66 @@
+/**
+ * scheduler.h - Mechanic workload scheduler for the Smart Garage system
+ *
+ * Keeps every mechanic's open jobs (their lines in appointments.txt) in
+ * memory, with the mechanics in a priority queue: fewest jobs first, then
+ * the one whose nearest deadline is furthest away. The best mechanic is at
+ * the top, and an assignment re-queues them in O(log m). A job is open
+ * until one of the customer's cars reaches 100% in progress.txt on or
+ * after the appointment date.
+ *
+ * An order is a customer and a part (as in appointments.txt); it is due by
+ * the earliest deadline in deadlines.txt for any car the customer parked
+ * with us. Orders, appointments, mechanics, deadlines, progress and
+ * parking records are read again only when their files change, and new
+ * orders are read from the end of orders.txt.
+ *
+ * Usage:
+ *   SchedulerMechanic best;
+ *   if (scheduler_suggest(&best)) {
+ *       scheduler_assign("Ashis_01", "tyres", best.username);
+ *   }
+ */
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+// scheduler_assign() and scheduler_assign_all() errors
+#define SCHEDULER_UNKNOWN_MECHANIC -1   // No such mechanic, or none at all
+#define SCHEDULER_NO_ORDER -2           // The customer never ordered the part
+#define SCHEDULER_WRITE_FAILED -3       // appointments.txt cannot be written
+
+typedef struct {
+    char customer[30];
+    char part[50];
+    int open;                   // Orders not assigned to a mechanic yet
+    long due;                   // YYYYMMDD, 0 = no deadline
+} SchedulerOrder;
+
+typedef struct {
+    char username[30];
+    char name[50];
+    int jobs;                   // Open assignments: work not finished yet
+    long next_due;              // Nearest deadline among them, 0 = none
+} SchedulerMechanic;
+
+typedef void (*SchedulerAssignVisitor)(const SchedulerOrder *order,
+                                       const SchedulerMechanic *mechanic, void *context);
+
+// Up to `max` orders waiting for a mechanic, most urgent first; returns
+// how many (customer, part) orders are waiting in total
+int scheduler_unassigned(SchedulerOrder out[], int max);
+
+// 1 and the least loaded mechanic, 0 when there are no mechanics
+int scheduler_suggest(SchedulerMechanic *mechanic);
+
+// 1 and the mechanic's workload when `username` is a mechanic
+int scheduler_find_mechanic(const char *username, SchedulerMechanic *mechanic);
+
+// Assign the order to `mechanic` (NULL = least loaded); 1 on success,
+// otherwise one of the errors above
+int scheduler_assign(const char *customer, const char *part, const char *mechanic);
+
+// Assign every waiting order, most urgent first, each to the least loaded
+// mechanic at that point; returns the number assigned or an error
+int scheduler_assign_all(SchedulerAssignVisitor visit, void *context);
+
+#endif
@@ -0,0 +1,235 @@
+/**
+ * screen.c - Buffered screen composition for the Smart Garage console UI
+ *
+ * Two backends share one frame buffer:
+ *   - ANSI: color changes and clears are escape codes stored inline, so a
+ *     frame is flushed with a single write (Linux terminals, and Windows
+ *     10+ consoles once virtual terminal processing is enabled).
+ *   - Native: color changes and clears are recorded as runs next to the
+ *     text and replayed through the platform layer, one attribute change
+ *     per run (legacy Windows consoles, redirected output).
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include "platform.h"
+#include "screen.h"
+
+#define SCREEN_INITIAL_SIZE 16384
+#define SCREEN_NO_COLOR -1
+
+// A color change or screen clear at a given offset of the frame (native backend)
+typedef struct {
+    size_t offset;
+    int color;
+    int clear;
+} ScreenRun;
+
+static char *frame_buffer = NULL;
+static size_t frame_length = 0;
+static size_t frame_capacity = 0;
+static int frame_depth = 0;
+
+static ScreenRun *frame_runs = NULL;
+static int run_count = 0;
+static int run_capacity = 0;
+
+static int use_ansi = 0;
+static int frame_color = SCREEN_NO_COLOR;  // Color in effect at the end of the frame
+
+/**
+ * Make room for extra bytes in the frame buffer
+ */
+static int reserve(size_t extra) {
+    if (frame_length + extra <= frame_capacity) return 1;
+
+    size_t new_capacity = frame_capacity ? frame_capacity : SCREEN_INITIAL_SIZE;
+    while (new_capacity < frame_length + extra) new_capacity *= 2;
+
+    char *grown = realloc(frame_buffer, new_capacity);
+    if (!grown) return 0;
+
+    frame_buffer = grown;
+    frame_capacity = new_capacity;
+    return 1;
+}
+
+/**
+ * Record a color change or clear for the native backend
+ */
+static void add_run(int color, int clear) {
+    // Collapse back-to-back changes with no text in between into one run
+    if (run_count > 0 && frame_runs[run_count - 1].offset == frame_length) {
+        frame_runs[run_count - 1].color = color;
+        frame_runs[run_count - 1].clear |= clear;
+        return;
+    }
+
+    if (run_count == run_capacity) {
+        int new_capacity = run_capacity ? run_capacity * 2 : 64;
+        ScreenRun *grown = realloc(frame_runs, new_capacity * sizeof(ScreenRun));
+        if (!grown) return;
+        frame_runs = grown;
+        run_capacity = new_capacity;
+    }
+
+    frame_runs[run_count].offset = frame_length;
+    frame_runs[run_count].color = color;
+    frame_runs[run_count].clear = clear;
+    run_count++;
+}
+
+/**
+ * Map a Windows console attribute (COLOR_* values) to an ANSI SGR code
+ */
+static int ansi_color_code(int color) {
+    int rgb = ((color & 1) ? 4 : 0) | ((color & 2) ? 2 : 0) | ((color & 4) ? 1 : 0);
+    return ((color & 8) ? 90 : 30) + rgb;
+}
+
+static void append_color_escape(int color) {
+    if (!reserve(16)) return;
+    frame_length += sprintf(frame_buffer + frame_length, "\x1b[0;%dm", ansi_color_code(color));
+}
+
+/**
+ * Initialize the console backend
+ */
+void screen_init() {
+    platform_init();
+    use_ansi = platform_ansi_enabled();
+}
+
+/**
+ * Start composing a frame
+ */
+void screen_begin() {
+    frame_depth++;
+}
+
+/**
+ * Finish a frame; the outermost frame is flushed to the console
+ */
+void screen_end() {
+    if (frame_depth > 0) frame_depth--;
+    if (frame_depth == 0) screen_flush();
+}
+
+/**
+ * Write everything composed so far to the console
+ */
+void screen_flush() {
+    if (frame_length == 0 && run_count == 0) return;
+
+    // Keep ordering with any printf() output that is still buffered
+    fflush(stdout);
+
+    if (run_count == 0) {
+        platform_write(frame_buffer, frame_length);
+    } else {
+        size_t start = 0;
+
+        for (int i = 0; i <= run_count; i++) {
+            size_t end = (i < run_count) ? frame_runs[i].offset : frame_length;
+            platform_write(frame_buffer + start, end - start);
+            start = end;
+
+            if (i < run_count) {
+                if (frame_runs[i].clear) platform_clear_console();
+                if (frame_runs[i].color != SCREEN_NO_COLOR) {
+                    platform_set_text_attribute(frame_runs[i].color);
+                }
+            }
+        }
+    }
+
+    frame_length = 0;
+    run_count = 0;
+}
+
+static void append(const char *text, size_t len) {
+    if (len > 0 && reserve(len)) {
+        memcpy(frame_buffer + frame_length, text, len);
+        frame_length += len;
+    }
+}
+
+/**
+ * Append raw text to the frame
+ */
+void screen_write(const char *text, size_t len) {
+    append(text, len);
+    if (frame_depth == 0) screen_flush();
+}
+
+void screen_puts(const char *text) {
+    screen_write(text, strlen(text));
+}
+
+/**
+ * Append formatted text to the frame
+ */
+void screen_printf(const char *format, ...) {
+    va_list args;
+
+    if (reserve(256)) {
+        size_t available = frame_capacity - frame_length;
+
+        va_start(args, format);
+        int needed = vsnprintf(frame_buffer + frame_length, available, format, args);
+        va_end(args);
+
+        if (needed >= 0 && (size_t)needed >= available && reserve((size_t)needed + 1)) {
+            va_start(args, format);
+            vsnprintf(frame_buffer + frame_length, (size_t)needed + 1, format, args);
+            va_end(args);
+        }
+        if (needed >= 0 && frame_length + (size_t)needed < frame_capacity) {
+            frame_length += (size_t)needed;
+        }
+    }
+    if (frame_depth == 0) screen_flush();
+}
+
+/**
+ * Append a run of the same character (padding, separators)
+ */
+void screen_pad(int count, char ch) {
+    if (count > 0 && reserve((size_t)count)) {
+        memset(frame_buffer + frame_length, ch, (size_t)count);
+        frame_length += (size_t)count;
+    }
+    if (frame_depth == 0) screen_flush();
+}
+
+/**
+ * Change the text color; redundant changes cost nothing
+ */
+void screen_set_color(int color) {
+    if (color == frame_color) return;
+    frame_color = color;
+
+    if (use_ansi) {
+        append_color_escape(color);
+    } else {
+        add_run(color, 0);
+    }
+    if (frame_depth == 0) screen_flush();
+}
+
+/**
+ * Clear the console; anything composed before the clear is dropped
+ */
+void screen_clear() {
+    frame_length = 0;
+    run_count = 0;
+
+    if (use_ansi) {
+        append("\x1b[H\x1b[2J\x1b[3J", 11);
+        if (frame_color != SCREEN_NO_COLOR) append_color_escape(frame_color);
+    } else {
+        add_run(frame_color, 1);
+    }
+    if (frame_depth == 0) screen_flush();
+}
@@ -0,0 +1,40 @@
+/**
+ * screen.h - Buffered screen composition for the Smart Garage console UI
+ *
+ * Output is composed into one frame buffer (text plus color runs) and
+ * written to the console in a single flush instead of one syscall per
+ * color change and one printf per padding space.
+ *
+ * Usage:
+ *   screen_begin();                 // start composing a frame
+ *   screen_set_color(COLOR_CYAN);
+ *   screen_pad(10, ' ');
+ *   screen_printf("%s\n", text);
+ *   screen_end();                   // flush the whole frame at once
+ *
+ * Calls made outside a begin/end pair are flushed immediately, so the
+ * helpers can be mixed with plain printf() output on screens that have
+ * not been converted yet.
+ */
+#ifndef SCREEN_H
+#define SCREEN_H
+
+#include <stddef.h>
+
+// Initialize the console backend (ANSI escape codes or native console calls)
+void screen_init();
+
+// Frame composition (frames may nest; the outermost screen_end() flushes)
+void screen_begin();
+void screen_end();
+void screen_flush();
+
+// Frame content
+void screen_write(const char *text, size_t len);
+void screen_puts(const char *text);
+void screen_printf(const char *format, ...);
+void screen_pad(int count, char ch);
+void screen_set_color(int color);
+void screen_clear();
+
+#endif
@@ -0,0 +1,320 @@
+/**
+ * stock.c - Part stock levels and order reservations for the Smart Garage system
+ *
+ * Journal lines are "KIND part quantity id time":
+ *   IN   part n 0 time       n units added (negative: written off)
+ *   HOLD part n id time      n units held; id is the line's number
+ *   SOLD part n id time      hold id sold
+ *   FREE part n id time      hold id released
+ *   DROP part 0 0 time       part no longer tracked
+ *
+ * Every move is applied by apply_move(), whether it was read from the
+ * file or just written, so all processes derive the same levels.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "garage.h"
+#include "platform.h"
+#include "stock.h"
+
+#define MIN_HOLDS 64
+
+typedef struct {
+    char name[50];
+    int on_hand;
+    int held;
+    int tracked;
+} Part;
+
+// A hold not yet sold or released
+typedef struct {
+    long id;
+    int part;                   // Index into parts
+    int quantity;
+    long taken;                 // time_t when it was taken
+} Hold;
+
+static GarageTable parts = GARAGE_TABLE(Part);
+
+static Hold *holds;
+static int hold_count, hold_capacity;
+
+static long lines_read;         // Journal lines applied; the next HOLD id is this + 1
+static GarageTail journal;      // How far stock.txt is applied
+
+// ==================== PARTS ====================
+
+static Part *part_at(int index) {
+    return garage_table_at(&parts, index);
+}
+
+static int find_part(const char *name, int create) {
+    int index = garage_table_find(&parts, name);
+    if (index >= 0 || !create) return index;
+
+    Part *part = garage_table_add(&parts, name, sizeof(part->name));
+    return part ? parts.count - 1 : -1;
+}
+
+static int find_hold(long id) {
+    for (int i = 0; i < hold_count; i++) {
+        if (holds[i].id == id) return i;
+    }
+    return -1;
+}
+
+static void fill_level(const Part *part, StockLevel *level) {
+    snprintf(level->part, sizeof(level->part), "%s", part->name);
+    level->on_hand = part->on_hand;
+    level->held = part->held;
+    level->available = part->on_hand - part->held;
+}
+
+// ==================== JOURNAL ====================
+
+static void apply_move(const char *line) {
+    char kind[8], name[50];
+    int quantity;
+    long id, when;
+
+    lines_read++;
+    if (sscanf(line, "%7s %49s %d %ld %ld", kind, name, &quantity, &id, &when) != 5) return;
+
+    int index = find_part(name, 1);
+    if (index < 0) return;
+    Part *part = part_at(index);
+
+    if (strcmp(kind, "IN") == 0) {
+        part->on_hand += quantity;
+        part->tracked = 1;
+    } else if (strcmp(kind, "DROP") == 0) {
+        part->on_hand = 0;
+        part->tracked = 0;
+    } else if (strcmp(kind, "HOLD") == 0) {
+        if (hold_count == hold_capacity) {
+            int capacity = hold_capacity ? hold_capacity * 2 : MIN_HOLDS;
+            Hold *grown = realloc(holds, (size_t)capacity * sizeof(Hold));
+            if (!grown) return;
+            holds = grown;
+            hold_capacity = capacity;
+        }
+        Hold *hold = &holds[hold_count++];
+        hold->id = lines_read;
+        hold->part = index;
+        hold->quantity = quantity;
+        hold->taken = when;
+        part->held += quantity;
+    } else if (strcmp(kind, "SOLD") == 0 || strcmp(kind, "FREE") == 0) {
+        int open = find_hold(id);
+        if (open < 0) return;   // Already sold or released
+
+        part = part_at(holds[open].part);
+        part->held -= holds[open].quantity;
+        if (kind[0] == 'S' && part->tracked) part->on_hand -= holds[open].quantity;
+        holds[open] = holds[--hold_count];
+    }
+}
+
+static void read_move(char *line, long offset, void *context) {
+    (void)offset;
+    (void)context;
+    apply_move(line);
+}
+
+/**
+ * Apply the lines appended since the last call; if the lines already
+ * applied changed (rewritten by hand), start over from the top
+ */
+static void catch_up(FILE *f) {
+    if (garage_tail_rewritten(f, &journal)) {
+        garage_table_clear(&parts);
+        hold_count = 0;
+        lines_read = 0;
+        garage_tail_reset(&journal);
+    }
+    garage_tail_read_file(f, &journal, read_move, NULL);
+}
+
+/**
+ * stock.txt opened, locked and caught up; NULL when it cannot be
+ */
+static FILE *open_journal(void) {
+    FILE *f = fopen(STOCK_FILE, "a+b");
+    if (!f) return NULL;
+
+    if (!platform_lock_file(f)) {
+        fclose(f);
+        return NULL;
+    }
+    catch_up(f);
+    return f;
+}
+
+static void close_journal(FILE *f) {
+    fflush(f);                  // Written before another process can lock
+    platform_unlock_file(f);
+    fclose(f);
+}
+
+/**
+ * Append one move and apply it; returns its line number (the id of a HOLD)
+ */
+static long write_move(FILE *f, const char *kind, const char *part, int quantity, long id) {
+    char line[128];
+
+    snprintf(line, sizeof(line), "%s %s %d %ld %ld\n", kind, part, quantity, id, (long)time(NULL));
+    fseek(f, 0, SEEK_END);
+    fputs(line, f);
+    fflush(f);
+    garage_tail_read_file(f, &journal, read_move, NULL); // Just this line: the file is locked
+    return lines_read;
+}
+
+/**
+ * Release the holds older than STOCK_HOLD_SECONDS (checkouts abandoned or
+ * crashed)
+ */
+static void release_expired(FILE *f) {
+    long now = (long)time(NULL);
+
+    for (int i = hold_count - 1; i >= 0; i--) {
+        if (now - holds[i].taken >= STOCK_HOLD_SECONDS) {
+            // Removes holds[i]; the hold moved into its place was already checked
+            write_move(f, "FREE", part_at(holds[i].part)->name, holds[i].quantity, holds[i].id);
+        }
+    }
+}
+
+// ==================== LEVELS ====================
+
+int stock_get(const char *part, StockLevel *level) {
+    FILE *f = open_journal();
+    if (!f) return 0;
+
+    int index = find_part(part, 0);
+    int tracked = index >= 0 && part_at(index)->tracked;
+    if (tracked) fill_level(part_at(index), level);
+
+    close_journal(f);
+    return tracked;
+}
+
+int stock_get_many(const char *const names[], int count, StockLevel levels[], int tracked[]) {
+    int found = 0;
+
+    for (int i = 0; i < count; i++) tracked[i] = 0;
+
+    FILE *f = open_journal();
+    if (!f) return 0;
+
+    for (int i = 0; i < count; i++) {
+        int index = find_part(names[i], 0);
+        if (index < 0 || !part_at(index)->tracked) continue;
+
+        fill_level(part_at(index), &levels[i]);
+        tracked[i] = 1;
+        found++;
+    }
+    close_journal(f);
+    return found;
+}
+
+int stock_add(const char *part, int quantity) {
+    FILE *f = open_journal();
+    if (!f) return 0;
+
+    write_move(f, "IN", part, quantity, 0);
+    close_journal(f);
+    return 1;
+}
+
+int stock_drop(const char *part) {
+    FILE *f = open_journal();
+    if (!f) return 0;
+
+    int index = find_part(part, 0);
+    if (index >= 0 && part_at(index)->tracked) write_move(f, "DROP", part, 0, 0);
+    close_journal(f);
+    return 1;
+}
+
+int stock_for_each(StockList list, StockVisitor visit, void *context) {
+    FILE *f = open_journal();
+    int count = 0;
+
+    if (!f) return 0;
+
+    for (int i = 0; i < parts.count; i++) {
+        StockLevel level;
+        if (!part_at(i)->tracked) continue;
+
+        fill_level(part_at(i), &level);
+        if (list == STOCK_LIST_LOW && (level.available <= 0 || level.available > STOCK_LOW_LEVEL)) continue;
+        if (list == STOCK_LIST_OUT && level.available > 0) continue;
+
+        count++;
+        if (visit && visit(&level, context)) break;
+    }
+    close_journal(f);
+    return count;
+}
+
+// ==================== RESERVATIONS ====================
+
+StockResult stock_reserve(const char *part, int quantity, StockHold *hold) {
+    snprintf(hold->part, sizeof(hold->part), "%s", part);
+    hold->id = 0;
+    hold->quantity = quantity;
+
+    FILE *f = open_journal();
+    if (!f) return STOCK_ERROR;
+
+    int index = find_part(part, 0);
+    if (index < 0 || !part_at(index)->tracked) {
+        close_journal(f);
+        return STOCK_UNTRACKED;
+    }
+
+    int available = part_at(index)->on_hand - part_at(index)->held;
+    if (available < quantity && hold_count > 0) {
+        release_expired(f);
+        available = part_at(index)->on_hand - part_at(index)->held;
+    }
+    if (available < quantity) {
+        hold->quantity = available > 0 ? available : 0;
+        close_journal(f);
+        return STOCK_SHORT;
+    }
+
+    hold->id = write_move(f, "HOLD", part, quantity, 0);
+    close_journal(f);
+    return STOCK_OK;
+}
+
+/**
+ * Sell or release one hold; a hold of an untracked part has nothing to do
+ */
+static StockResult finish_hold(const StockHold *hold, const char *kind) {
+    if (hold->id == 0) return STOCK_OK;
+
+    FILE *f = open_journal();
+    if (!f) return STOCK_ERROR;
+
+    StockResult result = STOCK_EXPIRED;
+    if (find_hold(hold->id) >= 0) {
+        write_move(f, kind, hold->part, hold->quantity, hold->id);
+        result = STOCK_OK;
+    }
+    close_journal(f);
+    return result;
+}
+
+StockResult stock_commit(const StockHold *hold) {
+    return finish_hold(hold, "SOLD");
+}
+
+StockResult stock_release(const StockHold *hold) {
+    return finish_hold(hold, "FREE");
+}
@@ -0,0 +1,89 @@
+/**
+ * stock.h - Part stock levels and order reservations for the Smart Garage system
+ *
+ * stock.txt is an append-only journal of stock moves: restocks, holds
+ * taken while a customer checks out, and the sale or release of each
+ * hold. The levels it adds up to are kept in memory, and every call first
+ * reads whatever other processes appended since the last one, so a check
+ * costs a file lock and a few new lines, not a scan of the history.
+ *
+ * Each call holds an exclusive lock on stock.txt from reading the new
+ * moves to writing its own, so two checkouts - in two programs or two
+ * threads - can never both take the last unit.
+ *
+ * Parts that were never stocked are untracked: they can always be
+ * ordered, and reservations of them succeed without a hold.
+ *
+ * Usage:
+ *   StockHold hold;
+ *   if (stock_reserve("Battery", 2, &hold) == STOCK_SHORT) {
+ *       printf("only %d left\n", hold.quantity);
+ *   } else if (stock_commit(&hold) == STOCK_OK) {
+ *       // save the order
+ *   }
+ */
+#ifndef STOCK_H
+#define STOCK_H
+
+#define STOCK_LOW_LEVEL 5                // At or below this many units is low stock
+#define STOCK_HOLD_SECONDS (15 * 60)     // Holds not sold by then are released
+
+typedef enum {
+    STOCK_OK,
+    STOCK_SHORT,                // Fewer units available than asked for
+    STOCK_UNTRACKED,            // Never stocked; not limited
+    STOCK_EXPIRED,              // The hold was released before the sale
+    STOCK_ERROR                 // stock.txt cannot be opened or locked
+} StockResult;
+
+typedef struct {
+    char part[50];
+    int on_hand;                // In the store, held units included
+    int held;                   // Held by checkouts not finished yet
+    int available;              // on_hand - held
+} StockLevel;
+
+typedef struct {
+    long id;                    // 0 for an untracked part (nothing held)
+    char part[50];
+    int quantity;
+} StockHold;
+
+typedef enum {
+    STOCK_LIST_ALL,
+    STOCK_LIST_LOW,             // 1..STOCK_LOW_LEVEL units available
+    STOCK_LIST_OUT              // None available
+} StockList;
+
+// Visitors return 0 to continue and non-zero to stop
+typedef int (*StockVisitor)(const StockLevel *level, void *context);
+
+// 1 and the level when the part is tracked, 0 when it is not or on error
+int stock_get(const char *part, StockLevel *level);
+
+// stock_get() for `count` parts under one lock (one catch-up for a whole
+// list): tracked[i] is 1 and levels[i] filled for each tracked part.
+// Returns how many are tracked, 0 on error.
+int stock_get_many(const char *const names[], int count, StockLevel levels[], int tracked[]);
+
+// Add units (a negative quantity writes them off); starts tracking the
+// part. Returns 1 on success, 0 when stock.txt cannot be written.
+int stock_add(const char *part, int quantity);
+
+// Stop tracking a deleted part; returns 1 on success
+int stock_drop(const char *part);
+
+// Hold `quantity` units for a checkout. On STOCK_SHORT, hold->quantity is
+// the number available instead.
+StockResult stock_reserve(const char *part, int quantity, StockHold *hold);
+
+// Sell the held units or give them back. STOCK_EXPIRED: the hold outlived
+// STOCK_HOLD_SECONDS and another checkout has released it meanwhile.
+StockResult stock_commit(const StockHold *hold);
+StockResult stock_release(const StockHold *hold);
+
+// Tracked parts in the list, in the order they were first stocked;
+// returns how many
+int stock_for_each(StockList list, StockVisitor visit, void *context);
+
+#endif
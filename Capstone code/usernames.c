@@ -0,0 +1,286 @@
+/**
+ * usernames.c - Username existence check for the Smart Garage system
+ *
+ * usernames.bloom is a BloomHeader followed by the filter bits. The
+ * header says how much of user_data.txt the bits cover and fingerprints
+ * the last bytes of that part, so a rewritten users file is noticed
+ * without reading it all. Names added since the last save only touch a
+ * few bytes of the filter, and only those bytes are written back.
+ *
+ * The filter holds about BLOOM_BITS_PER_NAME bits per username (about
+ * 1% false "maybe" answers with BLOOM_PROBES probes); it doubles and is
+ * rebuilt from the users file when it fills up.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "garage.h"
+#include "platform.h"
+#include "usernames.h"
+
+#define BLOOM_MAGIC 0x4d4f4c42u         // "BLOM"
+#define BLOOM_MIN_BITS (1L << 16)
+#define BLOOM_BITS_PER_NAME 10
+#define BLOOM_PROBES 7
+#define MIN_TOUCHED 64
+#define USERNAME_SIZE 30
+
+typedef struct {
+    unsigned int magic;
+    unsigned int probes;
+    long bits;                  // Power of two
+    long names;                 // Usernames added
+    long covered;               // Bytes of user_data.txt added
+    unsigned long fingerprint;  // Hash of the last bytes of that part
+} BloomHeader;
+
+static BloomHeader header;      // As last read from or written to disk
+static unsigned char *bloom;
+static int bloom_loaded;
+static long *touched;           // Bytes of the filter changed since the last save
+static int touched_count, touched_capacity;
+static int rewrite_all;         // Too much changed: save the whole filter
+
+typedef struct {
+    char username[USERNAME_SIZE];
+} Name;
+
+static GarageTable names = GARAGE_TABLE(Name);
+static GarageTail set_tail;     // How far the exact set has read user_data.txt
+
+// ==================== BLOOM FILTER ====================
+
+// Second hash for the probe sequence (djb2), odd so every bit is reachable
+static unsigned long step_hash(const char *text) {
+    unsigned long hash = 5381;
+    while (*text) hash = hash * 33 + (unsigned char)*text++;
+    return hash | 1;
+}
+
+static void bloom_add(const char *username) {
+    unsigned long first = garage_hash(username), step = step_hash(username);
+    unsigned long mask = (unsigned long)header.bits - 1;
+
+    for (int i = 0; i < BLOOM_PROBES; i++) {
+        unsigned long bit = (first + (unsigned long)i * step) & mask;
+        unsigned char flag = (unsigned char)(1u << (bit % 8));
+        if (bloom[bit / 8] & flag) continue;
+
+        bloom[bit / 8] |= flag;
+        if (rewrite_all) continue;
+        if (touched_count == touched_capacity) {
+            int capacity = touched_capacity ? touched_capacity * 2 : MIN_TOUCHED;
+            long *grown = realloc(touched, (size_t)capacity * sizeof(long));
+            if (!grown || capacity > header.bits / 64) {
+                if (grown) touched = grown;
+                rewrite_all = 1; // Cheaper to write it all
+                continue;
+            }
+            touched = grown;
+            touched_capacity = capacity;
+        }
+        touched[touched_count++] = (long)(bit / 8);
+    }
+    header.names++;
+}
+
+static void read_bloom_name(char *line, long offset, void *context) {
+    GarageUser user;
+    (void)offset;
+    (void)context;
+    if (garage_parse_user(line, &user)) bloom_add(user.username);
+}
+
+static int bloom_maybe(const char *username) {
+    unsigned long first = garage_hash(username), step = step_hash(username);
+    unsigned long mask = (unsigned long)header.bits - 1;
+
+    for (int i = 0; i < BLOOM_PROBES; i++) {
+        unsigned long bit = (first + (unsigned long)i * step) & mask;
+        if (!(bloom[bit / 8] & (1u << (bit % 8)))) return 0;
+    }
+    return 1;
+}
+
+// An empty filter of `bits` bits, to be filled from the top of the users file
+static int bloom_reset(long bits) {
+    unsigned char *cleared = calloc((size_t)(bits / 8), 1);
+    if (!cleared) return 0;
+
+    free(bloom);
+    bloom = cleared;
+    header.magic = BLOOM_MAGIC;
+    header.probes = BLOOM_PROBES;
+    header.bits = bits;
+    header.names = header.covered = 0;
+    header.fingerprint = 0;
+    rewrite_all = 1;
+    touched_count = 0;
+    return 1;
+}
+
+/**
+ * Read the filter from disk when another program saved a different one
+ * (or this one has none yet); 0 when there is no usable file
+ */
+static int bloom_load(FILE *file) {
+    BloomHeader stored;
+
+    rewind(file);
+    if (fread(&stored, sizeof(stored), 1, file) != 1 || stored.magic != BLOOM_MAGIC ||
+        stored.probes != BLOOM_PROBES || stored.bits < BLOOM_MIN_BITS || (stored.bits & (stored.bits - 1))) {
+        return 0;
+    }
+    if (bloom_loaded && memcmp(&stored, &header, sizeof(stored)) == 0) return 1;
+
+    unsigned char *bits = malloc((size_t)(stored.bits / 8));
+    if (!bits) return 0;
+    if (fread(bits, 1, (size_t)(stored.bits / 8), file) != (size_t)(stored.bits / 8)) {
+        free(bits);
+        return 0;
+    }
+
+    free(bloom);
+    bloom = bits;
+    header = stored;
+    rewrite_all = 0;
+    touched_count = 0;
+    return 1;
+}
+
+static void bloom_save(FILE *file) {
+    if (rewrite_all) {
+        rewind(file);
+        fwrite(&header, sizeof(header), 1, file);
+        fwrite(bloom, 1, (size_t)(header.bits / 8), file);
+    } else if (touched_count > 0) {
+        for (int i = 0; i < touched_count; i++) {
+            fseek(file, (long)sizeof(header) + touched[i], SEEK_SET);
+            fputc(bloom[touched[i]], file);
+        }
+        // Header last: a crash before it leaves extra bits, never missing ones
+        rewind(file);
+        fwrite(&header, sizeof(header), 1, file);
+    } else {
+        return;
+    }
+    fflush(file);
+    rewrite_all = 0;
+    touched_count = 0;
+}
+
+/**
+ * usernames.bloom opened and locked; NULL when it cannot be. The lock is
+ * also what makes a registration's check and append one step.
+ */
+static FILE *lock_filter(void) {
+    FILE *file = fopen(USERNAME_BLOOM_FILE, "r+b");
+    if (!file) file = fopen(USERNAME_BLOOM_FILE, "w+b");
+    if (!file) return NULL;
+
+    if (!platform_lock_file(file)) {
+        fclose(file);
+        return NULL;
+    }
+    return file;
+}
+
+static void unlock_filter(FILE *file) {
+    platform_unlock_file(file);
+    fclose(file);
+}
+
+/**
+ * Bring the locked filter up to date with user_data.txt and save it; 0
+ * when it cannot be (the caller falls back to the exact set)
+ */
+static int bloom_refresh(FILE *file, FILE *users) {
+    int ready = bloom_load(file) || bloom_reset(BLOOM_MIN_BITS);
+    if (ready) {
+        bloom_loaded = 1;
+        GarageTail coverage = {{0, 0, 0}, header.covered, header.fingerprint};
+        if (garage_tail_rewritten(users, &coverage)) {
+            ready = bloom_reset(header.bits);
+            garage_tail_reset(&coverage);
+        }
+
+        if (ready) {
+            garage_tail_read_file(users, &coverage, read_bloom_name, NULL);
+
+            // Full: double it and add every name again
+            if (header.names * BLOOM_BITS_PER_NAME > header.bits) {
+                long bits = header.bits;
+                while (header.names * BLOOM_BITS_PER_NAME > bits) bits *= 2;
+                if (bloom_reset(bits)) {
+                    garage_tail_reset(&coverage);
+                    garage_tail_read_file(users, &coverage, read_bloom_name, NULL);
+                }
+            }
+            header.covered = coverage.read;
+            header.fingerprint = coverage.fingerprint;
+            bloom_save(file);
+        }
+    }
+    return ready;
+}
+
+// ==================== EXACT SET ====================
+
+static int find_name(const char *username) {
+    return garage_table_find(&names, username);
+}
+
+static void set_add(const char *username) {
+    if (find_name(username) < 0) garage_table_add(&names, username, USERNAME_SIZE);
+}
+
+static void read_set_name(char *line, long offset, void *context) {
+    GarageUser user;
+    (void)offset;
+    (void)context;
+    if (garage_parse_user(line, &user)) set_add(user.username);
+}
+
+static void set_refresh(FILE *users) {
+    if (garage_tail_rewritten(users, &set_tail)) {
+        garage_table_clear(&names);
+        garage_tail_reset(&set_tail);
+    }
+    garage_tail_read_file(users, &set_tail, read_set_name, NULL);
+}
+
+// ==================== QUERY ====================
+
+// Whether `users` has the username; `filter` is the locked filter file,
+// NULL to go straight to the exact set
+static int lookup(const char *username, FILE *users, FILE *filter) {
+    if (filter && bloom_refresh(filter, users) && !bloom_maybe(username)) return 0;
+
+    set_refresh(users);
+    return find_name(username) >= 0;
+}
+
+int usernames_taken(const char *username) {
+    FILE *users = fopen(USERS_FILE, "rb");
+    if (!users) return 0;       // No users yet
+
+    FILE *filter = lock_filter();
+    int taken = lookup(username, users, filter);
+    if (filter) unlock_filter(filter);
+    fclose(users);
+    return taken;
+}
+
+int usernames_register(const GarageUser *user) {
+    FILE *filter = lock_filter();
+    if (!filter) return -1;
+
+    FILE *users = fopen(USERS_FILE, "rb");
+    int taken = users && lookup(user->username, users, filter);
+    if (users) fclose(users);
+
+    // Still locked: nobody can add the same name between the check and this
+    int result = taken ? 0 : (garage_add_user(user) ? 1 : -1);
+    unlock_filter(filter);
+    return result;
+}
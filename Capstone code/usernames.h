@@ -0,0 +1,36 @@
+/**
+ * usernames.h - Username existence check for the Smart Garage system
+ *
+ * A Bloom filter over every username in user_data.txt is kept on disk
+ * (usernames.bloom), so a program starting up reads a few bits per
+ * registered user instead of the whole users file. Most new usernames
+ * are cleared by the filter alone: a few probes and no file scan. When
+ * the filter says "maybe", an in-memory hash set of the usernames gives
+ * the exact answer; it is built on first use and then kept up to date.
+ *
+ * Both catch up with lines appended to user_data.txt since they last
+ * looked, and start over if the file was rewritten. The filter file is
+ * locked while it is brought up to date, and usernames_register() checks
+ * the name and appends the user under that same lock, so two programs
+ * registering one username at once cannot both get it.
+ *
+ * Usage:
+ *   if (usernames_taken("Ashis_01")) {
+ *       // ask for another username
+ *   } else if (usernames_register(&user) == 0) {
+ *       // taken meanwhile by another program
+ *   }
+ */
+#ifndef USERNAMES_H
+#define USERNAMES_H
+
+#include "garage.h"
+
+// 1 when user_data.txt already has a user with this username
+int usernames_taken(const char *username);
+
+// Add the user unless the username is taken, in one step under the filter
+// lock: 1 added, 0 taken, -1 when the files cannot be locked or written
+int usernames_register(const GarageUser *user);
+
+#endif
@@ -0,0 +1,390 @@
+/**
+ * vehicles.c - Per-vehicle record index for the Smart Garage system
+ *
+ * Every indexed line is an entry (kind, byte offset, date) chained to its
+ * car; assignments are chained to their customer and their mechanic
+ * instead. Lookups gather one chain, sort it and read just those lines.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "garage.h"
+#include "vehicles.h"
+
+#define MIN_SLOTS 64
+#define MAX_OWNERS 4            // Customers remembered per car
+#define MAX_WORDS 8
+
+typedef struct {
+    VehicleRecordKind kind;
+    long offset;                // Start of the line in its file
+    long date;
+    int next;                   // Next entry of the car or customer, -1 = end
+    int next_by_mechanic;       // Assignments only
+} Entry;
+
+typedef struct {
+    char car_number[20];
+    int first, last;
+    char owners[MAX_OWNERS][30];
+    int owner_count;
+} Car;
+
+typedef struct {
+    char username[30];
+    int first, last;            // Assignments
+    char latest_car[20];        // Car parked most recently (or in a profile)
+    long latest_date;
+} Customer;
+
+typedef struct {
+    char username[30];
+    int first, last;
+} Mechanic;
+
+typedef struct {
+    const char *path;
+    VehicleRecordKind kind;
+    int key_field;              // Word holding the car (customer for assignments)
+    int date_field;             // -1 = undated
+    GarageTail tail;
+} Source;
+
+static Source sources[VEHICLE_KIND_COUNT] = {
+    {CAR_PROFILES_FILE, VEHICLE_PROFILE, 0, -1, {{0, 0, 0}, 0, 0}},
+    {VEHICLE_HISTORY_FILE, VEHICLE_SERVICE, 0, 1, {{0, 0, 0}, 0, 0}},
+    {PROGRESS_FILE, VEHICLE_PROGRESS, 0, 1, {{0, 0, 0}, 0, 0}},
+    {DEADLINES_FILE, VEHICLE_DEADLINE, 0, 1, {{0, 0, 0}, 0, 0}},
+    {MAINTENANCE_REMINDERS_FILE, VEHICLE_REMINDER, 0, 1, {{0, 0, 0}, 0, 0}},
+    {CAR_PARKING_FILE, VEHICLE_PARKING, 1, 2, {{0, 0, 0}, 0, 0}},
+    {APPOINTMENTS_FILE, VEHICLE_ASSIGNMENT, 0, 3, {{0, 0, 0}, 0, 0}},
+};
+
+static Entry *entries;
+static int entry_count, entry_capacity;
+
+static GarageTable cars = GARAGE_TABLE(Car);
+static GarageTable customers = GARAGE_TABLE(Customer);
+static GarageTable mechanics = GARAGE_TABLE(Mechanic);
+
+// ==================== TABLES ====================
+
+static Car *find_car(const char *car_number) {
+    int index = garage_table_find(&cars, car_number);
+    if (index >= 0) return garage_table_at(&cars, index);
+
+    Car *car = garage_table_add(&cars, car_number, sizeof(car->car_number));
+    if (car) car->first = car->last = -1;
+    return car;
+}
+
+static Customer *find_customer(const char *username) {
+    int index = garage_table_find(&customers, username);
+    if (index >= 0) return garage_table_at(&customers, index);
+
+    Customer *customer = garage_table_add(&customers, username, sizeof(customer->username));
+    if (customer) customer->first = customer->last = -1;
+    return customer;
+}
+
+static Mechanic *find_mechanic(const char *username) {
+    int index = garage_table_find(&mechanics, username);
+    if (index >= 0) return garage_table_at(&mechanics, index);
+
+    Mechanic *mechanic = garage_table_add(&mechanics, username, sizeof(mechanic->username));
+    if (mechanic) mechanic->first = mechanic->last = -1;
+    return mechanic;
+}
+
+// ==================== INDEXING ====================
+
+/**
+ * Split a line into whitespace-separated words (in place); the last word
+ * keeps the rest of the line
+ */
+static int split_words(char *line, char *words[], int max) {
+    int count = 0;
+    char *p = line;
+
+    line[strcspn(line, "\r\n")] = '\0';
+    while (count < max) {
+        while (*p == ' ' || *p == '\t') p++;
+        if (!*p) break;
+
+        words[count++] = p;
+        if (count == max) break;
+        while (*p && *p != ' ' && *p != '\t') p++;
+        if (*p) *p++ = '\0';
+    }
+    return count;
+}
+
+static int add_entry(VehicleRecordKind kind, long offset, long date) {
+    if (entry_count == entry_capacity) {
+        int capacity = entry_capacity ? entry_capacity * 2 : MIN_SLOTS;
+        Entry *grown = realloc(entries, (size_t)capacity * sizeof(Entry));
+        if (!grown) return -1;
+        entries = grown;
+        entry_capacity = capacity;
+    }
+
+    Entry *entry = &entries[entry_count];
+    entry->kind = kind;
+    entry->offset = offset;
+    entry->date = date;
+    entry->next = -1;
+    entry->next_by_mechanic = -1;
+    return entry_count++;
+}
+
+// Append entry `index` to a chain held as first/last
+static void chain_append(int *first, int *last, int index, int by_mechanic) {
+    if (*last < 0) {
+        *first = index;
+    } else if (by_mechanic) {
+        entries[*last].next_by_mechanic = index;
+    } else {
+        entries[*last].next = index;
+    }
+    *last = index;
+}
+
+static void link_owner(const char *car_number, const char *username, long date) {
+    Car *car = find_car(car_number);
+    Customer *customer = find_customer(username);
+    if (!car || !customer) return;
+
+    int known = 0;
+    for (int i = 0; i < car->owner_count && !known; i++) {
+        known = strcmp(car->owners[i], username) == 0;
+    }
+    if (!known && car->owner_count < MAX_OWNERS) {
+        snprintf(car->owners[car->owner_count++], sizeof(car->owners[0]), "%s", username);
+    }
+
+    if (!customer->latest_car[0] || date >= customer->latest_date) {
+        snprintf(customer->latest_car, sizeof(customer->latest_car), "%s", car_number);
+        customer->latest_date = date;
+    }
+}
+
+static void index_line(const Source *source, char *line, long offset) {
+    char *words[MAX_WORDS];
+    int count = split_words(line, words, MAX_WORDS);
+    int needed = source->kind == VEHICLE_ASSIGNMENT ? 3 : source->date_field + 1;
+
+    if (count <= source->key_field || count < needed || words[0][0] == '#') return;
+
+    const char *key = words[source->key_field];
+    long date = source->date_field >= 0 && count > source->date_field
+                    ? garage_date_key(words[source->date_field]) : 0;
+    int index = add_entry(source->kind, offset, date);
+    if (index < 0) return;
+
+    if (source->kind == VEHICLE_ASSIGNMENT) {
+        Customer *customer = find_customer(key);
+        Mechanic *mechanic = find_mechanic(words[2]);
+        if (customer) chain_append(&customer->first, &customer->last, index, 0);
+        if (mechanic) chain_append(&mechanic->first, &mechanic->last, index, 1);
+        return;
+    }
+
+    Car *car = find_car(key);
+    if (!car) return;
+    chain_append(&car->first, &car->last, index, 0);
+
+    // Profiles name the owner and parking records the customer
+    if (source->kind == VEHICLE_PROFILE && count > 1) link_owner(key, words[1], 0);
+    if (source->kind == VEHICLE_PARKING) link_owner(key, words[0], date);
+}
+
+static void read_line(char *line, long offset, void *context) {
+    index_line(context, line, offset);
+}
+
+static void refresh(void) {
+    int changed[VEHICLE_KIND_COUNT];
+    int rebuild = 0;
+
+    // Appends are read from where the last call stopped; any other change
+    // (a record deleted or edited) means starting over
+    for (int i = 0; i < VEHICLE_KIND_COUNT; i++) {
+        changed[i] = garage_tail_changed(sources[i].path, &sources[i].tail);
+        if (changed[i] == GARAGE_TAIL_REWRITTEN) rebuild = 1;
+    }
+
+    if (rebuild) {
+        entry_count = 0;
+        garage_table_clear(&cars);
+        garage_table_clear(&customers);
+        garage_table_clear(&mechanics);
+        for (int i = 0; i < VEHICLE_KIND_COUNT; i++) garage_tail_reset(&sources[i].tail);
+    }
+
+    for (int i = 0; i < VEHICLE_KIND_COUNT; i++) {
+        if (rebuild || changed[i] != GARAGE_TAIL_SAME) {
+            garage_tail_read(sources[i].path, &sources[i].tail, read_line, &sources[i]);
+        }
+    }
+}
+
+// ==================== LOOKUPS ====================
+
+const char *vehicle_kind_name(VehicleRecordKind kind) {
+    static const char *names[VEHICLE_KIND_COUNT] = {
+        "Profile", "Service", "Progress", "Deadline", "Reminder", "Parking", "Assignment"
+    };
+    return kind >= 0 && kind < VEHICLE_KIND_COUNT ? names[kind] : "?";
+}
+
+// Profile first, then by date; ties keep the order the lines were written
+static int compare_entries(const void *a, const void *b) {
+    const Entry *x = *(const Entry * const *)a;
+    const Entry *y = *(const Entry * const *)b;
+    int x_profile = x->kind == VEHICLE_PROFILE, y_profile = y->kind == VEHICLE_PROFILE;
+
+    if (x_profile != y_profile) return y_profile - x_profile;
+    if (x->date != y->date) return x->date < y->date ? -1 : 1;
+    return x < y ? -1 : x > y;
+}
+
+// Words of `line` from `from` on, joined by single spaces
+static void join_words(char *out, size_t size, char *words[], int count, int from) {
+    size_t length = 0;
+
+    out[0] = '\0';
+    for (int i = from; i < count && length + 1 < size; i++) {
+        int written = snprintf(out + length, size - length, "%s%s", length ? " " : "", words[i]);
+        if (written < 0) break;
+        length += (size_t)written;
+    }
+}
+
+/**
+ * Read an entry's line back and fill `record`; 0 when the line is gone
+ */
+static int load_record(FILE *files[], const Entry *entry, VehicleRecord *record) {
+    char line[GARAGE_LINE_MAX];
+    char *words[MAX_WORDS];
+    const Source *source = &sources[entry->kind];
+
+    if (!files[entry->kind]) files[entry->kind] = fopen(source->path, "rb");
+    FILE *f = files[entry->kind];
+    if (!f || fseek(f, entry->offset, SEEK_SET) != 0 || !fgets(line, sizeof(line), f)) return 0;
+
+    int count = split_words(line, words, MAX_WORDS);
+    if (count <= source->key_field) return 0;
+
+    record->kind = entry->kind;
+    record->date = entry->date;
+
+    switch (entry->kind) {
+        case VEHICLE_PARKING: {
+            // username car date time manufacturer...: "time manufacturer (username)"
+            snprintf(record->car_number, sizeof(record->car_number), "%s", words[1]);
+            char rest[150];
+            join_words(rest, sizeof(rest), words, count, 3);
+            snprintf(record->detail, sizeof(record->detail), "%s (%.30s)", rest, words[0]);
+            break;
+        }
+        case VEHICLE_ASSIGNMENT: {
+            // customer part mechanic date: "part by mechanic for customer",
+            // on the car the customer parked last
+            int c = garage_table_find(&customers, words[0]);
+            const char *car = c >= 0 ? ((Customer *)garage_table_at(&customers, c))->latest_car : "";
+            snprintf(record->car_number, sizeof(record->car_number), "%s", car[0] ? car : "-");
+            snprintf(record->detail, sizeof(record->detail), "%s by %s for %s",
+                     count > 1 ? words[1] : "-", count > 2 ? words[2] : "-", words[0]);
+            break;
+        }
+        default:
+            snprintf(record->car_number, sizeof(record->car_number), "%s", words[0]);
+            join_words(record->detail, sizeof(record->detail), words, count,
+                       source->date_field >= 0 ? source->date_field + 1 : 1);
+            break;
+    }
+    return 1;
+}
+
+/**
+ * Sort the gathered entries and show them, as records of `car_number`
+ * when given; frees `list`
+ */
+static int visit_entries(const Entry **list, int count, const char *car_number,
+                         VehicleRecordVisitor visit, void *context) {
+    FILE *files[VEHICLE_KIND_COUNT] = {NULL};
+    VehicleRecord record;
+    int shown = 0;
+
+    qsort(list, (size_t)count, sizeof(list[0]), compare_entries);
+    for (int i = 0; i < count; i++) {
+        if (!load_record(files, list[i], &record)) continue;
+        if (car_number) snprintf(record.car_number, sizeof(record.car_number), "%s", car_number);
+        shown++;
+        if (visit && visit(&record, context)) break;
+    }
+
+    for (int i = 0; i < VEHICLE_KIND_COUNT; i++) {
+        if (files[i]) fclose(files[i]);
+    }
+    free(list);
+    return shown;
+}
+
+int vehicle_records(const char *car_number, unsigned kinds, VehicleRecordVisitor visit, void *context) {
+    refresh();
+
+    int index = garage_table_find(&cars, car_number);
+    if (index < 0) return 0;
+    const Car *car = garage_table_at(&cars, index);
+
+    // The car's own chain plus its customers' assignments
+    int count = 0;
+    for (int e = car->first; e >= 0; e = entries[e].next) count++;
+    if (kinds & VEHICLE_KIND(VEHICLE_ASSIGNMENT)) {
+        for (int i = 0; i < car->owner_count; i++) {
+            int c = garage_table_find(&customers, car->owners[i]);
+            if (c < 0) continue;
+            for (int e = ((Customer *)garage_table_at(&customers, c))->first; e >= 0; e = entries[e].next) count++;
+        }
+    }
+    if (count == 0) return 0;
+
+    const Entry **list = malloc((size_t)count * sizeof(*list));
+    if (!list) return 0;
+
+    count = 0;
+    for (int e = car->first; e >= 0; e = entries[e].next) {
+        if (kinds & VEHICLE_KIND(entries[e].kind)) list[count++] = &entries[e];
+    }
+    if (kinds & VEHICLE_KIND(VEHICLE_ASSIGNMENT)) {
+        for (int i = 0; i < car->owner_count; i++) {
+            int c = garage_table_find(&customers, car->owners[i]);
+            if (c < 0) continue;
+            for (int e = ((Customer *)garage_table_at(&customers, c))->first; e >= 0; e = entries[e].next) {
+                list[count++] = &entries[e];
+            }
+        }
+    }
+    return visit_entries(list, count, car->car_number, visit, context);
+}
+
+int vehicle_mechanic_jobs(const char *mechanic_name, VehicleRecordVisitor visit, void *context) {
+    refresh();
+
+    int index = garage_table_find(&mechanics, mechanic_name);
+    if (index < 0) return 0;
+    const Mechanic *mechanic = garage_table_at(&mechanics, index);
+
+    int count = 0;
+    for (int e = mechanic->first; e >= 0; e = entries[e].next_by_mechanic) count++;
+    if (count == 0) return 0;
+
+    const Entry **list = malloc((size_t)count * sizeof(*list));
+    if (!list) return 0;
+
+    count = 0;
+    for (int e = mechanic->first; e >= 0; e = entries[e].next_by_mechanic) list[count++] = &entries[e];
+
+    return visit_entries(list, count, NULL, visit, context);
+}
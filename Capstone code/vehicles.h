@@ -0,0 +1,59 @@
+/**
+ * vehicles.h - Per-vehicle record index for the Smart Garage system
+ *
+ * One index keyed by car number points at every line about that car in
+ * car_profiles.txt, vehicle_history.txt, progress.txt, deadlines.txt,
+ * maintenance_reminders.txt and car_parking.txt, by byte offset. Mechanic
+ * assignments (appointments.txt) name a customer rather than a car; they
+ * join to the cars that customer parked or owns. A car's timeline costs
+ * one hash lookup plus one read per record.
+ *
+ * New lines appended to any of the files are indexed on the next call;
+ * if a file was rewritten (a record deleted or edited), it is rebuilt.
+ *
+ * Usage:
+ *   static int show(const VehicleRecord *record, void *context) {
+ *       printf("%ld %s %s\n", record->date, vehicle_kind_name(record->kind), record->detail);
+ *       return 0;
+ *   }
+ *   vehicle_records("242-35-407", VEHICLE_ALL, show, NULL);
+ */
+#ifndef VEHICLES_H
+#define VEHICLES_H
+
+typedef enum {
+    VEHICLE_PROFILE,
+    VEHICLE_SERVICE,            // vehicle_history.txt
+    VEHICLE_PROGRESS,
+    VEHICLE_DEADLINE,
+    VEHICLE_REMINDER,
+    VEHICLE_PARKING,
+    VEHICLE_ASSIGNMENT,
+    VEHICLE_KIND_COUNT
+} VehicleRecordKind;
+
+// Masks for vehicle_records(): VEHICLE_KIND(VEHICLE_PROGRESS) | ...
+#define VEHICLE_KIND(kind) (1u << (kind))
+#define VEHICLE_ALL ((1u << VEHICLE_KIND_COUNT) - 1)
+
+typedef struct {
+    VehicleRecordKind kind;
+    long date;                  // YYYYMMDD, 0 for profiles
+    char car_number[20];        // "-" for a job whose customer has no car on file
+    char detail[200];           // The rest of the record, ready to show
+} VehicleRecord;
+
+typedef int (*VehicleRecordVisitor)(const VehicleRecord *record, void *context);
+
+// "Profile", "Service", "Progress", ...
+const char *vehicle_kind_name(VehicleRecordKind kind);
+
+// Records about one car whose kind is in `kinds`, profile first and then
+// by date; returns how many
+int vehicle_records(const char *car_number, unsigned kinds, VehicleRecordVisitor visit, void *context);
+
+// Assignments of one mechanic, oldest first, each with the customer's
+// most recently parked car; returns how many
+int vehicle_mechanic_jobs(const char *mechanic, VehicleRecordVisitor visit, void *context);
+
+#endif